@@ -0,0 +1,236 @@
+/*
+ * AACheck.cpp
+ *
+ * Created: 21/10/2026 17:04:26
+ *
+ * Host build only. Checks the drawing of anti-aliased fonts, using the 2 and 4 bits per pixel fonts in Fonts/. Random strings are
+ * printed at random positions with random right margins, and for each one it checks that:
+ *  - the text position moves on by the width that measure() gives;
+ *  - printing with a background writes every pixel of the text, and nothing outside it;
+ *  - printing on a transparent background writes the foreground colour where the level is more than half, and nothing else;
+ *  - the levels 0 and maximum come out exactly in the background and foreground colours, and the levels in between have each
+ *    colour channel between the two.
+ * The levels of the pixels are found by printing the string in white on black first.
+ *
+ * Usage: aacheck [-i]
+ *   -i	draw the screens upside down, as after pressing the Invert Y button
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "Configuration.hpp"
+#include "Library/Vector.hpp"
+#include "PanelDue.hpp"
+#include "Fields.hpp"
+#include "HostLcd.hpp"
+#include "HostFirmware.hpp"
+
+extern const uint8_t dejavu16_2bpp[], dejavu16_4bpp[];
+
+static const struct { const char *name; const uint8_t *font; unsigned int maxLevel; } fonts[] =
+{
+	{ "dejavu16_2bpp", dejavu16_2bpp, 3 },
+	{ "dejavu16_4bpp", dejavu16_4bpp, 15 }
+};
+
+const Colour markerColour = 0xF81F;			// what the area around the text is filled with, to show whether anything was drawn there
+
+static DisplayOrientation orientation = DefaultDisplayOrientAdjust;
+
+// The area around the text that is filled and read back, in display coordinates
+static unsigned int areaX1, areaY1, areaX2, areaY2;
+
+static void FillArea(Colour c)
+{
+	lcd.setColor(c);
+	lcd.fillRect(areaX1, areaY1, areaX2, areaY2);
+}
+
+static std::vector<uint16_t> GrabArea()
+{
+	std::vector<uint16_t> pixels;
+	for (unsigned int y = areaY1; y <= areaY2; ++y)
+	{
+		for (unsigned int x = areaX1; x <= areaX2; ++x)
+		{
+			pixels.push_back(HostLcd::GetPixel(x, y, orientation));
+		}
+	}
+	return pixels;
+}
+
+static unsigned int Red(Colour c) { return c >> 11; }
+static unsigned int Green(Colour c) { return (c >> 5) & 0x3F; }
+static unsigned int Blue(Colour c) { return c & 0x1F; }
+
+static bool Between(unsigned int v, unsigned int a, unsigned int b)
+{
+	return (a <= b) ? (v >= a && v <= b) : (v >= b && v <= a);
+}
+
+int main(int argc, char **argv)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "-i") == 0)
+		{
+			orientation = static_cast<DisplayOrientation>(orientation ^ (ReverseX | ReverseY | InvertText | InvertBitmap));
+		}
+		else
+		{
+			fprintf(stderr, "Usage: aacheck [-i]\n");
+			return 1;
+		}
+	}
+
+	HostLcd::Init(16, 17, 18, DISPLAY_X, DISPLAY_Y);
+	HostFirmware::Start(orientation);
+
+	srand(11);
+	unsigned int numChecks = 0, numFailures = 0;
+	for (size_t f = 0; f < sizeof(fonts)/sizeof(fonts[0]); ++f)
+	{
+		const unsigned int maxLevel = fonts[f].maxLevel;
+		if (!lcd.setFont(fonts[f].font))
+		{
+			++numFailures;
+			printf("%s: setFont failed\n", fonts[f].name);
+			continue;
+		}
+
+		// The grey for each level in white on black, blended the way UTFT::getBlendTable is documented to
+		Colour greys[16];
+		for (unsigned int level = 0; level <= maxLevel; ++level)
+		{
+			const unsigned int r = (31 * level + maxLevel/2)/maxLevel, g = (63 * level + maxLevel/2)/maxLevel;
+			greys[level] = (Colour)((r << 11) | (g << 5) | r);
+		}
+
+		for (unsigned int trial = 0; trial < 300; ++trial)
+		{
+			char s[31];
+			const unsigned int len = 1 + rand() % (sizeof(s) - 1);
+			for (unsigned int i = 0; i < len; ++i)
+			{
+				s[i] = (char)(0x20 + rand() % (0x7F - 0x20));
+			}
+			s[len] = 0;
+
+			const bool defaultMargin = (rand() % 8 == 0);
+			const uint16_t x = (defaultMargin) ? 0 : rand() % (DisplayX - 1);
+			const uint16_t y = rand() % (DisplayY - lcd.getFontHeight());
+			const uint16_t margin = (defaultMargin) ? 9999 : 1 + rand() % (DisplayX - x);
+			const uint16_t rightMargin = (defaultMargin) ? 9999 : x + margin;
+			const unsigned int width = lcd.measure(s, margin);
+			if (width == 0)
+			{
+				continue;
+			}
+
+			areaX1 = (x >= 2) ? x - 2 : 0;
+			areaY1 = (y >= 2) ? y - 2 : 0;
+			areaX2 = (x + width + 2 <= DisplayX) ? x + width + 1 : DisplayX - 1;
+			areaY2 = (y + lcd.getFontHeight() + 2 <= DisplayY) ? y + lcd.getFontHeight() + 1 : DisplayY - 1;
+			const unsigned int areaWidth = areaX2 - areaX1 + 1;
+
+			// Find the level of each pixel, and check the width and that the whole of the text and nothing else was written
+			FillArea(markerColour);
+			lcd.setTransparentBackground(false);
+			lcd.setColor(0xFFFF);
+			lcd.setBackColor(0x0000);
+			lcd.print(s, x, y, rightMargin);
+			++numChecks;
+			if ((unsigned int)(lcd.getTextX() - x) != width)
+			{
+				++numFailures;
+				printf("%s, string %u \"%s\" at x=%u with margin %u: measured %u, printed %u\n", fonts[f].name, trial, s, x, margin, width, lcd.getTextX() - x);
+				continue;
+			}
+
+			const std::vector<uint16_t> levelPixels = GrabArea();
+			std::vector<uint8_t> levels(levelPixels.size(), 0xFF);
+			bool ok = true;
+			for (size_t i = 0; i < levelPixels.size() && ok; ++i)
+			{
+				const unsigned int px = areaX1 + i % areaWidth, py = areaY1 + i / areaWidth;
+				const bool inText = px >= x && px < x + width && py >= y && py < y + lcd.getFontHeight();
+				if (!inText)
+				{
+					ok = (levelPixels[i] == markerColour);
+				}
+				else
+				{
+					for (unsigned int level = 0; level <= maxLevel; ++level)
+					{
+						if (levelPixels[i] == greys[level])
+						{
+							levels[i] = level;
+						}
+					}
+					ok = (levels[i] != 0xFF);
+				}
+				if (!ok)
+				{
+					printf("%s, string %u \"%s\" at x=%u: pixel (%u,%u) is %04x after printing white on black\n", fonts[f].name, trial, s, x, px, py, levelPixels[i]);
+				}
+			}
+			++numChecks;
+			if (!ok)
+			{
+				++numFailures;
+				continue;
+			}
+
+			// On a transparent background, the pixels more than half covered must be in the foreground colour and the rest unchanged
+			const Colour fg = (Colour)rand(), bg = (Colour)rand();
+			FillArea(bg);
+			lcd.setTransparentBackground(true);
+			lcd.setColor(fg);
+			lcd.print(s, x, y, rightMargin);
+			lcd.setTransparentBackground(false);
+			const std::vector<uint16_t> transparentPixels = GrabArea();
+			++numChecks;
+			for (size_t i = 0; i < transparentPixels.size(); ++i)
+			{
+				const Colour expected = (levels[i] != 0xFF && levels[i] * 2 > maxLevel) ? fg : bg;
+				if (transparentPixels[i] != expected)
+				{
+					++numFailures;
+					printf("%s, string %u \"%s\" at x=%u: pixel (%u,%u) at level %u is %04x on a transparent background, should be %04x\n", fonts[f].name, trial, s, x,
+							areaX1 + (unsigned int)(i % areaWidth), areaY1 + (unsigned int)(i / areaWidth), levels[i], transparentPixels[i], expected);
+					break;
+				}
+			}
+
+			// With a background, the end levels must be exactly the two colours and the ones in between must be between them
+			FillArea(markerColour);
+			lcd.setColor(fg);
+			lcd.setBackColor(bg);
+			lcd.print(s, x, y, rightMargin);
+			const std::vector<uint16_t> blendPixels = GrabArea();
+			++numChecks;
+			for (size_t i = 0; i < blendPixels.size(); ++i)
+			{
+				const Colour c = blendPixels[i];
+				const bool good = (levels[i] == 0xFF) ? c == markerColour
+									: (levels[i] == 0) ? c == bg
+									: (levels[i] == maxLevel) ? c == fg
+									: Between(Red(c), Red(fg), Red(bg)) && Between(Green(c), Green(fg), Green(bg)) && Between(Blue(c), Blue(fg), Blue(bg));
+				if (!good)
+				{
+					++numFailures;
+					printf("%s, string %u \"%s\" at x=%u: pixel (%u,%u) at level %u is %04x in %04x on %04x\n", fonts[f].name, trial, s, x,
+							areaX1 + (unsigned int)(i % areaWidth), areaY1 + (unsigned int)(i / areaWidth), levels[i], c, fg, bg);
+					break;
+				}
+			}
+		}
+	}
+
+	printf("aacheck: %u checks, %u failed\n", numChecks, numFailures);
+	return (numFailures == 0) ? 0 : 1;
+}
+
+// End
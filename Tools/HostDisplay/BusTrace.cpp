@@ -0,0 +1,105 @@
+/*
+ * BusTrace.cpp
+ *
+ * Created: 21/10/2026 19:42:08
+ *
+ * Host build only. Shows each tab and opens each popup, and for each step prints how many WR pulses there were and a hash of CS, RS and
+ * the data bus at each one. It is built twice, once driving the pins through the ASF functions and once writing the PIO registers as the
+ * firmware does, and make check compares the output of the two, so that the register path is checked as well as the ASF one.
+ *
+ * Usage: bustrace [-i]
+ *   -i	draw the screens upside down, as after pressing the Invert Y button
+ */
+
+#include <cstdio>
+#include <cstring>
+#include "Configuration.hpp"
+#include "Library/Vector.hpp"
+#include "PanelDue.hpp"
+#include "Fields.hpp"
+#include "MessageLog.hpp"
+#include "HostLcd.hpp"
+#include "HostFirmware.hpp"
+
+static void Report(const char *name)
+{
+	const HostLcd::Counts& c = HostLcd::GetCounts();
+	printf("%s: %lu strobes, %lu commands, %lu data words, hash %016llx\n", name, c.strobes, c.commands, c.dataWords, (unsigned long long)c.hash);
+	HostLcd::ClearCounts();
+}
+
+struct PopupScreen
+{
+	const char *name;
+	SingleButton **tab;
+	PopupWindow **popup;
+	PixelNumber x, y;
+};
+
+int main(int argc, char **argv)
+{
+	DisplayOrientation orientation = DefaultDisplayOrientAdjust;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "-i") == 0)
+		{
+			orientation = static_cast<DisplayOrientation>(orientation ^ (ReverseX | ReverseY | InvertText | InvertBitmap));
+		}
+		else
+		{
+			fprintf(stderr, "Usage: bustrace [-i]\n");
+			return 1;
+		}
+	}
+
+	HostLcd::Init(16, 17, 18, DISPLAY_X, DISPLAY_Y);
+	HostFirmware::Start(orientation);
+	Report("start");
+
+	static const char * const messages[] = { "Connected", "M104 S200", "Heater 1 reached target temperature", "Done printing file" };
+	for (const char *msg : messages)
+	{
+		HostFirmware::AdvanceTime(1500);
+		MessageLog::BeginNewMessage();
+		MessageLog::AppendMessage(msg);
+		MessageLog::DisplayNewMessage();
+	}
+	MessageLog::UpdateMessages(true);
+
+	const struct { const char *name; SingleButton **tab; } tabs[] =
+	{
+		{ "control", &tabControl }, { "print", &tabPrint }, { "console", &tabMsg }, { "setup", &tabSetup }
+	};
+	for (const auto& t : tabs)
+	{
+		HostFirmware::ChangeTab(*t.tab);
+		Report(t.name);
+	}
+
+	const PopupScreen popups[] =
+	{
+		{ "popup-temperature", &tabControl, &setTempPopup, tempPopupX, popupY },
+		{ "popup-move", &tabControl, &movePopup, movePopupX, movePopupY },
+		{ "popup-areyousure", &tabControl, &areYouSurePopup, (DisplayX - areYouSurePopupWidth)/2, (DisplayY - areYouSurePopupHeight)/2 },
+		{ "popup-filelist", &tabPrint, &fileListPopup, fileListPopupX, fileListPopupY },
+		{ "popup-keyboard", &tabMsg, &keyboardPopup, keyboardPopupX, keyboardPopupY },
+		{ "popup-baud", &tabSetup, &baudPopup, fullWidthPopupX, popupY },
+		{ "popup-volume", &tabSetup, &volumePopup, fullWidthPopupX, popupY },
+		{ "popup-language", &tabSetup, &languagePopup, fullWidthPopupX, popupY },
+	};
+	for (const PopupScreen& p : popups)
+	{
+		HostFirmware::ChangeTab(*p.tab);
+		HostLcd::ClearCounts();
+		mgr.SetPopup(*p.popup, p.x, p.y);
+		mgr.Refresh(false);
+		Report(p.name);
+		mgr.ClearPopup();
+		mgr.Refresh(false);
+		Report("  closed");
+	}
+
+	return 0;
+}
+
+// End
@@ -0,0 +1,220 @@
+/*
+ * ClipCheck.cpp
+ *
+ * Created: 20/10/2026 09:12:40
+ *
+ * Host build only. Checks that UTFT clip rectangles are pixel-exact. Each tab, and a set of random primitives, is drawn once without
+ * clipping and then again under random and nested clip rectangles on a screen filled with a marker colour. Inside the clip rectangle
+ * the result must match the unclipped drawing, and outside it the marker must be untouched.
+ *
+ * Usage: clipcheck [-i]
+ *   -i	draw the screens upside down, as after pressing the Invert Y button
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "Configuration.hpp"
+#include "Library/Vector.hpp"
+#include "PanelDue.hpp"
+#include "Fields.hpp"
+#include "Icons/Icons_21h.hpp"
+#include "HostLcd.hpp"
+#include "HostFirmware.hpp"
+
+static DisplayOrientation orientation = DefaultDisplayOrientAdjust;
+static const Colour marker = 0x1863;			// a colour that nothing on the screens uses
+static unsigned int numChecks = 0, numFailures = 0;
+
+static std::vector<uint16_t> GrabScreen()
+{
+	std::vector<uint16_t> pixels;
+	pixels.reserve(DisplayX * DisplayY);
+	for (unsigned int y = 0; y < DisplayY; ++y)
+	{
+		for (unsigned int x = 0; x < DisplayX; ++x)
+		{
+			pixels.push_back(HostLcd::GetPixel(x, y, orientation));
+		}
+	}
+	return pixels;
+}
+
+// Compare a clipped drawing with the unclipped one, and report the first pixel that is wrong
+static void Check(const std::vector<uint16_t>& unclipped, const ClipRect& clip, const char *what)
+{
+	const std::vector<uint16_t> clipped = GrabScreen();
+	++numChecks;
+	for (unsigned int y = 0; y < DisplayY; ++y)
+	{
+		for (unsigned int x = 0; x < DisplayX; ++x)
+		{
+			const bool inside = x >= clip.x1 && x <= clip.x2 && y >= clip.y1 && y <= clip.y2;
+			const uint16_t wanted = (inside) ? unclipped[y * DisplayX + x] : marker;
+			if (clipped[y * DisplayX + x] != wanted)
+			{
+				++numFailures;
+				printf("%s clipped to %d,%d-%d,%d: pixel %u,%u is %04x, should be %04x\n",
+						what, clip.x1, clip.y1, clip.x2, clip.y2, x, y, clipped[y * DisplayX + x], wanted);
+				return;
+			}
+		}
+	}
+}
+
+// A random clip rectangle, which may extend past the display or be only a few pixels across
+static ClipRect RandomClip()
+{
+	const int xa = rand() % (DisplayX + 40) - 20, xb = rand() % (DisplayX + 40) - 20;
+	const int ya = rand() % (DisplayY + 40) - 20, yb = rand() % (DisplayY + 40) - 20;
+	ClipRect r;
+	if (rand() % 10 == 0)
+	{
+		r.x1 = std::max(xa, 0);
+		r.x2 = r.x1 + rand() % 3;
+		r.y1 = std::max(ya, 0);
+		r.y2 = r.y1 + rand() % 3;
+	}
+	else
+	{
+		r.x1 = std::max(std::min(xa, xb), 0);
+		r.x2 = std::max(xa, xb);
+		r.y1 = std::max(std::min(ya, yb), 0);
+		r.y2 = std::max(ya, yb);
+	}
+	return r;
+}
+
+static void DrawTab(unsigned int /*seed*/)
+{
+	mgr.ClearAll();
+	mgr.Refresh(true);
+}
+
+// Draw a repeatable set of random primitives, all on the display
+static void DrawPrimitives(unsigned int seed)
+{
+	srand(seed);
+	for (unsigned int i = 0; i < 12; ++i)
+	{
+		lcd.setColor(rand() & 0xFFFF);
+		lcd.setBackColor(rand() & 0xFFFF);
+		const int xa = rand() % DisplayX, ya = rand() % DisplayY, xb = rand() % DisplayX, yb = rand() % DisplayY;
+		const int x1 = std::min(xa, xb), y1 = std::min(ya, yb), x2 = std::max(xa, xb), y2 = std::max(ya, yb);
+		const int radius = 1 + rand() % 40;
+		const int cx = std::max(radius, std::min(xa, (int)DisplayX - 1 - radius)), cy = std::max(radius, std::min(ya, (int)DisplayY - 1 - radius));
+		switch (rand() % 9)
+		{
+		case 0:
+			lcd.drawLine(xa, ya, xb, yb);
+			break;
+		case 1:
+			lcd.fillRect(x1, y1, x2, y2, (rand() & 1) ? 0 : rand() & 0xFFFF);
+			break;
+		case 2:
+			lcd.drawRoundRect(x1, y1, x2, y2);
+			break;
+		case 3:
+			lcd.fillRoundRect(x1, y1, x2, y2, rand() & 0xFFFF, 6);
+			break;
+		case 4:
+			lcd.drawCircle(cx, cy, radius);
+			break;
+		case 5:
+			lcd.fillCircle(cx, cy, radius);
+			break;
+		case 6:
+			{
+				const int x = std::min(xa, (int)DisplayX - 160), y = std::min(ya, (int)DisplayY - 30);
+				lcd.setFont(DEFAULT_FONT);
+				lcd.setTransparentBackground(rand() & 1);
+				lcd.print("Clip 123 Wg", x, y, x + 150);
+				lcd.setTransparentBackground(false);
+			}
+			break;
+		case 7:
+			lcd.drawPixel(xa, ya);
+			break;
+		case 8:
+			{
+				const Icon icon = (rand() & 1) ? IconNozzle1_21h : IconBed_21h;
+				lcd.drawCompressedBitmap(std::min(xa, (int)DisplayX - 40), std::min(ya, (int)DisplayY - 40),
+										 DisplayField::GetIconWidth(icon), DisplayField::GetIconHeight(icon), DisplayField::GetIconData(icon));
+			}
+			break;
+		}
+	}
+}
+
+// Draw something without clipping, then under 6 random clip rectangles, half of them nested inside another one
+static void CheckDrawing(void (*draw)(unsigned int), unsigned int seed, const char *what)
+{
+	lcd.fillScr(marker);
+	draw(seed);
+	const std::vector<uint16_t> unclipped = GrabScreen();
+	for (unsigned int i = 0; i < 6; ++i)
+	{
+		const ClipRect outer = RandomClip(), inner = RandomClip();
+		const bool nested = (rand() & 1) != 0;
+		lcd.fillScr(marker);
+		lcd.pushClip(outer.x1, outer.y1, outer.x2, outer.y2);
+		if (nested)
+		{
+			lcd.pushClip(inner.x1, inner.y1, inner.x2, inner.y2);
+		}
+		const ClipRect clip = lcd.getClip();
+		draw(seed);
+		if (nested)
+		{
+			lcd.popClip();
+		}
+		lcd.popClip();
+		if (lcd.isClipping())
+		{
+			++numFailures;
+			printf("%s: clip stack not empty after popping everything\n", what);
+		}
+		Check(unclipped, clip, what);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "-i") == 0)
+		{
+			orientation = static_cast<DisplayOrientation>(orientation ^ (ReverseX | ReverseY | InvertText | InvertBitmap));
+		}
+		else
+		{
+			fprintf(stderr, "Usage: clipcheck [-i]\n");
+			return 1;
+		}
+	}
+
+	HostLcd::Init(16, 17, 18, DISPLAY_X, DISPLAY_Y);
+	HostFirmware::Start(orientation);
+
+	srand(7);
+	SingleButton ** const tabs[] = { &tabControl, &tabPrint, &tabMsg, &tabSetup };
+	for (SingleButton **tab : tabs)
+	{
+		HostFirmware::ChangeTab(*tab);
+		for (unsigned int i = 0; i < 20; ++i)
+		{
+			CheckDrawing(DrawTab, 0, "tab");
+		}
+	}
+	for (unsigned int seed = 0; seed < 300; ++seed)
+	{
+		CheckDrawing(DrawPrimitives, seed, "primitives");
+	}
+
+	printf("clipcheck: %u checks, %u failed\n", numChecks, numFailures);
+	return (numFailures == 0) ? 0 : 1;
+}
+
+// End
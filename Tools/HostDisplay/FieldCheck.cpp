@@ -0,0 +1,137 @@
+/*
+ * FieldCheck.cpp
+ *
+ * Created: 20/10/2026 09:48:05
+ *
+ * Host build only. Checks that numeric fields which redraw only the characters that changed end up the same as a full redraw.
+ * It gives the temperature, position and setup fields random values, some much longer or shorter than the last, and random colours.
+ * After each change it compares the screen after a normal refresh with the screen after a full redraw. It also checks that a full redraw
+ * after marking the fields changed draws the same again, which would fail if a field kept the width of text it no longer shows.
+ *
+ * Usage: fieldcheck [-i] [-n steps]
+ *   -i	draw the screens upside down, as after pressing the Invert Y button
+ *   -n	number of changes on each tab, default 500
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "Configuration.hpp"
+#include "Library/Vector.hpp"
+#include "PanelDue.hpp"
+#include "Fields.hpp"
+#include "HostLcd.hpp"
+#include "HostFirmware.hpp"
+
+static DisplayOrientation orientation = DefaultDisplayOrientAdjust;
+
+static std::vector<uint16_t> GrabScreen()
+{
+	std::vector<uint16_t> pixels;
+	pixels.reserve(DisplayX * DisplayY);
+	for (unsigned int y = 0; y < DisplayY; ++y)
+	{
+		for (unsigned int x = 0; x < DisplayX; ++x)
+		{
+			pixels.push_back(HostLcd::GetPixel(x, y, orientation));
+		}
+	}
+	return pixels;
+}
+
+// Change one field. Most values are temperatures, but some are large or negative so that the number of characters changes.
+static void ChangeField()
+{
+	const float val = (rand() % 4 == 0) ? (rand() % 300000)/100.0 - 500.0 : (rand() % 3000)/10.0;
+	switch (rand() % 8)
+	{
+	case 0:
+	case 1:
+		currentTemps[rand() % 2]->SetValue(val);
+		break;
+	case 2:
+		xPos->SetValue(val);
+		break;
+	case 3:
+		yPos->SetValue(val);
+		break;
+	case 4:
+		zPos->SetValue(val);
+		break;
+	case 5:
+		freeMem->SetValue((int)(val * 10));
+		break;
+	case 6:
+		touchX->SetValue((int)val);
+		touchY->SetValue(rand() % 1000);
+		break;
+	case 7:
+		currentTemps[rand() % 2]->SetColours(infoTextColour, (rand() & 1) ? red : white);
+		break;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	unsigned int numSteps = 500;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "-i") == 0)
+		{
+			orientation = static_cast<DisplayOrientation>(orientation ^ (ReverseX | ReverseY | InvertText | InvertBitmap));
+		}
+		else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+		{
+			numSteps = strtoul(argv[++i], nullptr, 10);
+		}
+		else
+		{
+			fprintf(stderr, "Usage: fieldcheck [-i] [-n steps]\n");
+			return 1;
+		}
+	}
+
+	HostLcd::Init(16, 17, 18, DISPLAY_X, DISPLAY_Y);
+	HostFirmware::Start(orientation);
+
+	srand(1);
+	unsigned int numChecks = 0, numFailures = 0;
+	const struct { const char *name; SingleButton **tab; } tabs[] = { { "Control", &tabControl }, { "Print", &tabPrint }, { "Setup", &tabSetup } };
+	for (const auto& t : tabs)
+	{
+		HostFirmware::ChangeTab(*t.tab);
+		for (unsigned int step = 0; step < numSteps; ++step)
+		{
+			ChangeField();
+			mgr.Refresh(false);
+			const std::vector<uint16_t> refreshed = GrabScreen();
+			mgr.Refresh(true);
+			const std::vector<uint16_t> redrawn = GrabScreen();
+
+			DisplayField * const fields[] = { currentTemps[0], currentTemps[1], xPos, yPos, zPos, freeMem, touchX, touchY };
+			for (DisplayField *f : fields)
+			{
+				f->SetChanged();
+			}
+			mgr.Refresh(true);
+
+			numChecks += 2;
+			if (refreshed != redrawn)
+			{
+				++numFailures;
+				printf("%s tab, step %u: refreshing the changed characters differs from a full redraw\n", t.name, step);
+			}
+			if (GrabScreen() != redrawn)
+			{
+				++numFailures;
+				printf("%s tab, step %u: a full redraw of the changed fields differs from a full redraw\n", t.name, step);
+			}
+		}
+	}
+
+	printf("fieldcheck: %u checks, %u failed\n", numChecks, numFailures);
+	return (numFailures == 0) ? 0 : 1;
+}
+
+// End
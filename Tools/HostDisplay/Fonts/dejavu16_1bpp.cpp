@@ -0,0 +1,375 @@
+/*
+ * dejavu16_1bpp.cpp
+ *
+ * Generated by Tools/MakeFont.py from DejaVuSans.ttf - do not edit
+ * Command: MakeFont.py --ttf DejaVuSans.ttf --ranges 0x20-0x7E --height 16 --bpp 1 dejavu16_1bpp.cpp
+ * TrueType font: DejaVu Sans, Version 2.37, SHA-256 abdc775b21b1bc470d50c97e790d276f2054b7504e56e5bd3e64f48d68582322
+ */
+
+#include <asf.h>
+
+extern const uint8_t dejavu16_1bpp[] =
+{
+	0x00,	// compact font format
+	16,		// row height in pixels
+	1,		// space columns between characters before kerning
+	0x20,	// first character code
+	0x7E,	// last character code
+	12,		// maximum character width in pixels
+	0x01,	// flags
+	0x00,	// reserved
+
+	// Glyph offsets
+	0x00, 0x00, 0x03, 0x00, 0x08, 0x00, 0x13, 0x00, 0x28, 0x00, 0x37, 0x00, 0x52, 0x00, 0x67, 0x00,
+	0x6C, 0x00, 0x75, 0x00, 0x7E, 0x00, 0x8D, 0x00, 0xA2, 0x00, 0xA9, 0x00, 0xB2, 0x00, 0xB7, 0x00,
+	0xC2, 0x00, 0xD3, 0x00, 0xE2, 0x00, 0xF1, 0x00, 0x02, 0x01, 0x13, 0x01, 0x22, 0x01, 0x33, 0x01,
+	0x42, 0x01, 0x53, 0x01, 0x64, 0x01, 0x69, 0x01, 0x70, 0x01, 0x85, 0x01, 0x98, 0x01, 0xAD, 0x01,
+	0xBA, 0x01, 0xD5, 0x01, 0xEA, 0x01, 0xFB, 0x01, 0x0E, 0x02, 0x21, 0x02, 0x30, 0x02, 0x3F, 0x02,
+	0x54, 0x02, 0x67, 0x02, 0x6C, 0x02, 0x75, 0x02, 0x86, 0x02, 0x95, 0x02, 0xAA, 0x02, 0xBD, 0x02,
+	0xD2, 0x02, 0xE1, 0x02, 0xF6, 0x02, 0x07, 0x03, 0x18, 0x03, 0x2B, 0x03, 0x3E, 0x03, 0x53, 0x03,
+	0x6E, 0x03, 0x81, 0x03, 0x92, 0x03, 0xA5, 0x03, 0xAE, 0x03, 0xB9, 0x03, 0xC2, 0x03, 0xD3, 0x03,
+	0xE4, 0x03, 0xEB, 0x03, 0xFA, 0x03, 0x0B, 0x04, 0x1A, 0x04, 0x2B, 0x04, 0x3C, 0x04, 0x49, 0x04,
+	0x5A, 0x04, 0x69, 0x04, 0x6E, 0x04, 0x77, 0x04, 0x86, 0x04, 0x8B, 0x04, 0xA4, 0x04, 0xB3, 0x04,
+	0xC4, 0x04, 0xD5, 0x04, 0xE6, 0x04, 0xF1, 0x04, 0x00, 0x05, 0x0D, 0x05, 0x1C, 0x05, 0x2D, 0x05,
+	0x44, 0x05, 0x55, 0x05, 0x66, 0x05, 0x75, 0x05, 0x82, 0x05, 0x87, 0x05, 0x94, 0x05,
+
+	// Glyph metrics: advance, kerning column, last ink column
+	0x03, 0x00, 0x00, 0x00, 0x00,	// ' '
+	0x01, 0xF8, 0x19, 0xF8, 0x19,	// '!'
+	0x04, 0x38, 0x00, 0x38, 0x00,	// '"'
+	0x09, 0x00, 0x02, 0x40, 0x02,	// '#'
+	0x06, 0xE0, 0x08, 0x10, 0x0F,	// '$'
+	0x0C, 0x70, 0x00, 0x00, 0x04,	// '%'
+	0x09, 0x00, 0x07, 0x80, 0x11,	// '&'
+	0x01, 0x38, 0x00, 0x38, 0x00,	// '''
+	0x03, 0xE0, 0x07, 0x04, 0x60,	// '('
+	0x03, 0x04, 0x00, 0xE0, 0x0F,	// ')'
+	0x06, 0x10, 0x00, 0x10, 0x00,	// '*'
+	0x09, 0x00, 0x01, 0x00, 0x01,	// '+'
+	0x02, 0x00, 0x30, 0x00, 0x18,	// ','
+	0x03, 0x00, 0x03, 0x00, 0x03,	// '-'
+	0x01, 0x00, 0x18, 0x00, 0x18,	// '.'
+	0x04, 0x00, 0x30, 0x38, 0x00,	// '/'
+	0x07, 0xE0, 0x07, 0xE0, 0x07,	// '0'
+	0x06, 0x08, 0x10, 0x00, 0x10,	// '1'
+	0x06, 0x08, 0x18, 0xF8, 0x10,	// '2'
+	0x07, 0x08, 0x18, 0x00, 0x06,	// '3'
+	0x07, 0x00, 0x03, 0x00, 0x02,	// '4'
+	0x06, 0x78, 0x18, 0x88, 0x0F,	// '5'
+	0x07, 0xE0, 0x07, 0x00, 0x07,	// '6'
+	0x06, 0x08, 0x00, 0x38, 0x00,	// '7'
+	0x07, 0x30, 0x0F, 0x30, 0x06,	// '8'
+	0x07, 0xF0, 0x00, 0xE0, 0x03,	// '9'
+	0x01, 0x40, 0x18, 0x40, 0x18,	// ':'
+	0x02, 0x00, 0x30, 0x40, 0x18,	// ';'
+	0x09, 0x00, 0x01, 0x20, 0x08,	// '<'
+	0x08, 0xC0, 0x02, 0xC0, 0x02,	// '='
+	0x09, 0x20, 0x08, 0x00, 0x01,	// '>'
+	0x05, 0x08, 0x00, 0x78, 0x00,	// '?'
+	0x0C, 0x80, 0x0F, 0xC0, 0x03,	// '@'
+	0x09, 0x00, 0x18, 0x00, 0x18,	// 'A'
+	0x07, 0xF8, 0x1F, 0x30, 0x0F,	// 'B'
+	0x08, 0xE0, 0x03, 0x08, 0x08,	// 'C'
+	0x08, 0xF8, 0x1F, 0xF0, 0x07,	// 'D'
+	0x06, 0xF8, 0x1F, 0x88, 0x10,	// 'E'
+	0x06, 0xF8, 0x1F, 0x08, 0x00,	// 'F'
+	0x09, 0xE0, 0x03, 0x00, 0x0F,	// 'G'
+	0x08, 0xF8, 0x1F, 0xF8, 0x0F,	// 'H'
+	0x01, 0xF8, 0x1F, 0xF8, 0x1F,	// 'I'
+	0x03, 0x00, 0xC0, 0xF8, 0x7F,	// 'J'
+	0x07, 0xF8, 0x1F, 0x08, 0x18,	// 'K'
+	0x06, 0xF8, 0x1F, 0x00, 0x10,	// 'L'
+	0x09, 0xF8, 0x1F, 0xF8, 0x1F,	// 'M'
+	0x08, 0xF8, 0x1F, 0xF8, 0x0F,	// 'N'
+	0x09, 0xE0, 0x03, 0xE0, 0x07,	// 'O'
+	0x06, 0xF8, 0x1F, 0xF8, 0x00,	// 'P'
+	0x09, 0xE0, 0x03, 0xE0, 0x07,	// 'Q'
+	0x07, 0xF8, 0x1F, 0x00, 0x1C,	// 'R'
+	0x07, 0x70, 0x08, 0x00, 0x0F,	// 'S'
+	0x08, 0x08, 0x00, 0x08, 0x00,	// 'T'
+	0x08, 0xF8, 0x07, 0xF8, 0x03,	// 'U'
+	0x09, 0x08, 0x00, 0x18, 0x00,	// 'V'
+	0x0C, 0x18, 0x00, 0x78, 0x00,	// 'W'
+	0x08, 0x00, 0x10, 0x08, 0x18,	// 'X'
+	0x07, 0x18, 0x00, 0x08, 0x00,	// 'Y'
+	0x08, 0x08, 0x18, 0x08, 0x10,	// 'Z'
+	0x03, 0xFC, 0x7F, 0x04, 0x00,	// '['
+	0x04, 0x08, 0x00, 0x00, 0x3C,	// '\\'
+	0x03, 0x04, 0x40, 0xFC, 0x3F,	// ']'
+	0x07, 0x20, 0x00, 0x20, 0x00,	// '^'
+	0x07, 0x00, 0x80, 0x00, 0x80,	// '_'
+	0x02, 0x04, 0x00, 0x08, 0x00,	// '`'
+	0x06, 0x00, 0x0E, 0xC0, 0x1F,	// 'a'
+	0x07, 0xFC, 0x1F, 0x80, 0x07,	// 'b'
+	0x06, 0x80, 0x07, 0x20, 0x10,	// 'c'
+	0x07, 0x80, 0x07, 0xF8, 0x1F,	// 'd'
+	0x07, 0x80, 0x07, 0x80, 0x01,	// 'e'
+	0x05, 0x20, 0x00, 0x04, 0x00,	// 'f'
+	0x07, 0x80, 0x07, 0xE0, 0x1F,	// 'g'
+	0x06, 0xFC, 0x1F, 0xC0, 0x1F,	// 'h'
+	0x01, 0xEC, 0x1F, 0xEC, 0x1F,	// 'i'
+	0x03, 0x00, 0x80, 0xEC, 0x3F,	// 'j'
+	0x06, 0xFC, 0x1F, 0x20, 0x10,	// 'k'
+	0x01, 0xFC, 0x1F, 0xFC, 0x1F,	// 'l'
+	0x0B, 0xE0, 0x1F, 0xC0, 0x1F,	// 'm'
+	0x06, 0xE0, 0x1F, 0xC0, 0x1F,	// 'n'
+	0x07, 0x80, 0x07, 0x80, 0x07,	// 'o'
+	0x07, 0xE0, 0xFF, 0x80, 0x07,	// 'p'
+	0x07, 0x80, 0x07, 0xE0, 0x7F,	// 'q'
+	0x04, 0xE0, 0x1F, 0x20, 0x00,	// 'r'
+	0x06, 0xC0, 0x19, 0x00, 0x0C,	// 's'
+	0x05, 0x20, 0x00, 0x20, 0x10,	// 't'
+	0x06, 0xE0, 0x0F, 0xE0, 0x1F,	// 'u'
+	0x07, 0x60, 0x00, 0x60, 0x00,	// 'v'
+	0x0A, 0x60, 0x00, 0x60, 0x00,	// 'w'
+	0x07, 0x00, 0x10, 0x20, 0x10,	// 'x'
+	0x07, 0x20, 0x00, 0x60, 0x00,	// 'y'
+	0x06, 0x20, 0x18, 0x60, 0x10,	// 'z'
+	0x05, 0x00, 0x01, 0x04, 0x40,	// '{'
+	0x01, 0xFC, 0xFF, 0xFC, 0xFF,	// '|'
+	0x05, 0x04, 0x40, 0x00, 0x01,	// '}'
+	0x08, 0x00, 0x01, 0x00, 0x01,	// '~'
+
+	// Glyph data: left bearing, number of ink columns, right bearing, ink columns
+	// ' '
+	0x03, 0x00, 0x00,
+	// '!'
+	0x00, 0x01, 0x00, 0xF8, 0x19,
+	// '"'
+	0x00, 0x04, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
+	// '#'
+	0x00, 0x09, 0x00, 0x00, 0x02, 0x40, 0x02, 0x40, 0x0F, 0xF0, 0x03, 0x78, 0x02, 0x40, 0x0E, 0xE0,
+	0x03, 0x78, 0x02, 0x40, 0x02,
+	// '$'
+	0x00, 0x06, 0x00, 0xE0, 0x08, 0xB0, 0x10, 0x90, 0x11, 0xF8, 0x3F, 0x10, 0x19, 0x10, 0x0F,
+	// '%'
+	0x00, 0x0C, 0x00, 0x70, 0x00, 0x88, 0x00, 0x80, 0x10, 0xD8, 0x08, 0x30, 0x06, 0x80, 0x01, 0x40,
+	0x00, 0x30, 0x0F, 0x08, 0x11, 0x00, 0x10, 0x00, 0x1F, 0x00, 0x04,
+	// '&'
+	0x00, 0x09, 0x00, 0x00, 0x07, 0xB0, 0x0D, 0xF8, 0x10, 0x88, 0x10, 0x08, 0x11, 0x08, 0x1A, 0x00,
+	0x0C, 0x00, 0x0E, 0x80, 0x11,
+	// '''
+	0x00, 0x01, 0x00, 0x38, 0x00,
+	// '('
+	0x00, 0x03, 0x00, 0xE0, 0x07, 0x38, 0x3C, 0x04, 0x60,
+	// ')'
+	0x00, 0x03, 0x00, 0x04, 0x00, 0x38, 0x38, 0xE0, 0x0F,
+	// '*'
+	0x00, 0x06, 0x00, 0x10, 0x00, 0x50, 0x00, 0x60, 0x00, 0x60, 0x00, 0x50, 0x00, 0x10, 0x00,
+	// '+'
+	0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x01, 0x00,
+	0x01, 0x00, 0x01, 0x00, 0x01,
+	// ','
+	0x00, 0x02, 0x00, 0x00, 0x30, 0x00, 0x18,
+	// '-'
+	0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+	// '.'
+	0x00, 0x01, 0x00, 0x00, 0x18,
+	// '/'
+	0x00, 0x04, 0x00, 0x00, 0x30, 0x00, 0x1E, 0xC0, 0x03, 0x38, 0x00,
+	// '0'
+	0x00, 0x07, 0x00, 0xE0, 0x07, 0x38, 0x0C, 0x08, 0x10, 0x08, 0x10, 0x08, 0x18, 0x38, 0x0E, 0xE0,
+	0x07,
+	// '1'
+	0x00, 0x06, 0x00, 0x08, 0x10, 0x08, 0x10, 0xF8, 0x1F, 0xF8, 0x1F, 0x00, 0x10, 0x00, 0x10,
+	// '2'
+	0x00, 0x06, 0x00, 0x08, 0x18, 0x08, 0x1C, 0x08, 0x16, 0x08, 0x13, 0x88, 0x11, 0xF8, 0x10,
+	// '3'
+	0x00, 0x07, 0x00, 0x08, 0x18, 0x08, 0x10, 0x88, 0x10, 0x88, 0x10, 0xC8, 0x18, 0x78, 0x0F, 0x00,
+	0x06,
+	// '4'
+	0x00, 0x07, 0x00, 0x00, 0x03, 0x80, 0x03, 0x60, 0x02, 0x30, 0x02, 0x18, 0x06, 0xF8, 0x1F, 0x00,
+	0x02,
+	// '5'
+	0x00, 0x06, 0x00, 0x78, 0x18, 0x78, 0x10, 0x48, 0x10, 0x48, 0x10, 0xC8, 0x18, 0x88, 0x0F,
+	// '6'
+	0x00, 0x07, 0x00, 0xE0, 0x07, 0xF0, 0x0F, 0xC8, 0x10, 0x48, 0x10, 0x48, 0x10, 0x88, 0x0D, 0x00,
+	0x07,
+	// '7'
+	0x00, 0x06, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x1C, 0x88, 0x07, 0xE8, 0x00, 0x38, 0x00,
+	// '8'
+	0x00, 0x07, 0x00, 0x30, 0x0F, 0xF8, 0x19, 0x88, 0x10, 0x88, 0x10, 0x88, 0x10, 0x78, 0x0F, 0x30,
+	0x06,
+	// '9'
+	0x00, 0x07, 0x00, 0xF0, 0x00, 0x98, 0x11, 0x08, 0x11, 0x08, 0x11, 0x08, 0x19, 0xF8, 0x0F, 0xE0,
+	0x03,
+	// ':'
+	0x00, 0x01, 0x00, 0x40, 0x18,
+	// ';'
+	0x00, 0x02, 0x00, 0x00, 0x30, 0x40, 0x18,
+	// '<'
+	0x00, 0x09, 0x00, 0x00, 0x01, 0x80, 0x03, 0x80, 0x02, 0x80, 0x02, 0x40, 0x06, 0x40, 0x04, 0x40,
+	0x04, 0x20, 0x08, 0x20, 0x08,
+	// '='
+	0x00, 0x08, 0x00, 0xC0, 0x02, 0xC0, 0x02, 0xC0, 0x02, 0xC0, 0x02, 0xC0, 0x02, 0xC0, 0x02, 0xC0,
+	0x02, 0xC0, 0x02,
+	// '>'
+	0x00, 0x09, 0x00, 0x20, 0x08, 0x60, 0x0C, 0x40, 0x04, 0x40, 0x04, 0xC0, 0x02, 0x80, 0x02, 0x80,
+	0x03, 0x80, 0x01, 0x00, 0x01,
+	// '?'
+	0x00, 0x05, 0x00, 0x08, 0x00, 0x08, 0x00, 0x88, 0x1B, 0xC8, 0x00, 0x78, 0x00,
+	// '@'
+	0x00, 0x0C, 0x00, 0x80, 0x0F, 0x60, 0x18, 0x10, 0x20, 0x10, 0x47, 0xC8, 0x4C, 0x48, 0x48, 0x48,
+	0x48, 0x88, 0x4C, 0xD0, 0x4F, 0x10, 0x28, 0x60, 0x04, 0xC0, 0x03,
+	// 'A'
+	0x00, 0x09, 0x00, 0x00, 0x18, 0x00, 0x0E, 0xC0, 0x03, 0x70, 0x02, 0x18, 0x02, 0x78, 0x02, 0xC0,
+	0x03, 0x00, 0x0F, 0x00, 0x18,
+	// 'B'
+	0x00, 0x07, 0x00, 0xF8, 0x1F, 0x88, 0x18, 0x88, 0x10, 0x88, 0x10, 0x88, 0x10, 0xF8, 0x09, 0x30,
+	0x0F,
+	// 'C'
+	0x00, 0x08, 0x00, 0xE0, 0x03, 0x70, 0x0E, 0x18, 0x08, 0x08, 0x10, 0x08, 0x10, 0x08, 0x10, 0x08,
+	0x10, 0x08, 0x08,
+	// 'D'
+	0x00, 0x08, 0x00, 0xF8, 0x1F, 0x08, 0x18, 0x08, 0x10, 0x08, 0x10, 0x08, 0x18, 0x08, 0x08, 0x10,
+	0x0C, 0xF0, 0x07,
+	// 'E'
+	0x00, 0x06, 0x00, 0xF8, 0x1F, 0x88, 0x18, 0x88, 0x10, 0x88, 0x10, 0x88, 0x10, 0x88, 0x10,
+	// 'F'
+	0x00, 0x06, 0x00, 0xF8, 0x1F, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x08, 0x00,
+	// 'G'
+	0x00, 0x09, 0x00, 0xE0, 0x03, 0x70, 0x0E, 0x18, 0x08, 0x08, 0x10, 0x08, 0x10, 0x08, 0x11, 0x88,
+	0x11, 0x88, 0x0F, 0x00, 0x0F,
+	// 'H'
+	0x00, 0x08, 0x00, 0xF8, 0x1F, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0xF8,
+	0x1F, 0xF8, 0x0F,
+	// 'I'
+	0x00, 0x01, 0x00, 0xF8, 0x1F,
+	// 'J'
+	0x00, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x40, 0xF8, 0x7F,
+	// 'K'
+	0x00, 0x07, 0x00, 0xF8, 0x1F, 0xC0, 0x01, 0xC0, 0x01, 0x60, 0x03, 0x30, 0x06, 0x18, 0x0C, 0x08,
+	0x18,
+	// 'L'
+	0x00, 0x06, 0x00, 0xF8, 0x1F, 0x00, 0x18, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10,
+	// 'M'
+	0x00, 0x09, 0x00, 0xF8, 0x1F, 0x18, 0x00, 0x70, 0x00, 0x80, 0x03, 0x00, 0x06, 0x80, 0x03, 0xF0,
+	0x00, 0x18, 0x00, 0xF8, 0x1F,
+	// 'N'
+	0x00, 0x08, 0x00, 0xF8, 0x1F, 0x18, 0x00, 0x70, 0x00, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x0C, 0xF8,
+	0x1F, 0xF8, 0x0F,
+	// 'O'
+	0x00, 0x09, 0x00, 0xE0, 0x03, 0x70, 0x0E, 0x18, 0x08, 0x08, 0x10, 0x08, 0x10, 0x08, 0x10, 0x08,
+	0x18, 0x30, 0x0C, 0xE0, 0x07,
+	// 'P'
+	0x00, 0x06, 0x00, 0xF8, 0x1F, 0x88, 0x01, 0x08, 0x01, 0x08, 0x01, 0x88, 0x01, 0xF8, 0x00,
+	// 'Q'
+	0x00, 0x09, 0x00, 0xE0, 0x03, 0x70, 0x0E, 0x18, 0x08, 0x08, 0x10, 0x08, 0x10, 0x08, 0x10, 0x08,
+	0x38, 0x30, 0x0C, 0xE0, 0x07,
+	// 'R'
+	0x00, 0x07, 0x00, 0xF8, 0x1F, 0x88, 0x01, 0x88, 0x01, 0x88, 0x01, 0x88, 0x01, 0xF8, 0x06, 0x00,
+	0x1C,
+	// 'S'
+	0x00, 0x07, 0x00, 0x70, 0x08, 0xD8, 0x10, 0x88, 0x10, 0x88, 0x10, 0x88, 0x11, 0x88, 0x19, 0x00,
+	0x0F,
+	// 'T'
+	0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0xF8, 0x1F, 0x08, 0x00, 0x08,
+	0x00, 0x08, 0x00,
+	// 'U'
+	0x00, 0x08, 0x00, 0xF8, 0x07, 0x00, 0x0C, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x18, 0xF8,
+	0x0F, 0xF8, 0x03,
+	// 'V'
+	0x00, 0x09, 0x00, 0x08, 0x00, 0x78, 0x00, 0xC0, 0x01, 0x00, 0x0F, 0x00, 0x18, 0x00, 0x0E, 0xC0,
+	0x03, 0x78, 0x00, 0x18, 0x00,
+	// 'W'
+	0x00, 0x0C, 0x00, 0x18, 0x00, 0xF8, 0x01, 0x80, 0x0F, 0x00, 0x1C, 0x80, 0x0F, 0xF8, 0x00, 0x18,
+	0x00, 0xF0, 0x01, 0x00, 0x0F, 0x00, 0x1C, 0xC0, 0x07, 0x78, 0x00,
+	// 'X'
+	0x00, 0x08, 0x00, 0x00, 0x10, 0x08, 0x18, 0x30, 0x06, 0xE0, 0x03, 0xC0, 0x01, 0x60, 0x03, 0x38,
+	0x0C, 0x08, 0x18,
+	// 'Y'
+	0x00, 0x07, 0x00, 0x18, 0x00, 0x30, 0x00, 0xC0, 0x00, 0xC0, 0x1F, 0x60, 0x00, 0x38, 0x00, 0x08,
+	0x00,
+	// 'Z'
+	0x00, 0x08, 0x00, 0x08, 0x18, 0x08, 0x1C, 0x08, 0x16, 0x88, 0x11, 0xC8, 0x10, 0x68, 0x10, 0x38,
+	0x10, 0x08, 0x10,
+	// '['
+	0x00, 0x03, 0x00, 0xFC, 0x7F, 0x04, 0x60, 0x04, 0x00,
+	// '\\'
+	0x00, 0x04, 0x00, 0x08, 0x00, 0xF0, 0x00, 0x80, 0x07, 0x00, 0x3C,
+	// ']'
+	0x00, 0x03, 0x00, 0x04, 0x40, 0x0C, 0x60, 0xFC, 0x3F,
+	// '^'
+	0x00, 0x07, 0x00, 0x20, 0x00, 0x10, 0x00, 0x18, 0x00, 0x08, 0x00, 0x18, 0x00, 0x30, 0x00, 0x20,
+	0x00,
+	// '_'
+	0x00, 0x07, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
+	0x80,
+	// '`'
+	0x00, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00,
+	// 'a'
+	0x00, 0x06, 0x00, 0x00, 0x0E, 0x20, 0x1B, 0x20, 0x11, 0x20, 0x11, 0x60, 0x09, 0xC0, 0x1F,
+	// 'b'
+	0x00, 0x07, 0x00, 0xFC, 0x1F, 0x40, 0x08, 0x20, 0x10, 0x20, 0x10, 0x60, 0x18, 0xC0, 0x0F, 0x80,
+	0x07,
+	// 'c'
+	0x00, 0x06, 0x00, 0x80, 0x07, 0xC0, 0x0C, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10,
+	// 'd'
+	0x00, 0x07, 0x00, 0x80, 0x07, 0xC0, 0x0C, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0xF8, 0x0F, 0xF8,
+	0x1F,
+	// 'e'
+	0x00, 0x07, 0x00, 0x80, 0x07, 0xC0, 0x0F, 0x20, 0x11, 0x20, 0x11, 0x20, 0x11, 0x40, 0x11, 0x80,
+	0x01,
+	// 'f'
+	0x00, 0x05, 0x00, 0x20, 0x00, 0xF8, 0x1F, 0x6C, 0x00, 0x24, 0x00, 0x04, 0x00,
+	// 'g'
+	0x00, 0x07, 0x00, 0x80, 0x07, 0xC0, 0x4C, 0x20, 0x90, 0x20, 0x90, 0x20, 0x48, 0xC0, 0x7F, 0xE0,
+	0x1F,
+	// 'h'
+	0x00, 0x06, 0x00, 0xFC, 0x1F, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00, 0x60, 0x00, 0xC0, 0x1F,
+	// 'i'
+	0x00, 0x01, 0x00, 0xEC, 0x1F,
+	// 'j'
+	0x00, 0x03, 0x00, 0x00, 0x80, 0x00, 0x40, 0xEC, 0x3F,
+	// 'k'
+	0x00, 0x06, 0x00, 0xFC, 0x1F, 0x00, 0x03, 0x80, 0x03, 0xC0, 0x04, 0x40, 0x08, 0x20, 0x10,
+	// 'l'
+	0x00, 0x01, 0x00, 0xFC, 0x1F,
+	// 'm'
+	0x00, 0x0B, 0x00, 0xE0, 0x1F, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00, 0x60, 0x00, 0xC0, 0x1F, 0x40,
+	0x00, 0x20, 0x00, 0x20, 0x00, 0x60, 0x00, 0xC0, 0x1F,
+	// 'n'
+	0x00, 0x06, 0x00, 0xE0, 0x1F, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00, 0x60, 0x00, 0xC0, 0x1F,
+	// 'o'
+	0x00, 0x07, 0x00, 0x80, 0x07, 0xC0, 0x0C, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0xC0, 0x0C, 0x80,
+	0x07,
+	// 'p'
+	0x00, 0x07, 0x00, 0xE0, 0xFF, 0x40, 0x08, 0x20, 0x10, 0x20, 0x10, 0x60, 0x18, 0xC0, 0x0F, 0x80,
+	0x07,
+	// 'q'
+	0x00, 0x07, 0x00, 0x80, 0x07, 0xC0, 0x0C, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0xC0, 0x7F, 0xE0,
+	0x7F,
+	// 'r'
+	0x00, 0x04, 0x00, 0xE0, 0x1F, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00,
+	// 's'
+	0x00, 0x06, 0x00, 0xC0, 0x19, 0x60, 0x11, 0x20, 0x11, 0x20, 0x12, 0x20, 0x1E, 0x00, 0x0C,
+	// 't'
+	0x00, 0x05, 0x00, 0x20, 0x00, 0xF8, 0x0F, 0x20, 0x18, 0x20, 0x10, 0x20, 0x10,
+	// 'u'
+	0x00, 0x06, 0x00, 0xE0, 0x0F, 0x00, 0x18, 0x00, 0x10, 0x00, 0x10, 0x00, 0x08, 0xE0, 0x1F,
+	// 'v'
+	0x00, 0x07, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x00, 0x0F, 0x00, 0x18, 0x00, 0x0E, 0x80, 0x03, 0x60,
+	0x00,
+	// 'w'
+	0x00, 0x0A, 0x00, 0x60, 0x00, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x0F, 0xE0, 0x01, 0xE0, 0x00, 0x00,
+	0x0F, 0x00, 0x1C, 0x80, 0x07, 0x60, 0x00,
+	// 'x'
+	0x00, 0x07, 0x00, 0x00, 0x10, 0x60, 0x18, 0xC0, 0x06, 0x00, 0x03, 0x80, 0x07, 0x40, 0x0C, 0x20,
+	0x10,
+	// 'y'
+	0x00, 0x07, 0x00, 0x20, 0x00, 0xC0, 0x81, 0x00, 0x47, 0x00, 0x7C, 0x00, 0x0E, 0x80, 0x03, 0x60,
+	0x00,
+	// 'z'
+	0x00, 0x06, 0x00, 0x20, 0x18, 0x20, 0x1C, 0x20, 0x12, 0x20, 0x11, 0xE0, 0x10, 0x60, 0x10,
+	// '{'
+	0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x01, 0xF8, 0x3F, 0x0C, 0x60, 0x04, 0x40,
+	// '|'
+	0x00, 0x01, 0x00, 0xFC, 0xFF,
+	// '}'
+	0x00, 0x05, 0x00, 0x04, 0x40, 0x0C, 0x40, 0xF8, 0x7E, 0x00, 0x03, 0x00, 0x01,
+	// '~'
+	0x00, 0x08, 0x00, 0x00, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+	0x01, 0x00, 0x01,
+};
+
+// End
@@ -0,0 +1,438 @@
+/*
+ * dejavu16_2bpp.cpp
+ *
+ * Generated by Tools/MakeFont.py from DejaVuSans.ttf - do not edit
+ * Command: MakeFont.py --ttf DejaVuSans.ttf --ranges 0x20-0x7E --height 16 --bpp 2 dejavu16_2bpp.cpp
+ * TrueType font: DejaVu Sans, Version 2.37, SHA-256 abdc775b21b1bc470d50c97e790d276f2054b7504e56e5bd3e64f48d68582322
+ */
+
+#include <asf.h>
+
+extern const uint8_t dejavu16_2bpp[] =
+{
+	0x00,	// compact font format
+	16,		// row height in pixels
+	1,		// space columns between characters before kerning
+	0x20,	// first character code
+	0x7E,	// last character code
+	13,		// maximum character width in pixels
+	0x05,	// flags
+	0x00,	// reserved
+
+	// Glyph offsets
+	0x00, 0x00, 0x03, 0x00, 0x0E, 0x00, 0x21, 0x00, 0x4C, 0x00, 0x6B, 0x00, 0x9E, 0x00, 0xC5, 0x00,
+	0xCC, 0x00, 0xDB, 0x00, 0xEA, 0x00, 0x05, 0x01, 0x2C, 0x01, 0x37, 0x01, 0x4A, 0x01, 0x55, 0x01,
+	0x6C, 0x01, 0x8B, 0x01, 0xA6, 0x01, 0xC5, 0x01, 0xE4, 0x01, 0x07, 0x02, 0x26, 0x02, 0x45, 0x02,
+	0x64, 0x02, 0x83, 0x02, 0xA2, 0x02, 0xAD, 0x02, 0xB8, 0x02, 0xDF, 0x02, 0x06, 0x03, 0x2D, 0x03,
+	0x48, 0x03, 0x7B, 0x03, 0xA2, 0x03, 0xC1, 0x03, 0xE4, 0x03, 0x0B, 0x04, 0x2A, 0x04, 0x45, 0x04,
+	0x6C, 0x04, 0x8F, 0x04, 0x9A, 0x04, 0xAD, 0x04, 0xD0, 0x04, 0xEF, 0x04, 0x1A, 0x05, 0x3D, 0x05,
+	0x68, 0x05, 0x87, 0x05, 0xB2, 0x05, 0xD5, 0x05, 0xF4, 0x05, 0x1B, 0x06, 0x3E, 0x06, 0x65, 0x06,
+	0x9C, 0x06, 0xC3, 0x06, 0xE6, 0x06, 0x09, 0x07, 0x18, 0x07, 0x2F, 0x07, 0x3E, 0x07, 0x65, 0x07,
+	0x84, 0x07, 0x93, 0x07, 0xB2, 0x07, 0xD1, 0x07, 0xEC, 0x07, 0x0B, 0x08, 0x2A, 0x08, 0x41, 0x08,
+	0x60, 0x08, 0x7F, 0x08, 0x8A, 0x08, 0x99, 0x08, 0xB8, 0x08, 0xC3, 0x08, 0xF2, 0x08, 0x11, 0x09,
+	0x30, 0x09, 0x4F, 0x09, 0x6E, 0x09, 0x85, 0x09, 0xA0, 0x09, 0xB7, 0x09, 0xD6, 0x09, 0xF5, 0x09,
+	0x20, 0x0A, 0x3F, 0x0A, 0x5E, 0x0A, 0x79, 0x0A, 0x94, 0x0A, 0x9B, 0x0A, 0xB6, 0x0A,
+
+	// Glyph metrics: advance, kerning column, last ink column
+	0x03, 0x00, 0x00, 0x00, 0x00,	// ' '
+	0x02, 0xF8, 0x19, 0xF8, 0x19,	// '!'
+	0x04, 0x38, 0x00, 0x38, 0x00,	// '"'
+	0x0A, 0x00, 0x02, 0x40, 0x02,	// '#'
+	0x07, 0xE0, 0x08, 0x10, 0x0F,	// '$'
+	0x0C, 0x70, 0x00, 0x00, 0x04,	// '%'
+	0x09, 0x00, 0x07, 0x80, 0x11,	// '&'
+	0x01, 0x38, 0x00, 0x38, 0x00,	// '''
+	0x03, 0xE0, 0x07, 0x04, 0x60,	// '('
+	0x03, 0x04, 0x00, 0xE0, 0x0F,	// ')'
+	0x06, 0x10, 0x00, 0x10, 0x00,	// '*'
+	0x09, 0x00, 0x01, 0x00, 0x01,	// '+'
+	0x02, 0x00, 0x30, 0x00, 0x18,	// ','
+	0x04, 0x00, 0x03, 0x00, 0x03,	// '-'
+	0x02, 0x00, 0x18, 0x00, 0x18,	// '.'
+	0x05, 0x00, 0x30, 0x38, 0x00,	// '/'
+	0x07, 0xE0, 0x07, 0xE0, 0x07,	// '0'
+	0x06, 0x08, 0x10, 0x00, 0x10,	// '1'
+	0x07, 0x08, 0x18, 0xF8, 0x10,	// '2'
+	0x07, 0x08, 0x18, 0x00, 0x06,	// '3'
+	0x08, 0x00, 0x03, 0x00, 0x02,	// '4'
+	0x07, 0x78, 0x18, 0x88, 0x0F,	// '5'
+	0x07, 0xE0, 0x07, 0x00, 0x07,	// '6'
+	0x07, 0x08, 0x00, 0x38, 0x00,	// '7'
+	0x07, 0x30, 0x0F, 0x30, 0x06,	// '8'
+	0x07, 0xF0, 0x00, 0xE0, 0x03,	// '9'
+	0x02, 0x40, 0x18, 0x40, 0x18,	// ':'
+	0x02, 0x00, 0x30, 0x40, 0x18,	// ';'
+	0x09, 0x00, 0x01, 0x20, 0x08,	// '<'
+	0x09, 0xC0, 0x02, 0xC0, 0x02,	// '='
+	0x09, 0x20, 0x08, 0x00, 0x01,	// '>'
+	0x06, 0x08, 0x00, 0x78, 0x00,	// '?'
+	0x0C, 0x80, 0x0F, 0xC0, 0x03,	// '@'
+	0x09, 0x00, 0x18, 0x00, 0x18,	// 'A'
+	0x07, 0xF8, 0x1F, 0x30, 0x0F,	// 'B'
+	0x08, 0xE0, 0x03, 0x08, 0x08,	// 'C'
+	0x09, 0xF8, 0x1F, 0xF0, 0x07,	// 'D'
+	0x07, 0xF8, 0x1F, 0x88, 0x10,	// 'E'
+	0x06, 0xF8, 0x1F, 0x08, 0x00,	// 'F'
+	0x09, 0xE0, 0x03, 0x00, 0x0F,	// 'G'
+	0x08, 0xF8, 0x1F, 0xF8, 0x0F,	// 'H'
+	0x02, 0xF8, 0x1F, 0xF8, 0x1F,	// 'I'
+	0x04, 0x00, 0xC0, 0xF8, 0x7F,	// 'J'
+	0x08, 0xF8, 0x1F, 0x08, 0x18,	// 'K'
+	0x07, 0xF8, 0x1F, 0x00, 0x10,	// 'L'
+	0x0A, 0xF8, 0x1F, 0xF8, 0x1F,	// 'M'
+	0x08, 0xF8, 0x1F, 0xF8, 0x0F,	// 'N'
+	0x0A, 0xE0, 0x03, 0xE0, 0x07,	// 'O'
+	0x07, 0xF8, 0x1F, 0xF8, 0x00,	// 'P'
+	0x0A, 0xE0, 0x03, 0xE0, 0x07,	// 'Q'
+	0x08, 0xF8, 0x1F, 0x00, 0x1C,	// 'R'
+	0x07, 0x70, 0x08, 0x00, 0x0F,	// 'S'
+	0x09, 0x08, 0x00, 0x08, 0x00,	// 'T'
+	0x08, 0xF8, 0x07, 0xF8, 0x03,	// 'U'
+	0x09, 0x08, 0x00, 0x18, 0x00,	// 'V'
+	0x0D, 0x18, 0x00, 0x78, 0x00,	// 'W'
+	0x09, 0x00, 0x10, 0x08, 0x18,	// 'X'
+	0x08, 0x18, 0x00, 0x08, 0x00,	// 'Y'
+	0x08, 0x08, 0x18, 0x08, 0x10,	// 'Z'
+	0x03, 0xFC, 0x7F, 0x04, 0x00,	// '['
+	0x05, 0x08, 0x00, 0x00, 0x3C,	// '\\'
+	0x03, 0x04, 0x40, 0xFC, 0x3F,	// ']'
+	0x09, 0x20, 0x00, 0x20, 0x00,	// '^'
+	0x07, 0x00, 0x80, 0x00, 0x80,	// '_'
+	0x03, 0x04, 0x00, 0x08, 0x00,	// '`'
+	0x07, 0x00, 0x0E, 0xC0, 0x1F,	// 'a'
+	0x07, 0xFC, 0x1F, 0x80, 0x07,	// 'b'
+	0x06, 0x80, 0x07, 0x20, 0x10,	// 'c'
+	0x07, 0x80, 0x07, 0xF8, 0x1F,	// 'd'
+	0x07, 0x80, 0x07, 0x80, 0x01,	// 'e'
+	0x05, 0x20, 0x00, 0x04, 0x00,	// 'f'
+	0x07, 0x80, 0x07, 0xE0, 0x1F,	// 'g'
+	0x07, 0xFC, 0x1F, 0xC0, 0x1F,	// 'h'
+	0x02, 0xEC, 0x1F, 0xEC, 0x1F,	// 'i'
+	0x03, 0x00, 0x80, 0xEC, 0x3F,	// 'j'
+	0x07, 0xFC, 0x1F, 0x20, 0x10,	// 'k'
+	0x02, 0xFC, 0x1F, 0xFC, 0x1F,	// 'l'
+	0x0B, 0xE0, 0x1F, 0xC0, 0x1F,	// 'm'
+	0x07, 0xE0, 0x1F, 0xC0, 0x1F,	// 'n'
+	0x07, 0x80, 0x07, 0x80, 0x07,	// 'o'
+	0x07, 0xE0, 0xFF, 0x80, 0x07,	// 'p'
+	0x07, 0x80, 0x07, 0xE0, 0x7F,	// 'q'
+	0x05, 0xE0, 0x1F, 0x20, 0x00,	// 'r'
+	0x06, 0xC0, 0x19, 0x00, 0x0C,	// 's'
+	0x05, 0x20, 0x00, 0x20, 0x10,	// 't'
+	0x07, 0xE0, 0x0F, 0xE0, 0x1F,	// 'u'
+	0x07, 0x60, 0x00, 0x60, 0x00,	// 'v'
+	0x0A, 0x60, 0x00, 0x60, 0x00,	// 'w'
+	0x07, 0x00, 0x10, 0x20, 0x10,	// 'x'
+	0x07, 0x20, 0x00, 0x60, 0x00,	// 'y'
+	0x06, 0x20, 0x18, 0x60, 0x10,	// 'z'
+	0x06, 0x00, 0x01, 0x04, 0x40,	// '{'
+	0x01, 0xFC, 0xFF, 0xFC, 0xFF,	// '|'
+	0x06, 0x04, 0x40, 0x00, 0x01,	// '}'
+	0x09, 0x00, 0x01, 0x00, 0x01,	// '~'
+
+	// Glyph data: left bearing, number of ink columns, right bearing, ink columns (2 bits per pixel)
+	// ' '
+	0x03, 0x00, 0x00,
+	// '!'
+	0x00, 0x02, 0x00, 0xD0, 0xFF, 0xC7, 0x02, 0x40, 0x55, 0x41, 0x01,
+	// '"'
+	0x00, 0x04, 0x00, 0xD0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x15, 0x00, 0x00, 0x90,
+	0x1A, 0x00, 0x00,
+	// '#'
+	0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x24, 0x4C, 0x01, 0x00, 0x64, 0xBE, 0x01, 0x40,
+	0xBA, 0x0E, 0x00, 0x80, 0x2A, 0x4C, 0x01, 0x00, 0x64, 0xFD, 0x01, 0x40, 0xF9, 0x0E, 0x00, 0xC0,
+	0x2A, 0x0C, 0x00, 0x00, 0x24, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00,
+	// '$'
+	0x00, 0x07, 0x00, 0x00, 0xBD, 0x80, 0x01, 0x00, 0xDA, 0x41, 0x02, 0x40, 0x97, 0x56, 0x06, 0x90,
+	0xAB, 0xAB, 0x1B, 0x00, 0x03, 0x87, 0x02, 0x00, 0x06, 0xEE, 0x00, 0x00, 0x00, 0x14, 0x00,
+	// '%'
+	0x00, 0x0C, 0x00, 0x40, 0x6F, 0x00, 0x00, 0x90, 0xD1, 0x00, 0x00, 0x50, 0xC0, 0x00, 0x02, 0xC0,
+	0xA6, 0xD0, 0x01, 0x00, 0x1A, 0x29, 0x00, 0x00, 0x80, 0x06, 0x00, 0x00, 0x74, 0x00, 0x00, 0x40,
+	0x0A, 0xFE, 0x01, 0xD0, 0x41, 0x42, 0x02, 0x00, 0x40, 0x01, 0x03, 0x00, 0x00, 0xAB, 0x02, 0x00,
+	0x00, 0x64, 0x00,
+	// '&'
+	0x00, 0x09, 0x00, 0x00, 0x40, 0x7E, 0x00, 0x40, 0xDA, 0xE6, 0x01, 0xC0, 0xBA, 0x40, 0x02, 0x90,
+	0xD0, 0x01, 0x03, 0x90, 0x40, 0x47, 0x03, 0xD0, 0x00, 0x9D, 0x02, 0x00, 0x00, 0xF4, 0x00, 0x00,
+	0x40, 0xE9, 0x01, 0x00, 0x80, 0x46, 0x02,
+	// '''
+	0x00, 0x01, 0x00, 0xD0, 0x1F, 0x00, 0x00,
+	// '('
+	0x00, 0x03, 0x00, 0x00, 0xE8, 0x6F, 0x00, 0x80, 0x5B, 0xA5, 0x0B, 0x60, 0x00, 0x00, 0x28,
+	// ')'
+	0x00, 0x03, 0x00, 0x60, 0x00, 0x00, 0x14, 0x90, 0x5B, 0x95, 0x0B, 0x00, 0xF9, 0xBF, 0x01,
+	// '*'
+	0x00, 0x06, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x40, 0x6D, 0x01, 0x00, 0x50,
+	0x6D, 0x01, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00,
+	// '+'
+	0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x55, 0x57, 0x01, 0x00, 0xFE, 0xFF, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00,
+	// ','
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x1A, 0x00, 0x00, 0xC0, 0x06,
+	// '-'
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00,
+	0x00, 0x05, 0x00,
+	// '.'
+	0x00, 0x02, 0x00, 0x00, 0x00, 0xC0, 0x02, 0x00, 0x00, 0x40, 0x01,
+	// '/'
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x40, 0x0E, 0x00, 0x00, 0xF9, 0x06, 0x00, 0xE4, 0x1B, 0x00, 0x80,
+	0x1B, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	// '0'
+	0x00, 0x07, 0x00, 0x00, 0xF9, 0x6F, 0x00, 0x80, 0x5B, 0xE5, 0x01, 0xD0, 0x00, 0x40, 0x02, 0x90,
+	0x00, 0x00, 0x03, 0xD0, 0x00, 0x80, 0x02, 0x80, 0x5B, 0xE9, 0x01, 0x00, 0xF9, 0x2B, 0x00,
+	// '1'
+	0x00, 0x06, 0x00, 0xC0, 0x01, 0x40, 0x02, 0xC0, 0x00, 0x40, 0x02, 0xD0, 0xAA, 0xAA, 0x02, 0x90,
+	0xAA, 0xEA, 0x02, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x40, 0x02,
+	// '2'
+	0x00, 0x07, 0x00, 0xC0, 0x01, 0x80, 0x02, 0xD0, 0x00, 0xE0, 0x02, 0x90, 0x00, 0x6C, 0x02, 0x90,
+	0x00, 0x4B, 0x02, 0xC0, 0xD1, 0x42, 0x02, 0x80, 0xBF, 0x40, 0x02, 0x00, 0x04, 0x00, 0x01,
+	// '3'
+	0x00, 0x07, 0x00, 0x80, 0x00, 0x80, 0x02, 0xD0, 0x40, 0x40, 0x03, 0x90, 0xC0, 0x40, 0x03, 0x90,
+	0xD0, 0x40, 0x03, 0xD0, 0xE1, 0x81, 0x02, 0x80, 0x7F, 0xFB, 0x01, 0x00, 0x05, 0x29, 0x00,
+	// '4'
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xD0, 0x1A, 0x00, 0x00, 0x78, 0x18, 0x00, 0x40,
+	0x0B, 0x18, 0x00, 0xD0, 0x56, 0x6D, 0x01, 0xD0, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x18, 0x00, 0x00,
+	0x00, 0x04, 0x00,
+	// '5'
+	0x00, 0x07, 0x00, 0x80, 0x6A, 0x80, 0x02, 0xD0, 0x7A, 0x40, 0x03, 0xD0, 0x70, 0x40, 0x03, 0xD0,
+	0x60, 0x40, 0x03, 0xD0, 0xE0, 0x80, 0x02, 0x90, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x15, 0x00,
+	// '6'
+	0x00, 0x07, 0x00, 0x00, 0xF9, 0x6F, 0x00, 0x40, 0xEB, 0xEA, 0x01, 0xC0, 0xA1, 0x40, 0x02, 0x90,
+	0x70, 0x00, 0x03, 0x90, 0x60, 0x40, 0x03, 0xD0, 0xD0, 0xE6, 0x01, 0x40, 0x40, 0x6E, 0x00,
+	// '7'
+	0x00, 0x07, 0x00, 0xD0, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x01, 0xD0, 0x00, 0xE4, 0x02, 0xD0,
+	0x90, 0x6F, 0x00, 0xD0, 0xB9, 0x01, 0x00, 0xD0, 0x1B, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	// '8'
+	0x00, 0x07, 0x00, 0x40, 0x1A, 0xBE, 0x00, 0xC0, 0xBA, 0xD7, 0x02, 0x90, 0xD0, 0x41, 0x03, 0x90,
+	0xC0, 0x00, 0x03, 0xD0, 0xD0, 0x41, 0x03, 0xC0, 0x7B, 0xEB, 0x01, 0x00, 0x1A, 0x69, 0x00,
+	// '9'
+	0x00, 0x07, 0x00, 0x00, 0xBE, 0x40, 0x01, 0xC0, 0x96, 0x43, 0x02, 0x90, 0x00, 0x47, 0x03, 0x90,
+	0x00, 0x46, 0x03, 0xD0, 0x00, 0x83, 0x02, 0x80, 0xEB, 0xBA, 0x00, 0x00, 0xF9, 0x1B, 0x00,
+	// ':'
+	0x00, 0x02, 0x00, 0x00, 0x74, 0xC0, 0x02, 0x00, 0x10, 0x40, 0x01,
+	// ';'
+	0x00, 0x02, 0x00, 0x00, 0x54, 0x40, 0x1A, 0x00, 0x74, 0xC0, 0x06,
+	// '<'
+	0x00, 0x09, 0x00, 0x00, 0x40, 0x07, 0x00, 0x00, 0x80, 0x0B, 0x00, 0x00, 0xC0, 0x0D, 0x00, 0x00,
+	0x90, 0x1C, 0x00, 0x00, 0x60, 0x28, 0x00, 0x00, 0x30, 0x34, 0x00, 0x00, 0x24, 0x70, 0x00, 0x00,
+	0x18, 0x90, 0x00, 0x00, 0x08, 0x80, 0x00,
+	// '='
+	0x00, 0x09, 0x00, 0x00, 0xA0, 0x18, 0x00, 0x00, 0xA0, 0x18, 0x00, 0x00, 0xA0, 0x18, 0x00, 0x00,
+	0xA0, 0x18, 0x00, 0x00, 0xA0, 0x18, 0x00, 0x00, 0xA0, 0x18, 0x00, 0x00, 0xA0, 0x18, 0x00, 0x00,
+	0xA0, 0x18, 0x00, 0x00, 0x50, 0x14, 0x00,
+	// '>'
+	0x00, 0x09, 0x00, 0x00, 0x1C, 0xD0, 0x00, 0x00, 0x28, 0xA0, 0x00, 0x00, 0x34, 0x70, 0x00, 0x00,
+	0x70, 0x34, 0x00, 0x00, 0xA0, 0x18, 0x00, 0x00, 0xD0, 0x0C, 0x00, 0x00, 0xC0, 0x0A, 0x00, 0x00,
+	0x80, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00,
+	// '?'
+	0x00, 0x06, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x90, 0x00, 0x45, 0x01, 0x90, 0x80, 0xCF, 0x02, 0xD0,
+	0xB0, 0x00, 0x00, 0x80, 0x2F, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+	// '@'
+	0x00, 0x0C, 0x00, 0x00, 0x90, 0xBF, 0x00, 0x00, 0x68, 0x80, 0x07, 0x00, 0x06, 0x00, 0x0D, 0x40,
+	0x42, 0x2E, 0x24, 0x80, 0xA1, 0xA5, 0x30, 0xC0, 0x70, 0xC0, 0x30, 0xC0, 0x60, 0xC0, 0x30, 0x80,
+	0x91, 0xA5, 0x30, 0x40, 0xA2, 0xEA, 0x24, 0x00, 0x07, 0xC0, 0x08, 0x00, 0x6D, 0x64, 0x00, 0x00,
+	0xA0, 0x1B, 0x00,
+	// 'A'
+	0x00, 0x09, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0xF9, 0x01, 0x00, 0xE4, 0x1F, 0x00, 0x40,
+	0x6F, 0x1C, 0x00, 0xD0, 0x02, 0x1C, 0x00, 0x80, 0x2F, 0x1C, 0x00, 0x00, 0xE4, 0x1E, 0x00, 0x00,
+	0x40, 0xBE, 0x01, 0x00, 0x00, 0x90, 0x02,
+	// 'B'
+	0x00, 0x07, 0x00, 0xD0, 0xFF, 0xFF, 0x02, 0xD0, 0xD5, 0x95, 0x02, 0xD0, 0xC0, 0x40, 0x02, 0xD0,
+	0xC0, 0x40, 0x02, 0xC0, 0xD0, 0x40, 0x02, 0x80, 0xBB, 0xD6, 0x01, 0x00, 0x1A, 0xBE, 0x00,
+	// 'C'
+	0x00, 0x08, 0x00, 0x00, 0xF8, 0x1B, 0x00, 0x40, 0x6F, 0xB9, 0x00, 0xC0, 0x02, 0xD0, 0x01, 0xD0,
+	0x00, 0x40, 0x02, 0x90, 0x00, 0x40, 0x03, 0x90, 0x00, 0x40, 0x03, 0xD0, 0x00, 0x40, 0x02, 0x80,
+	0x01, 0xC0, 0x01,
+	// 'D'
+	0x00, 0x09, 0x00, 0xD0, 0xFF, 0xFF, 0x02, 0xD0, 0x55, 0x95, 0x02, 0xD0, 0x00, 0x40, 0x02, 0xD0,
+	0x00, 0x40, 0x02, 0xC0, 0x00, 0x80, 0x02, 0xC0, 0x01, 0xC0, 0x01, 0x40, 0x07, 0xE4, 0x00, 0x00,
+	0xFE, 0x6F, 0x00, 0x00, 0x50, 0x05, 0x00,
+	// 'E'
+	0x00, 0x07, 0x00, 0xD0, 0xFF, 0xFF, 0x02, 0xD0, 0xD5, 0x95, 0x02, 0xD0, 0xC0, 0x40, 0x02, 0xD0,
+	0xC0, 0x40, 0x02, 0xD0, 0xC0, 0x40, 0x02, 0xD0, 0xC0, 0x40, 0x02, 0x40, 0x00, 0x40, 0x01,
+	// 'F'
+	0x00, 0x06, 0x00, 0xD0, 0xFF, 0xFF, 0x02, 0xD0, 0xD5, 0x55, 0x01, 0xD0, 0xD0, 0x00, 0x00, 0xD0,
+	0xD0, 0x00, 0x00, 0xD0, 0xD0, 0x00, 0x00, 0x90, 0x40, 0x00, 0x00,
+	// 'G'
+	0x00, 0x09, 0x00, 0x00, 0xF8, 0x1B, 0x00, 0x40, 0x6F, 0xB9, 0x00, 0xC0, 0x02, 0xC0, 0x01, 0xD0,
+	0x00, 0x40, 0x02, 0x90, 0x00, 0x40, 0x03, 0x90, 0x40, 0x42, 0x03, 0xD0, 0x80, 0x42, 0x02, 0xC0,
+	0x81, 0xAB, 0x01, 0x40, 0x41, 0xAA, 0x00,
+	// 'H'
+	0x00, 0x08, 0x00, 0xD0, 0xFF, 0xFF, 0x02, 0x40, 0xD5, 0x55, 0x01, 0x00, 0xC0, 0x00, 0x00, 0x00,
+	0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x90, 0xEA, 0xAA, 0x02, 0x80,
+	0xAA, 0xAA, 0x01,
+	// 'I'
+	0x00, 0x02, 0x00, 0xD0, 0xFF, 0xFF, 0x02, 0x40, 0x55, 0x55, 0x01,
+	// 'J'
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x70, 0xD0, 0xFF, 0xFF, 0x2F, 0x40,
+	0x55, 0x55, 0x05,
+	// 'K'
+	0x00, 0x08, 0x00, 0xD0, 0xFF, 0xFF, 0x02, 0x40, 0xE5, 0x56, 0x01, 0x00, 0xF4, 0x07, 0x00, 0x00,
+	0x2C, 0x1E, 0x00, 0x00, 0x0B, 0x78, 0x00, 0xC0, 0x02, 0xE0, 0x01, 0x90, 0x00, 0x80, 0x02, 0x00,
+	0x00, 0x00, 0x01,
+	// 'L'
+	0x00, 0x07, 0x00, 0xD0, 0xFF, 0xFF, 0x02, 0x40, 0x55, 0x95, 0x02, 0x00, 0x00, 0x40, 0x02, 0x00,
+	0x00, 0x40, 0x02, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x01,
+	// 'M'
+	0x00, 0x0A, 0x00, 0xD0, 0xFF, 0xFF, 0x02, 0xD0, 0x56, 0x55, 0x01, 0x40, 0x6E, 0x00, 0x00, 0x00,
+	0x90, 0x1B, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x90, 0x1B, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xD0,
+	0x06, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x02, 0x40, 0x55, 0x55, 0x00,
+	// 'N'
+	0x00, 0x08, 0x00, 0xD0, 0xFF, 0xFF, 0x02, 0xD0, 0x57, 0x55, 0x01, 0x40, 0x2E, 0x00, 0x00, 0x00,
+	0xE4, 0x01, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x00, 0xF4, 0x01, 0x90, 0xAA, 0xEA, 0x02, 0x80,
+	0xAA, 0xAA, 0x01,
+	// 'O'
+	0x00, 0x0A, 0x00, 0x00, 0xF8, 0x1B, 0x00, 0x40, 0x6F, 0xB9, 0x00, 0xC0, 0x02, 0xC0, 0x01, 0xD0,
+	0x00, 0x40, 0x02, 0x90, 0x00, 0x00, 0x03, 0x90, 0x00, 0x40, 0x03, 0xC0, 0x01, 0x80, 0x02, 0x40,
+	0x1B, 0xE5, 0x00, 0x00, 0xFD, 0x2F, 0x00, 0x00, 0x40, 0x01, 0x00,
+	// 'P'
+	0x00, 0x07, 0x00, 0xD0, 0xFF, 0xFF, 0x02, 0xD0, 0x95, 0x57, 0x01, 0xD0, 0x40, 0x02, 0x00, 0xD0,
+	0x40, 0x02, 0x00, 0xC0, 0x81, 0x02, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
+	// 'Q'
+	0x00, 0x0A, 0x00, 0x00, 0xF8, 0x1B, 0x00, 0x40, 0x6F, 0xB9, 0x00, 0xC0, 0x02, 0xC0, 0x01, 0xD0,
+	0x00, 0x40, 0x02, 0x90, 0x00, 0x00, 0x03, 0x90, 0x00, 0x40, 0x07, 0xC0, 0x01, 0x80, 0x1F, 0x40,
+	0x1B, 0xE5, 0x14, 0x00, 0xFD, 0x2F, 0x00, 0x00, 0x40, 0x01, 0x00,
+	// 'R'
+	0x00, 0x08, 0x00, 0xD0, 0xFF, 0xFF, 0x02, 0xD0, 0x95, 0x56, 0x01, 0xD0, 0x80, 0x02, 0x00, 0xD0,
+	0x80, 0x02, 0x00, 0xC0, 0xD1, 0x07, 0x00, 0x80, 0xBF, 0x6D, 0x00, 0x00, 0x15, 0xE0, 0x02, 0x00,
+	0x00, 0x40, 0x01,
+	// 'S'
+	0x00, 0x07, 0x00, 0x40, 0x2F, 0x80, 0x01, 0xC0, 0xB6, 0x40, 0x02, 0xD0, 0xD0, 0x40, 0x03, 0x90,
+	0xC0, 0x01, 0x03, 0x90, 0xC0, 0x42, 0x03, 0xD0, 0x80, 0xD7, 0x02, 0x40, 0x00, 0xBE, 0x00,
+	// 'T'
+	0x00, 0x09, 0x00, 0xD0, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0xD0,
+	0x55, 0x55, 0x01, 0xD0, 0xFF, 0xFF, 0x02, 0xD0, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0xD0,
+	0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	// 'U'
+	0x00, 0x08, 0x00, 0xD0, 0xFF, 0x6F, 0x00, 0x40, 0x55, 0xE5, 0x01, 0x00, 0x00, 0x40, 0x02, 0x00,
+	0x00, 0x40, 0x03, 0x00, 0x00, 0x40, 0x03, 0x00, 0x00, 0x80, 0x02, 0x90, 0xAA, 0xFA, 0x01, 0x90,
+	0xAA, 0x1A, 0x00,
+	// 'V'
+	0x00, 0x09, 0x00, 0x90, 0x01, 0x00, 0x00, 0x80, 0x6F, 0x00, 0x00, 0x00, 0xE4, 0x06, 0x00, 0x00,
+	0x40, 0xBE, 0x01, 0x00, 0x00, 0xD0, 0x02, 0x00, 0x00, 0xF9, 0x01, 0x00, 0xE4, 0x1B, 0x00, 0x80,
+	0x6F, 0x00, 0x00, 0xD0, 0x02, 0x00, 0x00,
+	// 'W'
+	0x00, 0x0D, 0x00, 0x90, 0x06, 0x00, 0x00, 0x80, 0xBE, 0x06, 0x00, 0x00, 0x90, 0xBE, 0x01, 0x00,
+	0x00, 0xE0, 0x02, 0x00, 0x90, 0xAF, 0x01, 0x80, 0xAF, 0x01, 0x00, 0xD0, 0x06, 0x00, 0x00, 0x40,
+	0xBA, 0x06, 0x00, 0x00, 0x40, 0xFA, 0x01, 0x00, 0x00, 0xE4, 0x02, 0x00, 0xE4, 0x6F, 0x01, 0xD0,
+	0x6F, 0x01, 0x00, 0x40, 0x01, 0x00, 0x00,
+	// 'X'
+	0x00, 0x09, 0x00, 0x00, 0x00, 0x40, 0x02, 0xD0, 0x01, 0xD0, 0x02, 0x40, 0x0B, 0x79, 0x00, 0x00,
+	0xB8, 0x0B, 0x00, 0x00, 0xF0, 0x02, 0x00, 0x00, 0x6D, 0x1E, 0x00, 0x80, 0x0B, 0xB4, 0x00, 0x90,
+	0x01, 0x80, 0x02, 0x00, 0x00, 0x00, 0x01,
+	// 'Y'
+	0x00, 0x08, 0x00, 0x50, 0x00, 0x00, 0x00, 0xC0, 0x02, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
+	0xB4, 0x55, 0x01, 0x00, 0xE0, 0xFF, 0x02, 0x00, 0x79, 0x00, 0x00, 0x80, 0x0B, 0x00, 0x00, 0xD0,
+	0x01, 0x00, 0x00,
+	// 'Z'
+	0x00, 0x08, 0x00, 0x90, 0x00, 0x80, 0x02, 0xD0, 0x00, 0xF4, 0x02, 0xD0, 0x00, 0x6D, 0x02, 0xD0,
+	0x80, 0x47, 0x02, 0xD0, 0xE0, 0x41, 0x02, 0xD0, 0x2D, 0x40, 0x02, 0xD0, 0x0B, 0x40, 0x02, 0xD0,
+	0x01, 0x40, 0x02,
+	// '['
+	0x00, 0x03, 0x00, 0xE0, 0xFF, 0xFF, 0x2F, 0x60, 0x55, 0x55, 0x29, 0x60, 0x00, 0x00, 0x14,
+	// '\\'
+	0x00, 0x05, 0x00, 0x90, 0x01, 0x00, 0x00, 0x40, 0xBE, 0x01, 0x00, 0x00, 0x90, 0x6F, 0x00, 0x00,
+	0x00, 0xE4, 0x0B, 0x00, 0x00, 0x00, 0x04,
+	// ']'
+	0x00, 0x03, 0x00, 0x60, 0x00, 0x00, 0x24, 0xA0, 0x55, 0x55, 0x29, 0xE0, 0xFF, 0xFF, 0x1F,
+	// '^'
+	0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x40, 0x07, 0x00, 0x00, 0xC0,
+	0x02, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	// '_'
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00,
+	0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	// '`'
+	0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+	// 'a'
+	0x00, 0x07, 0x00, 0x00, 0x14, 0xB8, 0x01, 0x00, 0x18, 0x9A, 0x02, 0x00, 0x0C, 0x03, 0x03, 0x00,
+	0x0C, 0x43, 0x02, 0x00, 0x28, 0x83, 0x01, 0x00, 0xF4, 0xFF, 0x02, 0x00, 0x40, 0x55, 0x01,
+	// 'b'
+	0x00, 0x07, 0x00, 0xE0, 0xFF, 0xFF, 0x02, 0x40, 0x75, 0xD5, 0x01, 0x00, 0x18, 0x40, 0x02, 0x00,
+	0x0C, 0x00, 0x03, 0x00, 0x28, 0x80, 0x02, 0x00, 0xB4, 0xEA, 0x01, 0x00, 0x80, 0x2A, 0x00,
+	// 'c'
+	0x00, 0x06, 0x00, 0x00, 0x90, 0x6F, 0x00, 0x00, 0xB4, 0xE5, 0x01, 0x00, 0x18, 0x40, 0x02, 0x00,
+	0x0C, 0x00, 0x03, 0x00, 0x1C, 0x00, 0x03, 0x00, 0x18, 0x40, 0x02,
+	// 'd'
+	0x00, 0x07, 0x00, 0x00, 0x90, 0x6F, 0x00, 0x00, 0xB4, 0xE5, 0x01, 0x00, 0x1C, 0x40, 0x03, 0x00,
+	0x0C, 0x00, 0x03, 0x00, 0x18, 0x40, 0x02, 0x90, 0xBA, 0xEA, 0x01, 0x90, 0xAA, 0xAA, 0x02,
+	// 'e'
+	0x00, 0x07, 0x00, 0x00, 0x90, 0x6F, 0x00, 0x00, 0xB4, 0xEA, 0x01, 0x00, 0x18, 0x46, 0x02, 0x00,
+	0x0C, 0x06, 0x03, 0x00, 0x1C, 0x06, 0x03, 0x00, 0x74, 0x46, 0x02, 0x00, 0x90, 0x47, 0x01,
+	// 'f'
+	0x00, 0x05, 0x00, 0x00, 0x18, 0x00, 0x00, 0x80, 0xBE, 0xAA, 0x02, 0xA0, 0x6D, 0x55, 0x01, 0x60,
+	0x18, 0x00, 0x00, 0x60, 0x04, 0x00, 0x00,
+	// 'g'
+	0x00, 0x07, 0x00, 0x00, 0x90, 0x6F, 0x00, 0x00, 0xB4, 0xE5, 0x61, 0x00, 0x1C, 0x40, 0x92, 0x00,
+	0x0C, 0x40, 0x92, 0x00, 0x18, 0x80, 0x61, 0x00, 0xB4, 0xEA, 0x3A, 0x00, 0xA8, 0xAA, 0x06,
+	// 'h'
+	0x00, 0x07, 0x00, 0xE0, 0xFF, 0xFF, 0x02, 0x40, 0x75, 0x55, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x0C, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x02, 0x00, 0x40, 0x55, 0x01,
+	// 'i'
+	0x00, 0x02, 0x00, 0xE0, 0xF8, 0xFF, 0x02, 0x40, 0x54, 0x55, 0x01,
+	// 'j'
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x90, 0x50, 0x54, 0x55, 0x75, 0xA0, 0xA8, 0xAA, 0x1A,
+	// 'k'
+	0x00, 0x07, 0x00, 0xE0, 0xFF, 0xFF, 0x02, 0x40, 0x55, 0x5B, 0x01, 0x00, 0x80, 0x1E, 0x00, 0x00,
+	0xA0, 0x74, 0x00, 0x00, 0x34, 0xD0, 0x01, 0x00, 0x18, 0x40, 0x02, 0x00, 0x00, 0x00, 0x01,
+	// 'l'
+	0x00, 0x02, 0x00, 0xE0, 0xFF, 0xFF, 0x02, 0x40, 0x55, 0x55, 0x01,
+	// 'm'
+	0x00, 0x0B, 0x00, 0x00, 0xF8, 0xFF, 0x02, 0x00, 0x74, 0x55, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x0C, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x02, 0x00, 0x64, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x68, 0x55, 0x01, 0x00, 0xE0, 0xFF, 0x02,
+	// 'n'
+	0x00, 0x07, 0x00, 0x00, 0xF8, 0xFF, 0x02, 0x00, 0x74, 0x55, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x0C, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x02, 0x00, 0x40, 0x55, 0x01,
+	// 'o'
+	0x00, 0x07, 0x00, 0x00, 0x90, 0x6F, 0x00, 0x00, 0xB4, 0xE5, 0x01, 0x00, 0x18, 0x40, 0x02, 0x00,
+	0x0C, 0x00, 0x03, 0x00, 0x18, 0x40, 0x02, 0x00, 0xB4, 0xE5, 0x01, 0x00, 0x90, 0x6F, 0x00,
+	// 'p'
+	0x00, 0x07, 0x00, 0x00, 0xF8, 0xFF, 0xBF, 0x00, 0x74, 0xD5, 0x15, 0x00, 0x18, 0x40, 0x02, 0x00,
+	0x0C, 0x00, 0x03, 0x00, 0x28, 0x80, 0x02, 0x00, 0xB4, 0xEA, 0x01, 0x00, 0x80, 0x2A, 0x00,
+	// 'q'
+	0x00, 0x07, 0x00, 0x00, 0x90, 0x6F, 0x00, 0x00, 0xB4, 0xE5, 0x01, 0x00, 0x1C, 0x40, 0x03, 0x00,
+	0x0C, 0x00, 0x03, 0x00, 0x18, 0x40, 0x02, 0x00, 0xB4, 0xEA, 0x6A, 0x00, 0xA8, 0xAA, 0x6A,
+	// 'r'
+	0x00, 0x05, 0x00, 0x00, 0xF8, 0xFF, 0x02, 0x00, 0x74, 0x55, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x1C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+	// 's'
+	0x00, 0x06, 0x00, 0x00, 0xE0, 0x82, 0x02, 0x00, 0x68, 0x47, 0x03, 0x00, 0x0C, 0x06, 0x03, 0x00,
+	0x0C, 0x49, 0x03, 0x00, 0x18, 0xAD, 0x02, 0x00, 0x14, 0xA4, 0x00,
+	// 't'
+	0x00, 0x05, 0x00, 0x00, 0x18, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x18, 0x80, 0x02, 0x00,
+	0x18, 0x40, 0x02, 0x00, 0x08, 0x40, 0x02,
+	// 'u'
+	0x00, 0x07, 0x00, 0x00, 0xF8, 0xBF, 0x00, 0x00, 0x54, 0x95, 0x02, 0x00, 0x00, 0x40, 0x03, 0x00,
+	0x00, 0x40, 0x02, 0x00, 0x00, 0x80, 0x01, 0x00, 0xF8, 0xFF, 0x02, 0x00, 0x54, 0x55, 0x01,
+	// 'v'
+	0x00, 0x07, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xE4, 0x06, 0x00, 0x00, 0x00, 0xBE, 0x01, 0x00,
+	0x00, 0xD0, 0x02, 0x00, 0x00, 0xF9, 0x01, 0x00, 0xD0, 0x1B, 0x00, 0x00, 0x78, 0x00, 0x00,
+	// 'w'
+	0x00, 0x0A, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0xA4, 0x6F, 0x00, 0x00, 0x00, 0xE4, 0x02, 0x00,
+	0x40, 0xBA, 0x01, 0x00, 0xB8, 0x06, 0x00, 0x00, 0xB8, 0x05, 0x00, 0x00, 0x40, 0xBE, 0x01, 0x00,
+	0x00, 0xE4, 0x02, 0x00, 0x94, 0x6F, 0x00, 0x00, 0x68, 0x01, 0x00,
+	// 'x'
+	0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x28, 0xD0, 0x02, 0x00, 0xE0, 0x79, 0x00, 0x00,
+	0x40, 0x1F, 0x00, 0x00, 0xD0, 0x2E, 0x00, 0x00, 0x74, 0xE0, 0x01, 0x00, 0x18, 0x40, 0x02,
+	// 'y'
+	0x00, 0x07, 0x00, 0x00, 0x18, 0x00, 0x40, 0x00, 0xE4, 0x06, 0x90, 0x00, 0x40, 0x7E, 0x74, 0x00,
+	0x00, 0xE0, 0x2F, 0x00, 0x00, 0xB9, 0x01, 0x00, 0xD0, 0x1B, 0x00, 0x00, 0x68, 0x00, 0x00,
+	// 'z'
+	0x00, 0x06, 0x00, 0x00, 0x18, 0x80, 0x02, 0x00, 0x18, 0xB4, 0x02, 0x00, 0x18, 0x5D, 0x02, 0x00,
+	0x58, 0x47, 0x02, 0x00, 0xE8, 0x41, 0x02, 0x00, 0x38, 0x40, 0x02,
+	// '{'
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x80, 0xFF, 0xFE, 0x1B, 0xA0,
+	0x55, 0x50, 0x39, 0x60, 0x00, 0x00, 0x30, 0x10, 0x00, 0x00, 0x10,
+	// '|'
+	0x00, 0x01, 0x00, 0xE0, 0xFF, 0xFF, 0xFF,
+	// '}'
+	0x00, 0x06, 0x00, 0x60, 0x00, 0x00, 0x30, 0xA0, 0x00, 0x00, 0x34, 0xD0, 0xFF, 0xF9, 0x2F, 0x00,
+	0x55, 0x5B, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00,
+	// '~'
+	0x00, 0x09, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00,
+	0x40, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x40, 0x01, 0x00,
+};
+
+// End
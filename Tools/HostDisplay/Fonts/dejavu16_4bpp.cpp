@@ -0,0 +1,619 @@
+/*
+ * dejavu16_4bpp.cpp
+ *
+ * Generated by Tools/MakeFont.py from DejaVuSans.ttf - do not edit
+ * Command: MakeFont.py --ttf DejaVuSans.ttf --ranges 0x20-0x7E --height 16 --bpp 4 dejavu16_4bpp.cpp
+ * TrueType font: DejaVu Sans, Version 2.37, SHA-256 abdc775b21b1bc470d50c97e790d276f2054b7504e56e5bd3e64f48d68582322
+ */
+
+#include <asf.h>
+
+extern const uint8_t dejavu16_4bpp[] =
+{
+	0x00,	// compact font format
+	16,		// row height in pixels
+	1,		// space columns between characters before kerning
+	0x20,	// first character code
+	0x7E,	// last character code
+	13,		// maximum character width in pixels
+	0x09,	// flags
+	0x00,	// reserved
+
+	// Glyph offsets
+	0x00, 0x00, 0x03, 0x00, 0x16, 0x00, 0x39, 0x00, 0x8C, 0x00, 0xC7, 0x00, 0x2A, 0x01, 0x7D, 0x01,
+	0x90, 0x01, 0xAB, 0x01, 0xCE, 0x01, 0x01, 0x02, 0x4C, 0x02, 0x5F, 0x02, 0x82, 0x02, 0x95, 0x02,
+	0xC0, 0x02, 0xFB, 0x02, 0x2E, 0x03, 0x69, 0x03, 0xA4, 0x03, 0xE7, 0x03, 0x22, 0x04, 0x5D, 0x04,
+	0x98, 0x04, 0xD3, 0x04, 0x0E, 0x05, 0x21, 0x05, 0x34, 0x05, 0x7F, 0x05, 0xCA, 0x05, 0x15, 0x06,
+	0x48, 0x06, 0xAB, 0x06, 0xFE, 0x06, 0x41, 0x07, 0x8C, 0x07, 0xD7, 0x07, 0x12, 0x08, 0x45, 0x08,
+	0x90, 0x08, 0xD3, 0x08, 0xE6, 0x08, 0x09, 0x09, 0x4C, 0x09, 0x87, 0x09, 0xDA, 0x09, 0x1D, 0x0A,
+	0x70, 0x0A, 0xAB, 0x0A, 0xFE, 0x0A, 0x41, 0x0B, 0x7C, 0x0B, 0xC7, 0x0B, 0x0A, 0x0C, 0x55, 0x0C,
+	0xC0, 0x0C, 0x0B, 0x0D, 0x56, 0x0D, 0xA1, 0x0D, 0xBC, 0x0D, 0xE7, 0x0D, 0x02, 0x0E, 0x4D, 0x0E,
+	0x90, 0x0E, 0xAB, 0x0E, 0xE6, 0x0E, 0x21, 0x0F, 0x54, 0x0F, 0x8F, 0x0F, 0xCA, 0x0F, 0xF5, 0x0F,
+	0x30, 0x10, 0x6B, 0x10, 0x7E, 0x10, 0x99, 0x10, 0xD4, 0x10, 0xE7, 0x10, 0x42, 0x11, 0x7D, 0x11,
+	0xB8, 0x11, 0xF3, 0x11, 0x2E, 0x12, 0x59, 0x12, 0x8C, 0x12, 0xB7, 0x12, 0xF2, 0x12, 0x35, 0x13,
+	0x88, 0x13, 0xCB, 0x13, 0x0E, 0x14, 0x41, 0x14, 0x74, 0x14, 0x87, 0x14, 0xBA, 0x14,
+
+	// Glyph metrics: advance, kerning column, last ink column
+	0x03, 0x00, 0x00, 0x00, 0x00,	// ' '
+	0x02, 0xF8, 0x19, 0xF8, 0x19,	// '!'
+	0x04, 0x38, 0x00, 0x38, 0x00,	// '"'
+	0x0A, 0x00, 0x02, 0x40, 0x02,	// '#'
+	0x07, 0xE0, 0x08, 0x10, 0x0F,	// '$'
+	0x0C, 0x70, 0x00, 0x00, 0x04,	// '%'
+	0x0A, 0x00, 0x07, 0x80, 0x11,	// '&'
+	0x02, 0x38, 0x00, 0x38, 0x00,	// '''
+	0x03, 0xE0, 0x07, 0x04, 0x60,	// '('
+	0x04, 0x04, 0x00, 0xE0, 0x0F,	// ')'
+	0x06, 0x10, 0x00, 0x10, 0x00,	// '*'
+	0x09, 0x00, 0x01, 0x00, 0x01,	// '+'
+	0x02, 0x00, 0x30, 0x00, 0x18,	// ','
+	0x04, 0x00, 0x03, 0x00, 0x03,	// '-'
+	0x02, 0x00, 0x18, 0x00, 0x18,	// '.'
+	0x05, 0x00, 0x30, 0x38, 0x00,	// '/'
+	0x07, 0xE0, 0x07, 0xE0, 0x07,	// '0'
+	0x06, 0x08, 0x10, 0x00, 0x10,	// '1'
+	0x07, 0x08, 0x18, 0xF8, 0x10,	// '2'
+	0x07, 0x08, 0x18, 0x00, 0x06,	// '3'
+	0x08, 0x00, 0x03, 0x00, 0x02,	// '4'
+	0x07, 0x78, 0x18, 0x88, 0x0F,	// '5'
+	0x07, 0xE0, 0x07, 0x00, 0x07,	// '6'
+	0x07, 0x08, 0x00, 0x38, 0x00,	// '7'
+	0x07, 0x30, 0x0F, 0x30, 0x06,	// '8'
+	0x07, 0xF0, 0x00, 0xE0, 0x03,	// '9'
+	0x02, 0x40, 0x18, 0x40, 0x18,	// ':'
+	0x02, 0x00, 0x30, 0x40, 0x18,	// ';'
+	0x09, 0x00, 0x01, 0x20, 0x08,	// '<'
+	0x09, 0xC0, 0x02, 0xC0, 0x02,	// '='
+	0x09, 0x20, 0x08, 0x00, 0x01,	// '>'
+	0x06, 0x08, 0x00, 0x78, 0x00,	// '?'
+	0x0C, 0x80, 0x0F, 0xC0, 0x03,	// '@'
+	0x0A, 0x00, 0x18, 0x00, 0x18,	// 'A'
+	0x08, 0xF8, 0x1F, 0x30, 0x0F,	// 'B'
+	0x09, 0xE0, 0x03, 0x08, 0x08,	// 'C'
+	0x09, 0xF8, 0x1F, 0xF0, 0x07,	// 'D'
+	0x07, 0xF8, 0x1F, 0x88, 0x10,	// 'E'
+	0x06, 0xF8, 0x1F, 0x08, 0x00,	// 'F'
+	0x09, 0xE0, 0x03, 0x00, 0x0F,	// 'G'
+	0x08, 0xF8, 0x1F, 0xF8, 0x0F,	// 'H'
+	0x02, 0xF8, 0x1F, 0xF8, 0x1F,	// 'I'
+	0x04, 0x00, 0xC0, 0xF8, 0x7F,	// 'J'
+	0x08, 0xF8, 0x1F, 0x08, 0x18,	// 'K'
+	0x07, 0xF8, 0x1F, 0x00, 0x10,	// 'L'
+	0x0A, 0xF8, 0x1F, 0xF8, 0x1F,	// 'M'
+	0x08, 0xF8, 0x1F, 0xF8, 0x0F,	// 'N'
+	0x0A, 0xE0, 0x03, 0xE0, 0x07,	// 'O'
+	0x07, 0xF8, 0x1F, 0xF8, 0x00,	// 'P'
+	0x0A, 0xE0, 0x03, 0xE0, 0x07,	// 'Q'
+	0x08, 0xF8, 0x1F, 0x00, 0x1C,	// 'R'
+	0x07, 0x70, 0x08, 0x00, 0x0F,	// 'S'
+	0x09, 0x08, 0x00, 0x08, 0x00,	// 'T'
+	0x08, 0xF8, 0x07, 0xF8, 0x03,	// 'U'
+	0x09, 0x08, 0x00, 0x18, 0x00,	// 'V'
+	0x0D, 0x18, 0x00, 0x78, 0x00,	// 'W'
+	0x09, 0x00, 0x10, 0x08, 0x18,	// 'X'
+	0x09, 0x18, 0x00, 0x08, 0x00,	// 'Y'
+	0x09, 0x08, 0x18, 0x08, 0x10,	// 'Z'
+	0x03, 0xFC, 0x7F, 0x04, 0x00,	// '['
+	0x05, 0x08, 0x00, 0x00, 0x3C,	// '\\'
+	0x03, 0x04, 0x40, 0xFC, 0x3F,	// ']'
+	0x09, 0x20, 0x00, 0x20, 0x00,	// '^'
+	0x08, 0x00, 0x80, 0x00, 0x80,	// '_'
+	0x03, 0x04, 0x00, 0x08, 0x00,	// '`'
+	0x07, 0x00, 0x0E, 0xC0, 0x1F,	// 'a'
+	0x07, 0xFC, 0x1F, 0x80, 0x07,	// 'b'
+	0x06, 0x80, 0x07, 0x20, 0x10,	// 'c'
+	0x07, 0x80, 0x07, 0xF8, 0x1F,	// 'd'
+	0x07, 0x80, 0x07, 0x80, 0x01,	// 'e'
+	0x05, 0x20, 0x00, 0x04, 0x00,	// 'f'
+	0x07, 0x80, 0x07, 0xE0, 0x1F,	// 'g'
+	0x07, 0xFC, 0x1F, 0xC0, 0x1F,	// 'h'
+	0x02, 0xEC, 0x1F, 0xEC, 0x1F,	// 'i'
+	0x03, 0x00, 0x80, 0xEC, 0x3F,	// 'j'
+	0x07, 0xFC, 0x1F, 0x20, 0x10,	// 'k'
+	0x02, 0xFC, 0x1F, 0xFC, 0x1F,	// 'l'
+	0x0B, 0xE0, 0x1F, 0xC0, 0x1F,	// 'm'
+	0x07, 0xE0, 0x1F, 0xC0, 0x1F,	// 'n'
+	0x07, 0x80, 0x07, 0x80, 0x07,	// 'o'
+	0x07, 0xE0, 0xFF, 0x80, 0x07,	// 'p'
+	0x07, 0x80, 0x07, 0xE0, 0x7F,	// 'q'
+	0x05, 0xE0, 0x1F, 0x20, 0x00,	// 'r'
+	0x06, 0xC0, 0x19, 0x00, 0x0C,	// 's'
+	0x05, 0x20, 0x00, 0x20, 0x10,	// 't'
+	0x07, 0xE0, 0x0F, 0xE0, 0x1F,	// 'u'
+	0x08, 0x60, 0x00, 0x60, 0x00,	// 'v'
+	0x0A, 0x60, 0x00, 0x60, 0x00,	// 'w'
+	0x08, 0x00, 0x10, 0x20, 0x10,	// 'x'
+	0x08, 0x20, 0x00, 0x60, 0x00,	// 'y'
+	0x06, 0x20, 0x18, 0x60, 0x10,	// 'z'
+	0x06, 0x00, 0x01, 0x04, 0x40,	// '{'
+	0x02, 0xFC, 0xFF, 0xFC, 0xFF,	// '|'
+	0x06, 0x04, 0x40, 0x00, 0x01,	// '}'
+	0x09, 0x00, 0x01, 0x00, 0x01,	// '~'
+
+	// Glyph data: left bearing, number of ink columns, right bearing, ink columns (4 bits per pixel)
+	// ' '
+	0x03, 0x00, 0x00,
+	// '!'
+	0x00, 0x02, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x7E, 0xE0, 0x0B, 0x00, 0x00, 0x51, 0x55, 0x55, 0x24,
+	0x50, 0x04, 0x00,
+	// '"'
+	0x00, 0x04, 0x00, 0x00, 0xF4, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x72, 0x77, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0xAA, 0x04, 0x00,
+	0x00, 0x00, 0x00,
+	// '#'
+	0x00, 0x0A, 0x00, 0x00, 0x00, 0x10, 0x02, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0A, 0xF1,
+	0x41, 0x05, 0x00, 0x00, 0x00, 0x50, 0x4B, 0xF8, 0xCF, 0x07, 0x00, 0x00, 0x40, 0xC8, 0xCF, 0xF9,
+	0x01, 0x00, 0x00, 0x00, 0xC2, 0x88, 0x0A, 0xF1, 0x30, 0x05, 0x00, 0x00, 0x00, 0x50, 0x3B, 0xF7,
+	0xDE, 0x07, 0x00, 0x00, 0x30, 0xC7, 0xDF, 0xFA, 0x02, 0x00, 0x00, 0x00, 0xD2, 0x99, 0x0A, 0xF1,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0A, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00,
+	0x00, 0x00, 0x00,
+	// '$'
+	0x00, 0x07, 0x00, 0x00, 0x00, 0xD3, 0xAF, 0x00, 0xC0, 0x05, 0x00, 0x00, 0x00, 0x8C, 0xD4, 0x06,
+	0x60, 0x09, 0x00, 0x00, 0x32, 0x3E, 0x93, 0x3B, 0x53, 0x3C, 0x02, 0x00, 0x85, 0x8E, 0x98, 0x8E,
+	0xA8, 0x8D, 0x06, 0x00, 0x00, 0x0E, 0x10, 0x3F, 0x80, 0x09, 0x00, 0x00, 0x00, 0x4B, 0x00, 0xE9,
+	0xEC, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x26, 0x00, 0x00,
+	// '%'
+	0x00, 0x0C, 0x00, 0x00, 0x70, 0xFE, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x13, 0xD5, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0xD0, 0x00, 0x10, 0x09, 0x00, 0x00, 0xE2, 0x78, 0xAB, 0x00,
+	0xD6, 0x07, 0x00, 0x00, 0x20, 0x98, 0x06, 0xC3, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x4C,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x7D, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0xAC, 0x02, 0xF9,
+	0xDF, 0x03, 0x00, 0x00, 0xD5, 0x04, 0x60, 0x1A, 0x50, 0x0C, 0x00, 0x00, 0x02, 0x00, 0x70, 0x07,
+	0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x20, 0x9E, 0xC8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72,
+	0x58, 0x00, 0x00,
+	// '&'
+	0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFB, 0x6D, 0x00, 0x00, 0x00, 0x50, 0xCC, 0xE6, 0x59,
+	0xF8, 0x05, 0x00, 0x00, 0xF2, 0x98, 0x9F, 0x00, 0x70, 0x0C, 0x00, 0x00, 0xA6, 0x00, 0xF5, 0x06,
+	0x20, 0x0E, 0x00, 0x00, 0xA6, 0x00, 0x50, 0x7F, 0x30, 0x0D, 0x00, 0x00, 0xE3, 0x01, 0x00, 0xF4,
+	0x97, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x40, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x30, 0xC7,
+	0xEC, 0x07, 0x00, 0x00, 0x00, 0x00, 0x90, 0x5B, 0x40, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00,
+	// '''
+	0x00, 0x02, 0x00, 0x00, 0xF4, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x01, 0x00,
+	0x00, 0x00, 0x00,
+	// '('
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x82, 0xEC, 0xEF, 0x7B, 0x02, 0x00, 0x00, 0xA2, 0xBF, 0x57, 0x55,
+	0xB8, 0x9F, 0x01, 0x00, 0x79, 0x01, 0x00, 0x00, 0x00, 0x81, 0x08,
+	// ')'
+	0x00, 0x04, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x71, 0x07, 0x00, 0xB3, 0xAE, 0x46, 0x43,
+	0xA6, 0xAE, 0x02, 0x00, 0x00, 0x93, 0xFD, 0xFF, 0x8D, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00,
+	// '*'
+	0x00, 0x06, 0x00, 0x00, 0x10, 0x09, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x1B, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x52, 0xE6, 0x5A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x63, 0xE7, 0x6A, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0A, 0x65, 0x00,
+	0x00, 0x00, 0x00,
+	// '+'
+	0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0F,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x54, 0x4F,
+	0x44, 0x03, 0x00, 0x00, 0x00, 0xDB, 0xDD, 0xDF, 0xDD, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0F,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0F,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x09, 0x00, 0x00, 0x00,
+	// ','
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xC8, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xE0, 0x5C, 0x00,
+	// '-'
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
+	0x00, 0x00, 0x00,
+	// '.'
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x60, 0x05, 0x00,
+	// '/'
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xD8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x94,
+	0xEE, 0x59, 0x00, 0x00, 0x00, 0x51, 0xEA, 0x8D, 0x03, 0x00, 0x00, 0x00, 0xB2, 0xCF, 0x27, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x62, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '0'
+	0x00, 0x07, 0x00, 0x00, 0x00, 0xB6, 0xFE, 0xDF, 0x39, 0x00, 0x00, 0x00, 0xB0, 0x9E, 0x66, 0x76,
+	0xFB, 0x04, 0x00, 0x00, 0xD4, 0x01, 0x00, 0x00, 0x70, 0x0C, 0x00, 0x00, 0xA7, 0x00, 0x00, 0x00,
+	0x20, 0x0E, 0x00, 0x00, 0xE4, 0x02, 0x00, 0x00, 0x80, 0x0C, 0x00, 0x00, 0xA0, 0xAE, 0x77, 0x87,
+	0xEC, 0x04, 0x00, 0x00, 0x00, 0xA5, 0xED, 0xCD, 0x28, 0x00, 0x00,
+	// '1'
+	0x00, 0x06, 0x00, 0x00, 0xD0, 0x05, 0x00, 0x00, 0x50, 0x09, 0x00, 0x00, 0xF1, 0x02, 0x00, 0x00,
+	0x60, 0x0B, 0x00, 0x00, 0xF4, 0x99, 0x99, 0x99, 0xB9, 0x0B, 0x00, 0x00, 0xB3, 0xBB, 0xBB, 0xBB,
+	0xDB, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x50, 0x0B, 0x00,
+	// '2'
+	0x00, 0x07, 0x00, 0x00, 0xD0, 0x05, 0x00, 0x00, 0xC1, 0x0B, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x10,
+	0xEC, 0x0B, 0x00, 0x00, 0xB6, 0x00, 0x00, 0xD1, 0x6B, 0x0B, 0x00, 0x00, 0xC6, 0x00, 0x20, 0xAD,
+	0x60, 0x0B, 0x00, 0x00, 0xF2, 0x16, 0xE5, 0x0A, 0x60, 0x0B, 0x00, 0x00, 0x80, 0xFF, 0x8F, 0x00,
+	0x60, 0x0B, 0x00, 0x00, 0x00, 0x42, 0x02, 0x00, 0x20, 0x04, 0x00,
+	// '3'
+	0x00, 0x07, 0x00, 0x00, 0xA1, 0x01, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0xD4, 0x00, 0x41, 0x00,
+	0x50, 0x0D, 0x00, 0x00, 0xB6, 0x00, 0xE2, 0x00, 0x30, 0x0E, 0x00, 0x00, 0xB6, 0x00, 0xF3, 0x00,
+	0x40, 0x0E, 0x00, 0x00, 0xF3, 0x04, 0xE9, 0x06, 0xA0, 0x0A, 0x00, 0x00, 0xA0, 0xFF, 0x4D, 0xCF,
+	0xED, 0x03, 0x00, 0x00, 0x00, 0x54, 0x01, 0x83, 0x28, 0x00, 0x00,
+	// '4'
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xC9,
+	0x06, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x4D, 0xB0, 0x06, 0x00, 0x00, 0x00, 0x50, 0x8D, 0x00, 0xB0,
+	0x06, 0x00, 0x00, 0x00, 0xF3, 0x7A, 0x77, 0xD7, 0x7A, 0x05, 0x00, 0x00, 0xD3, 0xDD, 0xDD, 0xFD,
+	0xDE, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+	0x02, 0x00, 0x00,
+	// '5'
+	0x00, 0x07, 0x00, 0x00, 0x92, 0x99, 0x69, 0x00, 0x90, 0x0A, 0x00, 0x00, 0xE4, 0xAA, 0x6E, 0x00,
+	0x50, 0x0D, 0x00, 0x00, 0xD4, 0x00, 0x4D, 0x00, 0x30, 0x0E, 0x00, 0x00, 0xD4, 0x00, 0x6C, 0x00,
+	0x50, 0x0D, 0x00, 0x00, 0xD4, 0x00, 0xD8, 0x02, 0xC1, 0x09, 0x00, 0x00, 0xA3, 0x00, 0xC1, 0xDF,
+	0xDF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x15, 0x00, 0x00,
+	// '6'
+	0x00, 0x07, 0x00, 0x00, 0x00, 0xA3, 0xFE, 0xDF, 0x39, 0x00, 0x00, 0x00, 0x60, 0xAF, 0xE8, 0x9C,
+	0xFB, 0x04, 0x00, 0x00, 0xF2, 0x04, 0x89, 0x00, 0x70, 0x0C, 0x00, 0x00, 0xC6, 0x00, 0x3D, 0x00,
+	0x20, 0x0E, 0x00, 0x00, 0xB6, 0x00, 0x7C, 0x00, 0x60, 0x0D, 0x00, 0x00, 0xE4, 0x00, 0xF5, 0x79,
+	0xF9, 0x06, 0x00, 0x00, 0x40, 0x01, 0x60, 0xEC, 0x6C, 0x00, 0x00,
+	// '7'
+	0x00, 0x07, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x00,
+	0x20, 0x05, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x51, 0xFB, 0x0B, 0x00, 0x00, 0xD4, 0x00, 0x93, 0xFE,
+	0x4A, 0x00, 0x00, 0x00, 0xE4, 0xC6, 0xCF, 0x17, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x9E, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '8'
+	0x00, 0x07, 0x00, 0x00, 0x30, 0xBA, 0x05, 0xE8, 0x9E, 0x01, 0x00, 0x00, 0xE1, 0x9C, 0x9E, 0x6D,
+	0xE7, 0x08, 0x00, 0x00, 0xC5, 0x00, 0xF4, 0x03, 0x50, 0x0D, 0x00, 0x00, 0xA7, 0x00, 0xF1, 0x00,
+	0x20, 0x0E, 0x00, 0x00, 0xD5, 0x01, 0xF5, 0x04, 0x50, 0x0D, 0x00, 0x00, 0xD1, 0xBD, 0x7E, 0x8E,
+	0xE9, 0x07, 0x00, 0x00, 0x20, 0x98, 0x03, 0xC6, 0x7C, 0x00, 0x00,
+	// '9'
+	0x00, 0x07, 0x00, 0x00, 0x20, 0xEB, 0xBE, 0x02, 0x30, 0x03, 0x00, 0x00, 0xD1, 0x6B, 0xC6, 0x1D,
+	0x60, 0x0C, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x4D, 0x30, 0x0E, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x5B,
+	0x40, 0x0D, 0x00, 0x00, 0xE4, 0x02, 0x20, 0x2E, 0xC1, 0x08, 0x00, 0x00, 0xA0, 0xBE, 0xEB, 0x9B,
+	0xCE, 0x01, 0x00, 0x00, 0x00, 0xA5, 0xED, 0xBD, 0x06, 0x00, 0x00,
+	// ':'
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x60, 0x6F, 0x00, 0xE0, 0x0B, 0x00, 0x00, 0x00, 0x20, 0x26, 0x00,
+	0x60, 0x05, 0x00,
+	// ';'
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x30, 0x37, 0x00, 0x60, 0xC8, 0x05, 0x00, 0x00, 0x50, 0x5E, 0x00,
+	0xE0, 0x5C, 0x00,
+	// '<'
+	0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x8E,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0xD0,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0x80, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x20, 0x2F, 0x30,
+	0x1E, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0B, 0x00, 0x5D, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0x00,
+	0xB7, 0x00, 0x00, 0x00, 0x00, 0x91, 0x01, 0x00, 0x92, 0x00, 0x00,
+	// '='
+	0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x98, 0xB0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xB0,
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xB0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xB0,
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xB0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xB0,
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xB0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xB0,
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x70, 0x03, 0x00, 0x00,
+	// '>'
+	0x00, 0x09, 0x00, 0x00, 0x00, 0xF1, 0x03, 0x00, 0xE4, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x08, 0x00,
+	0x99, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0D, 0x10, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x50,
+	0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xA0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xF1,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x6F,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x19, 0x00, 0x00, 0x00,
+	// '?'
+	0x00, 0x06, 0x00, 0x00, 0xE1, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x54,
+	0x50, 0x04, 0x00, 0x00, 0xA7, 0x00, 0xC1, 0xEF, 0xE1, 0x0B, 0x00, 0x00, 0xE5, 0x22, 0xAD, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '@'
+	0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xC6, 0xEE, 0x8D, 0x01, 0x00, 0x00, 0x00, 0xC1, 0x3A, 0x00,
+	0x82, 0x3D, 0x00, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x00, 0xD4, 0x02, 0x00, 0x50, 0x0B, 0x70, 0xDC,
+	0x29, 0x70, 0x09, 0x00, 0xB0, 0x05, 0xC8, 0x44, 0xC9, 0x10, 0x0E, 0x00, 0xD0, 0x01, 0x3D, 0x00,
+	0xD0, 0x02, 0x2D, 0x00, 0xE0, 0x01, 0x3B, 0x00, 0xD0, 0x01, 0x2D, 0x00, 0xC0, 0x03, 0xC5, 0x45,
+	0xA9, 0x10, 0x0E, 0x00, 0x70, 0x09, 0xC9, 0xCC, 0xFC, 0x72, 0x09, 0x00, 0x10, 0x4D, 0x00, 0x00,
+	0xD1, 0x80, 0x02, 0x00, 0x00, 0xD3, 0x38, 0x41, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC8, 0xBD,
+	0x05, 0x00, 0x00,
+	// 'A'
+	0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x10, 0xB6,
+	0xDF, 0x06, 0x00, 0x00, 0x00, 0x30, 0xE9, 0xFE, 0x05, 0x00, 0x00, 0x00, 0x71, 0xFD, 0x5A, 0xE0,
+	0x03, 0x00, 0x00, 0x00, 0xF4, 0x1A, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0xA2, 0xDF, 0x28, 0xE0,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x61, 0xFC, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xE8,
+	0xAF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00,
+	// 'B'
+	0x00, 0x08, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xE4, 0x55, 0xF7, 0x55,
+	0x95, 0x0B, 0x00, 0x00, 0xD4, 0x00, 0xF2, 0x00, 0x60, 0x0B, 0x00, 0x00, 0xD4, 0x00, 0xF2, 0x00,
+	0x60, 0x0B, 0x00, 0x00, 0xF2, 0x01, 0xF5, 0x02, 0x70, 0x0A, 0x00, 0x00, 0xC0, 0xAD, 0xAE, 0x5C,
+	0xE7, 0x06, 0x00, 0x00, 0x20, 0xA9, 0x15, 0xFA, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x01, 0x00, 0x00,
+	// 'C'
+	0x00, 0x09, 0x00, 0x00, 0x00, 0x92, 0xFD, 0xCE, 0x06, 0x00, 0x00, 0x00, 0x40, 0xDE, 0x78, 0xA7,
+	0xBF, 0x00, 0x00, 0x00, 0xD0, 0x09, 0x00, 0x00, 0xE3, 0x06, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x00,
+	0x60, 0x0C, 0x00, 0x00, 0xB6, 0x00, 0x00, 0x00, 0x30, 0x0E, 0x00, 0x00, 0xB6, 0x00, 0x00, 0x00,
+	0x30, 0x0E, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x00, 0x70, 0x0B, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00,
+	0xD1, 0x05, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00,
+	// 'D'
+	0x00, 0x09, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xE4, 0x55, 0x55, 0x55,
+	0x95, 0x0B, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x00, 0x60, 0x0B, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x00,
+	0x60, 0x0B, 0x00, 0x00, 0xF2, 0x01, 0x00, 0x00, 0x80, 0x09, 0x00, 0x00, 0xD0, 0x06, 0x00, 0x00,
+	0xD1, 0x06, 0x00, 0x00, 0x70, 0x7F, 0x02, 0x41, 0xDC, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+	0x3C, 0x00, 0x00, 0x00, 0x00, 0x10, 0x65, 0x36, 0x00, 0x00, 0x00,
+	// 'E'
+	0x00, 0x07, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xE4, 0x55, 0xF7, 0x55,
+	0x95, 0x0B, 0x00, 0x00, 0xD4, 0x00, 0xF2, 0x00, 0x60, 0x0B, 0x00, 0x00, 0xD4, 0x00, 0xF2, 0x00,
+	0x60, 0x0B, 0x00, 0x00, 0xD4, 0x00, 0xF2, 0x00, 0x60, 0x0B, 0x00, 0x00, 0xD4, 0x00, 0xF2, 0x00,
+	0x60, 0x0B, 0x00, 0x00, 0x41, 0x00, 0x20, 0x00, 0x30, 0x05, 0x00,
+	// 'F'
+	0x00, 0x06, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xE4, 0x55, 0xF7, 0x55,
+	0x55, 0x04, 0x00, 0x00, 0xD4, 0x00, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x00, 0xF3, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xD4, 0x00, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x51, 0x00,
+	0x00, 0x00, 0x00,
+	// 'G'
+	0x00, 0x09, 0x00, 0x00, 0x00, 0x92, 0xFD, 0xCE, 0x06, 0x00, 0x00, 0x00, 0x40, 0xDE, 0x78, 0xA7,
+	0xBF, 0x00, 0x00, 0x00, 0xD0, 0x09, 0x00, 0x00, 0xE2, 0x06, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x00,
+	0x70, 0x0C, 0x00, 0x00, 0xB6, 0x00, 0x00, 0x00, 0x30, 0x0E, 0x00, 0x00, 0xA6, 0x00, 0x60, 0x08,
+	0x30, 0x0E, 0x00, 0x00, 0xD4, 0x00, 0x80, 0x09, 0x50, 0x0C, 0x00, 0x00, 0xE1, 0x04, 0x80, 0x9D,
+	0xC9, 0x07, 0x00, 0x00, 0x50, 0x06, 0x60, 0xBB, 0xBB, 0x01, 0x00,
+	// 'H'
+	0x00, 0x08, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x51, 0x55, 0xF7, 0x55,
+	0x55, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xB3, 0xBB, 0xFB, 0xBB, 0xBB, 0x08, 0x00, 0x00, 0xA2, 0xAA, 0xAA, 0xAA,
+	0xAA, 0x07, 0x00,
+	// 'I'
+	0x00, 0x02, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x51, 0x55, 0x55, 0x55,
+	0x55, 0x04, 0x00,
+	// 'J'
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x20, 0x6D, 0x00, 0xE4, 0xEE, 0xEE, 0xEE, 0xEE, 0xFE, 0x1C, 0x00, 0x62, 0x66, 0x66, 0x66,
+	0x66, 0x46, 0x00,
+	// 'K'
+	0x00, 0x08, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x51, 0x55, 0xF9, 0x58,
+	0x55, 0x04, 0x00, 0x00, 0x00, 0x30, 0xDE, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x09, 0xEA,
+	0x03, 0x00, 0x00, 0x00, 0x20, 0xAD, 0x00, 0xA0, 0x3E, 0x00, 0x00, 0x00, 0xD1, 0x0A, 0x00, 0x00,
+	0xEA, 0x03, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xA0, 0x0B, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x00,
+	// 'L'
+	0x00, 0x07, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x51, 0x55, 0x55, 0x55,
+	0x95, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x60, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x60, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0x00,
+	// 'M'
+	0x00, 0x0A, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xF4, 0x6C, 0x55, 0x55,
+	0x55, 0x04, 0x00, 0x00, 0x50, 0xFA, 0x5B, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC6, 0x9E,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xBE,
+	0x05, 0x00, 0x00, 0x00, 0x20, 0xD8, 0x8D, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x6C, 0x22, 0x22,
+	0x22, 0x02, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x31, 0x33, 0x33, 0x33,
+	0x33, 0x02, 0x00,
+	// 'N'
+	0x00, 0x08, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xF3, 0x7D, 0x55, 0x55,
+	0x55, 0x04, 0x00, 0x00, 0x30, 0xFB, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xEC, 0x17,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xED, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+	0xDE, 0x05, 0x00, 0x00, 0xB3, 0xBB, 0xBB, 0xBB, 0xFC, 0x0B, 0x00, 0x00, 0x92, 0x99, 0x99, 0x99,
+	0x99, 0x07, 0x00,
+	// 'O'
+	0x00, 0x0A, 0x00, 0x00, 0x00, 0x92, 0xFD, 0xCE, 0x06, 0x00, 0x00, 0x00, 0x40, 0xDE, 0x78, 0xA7,
+	0xBF, 0x00, 0x00, 0x00, 0xE1, 0x08, 0x00, 0x00, 0xD2, 0x07, 0x00, 0x00, 0xD5, 0x00, 0x00, 0x00,
+	0x60, 0x0C, 0x00, 0x00, 0xA7, 0x00, 0x00, 0x00, 0x20, 0x0E, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x00,
+	0x40, 0x0D, 0x00, 0x00, 0xF2, 0x05, 0x00, 0x00, 0xB0, 0x09, 0x00, 0x00, 0x70, 0x9F, 0x24, 0x63,
+	0xDC, 0x02, 0x00, 0x00, 0x00, 0xD6, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x13,
+	0x00, 0x00, 0x00,
+	// 'P'
+	0x00, 0x07, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xE4, 0x55, 0x95, 0x5D,
+	0x55, 0x04, 0x00, 0x00, 0xD4, 0x00, 0x60, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xE4, 0x00, 0x60, 0x0B,
+	0x00, 0x00, 0x00, 0x00, 0xF1, 0x06, 0xC2, 0x08, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xEF, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x16, 0x00, 0x00, 0x00, 0x00,
+	// 'Q'
+	0x00, 0x0A, 0x00, 0x00, 0x00, 0x92, 0xFD, 0xCE, 0x06, 0x00, 0x00, 0x00, 0x40, 0xDE, 0x78, 0xA7,
+	0xBF, 0x00, 0x00, 0x00, 0xE1, 0x08, 0x00, 0x00, 0xD2, 0x07, 0x00, 0x00, 0xD5, 0x00, 0x00, 0x00,
+	0x60, 0x0C, 0x00, 0x00, 0xA7, 0x00, 0x00, 0x00, 0x20, 0x0E, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x00,
+	0x40, 0x4F, 0x00, 0x00, 0xF2, 0x05, 0x00, 0x00, 0xB0, 0xFD, 0x04, 0x00, 0x70, 0x9F, 0x24, 0x63,
+	0xDC, 0x61, 0x07, 0x00, 0x00, 0xD6, 0xFF, 0xFF, 0x2A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x42, 0x14,
+	0x00, 0x00, 0x00,
+	// 'R'
+	0x00, 0x08, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xE4, 0x55, 0xB5, 0x5A,
+	0x55, 0x04, 0x00, 0x00, 0xD4, 0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x00, 0xA0, 0x09,
+	0x00, 0x00, 0x00, 0x00, 0xF1, 0x05, 0xE3, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xAF, 0xF6,
+	0x4C, 0x00, 0x00, 0x00, 0x00, 0x74, 0x05, 0x20, 0xFA, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x30, 0x07, 0x00,
+	// 'S'
+	0x00, 0x07, 0x00, 0x00, 0x40, 0xFD, 0x2C, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xE1, 0x69, 0xBD, 0x00,
+	0x70, 0x0B, 0x00, 0x00, 0xD5, 0x00, 0xF5, 0x01, 0x30, 0x0E, 0x00, 0x00, 0xA7, 0x00, 0xF1, 0x04,
+	0x20, 0x0E, 0x00, 0x00, 0xB6, 0x00, 0xD0, 0x08, 0x50, 0x0D, 0x00, 0x00, 0xE3, 0x01, 0x80, 0x7F,
+	0xE6, 0x08, 0x00, 0x00, 0x70, 0x02, 0x10, 0xFA, 0xAF, 0x01, 0x00,
+	// 'T'
+	0x00, 0x09, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0x77, 0x77, 0x77,
+	0x77, 0x05, 0x00, 0x00, 0xF4, 0xEE, 0xEE, 0xEE, 0xEE, 0x0A, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'U'
+	0x00, 0x08, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x51, 0x55, 0x55, 0x65,
+	0xF9, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x30, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xA0, 0x0A, 0x00, 0x00, 0xA3, 0xAA, 0xAA, 0xBA, 0xEE, 0x03, 0x00, 0x00, 0xA3, 0xAA, 0xAA, 0xAA,
+	0x27, 0x00, 0x00,
+	// 'V'
+	0x00, 0x09, 0x00, 0x00, 0xB4, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xEF, 0x38, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xFC, 0x6C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xE9,
+	0xAF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC6,
+	0xDF, 0x06, 0x00, 0x00, 0x00, 0x40, 0xEA, 0x9E, 0x03, 0x00, 0x00, 0x00, 0x81, 0xFD, 0x5B, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0xD4, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'W'
+	0x00, 0x0D, 0x00, 0x00, 0xC4, 0x58, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xFC, 0xCF, 0x58,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x85, 0xFC, 0xCF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+	0xFA, 0x0B, 0x00, 0x00, 0x00, 0x20, 0x95, 0xFD, 0x8C, 0x03, 0x00, 0x00, 0x92, 0xFD, 0x8B, 0x14,
+	0x00, 0x00, 0x00, 0x00, 0xF4, 0x5C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xC8, 0xCF, 0x59,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xC8, 0xDF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62,
+	0xFA, 0x0B, 0x00, 0x00, 0x00, 0x62, 0xD9, 0xEF, 0x7B, 0x03, 0x00, 0x00, 0xD3, 0xEF, 0x7B, 0x04,
+	0x00, 0x00, 0x00, 0x00, 0x72, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'X'
+	0x00, 0x09, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x30, 0x08, 0x00, 0x00, 0xE4, 0x05, 0x00, 0x00,
+	0xF7, 0x08, 0x00, 0x00, 0x60, 0xAE, 0x01, 0xC3, 0x5D, 0x00, 0x00, 0x00, 0x00, 0xB2, 0x9E, 0xAF,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x5C, 0xEB,
+	0x06, 0x00, 0x00, 0x00, 0x91, 0x8F, 0x00, 0x60, 0xBE, 0x02, 0x00, 0x00, 0xC4, 0x03, 0x00, 0x00,
+	0xB2, 0x0B, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+	// 'Y'
+	0x00, 0x09, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x2C, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0xFA, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xCE, 0x77,
+	0x77, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xEE, 0xEE, 0x0A, 0x00, 0x00, 0x00, 0xC3, 0x4D, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x9F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'Z'
+	0x00, 0x09, 0x00, 0x00, 0xB3, 0x00, 0x00, 0x00, 0xC2, 0x0B, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x30,
+	0xEE, 0x0B, 0x00, 0x00, 0xD4, 0x00, 0x00, 0xF6, 0x69, 0x0B, 0x00, 0x00, 0xD4, 0x00, 0x90, 0x6F,
+	0x60, 0x0B, 0x00, 0x00, 0xD4, 0x10, 0xEB, 0x03, 0x60, 0x0B, 0x00, 0x00, 0xD4, 0xD3, 0x2C, 0x00,
+	0x60, 0x0B, 0x00, 0x00, 0xE4, 0x9E, 0x00, 0x00, 0x60, 0x0B, 0x00, 0x00, 0xF4, 0x07, 0x00, 0x00,
+	0x60, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00,
+	// '['
+	0x00, 0x03, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x6A, 0x44, 0x44, 0x44,
+	0x44, 0x84, 0x08, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x50, 0x07,
+	// '\\'
+	0x00, 0x05, 0x00, 0x00, 0xB4, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xEA, 0x8D, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x95, 0xEE, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+	0xD8, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x01,
+	// ']'
+	0x00, 0x03, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x60, 0x08, 0x00, 0x8A, 0x66, 0x66, 0x66,
+	0x66, 0x96, 0x08, 0x00, 0xD9, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x07,
+	// '^'
+	0x00, 0x09, 0x00, 0x00, 0x00, 0x20, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0x05, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x1C, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+	// '_'
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x20,
+	// '`'
+	0x00, 0x03, 0x00, 0x30, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x7C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x91, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'a'
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x30, 0x04, 0xC2, 0xCF, 0x03, 0x00, 0x00, 0x00, 0xB0, 0x05, 0xAA,
+	0xA4, 0x0C, 0x00, 0x00, 0x00, 0xE0, 0x02, 0x1E, 0x20, 0x0E, 0x00, 0x00, 0x00, 0xE0, 0x02, 0x0F,
+	0x30, 0x0C, 0x00, 0x00, 0x00, 0xB0, 0x09, 0x0F, 0xB2, 0x05, 0x00, 0x00, 0x00, 0x30, 0xEE, 0xEF,
+	0xEF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x41, 0x55, 0x55, 0x04, 0x00,
+	// 'b'
+	0x00, 0x07, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x42, 0x64, 0x7D, 0x44,
+	0xD7, 0x05, 0x00, 0x00, 0x00, 0xB0, 0x05, 0x00, 0x40, 0x0B, 0x00, 0x00, 0x00, 0xE0, 0x02, 0x00,
+	0x20, 0x0E, 0x00, 0x00, 0x00, 0xC0, 0x08, 0x00, 0x80, 0x0C, 0x00, 0x00, 0x00, 0x40, 0xCE, 0x99,
+	0xEC, 0x04, 0x00, 0x00, 0x00, 0x00, 0x82, 0xAA, 0x28, 0x00, 0x00,
+	// 'c'
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x9F, 0x55,
+	0xF9, 0x05, 0x00, 0x00, 0x00, 0xB0, 0x07, 0x00, 0x70, 0x0C, 0x00, 0x00, 0x00, 0xE0, 0x02, 0x00,
+	0x20, 0x0E, 0x00, 0x00, 0x00, 0xD0, 0x03, 0x00, 0x20, 0x0D, 0x00, 0x00, 0x00, 0x90, 0x07, 0x00,
+	0x60, 0x09, 0x00,
+	// 'd'
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xFF, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x70, 0x8E, 0x55,
+	0xE8, 0x07, 0x00, 0x00, 0x00, 0xD0, 0x05, 0x00, 0x50, 0x0D, 0x00, 0x00, 0x00, 0xE0, 0x02, 0x00,
+	0x10, 0x0E, 0x00, 0x00, 0x00, 0x90, 0x07, 0x00, 0x70, 0x09, 0x00, 0x00, 0x85, 0x88, 0xCE, 0x88,
+	0xEB, 0x06, 0x00, 0x00, 0xB7, 0xBB, 0xBB, 0xBB, 0xBB, 0x08, 0x00,
+	// 'e'
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xFE, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x8E, 0x8C,
+	0xF9, 0x04, 0x00, 0x00, 0x00, 0xC0, 0x06, 0x5A, 0x70, 0x0B, 0x00, 0x00, 0x00, 0xE0, 0x02, 0x5A,
+	0x20, 0x0E, 0x00, 0x00, 0x00, 0xD0, 0x04, 0x5A, 0x20, 0x0E, 0x00, 0x00, 0x00, 0x60, 0x6E, 0x5C,
+	0x50, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x5E, 0x60, 0x05, 0x00,
+	// 'f'
+	0x00, 0x05, 0x00, 0x00, 0x00, 0xB0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xEC, 0xCD, 0xCC,
+	0xCC, 0x09, 0x00, 0x00, 0xC8, 0xD7, 0x68, 0x66, 0x66, 0x05, 0x00, 0x00, 0x5A, 0xB0, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x48, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00,
+	// 'g'
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0xC6, 0xEF, 0x4C, 0x00, 0x01, 0x00, 0x00, 0x70, 0x8E, 0x54,
+	0xF9, 0x04, 0x6B, 0x00, 0x00, 0xD0, 0x05, 0x00, 0x70, 0x0A, 0x97, 0x00, 0x00, 0xE0, 0x02, 0x00,
+	0x50, 0x0B, 0x97, 0x00, 0x00, 0x90, 0x07, 0x00, 0xA0, 0x06, 0x7B, 0x00, 0x00, 0x60, 0xBE, 0x88,
+	0xDC, 0xC8, 0x1D, 0x00, 0x00, 0x80, 0xBB, 0xBB, 0xBB, 0x7A, 0x01,
+	// 'h'
+	0x00, 0x07, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x42, 0x54, 0x6D, 0x44,
+	0x44, 0x03, 0x00, 0x00, 0x00, 0xA0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFE, 0xEE,
+	0xEE, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x41, 0x44, 0x44, 0x03, 0x00,
+	// 'i'
+	0x00, 0x02, 0x00, 0x00, 0xDA, 0xB0, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x32, 0x30, 0x44, 0x44,
+	0x44, 0x03, 0x00,
+	// 'j'
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x00, 0x65, 0x50, 0x77, 0x77,
+	0x77, 0x77, 0x7D, 0x00, 0xA8, 0x90, 0xCC, 0xCC, 0xCC, 0xBC, 0x07,
+	// 'k'
+	0x00, 0x07, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x42, 0x44, 0x44, 0x9D,
+	0x44, 0x03, 0x00, 0x00, 0x00, 0x00, 0x90, 0xEC, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0x51,
+	0x4E, 0x00, 0x00, 0x00, 0x00, 0x60, 0x2D, 0x00, 0xE5, 0x04, 0x00, 0x00, 0x00, 0xA0, 0x03, 0x00,
+	0x60, 0x0B, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00,
+	// 'l'
+	0x00, 0x02, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x42, 0x44, 0x44, 0x44,
+	0x44, 0x03, 0x00,
+	// 'm'
+	0x00, 0x0B, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x40, 0x6D, 0x44,
+	0x44, 0x03, 0x00, 0x00, 0x00, 0xB0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3A, 0x22, 0x22, 0x02, 0x00, 0x00, 0x00, 0x30, 0xFD, 0xFF,
+	0xFF, 0x0B, 0x00, 0x00, 0x00, 0x30, 0x4B, 0x22, 0x22, 0x01, 0x00, 0x00, 0x00, 0xB0, 0x04, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x5C, 0x44,
+	0x44, 0x03, 0x00, 0x00, 0x00, 0x20, 0xEA, 0xFF, 0xFF, 0x0B, 0x00,
+	// 'n'
+	0x00, 0x07, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x40, 0x6D, 0x44,
+	0x44, 0x03, 0x00, 0x00, 0x00, 0xA0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFE, 0xEE,
+	0xEE, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x41, 0x44, 0x44, 0x03, 0x00,
+	// 'o'
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x8F, 0x55,
+	0xF8, 0x06, 0x00, 0x00, 0x00, 0xC0, 0x06, 0x00, 0x50, 0x0C, 0x00, 0x00, 0x00, 0xE0, 0x02, 0x00,
+	0x20, 0x0E, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x60, 0x0C, 0x00, 0x00, 0x00, 0x50, 0xAF, 0x77,
+	0xFA, 0x05, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xDD, 0x4B, 0x00, 0x00,
+	// 'p'
+	0x00, 0x07, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x50, 0x7D, 0x44,
+	0xD7, 0x46, 0x24, 0x00, 0x00, 0xB0, 0x05, 0x00, 0x40, 0x0B, 0x00, 0x00, 0x00, 0xE0, 0x02, 0x00,
+	0x20, 0x0E, 0x00, 0x00, 0x00, 0xC0, 0x08, 0x00, 0x80, 0x0C, 0x00, 0x00, 0x00, 0x40, 0xCE, 0x99,
+	0xEC, 0x04, 0x00, 0x00, 0x00, 0x00, 0x82, 0xAA, 0x28, 0x00, 0x00,
+	// 'q'
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xFF, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x70, 0x8E, 0x55,
+	0xE8, 0x07, 0x00, 0x00, 0x00, 0xD0, 0x05, 0x00, 0x50, 0x0D, 0x00, 0x00, 0x00, 0xE0, 0x02, 0x00,
+	0x10, 0x0E, 0x00, 0x00, 0x00, 0x90, 0x07, 0x00, 0x70, 0x09, 0x00, 0x00, 0x00, 0x60, 0xCE, 0x88,
+	0xEB, 0x88, 0x58, 0x00, 0x00, 0x80, 0xBB, 0xBB, 0xBB, 0xBB, 0x7B,
+	// 'r'
+	0x00, 0x05, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x40, 0x7D, 0x44,
+	0x44, 0x03, 0x00, 0x00, 0x00, 0xA0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x02, 0x00, 0x00, 0x00, 0x00,
+	// 's'
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x20, 0xEC, 0x08, 0x80, 0x09, 0x00, 0x00, 0x00, 0xB0, 0x59, 0x3F,
+	0x30, 0x0D, 0x00, 0x00, 0x00, 0xE0, 0x02, 0x7B, 0x10, 0x0E, 0x00, 0x00, 0x00, 0xE0, 0x02, 0xB7,
+	0x30, 0x0D, 0x00, 0x00, 0x00, 0xC0, 0x05, 0xF3, 0xC9, 0x09, 0x00, 0x00, 0x00, 0x30, 0x03, 0x50,
+	0x8B, 0x01, 0x00,
+	// 't'
+	0x00, 0x05, 0x00, 0x00, 0x10, 0xC1, 0x14, 0x11, 0x01, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF,
+	0xEF, 0x04, 0x00, 0x00, 0x20, 0xC2, 0x25, 0x22, 0x92, 0x0A, 0x00, 0x00, 0x00, 0xB0, 0x03, 0x00,
+	0x40, 0x0B, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x30, 0x08, 0x00,
+	// 'u'
+	0x00, 0x07, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xAE, 0x02, 0x00, 0x00, 0x00, 0x30, 0x44, 0x44,
+	0xC5, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0x04, 0x00, 0x00, 0x00, 0xB0, 0xEE, 0xEE,
+	0xFF, 0x0B, 0x00, 0x00, 0x00, 0x30, 0x44, 0x44, 0x44, 0x03, 0x00,
+	// 'v'
+	0x00, 0x08, 0x00, 0x00, 0x00, 0xA0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFC, 0x6C,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xD8, 0xAE, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xD4, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xEE, 0x07, 0x00, 0x00, 0x00, 0x20, 0xD7, 0xBF,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x7D, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'w'
+	0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x6A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xC8, 0xDF,
+	0x59, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xFA, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x41, 0xC8,
+	0xBE, 0x06, 0x00, 0x00, 0x00, 0x90, 0xCF, 0x48, 0x01, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xBE, 0x37,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xD9, 0xAE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41,
+	0xFA, 0x0B, 0x00, 0x00, 0x00, 0x30, 0xB7, 0xEF, 0x7B, 0x02, 0x00, 0x00, 0x00, 0xB0, 0x7B, 0x04,
+	0x00, 0x00, 0x00,
+	// 'x'
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0xA0, 0x2C, 0x00,
+	0xE5, 0x08, 0x00, 0x00, 0x00, 0x10, 0xEA, 0x95, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0xDB, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x70, 0x7F, 0x10,
+	0xE9, 0x05, 0x00, 0x00, 0x00, 0xA0, 0x03, 0x00, 0x50, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00,
+	// 'y'
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x90, 0x17, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x50, 0xFC, 0x4A,
+	0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x30, 0xE9, 0x6D, 0x51, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0xF8, 0xEF, 0x08, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xCF, 0x16, 0x00, 0x00, 0x00, 0x20, 0xD7, 0x9E,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x6C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'z'
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x90, 0x03, 0x00, 0xC2, 0x0B, 0x00, 0x00, 0x00, 0xB0, 0x04, 0x30,
+	0xCE, 0x0B, 0x00, 0x00, 0x00, 0xB0, 0x04, 0xE5, 0x47, 0x0B, 0x00, 0x00, 0x00, 0xB0, 0x74, 0x5E,
+	0x40, 0x0B, 0x00, 0x00, 0x00, 0xB0, 0xEC, 0x03, 0x40, 0x0B, 0x00, 0x00, 0x00, 0xB0, 0x2D, 0x00,
+	0x40, 0x0B, 0x00,
+	// '{'
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x6F,
+	0x00, 0x00, 0x00, 0x00, 0xB2, 0xED, 0xFE, 0xF9, 0xEE, 0xCE, 0x05, 0x00, 0xB8, 0x55, 0x35, 0x20,
+	0x55, 0x85, 0x0D, 0x00, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x04,
+	// '|'
+	0x00, 0x02, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22,
+	// '}'
+	0x00, 0x06, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x89, 0x01, 0x00, 0x00,
+	0x00, 0x40, 0x0E, 0x00, 0xF4, 0xFF, 0xDF, 0xC5, 0xFF, 0xFF, 0x08, 0x00, 0x10, 0x33, 0x73, 0xAE,
+	0x34, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+	0x00, 0x00, 0x00,
+	// '~'
+	0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x10, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0B,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0B,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2E,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x00, 0x00,
+};
+
+// End
@@ -0,0 +1,124 @@
+/*
+ * HostDisplay.cpp
+ *
+ * Created: 19/10/2026 11:20:54
+ *
+ * Host build only. Runs the firmware's display code against a model of the display controller and writes an image of each screen.
+ *
+ * Usage: hostdisplay [-o directory] [-f png|ppm] [-i]
+ *   -o	where to write the images, default the current directory
+ *   -f	image format, default png
+ *   -i	draw the screens upside down, as after pressing the Invert Y button
+ */
+
+#include <cstdio>
+#include <cstring>
+#include "Configuration.hpp"
+#include "Library/Vector.hpp"
+#include "PanelDue.hpp"
+#include "Fields.hpp"
+#include "MessageLog.hpp"
+#include "HostLcd.hpp"
+#include "HostFirmware.hpp"
+
+static const char *outputDir = ".";
+static bool writePpm = false;
+static DisplayOrientation orientation = DefaultDisplayOrientAdjust;
+
+static bool Snapshot(const char *name)
+{
+	char fileName[256];
+	snprintf(fileName, sizeof(fileName), "%s/%s.%s", outputDir, name, (writePpm) ? "ppm" : "png");
+	const bool ok = (writePpm) ? HostLcd::WritePpm(fileName, orientation) : HostLcd::WritePng(fileName, orientation);
+	if (ok)
+	{
+		printf("%s\n", fileName);
+	}
+	else
+	{
+		fprintf(stderr, "Failed to write %s\n", fileName);
+	}
+	return ok;
+}
+
+struct PopupScreen
+{
+	const char *name;
+	SingleButton **tab;
+	PopupWindow **popup;
+	PixelNumber x, y;
+};
+
+int main(int argc, char **argv)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+		{
+			outputDir = argv[++i];
+		}
+		else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc && (strcmp(argv[i + 1], "png") == 0 || strcmp(argv[i + 1], "ppm") == 0))
+		{
+			writePpm = strcmp(argv[++i], "ppm") == 0;
+		}
+		else if (strcmp(argv[i], "-i") == 0)
+		{
+			orientation = static_cast<DisplayOrientation>(orientation ^ (ReverseX | ReverseY | InvertText | InvertBitmap));
+		}
+		else
+		{
+			fprintf(stderr, "Usage: hostdisplay [-o directory] [-f png|ppm] [-i]\n");
+			return 1;
+		}
+	}
+
+	// Same start-up sequence as the firmware
+	HostLcd::Init(16, 17, 18, DISPLAY_X, DISPLAY_Y);
+	HostFirmware::Start(orientation);
+
+	// Some messages for the console tab
+	static const char * const messages[] = { "Connected", "M104 S200", "Heater 1 reached target temperature", "Done printing file" };
+	for (const char *msg : messages)
+	{
+		HostFirmware::AdvanceTime(1500);
+		MessageLog::BeginNewMessage();
+		MessageLog::AppendMessage(msg);
+		MessageLog::DisplayNewMessage();
+	}
+	MessageLog::UpdateMessages(true);
+
+	bool ok = true;
+	const struct { const char *name; SingleButton **tab; } tabs[] =
+	{
+		{ "control", &tabControl }, { "print", &tabPrint }, { "console", &tabMsg }, { "setup", &tabSetup }
+	};
+	for (const auto& t : tabs)
+	{
+		HostFirmware::ChangeTab(*t.tab);
+		ok = Snapshot(t.name) && ok;
+	}
+
+	const PopupScreen popups[] =
+	{
+		{ "popup-temperature", &tabControl, &setTempPopup, tempPopupX, popupY },
+		{ "popup-move", &tabControl, &movePopup, movePopupX, movePopupY },
+		{ "popup-areyousure", &tabControl, &areYouSurePopup, (DisplayX - areYouSurePopupWidth)/2, (DisplayY - areYouSurePopupHeight)/2 },
+		{ "popup-filelist", &tabPrint, &fileListPopup, fileListPopupX, fileListPopupY },
+		{ "popup-keyboard", &tabMsg, &keyboardPopup, keyboardPopupX, keyboardPopupY },
+		{ "popup-baud", &tabSetup, &baudPopup, fullWidthPopupX, popupY },
+		{ "popup-volume", &tabSetup, &volumePopup, fullWidthPopupX, popupY },
+		{ "popup-language", &tabSetup, &languagePopup, fullWidthPopupX, popupY },
+	};
+	for (const PopupScreen& p : popups)
+	{
+		HostFirmware::ChangeTab(*p.tab);
+		mgr.SetPopup(*p.popup, p.x, p.y);
+		mgr.Refresh(false);
+		ok = Snapshot(p.name) && ok;
+		mgr.ClearPopup();
+	}
+
+	return (ok) ? 0 : 1;
+}
+
+// End
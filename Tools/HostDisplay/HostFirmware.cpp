@@ -0,0 +1,142 @@
+/*
+ * HostFirmware.cpp
+ *
+ * Created: 19/10/2026 11:02:36
+ *
+ * Host build only. Definitions of the firmware globals and services that the display code uses, in place of PanelDue.cpp and the
+ * hardware drivers that the host build doesn't include.
+ */
+
+#include "Configuration.hpp"
+#include "Library/Vector.hpp"
+#include "PanelDue.hpp"
+#include "Fields.hpp"
+#include "MessageLog.hpp"
+#include "Hardware/SysTick.hpp"
+#include "Hardware/SerialIo.hpp"
+#include "Hardware/Buzzer.hpp"
+#include "HostFirmware.hpp"
+
+// The same display and window manager as the firmware
+UTFT lcd(DISPLAY_CONTROLLER, TMode16bit, 16, 17, 18, 19);
+MainWindow mgr;
+RequestTimer filesListTimer(8000, "M20 S2 P/gcodes"), macroListTimer(8000, "M20 S2 P/macros");
+
+uint32_t SystemCoreClock = 64000000;
+
+namespace HostFirmware
+{
+	static uint32_t tickCount = 0;
+
+	// This does the display set-up from InitLcd and main() in PanelDue.cpp, for a printer that we haven't heard from yet
+	void Start(DisplayOrientation orient)
+	{
+		lcd.InitLCD(orient, is24BitLcd);
+		Fields::CreateFields(0);
+		mgr.Refresh(true);
+		currentTab = nullptr;
+
+		MessageLog::Init();
+		Fields::ShowFilesButton();
+		mgr.Show(printProgressBar, false);
+		mgr.Show(timeLeftField, false);
+
+		extrudeButton->Show(false);
+		fanButton->Show(false);
+		for (unsigned int i = 2; i < maxHeaters; ++i)
+		{
+			currentTemps[i]->Show(false);
+			activeTemps[i]->Show(false);
+			standbyTemps[i]->Show(false);
+			extrusionFactors[i - 1]->Show(false);
+		}
+		mgr.Show(standbyTemps[0], false);
+
+		ChangeTab(tabControl);
+	}
+
+	void AdvanceTime(uint32_t ms)
+	{
+		tickCount += ms;
+	}
+
+	// This does the same as ChangeTab in PanelDue.cpp, without the parts that depend on the printer status
+	void ChangeTab(ButtonBase *newTab)
+	{
+		if (newTab != currentTab)
+		{
+			if (currentTab != nullptr)
+			{
+				currentTab->Press(false, 0);
+			}
+			newTab->Press(true, 0);
+			currentTab = newTab;
+			switch (newTab->GetEvent())
+			{
+			case evTabControl:
+				mgr.SetRoot(controlRoot);
+				break;
+			case evTabPrint:
+				mgr.SetRoot(printRoot);
+				break;
+			case evTabMsg:
+				mgr.SetRoot(messageRoot);
+				break;
+			case evTabSetup:
+				mgr.SetRoot(setupRoot);
+				break;
+			default:
+				mgr.SetRoot(commonRoot);
+				break;
+			}
+			mgr.ClearAll();
+		}
+		mgr.Refresh(true);
+	}
+}
+
+uint32_t SystemTick::GetTickCount()
+{
+	return HostFirmware::tickCount;
+}
+
+// Nothing is connected to the serial port or the buzzer
+bool OkToSend()
+{
+	return false;
+}
+
+void SerialIo::SendChar(char /*c*/)
+{
+}
+
+void SerialIo::SendString(const char* array /*s*/)
+{
+}
+
+void Buzzer::Beep(uint32_t /*frequency*/, uint32_t /*ms*/, uint32_t /*volume*/)
+{
+}
+
+void ProcessReceivedValue(const char /*id*/[], const char /*val*/[], int /*index*/)
+{
+}
+
+void ProcessArrayLength(const char /*id*/[], int /*length*/)
+{
+}
+
+void StartReceivedMessage()
+{
+}
+
+void EndReceivedMessage()
+{
+}
+
+// The ASF delay functions end up here
+extern "C" void portable_delay_cycles(unsigned long /*n*/)
+{
+}
+
+// End
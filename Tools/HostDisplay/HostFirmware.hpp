@@ -0,0 +1,24 @@
+/*
+ * HostFirmware.hpp
+ *
+ * Created: 19/10/2026 11:02:36
+ *
+ * Host build only. Stand-ins for the parts of PanelDue.cpp that the host programs need.
+ */
+
+#ifndef HOSTFIRMWARE_H_
+#define HOSTFIRMWARE_H_
+
+#include <cstdint>
+#include "Hardware/DisplayOrientation.hpp"
+
+class ButtonBase;
+
+namespace HostFirmware
+{
+	void Start(DisplayOrientation orient);			// set up the display and fields and show the Control tab, as the firmware does at power up
+	void AdvanceTime(uint32_t ms);				// move the millisecond tick counter on
+	void ChangeTab(ButtonBase *newTab);			// show a tab, as the firmware does when a tab button is pressed
+}
+
+#endif /* HOSTFIRMWARE_H_ */
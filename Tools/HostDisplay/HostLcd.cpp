@@ -0,0 +1,435 @@
+/*
+ * HostLcd.cpp
+ *
+ * Created: 19/10/2026 10:34:12
+ *
+ * Host build only. See HostLcd.hpp.
+ */
+
+#include "HostLcd.hpp"
+#include <cstdio>
+#include <cstring>
+#include "asf.h"
+
+Pio hostPio[2];
+
+namespace HostLcd
+{
+	const unsigned int MaxColumns = 800, MaxLines = 480;
+
+	static uint16_t frame[MaxLines][MaxColumns];		// frame memory, [line][column]
+	static unsigned int numColumns = MaxColumns, numLines = MaxLines;
+	static uint32_t rsMask, wrMask, csMask;
+	static Counts counts;
+
+	// Interface state
+	static bool selected = false, dataMode = false;
+	static uint16_t bus = 0;
+	static bool busWritten = false;			// true if the bus has been written since the last WR pulse
+
+	// Controller state
+	static uint8_t command = 0;
+	static unsigned int numParams = 0;
+	static uint8_t params[6];
+	static unsigned int startColumn, endColumn, startLine, endLine;	// address window
+	static unsigned int column, line;								// write pointer
+	static unsigned int scrollTop, scrollHeight, scrollStart;		// vertical scroll registers
+
+	void Init(unsigned int rsPin, unsigned int wrPin, unsigned int csPin, unsigned int pnumColumns, unsigned int pnumLines)
+	{
+		rsMask = 1u << rsPin;
+		wrMask = 1u << wrPin;
+		csMask = 1u << csPin;
+		numColumns = (pnumColumns < MaxColumns) ? pnumColumns : MaxColumns;
+		numLines = (pnumLines < MaxLines) ? pnumLines : MaxLines;
+		startColumn = startLine = column = line = 0;
+		endColumn = numColumns - 1;
+		endLine = numLines - 1;
+		scrollTop = scrollHeight = scrollStart = 0;
+		ClearFrame();
+		ClearCounts();
+	}
+
+	void ClearFrame()
+	{
+		memset(frame, 0, sizeof(frame));
+	}
+
+	const Counts& GetCounts()
+	{
+		return counts;
+	}
+
+	void ClearCounts()
+	{
+		memset(&counts, 0, sizeof(counts));
+		counts.hash = 0xCBF29CE484222325ULL;
+	}
+
+	static unsigned int Param16(unsigned int index)
+	{
+		return (params[index] << 8) | params[index + 1];
+	}
+
+	// Process one write to the controller
+	static void Write()
+	{
+		if (!dataMode)
+		{
+			++counts.commands;
+			command = bus & 0xFF;
+			numParams = 0;
+			switch (command)
+			{
+			case 0x01:			// soft reset
+				scrollTop = scrollHeight = scrollStart = 0;
+				break;
+			case 0x2C:			// write memory start
+				column = startColumn;
+				line = startLine;
+				break;
+			default:
+				break;
+			}
+			return;
+		}
+
+		++counts.dataWords;
+		if (command == 0x2C || command == 0x3C)
+		{
+			// Write memory. UTFT sets address mode 0x22 so that each column of the window is filled before moving on to the next one.
+			// We assume the 16-bit 565 pixel data format that UTFT selects.
+			++counts.pixels;
+			if (line < numLines && column < numColumns)
+			{
+				frame[line][column] = bus;
+			}
+			if (line == endLine)
+			{
+				line = startLine;
+				column = (column == endColumn) ? startColumn : column + 1;
+			}
+			else
+			{
+				++line;
+			}
+			return;
+		}
+
+		if (numParams < sizeof(params))
+		{
+			params[numParams++] = bus & 0xFF;
+		}
+		switch (command)
+		{
+		case 0x2A:			// set column address
+			if (numParams == 4)
+			{
+				startColumn = Param16(0);
+				endColumn = Param16(2);
+			}
+			break;
+		case 0x2B:			// set page address
+			if (numParams == 4)
+			{
+				startLine = Param16(0);
+				endLine = Param16(2);
+			}
+			break;
+		case 0x33:			// set scroll area
+			if (numParams == 6)
+			{
+				scrollTop = Param16(0);
+				scrollHeight = Param16(2);
+			}
+			break;
+		case 0x37:			// set scroll start
+			if (numParams == 2)
+			{
+				scrollStart = Param16(0);
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	// Return the pixel shown on a line of the panel, taking account of the scroll registers
+	static uint16_t Displayed(unsigned int displayLine, unsigned int displayColumn)
+	{
+		if (scrollHeight != 0 && displayLine >= scrollTop && displayLine < scrollTop + scrollHeight)
+		{
+			displayLine = scrollStart + (displayLine - scrollTop);
+			if (displayLine >= scrollTop + scrollHeight)
+			{
+				displayLine -= scrollHeight;
+			}
+		}
+		return (displayLine < numLines && displayColumn < numColumns) ? frame[displayLine][displayColumn] : 0;
+	}
+
+	// This follows the mapping from display coordinates to SSD1963 columns and pages in UTFT::setXY
+	uint16_t GetPixel(unsigned int x, unsigned int y, DisplayOrientation orient)
+	{
+		if (orient & SwapXY)
+		{
+			return Displayed((orient & ReverseY) ? numLines - 1 - y : y, (orient & ReverseX) ? numColumns - 1 - x : x);
+		}
+		return Displayed((orient & ReverseX) ? numLines - 1 - x : x, (orient & ReverseY) ? numColumns - 1 - y : y);
+	}
+
+	static void GetImageSize(DisplayOrientation orient, unsigned int& width, unsigned int& height)
+	{
+		width = (orient & SwapXY) ? numColumns : numLines;
+		height = (orient & SwapXY) ? numLines : numColumns;
+	}
+
+	// Get one row of the image as 8-bit RGB
+	static void GetImageRow(unsigned int y, unsigned int width, DisplayOrientation orient, uint8_t *rgb)
+	{
+		for (unsigned int x = 0; x < width; ++x)
+		{
+			const uint16_t c = GetPixel(x, y, orient);
+			*rgb++ = ((c >> 11) << 3) | (c >> 13);
+			*rgb++ = (((c >> 5) & 0x3F) << 2) | ((c >> 9) & 0x03);
+			*rgb++ = ((c & 0x1F) << 3) | ((c >> 2) & 0x07);
+		}
+	}
+
+	bool WritePpm(const char *fileName, DisplayOrientation orient)
+	{
+		FILE *f = fopen(fileName, "wb");
+		if (f == nullptr)
+		{
+			return false;
+		}
+		unsigned int width, height;
+		GetImageSize(orient, width, height);
+		fprintf(f, "P6\n%u %u\n255\n", width, height);
+		uint8_t rgb[MaxColumns * 3];
+		for (unsigned int y = 0; y < height; ++y)
+		{
+			GetImageRow(y, width, orient, rgb);
+			fwrite(rgb, 3, width, f);
+		}
+		return fclose(f) == 0;
+	}
+
+	// PNG writing. We don't compress the image data, so that we don't need zlib.
+	static uint32_t crcTable[256];
+
+	static uint32_t Crc(uint32_t crc, const uint8_t *data, size_t length)
+	{
+		if (crcTable[1] == 0)
+		{
+			for (uint32_t n = 0; n < 256; ++n)
+			{
+				uint32_t c = n;
+				for (int k = 0; k < 8; ++k)
+				{
+					c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+				}
+				crcTable[n] = c;
+			}
+		}
+		crc = ~crc;
+		while (length-- != 0)
+		{
+			crc = crcTable[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+		}
+		return ~crc;
+	}
+
+	static void Put32(uint8_t *p, uint32_t v)
+	{
+		p[0] = v >> 24;
+		p[1] = v >> 16;
+		p[2] = v >> 8;
+		p[3] = v;
+	}
+
+	// Write a chunk header. The chunk CRC is accumulated by WriteChunkData.
+	static void WriteChunkHeader(FILE *f, const char *type, uint32_t length, uint32_t& crc)
+	{
+		uint8_t header[8];
+		Put32(header, length);
+		memcpy(header + 4, type, 4);
+		fwrite(header, 1, 8, f);
+		crc = Crc(0, header + 4, 4);
+	}
+
+	static void WriteChunkData(FILE *f, const uint8_t *data, size_t length, uint32_t& crc)
+	{
+		fwrite(data, 1, length, f);
+		crc = Crc(crc, data, length);
+	}
+
+	static void WriteChunkEnd(FILE *f, uint32_t crc)
+	{
+		uint8_t buf[4];
+		Put32(buf, crc);
+		fwrite(buf, 1, 4, f);
+	}
+
+	bool WritePng(const char *fileName, DisplayOrientation orient)
+	{
+		FILE *f = fopen(fileName, "wb");
+		if (f == nullptr)
+		{
+			return false;
+		}
+
+		unsigned int width, height;
+		GetImageSize(orient, width, height);
+		static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+		fwrite(signature, 1, sizeof(signature), f);
+
+		uint32_t crc;
+		uint8_t ihdr[13];
+		Put32(ihdr, width);
+		Put32(ihdr + 4, height);
+		ihdr[8] = 8;					// bit depth
+		ihdr[9] = 2;					// colour type RGB
+		ihdr[10] = ihdr[11] = ihdr[12] = 0;
+		WriteChunkHeader(f, "IHDR", sizeof(ihdr), crc);
+		WriteChunkData(f, ihdr, sizeof(ihdr), crc);
+		WriteChunkEnd(f, crc);
+
+		// The image data is a zlib stream of stored deflate blocks, one block per row. Each row is a filter type byte followed by the pixels.
+		const size_t rowLength = 1 + 3 * width;
+		WriteChunkHeader(f, "IDAT", 2 + height * (5 + rowLength) + 4, crc);
+		static const uint8_t zlibHeader[2] = { 0x78, 0x01 };
+		WriteChunkData(f, zlibHeader, sizeof(zlibHeader), crc);
+		uint32_t adlerA = 1, adlerB = 0;
+		uint8_t row[1 + MaxColumns * 3];
+		for (unsigned int y = 0; y < height; ++y)
+		{
+			row[0] = 0;					// no filter
+			GetImageRow(y, width, orient, row + 1);
+			const uint8_t blockHeader[5] =
+				{ (uint8_t)((y + 1 == height) ? 1 : 0), (uint8_t)rowLength, (uint8_t)(rowLength >> 8), (uint8_t)~rowLength, (uint8_t)(~rowLength >> 8) };
+			WriteChunkData(f, blockHeader, sizeof(blockHeader), crc);
+			WriteChunkData(f, row, rowLength, crc);
+			for (size_t i = 0; i < rowLength; ++i)
+			{
+				adlerA = (adlerA + row[i]) % 65521;
+				adlerB = (adlerB + adlerA) % 65521;
+			}
+		}
+		uint8_t adler[4];
+		Put32(adler, (adlerB << 16) | adlerA);
+		WriteChunkData(f, adler, sizeof(adler), crc);
+		WriteChunkEnd(f, crc);
+
+		WriteChunkHeader(f, "IEND", 0, crc);
+		WriteChunkEnd(f, crc);
+		return fclose(f) == 0;
+	}
+
+	// Pin changes from UTFT, through the ASF functions or the register model
+	static void SetPins(Pio *port, uint32_t mask, bool high)
+	{
+		if (port != PIOA)
+		{
+			return;
+		}
+		if (mask & rsMask)
+		{
+			dataMode = high;
+		}
+		if (mask & csMask)
+		{
+			selected = !high;
+		}
+		if ((mask & wrMask) != 0 && high)
+		{
+			// The controller latches the bus on the rising edge of WR
+			++counts.strobes;
+			if (!busWritten)
+			{
+				++counts.repeats;
+			}
+			busWritten = false;
+			counts.hash = (counts.hash ^ ((selected) ? 0x20000 : 0) ^ ((dataMode) ? 0x10000 : 0) ^ bus) * 0x100000001B3ULL;
+			if (selected)
+			{
+				Write();
+			}
+		}
+	}
+
+	static void SetBus(Pio *port, uint32_t value)
+	{
+		if (port == PIOA)
+		{
+			bus = value & 0xFFFF;
+			busWritten = true;
+		}
+	}
+}
+
+#ifdef PIO_USE_ASF_DRIVER
+
+// The ASF PIO functions that the firmware uses when built with PIO_USE_ASF_DRIVER
+extern "C"
+{
+	void pio_set(Pio *p_pio, const uint32_t ul_mask)
+	{
+		HostLcd::SetPins(p_pio, ul_mask, true);
+	}
+
+	void pio_clear(Pio *p_pio, const uint32_t ul_mask)
+	{
+		HostLcd::SetPins(p_pio, ul_mask, false);
+	}
+
+	void pio_sync_output_write(Pio *p_pio, const uint32_t ul_mask)
+	{
+		HostLcd::SetBus(p_pio, ul_mask);
+	}
+
+	uint32_t pio_configure(Pio * /*p_pio*/, const pio_type_t /*ul_type*/, const uint32_t /*ul_mask*/, const uint32_t /*ul_attribute*/)
+	{
+		return 1;
+	}
+
+	void pio_enable_output_write(Pio * /*p_pio*/, const uint32_t /*ul_mask*/)
+	{
+	}
+}
+
+#else
+
+// The register model that the firmware uses when built without PIO_USE_ASF_DRIVER. Only the data bus pins are enabled for
+// synchronous output, so a write to the output data register sets the bus.
+void HostPioRegister::operator=(uint32_t value)
+{
+	for (Pio& port : hostPio)
+	{
+		if (this == &port.PIO_SODR)
+		{
+			HostLcd::SetPins(&port, value, true);
+		}
+		else if (this == &port.PIO_CODR)
+		{
+			HostLcd::SetPins(&port, value, false);
+		}
+		else if (this == &port.PIO_ODSR)
+		{
+			HostLcd::SetBus(&port, value);
+		}
+	}
+}
+
+uint32_t pio_configure(Pio * /*p_pio*/, const pio_type_t /*ul_type*/, const uint32_t /*ul_mask*/, const uint32_t /*ul_attribute*/)
+{
+	return 1;
+}
+
+void pio_enable_output_write(Pio * /*p_pio*/, const uint32_t /*ul_mask*/)
+{
+}
+
+#endif
+
+// End
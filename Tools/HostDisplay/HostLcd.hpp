@@ -0,0 +1,47 @@
+/*
+ * HostLcd.hpp
+ *
+ * Created: 19/10/2026 10:20:47
+ *
+ * Host build only. A model of the SSD1963 display controller, driven by the pin changes that UTFT makes.
+ * It decodes the command stream into a frame buffer, applies the vertical scroll registers when reading back what the panel shows,
+ * and writes snapshots of the screen as PPM or PNG images.
+ */
+
+#ifndef HOSTLCD_H_
+#define HOSTLCD_H_
+
+#include <cstdint>
+#include "Hardware/DisplayOrientation.hpp"
+
+namespace HostLcd
+{
+	// Bus activity since the last call to ClearCounts
+	struct Counts
+	{
+		unsigned long strobes;			// WR pulses, including any made while the controller was not selected
+		unsigned long commands;			// WR pulses with RS low
+		unsigned long dataWords;		// WR pulses with RS high, i.e. command parameters and pixels
+		unsigned long pixels;			// data words written to frame memory
+		unsigned long repeats;			// WR pulses that repeated the previous bus value without writing it again, as LCD_Write_Again does
+		uint64_t hash;					// hash of CS, RS and the bus at each WR pulse, as one FNV-1a step per pulse, to compare the traffic of two builds
+	};
+
+	// Set up the model. The pin numbers are the ones passed to the UTFT constructor, the sizes are those of the panel in its native orientation.
+	void Init(unsigned int rsPin, unsigned int wrPin, unsigned int csPin, unsigned int numColumns, unsigned int numLines);
+
+	// Clear the frame memory to black
+	void ClearFrame();
+
+	const Counts& GetCounts();
+	void ClearCounts();
+
+	// Return the colour the panel shows at the given position in display coordinates, when UTFT is using orientation 'orient'
+	uint16_t GetPixel(unsigned int x, unsigned int y, DisplayOrientation orient);
+
+	// Write what the panel shows to a binary PPM or a PNG file, as the user would see it when UTFT is using orientation 'orient'
+	bool WritePpm(const char *fileName, DisplayOrientation orient);
+	bool WritePng(const char *fileName, DisplayOrientation orient);
+}
+
+#endif /* HOSTLCD_H_ */
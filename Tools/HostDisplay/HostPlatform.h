@@ -0,0 +1,47 @@
+/*
+ * HostPlatform.h
+ *
+ * Created: 19/10/2026 10:14:05
+ *
+ * Host build only, included ahead of every source file.
+ * The firmware is normally built with PIO_USE_ASF_DRIVER so that all pin changes go through pio_set(), pio_clear() and pio_sync_output_write().
+ * HostLcd.cpp supplies those and decodes what is written to the display. The PIO controllers are replaced by dummies in ordinary memory.
+ * Without PIO_USE_ASF_DRIVER the firmware writes the PIO registers directly, as it does on the SAM3S. Then Pio is replaced by a model of
+ * the registers that the display code uses, and writes to the set, clear and output data registers go to HostLcd.cpp instead.
+ */ 
+
+#ifndef HOSTPLATFORM_H_
+#define HOSTPLATFORM_H_
+
+#include "asf.h"
+
+#ifndef PIO_USE_ASF_DRIVER
+
+struct HostPioRegister
+{
+	void operator=(uint32_t value);
+	operator uint32_t() const { return 0; }		// the pins all read as low
+};
+
+struct HostPio
+{
+	HostPioRegister PIO_SODR, PIO_CODR, PIO_ODSR, PIO_PDSR;
+};
+
+// The ASF functions that are still used to set the pins up take the real Pio, so we need versions that take the model
+#define Pio		HostPio
+uint32_t pio_configure(Pio *p_pio, const pio_type_t ul_type, const uint32_t ul_mask, const uint32_t ul_attribute);
+void pio_enable_output_write(Pio *p_pio, const uint32_t ul_mask);
+
+#endif
+
+#undef PIOA
+#undef PIOB
+extern Pio hostPio[2];
+#define PIOA	(&hostPio[0])
+#define PIOB	(&hostPio[1])
+
+// There is no flash or RAM to choose between
+#define USE_RAM_FUNCTIONS	(0)
+
+#endif /* HOSTPLATFORM_H_ */
@@ -0,0 +1,296 @@
+/*
+ * MeasureCheck.cpp
+ *
+ * Created: 21/10/2026 15:12:40
+ *
+ * Host build only. Checks that measuring text gives the same width as printing it. Random strings of Latin-1 characters, of invalid
+ * UTF-8, of both mixed, and of characters around the edges of the font's character ranges are measured and printed in every font, at
+ * random positions with random right margins, and the width returned by measure() is compared with how far printing moved the text
+ * position. It also checks the lookup of each of the characters around the range edges on its own: the first and last character of
+ * each range, the characters just outside it, one in each gap between ranges, and CJK and astral characters that no font has.
+ * A character the font has must measure the advance in the font's metrics table, or more than nothing if there is no metrics table.
+ * A character beyond Latin-1 that the font doesn't have must measure the same as 0x7F.
+ *
+ * Usage: measurecheck [-i]
+ *   -i	draw the screens upside down, as after pressing the Invert Y button
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "Configuration.hpp"
+#include "Library/Vector.hpp"
+#include "PanelDue.hpp"
+#include "Fields.hpp"
+#include "HostLcd.hpp"
+#include "HostFirmware.hpp"
+
+// Fields.hpp declares the screen's default font, so declare the rest
+extern const uint8_t glcd10x10[], glcd16x16[], glcd19x20[], glcd19x21[], glcd28x32[];
+#if DISPLAY_X == 480
+extern uint8_t glcd28x32c[];
+#else
+extern uint8_t glcd19x21c[];
+#endif
+
+static const struct { const char *name; const uint8_t *font; } fonts[] =
+{
+	{ "glcd10x10", glcd10x10 },
+	{ "glcd16x16", glcd16x16 },
+	{ "glcd19x20", glcd19x20 },
+	{ "glcd19x21", glcd19x21 },
+	{ "glcd19x21c", glcd19x21c },
+	{ "glcd28x32", glcd28x32 },
+	{ "glcd28x32c", glcd28x32c }
+};
+
+enum StringKind { latin1String, invalidString, mixedString, rangeEdgeString, numStringKinds };
+
+// The character ranges of the current font, read from the font data so that they don't depend on UTFT::findGlyph
+struct CodeRange
+{
+	uint32_t first, last, firstGlyph;
+};
+
+static CodeRange ranges[64];
+static size_t numRanges;
+static const uint8_t *metrics;				// the metrics table, or NULL if the font doesn't have one
+static size_t metricsEntrySize;
+
+static uint32_t edgeCodes[4 * 64 + 4];
+static size_t numEdgeCodes;
+
+static void FindRanges(const uint8_t *font)
+{
+	if (font[0] == 0 && (font[6] & FontHasRanges) != 0)
+	{
+		numRanges = font[3] | ((size_t)font[4] << 8);
+		for (size_t i = 0; i < numRanges; ++i)
+		{
+			const uint8_t *range = font + 8 + (6 * i);
+			ranges[i].first = range[0] | ((uint32_t)range[1] << 8);
+			ranges[i].last = range[2] | ((uint32_t)range[3] << 8);
+			ranges[i].firstGlyph = range[4] | ((uint32_t)range[5] << 8);
+		}
+	}
+	else
+	{
+		numRanges = 1;
+		ranges[0].first = font[3];
+		ranges[0].last = font[4];
+		ranges[0].firstGlyph = 0;
+	}
+
+	metrics = NULL;
+	if (font[0] == 0 && (font[6] & FontHasMetrics) != 0)
+	{
+		const CodeRange& lastRange = ranges[numRanges - 1];
+		const size_t numGlyphs = lastRange.firstGlyph + lastRange.last - lastRange.first + 1;
+		metrics = font + 8 + ((font[6] & FontHasRanges) ? 6 * numRanges : 0) + (2 * numGlyphs);
+		metricsEntrySize = 1 + 2 * ((font[1] + 7)/8);
+	}
+
+	numEdgeCodes = 0;
+	for (size_t i = 0; i < numRanges; ++i)
+	{
+		edgeCodes[numEdgeCodes++] = ranges[i].first;
+		edgeCodes[numEdgeCodes++] = ranges[i].last;
+		if (ranges[i].first > 0x20)
+		{
+			edgeCodes[numEdgeCodes++] = ranges[i].first - 1;
+		}
+		edgeCodes[numEdgeCodes++] = ranges[i].last + 1;
+		if (i + 1 < numRanges && ranges[i + 1].first > ranges[i].last + 2)
+		{
+			edgeCodes[numEdgeCodes++] = (ranges[i].last + ranges[i + 1].first)/2;
+		}
+	}
+	edgeCodes[numEdgeCodes++] = 0x4E2D;
+	edgeCodes[numEdgeCodes++] = 0xFFFD;
+	edgeCodes[numEdgeCodes++] = 0x1F600;
+	edgeCodes[numEdgeCodes++] = 0x10FFFF;
+}
+
+// Return the number of the glyph for a character, or -1 if the font doesn't have it
+static int FindGlyph(uint32_t c)
+{
+	for (size_t i = 0; i < numRanges; ++i)
+	{
+		if (c >= ranges[i].first && c <= ranges[i].last)
+		{
+			return (int)(ranges[i].firstGlyph + c - ranges[i].first);
+		}
+	}
+	return -1;
+}
+
+// Append a character to a string as UTF-8, returning the new length
+static size_t AppendUtf8(char *s, size_t len, uint32_t c)
+{
+	if (c < 0x80)
+	{
+		s[len++] = (char)c;
+	}
+	else if (c < 0x800)
+	{
+		s[len++] = (char)(0xC0 | (c >> 6));
+		s[len++] = (char)(0x80 | (c & 0x3F));
+	}
+	else if (c < 0x10000)
+	{
+		s[len++] = (char)(0xE0 | (c >> 12));
+		s[len++] = (char)(0x80 | ((c >> 6) & 0x3F));
+		s[len++] = (char)(0x80 | (c & 0x3F));
+	}
+	else
+	{
+		s[len++] = (char)(0xF0 | (c >> 18));
+		s[len++] = (char)(0x80 | ((c >> 12) & 0x3F));
+		s[len++] = (char)(0x80 | ((c >> 6) & 0x3F));
+		s[len++] = (char)(0x80 | (c & 0x3F));
+	}
+	return len;
+}
+
+// Append something that isn't valid UTF-8: a stray continuation byte, a sequence cut short, a byte that can't start a sequence,
+// or a Latin-1 character written as one byte. Returns the new length.
+static size_t AppendInvalid(char *s, size_t len)
+{
+	switch (rand() % 4)
+	{
+	case 0:
+		s[len++] = (char)(0x80 + rand() % 0x40);
+		break;
+
+	case 1:
+		{
+			static const uint8_t leadBytes[] = { 0xC3, 0xE2, 0xF0, 0xF8, 0xFC };
+			const uint8_t lead = leadBytes[rand() % sizeof(leadBytes)];
+			s[len++] = (char)lead;
+			const unsigned int numContinuationBytes = rand() % ((lead == 0xC3) ? 1 : (lead == 0xE2) ? 2 : (lead == 0xF0) ? 3 : (lead == 0xF8) ? 4 : 5);
+			for (unsigned int i = 0; i < numContinuationBytes; ++i)
+			{
+				s[len++] = (char)(0x80 + rand() % 0x40);
+			}
+		}
+		break;
+
+	case 2:
+		s[len++] = (char)(0xFE + rand() % 2);
+		break;
+
+	default:
+		s[len++] = (char)(0xA0 + rand() % 0x60);
+		break;
+	}
+	return len;
+}
+
+static void RandomString(char *s, StringKind kind)
+{
+	const unsigned int numParts = 1 + rand() % 40;
+	size_t len = 0;
+	for (unsigned int i = 0; i < numParts; ++i)
+	{
+		if (kind == invalidString || (kind == mixedString && rand() % 3 == 0))
+		{
+			len = AppendInvalid(s, len);
+		}
+		else if (kind == rangeEdgeString && rand() % 2 == 0)
+		{
+			len = AppendUtf8(s, len, edgeCodes[rand() % numEdgeCodes]);
+		}
+		else
+		{
+			len = AppendUtf8(s, len, 0x20 + rand() % (0x100 - 0x20));
+		}
+	}
+	s[len] = 0;
+}
+
+static const char * const kindNames[] = { "Latin-1", "invalid UTF-8", "mixed", "range edge" };
+
+int main(int argc, char **argv)
+{
+	DisplayOrientation orientation = DefaultDisplayOrientAdjust;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "-i") == 0)
+		{
+			orientation = static_cast<DisplayOrientation>(orientation ^ (ReverseX | ReverseY | InvertText | InvertBitmap));
+		}
+		else
+		{
+			fprintf(stderr, "Usage: measurecheck [-i]\n");
+			return 1;
+		}
+	}
+
+	HostLcd::Init(16, 17, 18, DISPLAY_X, DISPLAY_Y);
+	HostFirmware::Start(orientation);
+
+	srand(7);
+	unsigned int numChecks = 0, numFailures = 0;
+	for (size_t f = 0; f < sizeof(fonts)/sizeof(fonts[0]); ++f)
+	{
+		if (!lcd.setFont(fonts[f].font))
+		{
+			++numFailures;
+			printf("%s: setFont failed\n", fonts[f].name);
+			continue;
+		}
+
+		FindRanges(fonts[f].font);
+		char s[40 * 6 + 1];
+		s[AppendUtf8(s, 0, 0x7F)] = 0;
+		const uint16_t replacementWidth = lcd.measure(s);
+		for (size_t i = 0; i < numEdgeCodes; ++i)
+		{
+			s[AppendUtf8(s, 0, edgeCodes[i])] = 0;
+			const uint16_t width = lcd.measure(s);
+			const int glyphNumber = FindGlyph(edgeCodes[i]);
+			++numChecks;
+			if ((glyphNumber < 0) ? width != ((edgeCodes[i] >= 0x100) ? replacementWidth : 0)
+					: (metrics != NULL) ? width != metrics[metricsEntrySize * glyphNumber]
+						: width == 0)
+			{
+				++numFailures;
+				printf("%s, character %04x (glyph %d): measured %u\n", fonts[f].name, (unsigned int)edgeCodes[i], glyphNumber, width);
+			}
+		}
+
+		for (unsigned int trial = 0; trial < 800; ++trial)
+		{
+			const StringKind kind = static_cast<StringKind>(trial % numStringKinds);
+			RandomString(s, kind);
+
+			// Measuring starts at 0 and printing at x, so the right margin for printing is x + margin. Sometimes use the default
+			// margins, which both stop at the edge of the display, so print those from 0.
+			const bool defaultMargin = (rand() % 8 == 0);
+			const uint16_t x = (defaultMargin) ? 0 : rand() % (DisplayX - 1);
+			const uint16_t y = rand() % (DisplayY - lcd.getFontHeight());
+			const uint16_t margin = (defaultMargin) ? 9999 : 1 + rand() % (DisplayX - x);
+			const uint16_t rightMargin = (defaultMargin) ? 9999 : x + margin;
+
+			const uint16_t width = lcd.measure(s, margin);
+			lcd.print(s, x, y, rightMargin);
+			const uint16_t printed = lcd.getTextX() - x;
+			++numChecks;
+			if (width != printed)
+			{
+				++numFailures;
+				printf("%s, %s string %u at x=%u with margin %u: measured %u, printed %u:", fonts[f].name, kindNames[kind], trial, x, margin, width, printed);
+				for (const char *p = s; *p != 0; ++p)
+				{
+					printf(" %02x", (unsigned int)(uint8_t)*p);
+				}
+				printf("\n");
+			}
+		}
+	}
+
+	printf("measurecheck: %u checks, %u failed\n", numChecks, numFailures);
+	return (numFailures == 0) ? 0 : 1;
+}
+
+// End
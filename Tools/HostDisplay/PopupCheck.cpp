@@ -0,0 +1,165 @@
+/*
+ * PopupCheck.cpp
+ *
+ * Created: 20/10/2026 10:54:19
+ *
+ * Host build only. Checks that closing a popup, which redraws only the area it covered, leaves the screen the same as a full redraw.
+ * Each popup is opened and closed over the tab that it belongs to. This happens with nothing changed, with fields under the popup changed
+ * while it was open, and with fields that stick out from under it changed. A nested popup is also checked.
+ *
+ * Usage: popupcheck [-i]
+ *   -i	draw the screens upside down, as after pressing the Invert Y button
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "Configuration.hpp"
+#include "Library/Vector.hpp"
+#include "PanelDue.hpp"
+#include "Fields.hpp"
+#include "HostLcd.hpp"
+#include "HostFirmware.hpp"
+
+static DisplayOrientation orientation = DefaultDisplayOrientAdjust;
+static unsigned int numChecks = 0, numFailures = 0;
+
+static std::vector<uint16_t> GrabScreen()
+{
+	std::vector<uint16_t> pixels;
+	pixels.reserve(DisplayX * DisplayY);
+	for (unsigned int y = 0; y < DisplayY; ++y)
+	{
+		for (unsigned int x = 0; x < DisplayX; ++x)
+		{
+			pixels.push_back(HostLcd::GetPixel(x, y, orientation));
+		}
+	}
+	return pixels;
+}
+
+// Compare the screen with what it should be, and report how many pixels are wrong
+static void Check(const std::vector<uint16_t>& wanted, const char *popup, const char *what)
+{
+	const std::vector<uint16_t> pixels = GrabScreen();
+	unsigned int numWrong = 0;
+	for (size_t i = 0; i < pixels.size(); ++i)
+	{
+		if (pixels[i] != wanted[i])
+		{
+			++numWrong;
+		}
+	}
+	++numChecks;
+	if (numWrong != 0)
+	{
+		++numFailures;
+		printf("closing the %s popup %s: %u pixels differ\n", popup, what, numWrong);
+	}
+}
+
+// Compare the screen with a full redraw of it
+static void CheckFullRedraw(const char *popup, const char *what)
+{
+	const std::vector<uint16_t> pixels = GrabScreen();
+	mgr.ClearAll();
+	mgr.Refresh(true);
+	const std::vector<uint16_t> redrawn = GrabScreen();
+	++numChecks;
+	if (pixels != redrawn)
+	{
+		++numFailures;
+		printf("closing the %s popup %s: the screen differs from a full redraw\n", popup, what);
+	}
+}
+
+static void SetFields(float temperature, float position, const char *fileName, const char *status)
+{
+	currentTemps[1]->SetValue(temperature);
+	activeTemps[0]->SetValue(temperature/4);
+	xPos->SetValue(position);
+	nameField->SetValue(fileName);
+	statusField->SetValue(status);
+	mgr.Refresh(false);
+}
+
+int main(int argc, char **argv)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "-i") == 0)
+		{
+			orientation = static_cast<DisplayOrientation>(orientation ^ (ReverseX | ReverseY | InvertText | InvertBitmap));
+		}
+		else
+		{
+			fprintf(stderr, "Usage: popupcheck [-i]\n");
+			return 1;
+		}
+	}
+
+	HostLcd::Init(16, 17, 18, DISPLAY_X, DISPLAY_Y);
+	HostFirmware::Start(orientation);
+
+	const PixelNumber areYouSureX = (DisplayX - areYouSurePopupWidth)/2, areYouSureY = (DisplayY - areYouSurePopupHeight)/2;
+	const struct { const char *name; SingleButton **tab; PopupWindow **popup; PixelNumber x, y; } popups[] =
+	{
+		{ "temperature", &tabControl, &setTempPopup, tempPopupX, popupY },
+		{ "move", &tabControl, &movePopup, movePopupX, movePopupY },
+		{ "are you sure", &tabControl, &areYouSurePopup, areYouSureX, areYouSureY },
+		{ "file list", &tabPrint, &fileListPopup, fileListPopupX, fileListPopupY },
+		{ "are you sure", &tabPrint, &areYouSurePopup, areYouSureX, areYouSureY },
+		{ "keyboard", &tabMsg, &keyboardPopup, keyboardPopupX, keyboardPopupY },
+		{ "baud", &tabSetup, &baudPopup, fullWidthPopupX, popupY },
+		{ "volume", &tabSetup, &volumePopup, fullWidthPopupX, popupY },
+		{ "language", &tabSetup, &languagePopup, fullWidthPopupX, popupY },
+		{ "are you sure", &tabSetup, &areYouSurePopup, areYouSureX, areYouSureY },
+	};
+
+	for (const auto& p : popups)
+	{
+		HostFirmware::ChangeTab(*p.tab);
+		const std::vector<uint16_t> before = GrabScreen();
+		mgr.SetPopup(*p.popup, p.x, p.y);
+		mgr.Refresh(false);
+		mgr.ClearPopup();
+		mgr.Refresh(false);
+		Check(before, p.name, "with nothing changed");
+
+		// Temperatures and positions under the popup change while it is open
+		mgr.SetPopup(*p.popup, p.x, p.y);
+		mgr.Refresh(false);
+		SetFields(123.4, 12.3, "", "Idle");
+		mgr.ClearPopup();
+		mgr.Refresh(false);
+		CheckFullRedraw(p.name, "after fields under it changed");
+
+		// The file name and status fields stick out from under the file list popup, as when a print is started from it
+		mgr.SetPopup(*p.popup, p.x, p.y);
+		mgr.Refresh(false);
+		SetFields(20.0, 0.0, "a-much-longer-file-name.gcode", "Printing");
+		mgr.ClearPopup();
+		mgr.Refresh(false);
+		CheckFullRedraw(p.name, "after fields partly under it changed");
+	}
+
+	// The file information popup on top of the file list
+	HostFirmware::ChangeTab(tabPrint);
+	const std::vector<uint16_t> withoutPopups = GrabScreen();
+	mgr.SetPopup(fileListPopup, fileListPopupX, fileListPopupY);
+	mgr.Refresh(false);
+	const std::vector<uint16_t> withFileList = GrabScreen();
+	mgr.SetPopup(filePopup, (DisplayX - fileInfoPopupWidth)/2, (DisplayY - fileInfoPopupHeight)/2);
+	mgr.Refresh(false);
+	mgr.ClearPopup();
+	mgr.Refresh(false);
+	Check(withFileList, "file information", "on top of the file list");
+	mgr.ClearPopup();
+	mgr.Refresh(false);
+	Check(withoutPopups, "file list", "from under the file information popup");
+
+	printf("popupcheck: %u checks, %u failed\n", numChecks, numFailures);
+	return (numFailures == 0) ? 0 : 1;
+}
+
+// End
@@ -0,0 +1,571 @@
+/*
+ * RenderBench.cpp
+ *
+ * Created: 19/10/2026 14:05:19
+ *
+ * Host build only. Runs the firmware's display code through a set of typical UI operations, counts the display bus traffic that
+ * each one generates, and estimates how long that traffic takes on the SAM3S. The report is JSON so that it can be compared between builds.
+ * The estimate only covers the bus writes, not the time the processor spends deciding what to write.
+ * The report ends with how often the button skin cache had the background of a button that was drawn, and how often the glyph cache
+ * had the glyph of a character that was drawn, over all the scenarios and over the printing status polls.
+ * With -t the report also gives the host processor time for redrawing each tab, pressing buttons, redrawing with a clip rectangle,
+ * printing and measuring text, refreshing when nothing has changed, and finding which button a touch selects. That isn't the time on
+ * the SAM3S and it varies from run to run, so it isn't in the saved reports, but comparing it between builds shows changes to the work
+ * of deciding what to write.
+ *
+ * Usage: renderbench [-o file] [-c command,data,repeat] [-m MHz] [-t repeats]
+ *   -o	where to write the report, default standard output
+ *   -c	processor cycles for each command write, data write and repeated data write, default 14,10,4
+ *   -m	processor clock frequency, default 64
+ *   -t	time this many runs of each timed operation on the host, and report the fastest
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "Configuration.hpp"
+#include "Library/Vector.hpp"
+#include "PanelDue.hpp"
+#include "Fields.hpp"
+#include "MessageLog.hpp"
+#include "HostLcd.hpp"
+#include "HostFirmware.hpp"
+
+// Cost model. A command or data write sets up RS and the data bus and pulses WR; a repeated write only pulses WR.
+static unsigned int cyclesPerCommand = 14, cyclesPerData = 10, cyclesPerRepeat = 4;
+static unsigned int clockMHz = 64;
+static unsigned int timingRepeats = 0;
+
+static FILE *report = stdout;
+static bool firstScenario = true;
+static uint32_t pollGlyphHits = 0, pollGlyphMisses = 0;		// glyph cache lookups during the printing status polls
+
+// Write one scenario to the report. 'operations' is the number of UI operations that the bus activity since the last ClearCounts covers.
+static void Record(const char *name, unsigned int operations)
+{
+	const HostLcd::Counts& c = HostLcd::GetCounts();
+	const unsigned long dataWrites = c.dataWords - c.repeats;
+	const unsigned long long cycles = (unsigned long long)c.commands * cyclesPerCommand
+									+ (unsigned long long)dataWrites * cyclesPerData
+									+ (unsigned long long)c.repeats * cyclesPerRepeat;
+	const double microseconds = (double)cycles/clockMHz;
+	fprintf(report,
+			"%s\n    { \"name\": \"%s\", \"operations\": %u, \"commands\": %lu, \"dataWords\": %lu, \"pixels\": %lu, \"strobes\": %lu, \"repeats\": %lu, "
+			"\"pixelsPerOperation\": %.1f, \"cycles\": %llu, \"microseconds\": %.1f, \"microsecondsPerOperation\": %.1f }",
+			(firstScenario) ? "" : ",", name, operations, c.commands, c.dataWords, c.pixels, c.strobes, c.repeats,
+			(double)c.pixels/operations, cycles, microseconds, microseconds/operations);
+	firstScenario = false;
+	HostLcd::ClearCounts();
+}
+
+// Find the key on the keyboard popup that types character 'c'
+static ButtonBase *FindKey(char c)
+{
+	for (DisplayField *f = keyboardPopup->GetRoot(); f != nullptr; f = f->next)
+	{
+		if (f->IsButton() && f->GetEvent() == evKey)
+		{
+			ButtonBase * const b = static_cast<ButtonBase*>(f);
+			if (b->GetIParam(0) == (int)c)
+			{
+				return b;
+			}
+		}
+	}
+	return nullptr;
+}
+
+static void BenchTabs()
+{
+	const struct { const char *name; SingleButton **tab; } tabs[] =
+	{
+		{ "tab-control", &tabControl }, { "tab-print", &tabPrint }, { "tab-console", &tabMsg }, { "tab-setup", &tabSetup }
+	};
+	for (const auto& t : tabs)
+	{
+		HostFirmware::ChangeTab((*t.tab == tabControl) ? tabSetup : tabControl);
+		HostLcd::ClearCounts();
+		HostFirmware::ChangeTab(*t.tab);
+		Record(t.name, 1);
+	}
+}
+
+static void BenchPopups()
+{
+	const struct { const char *name; SingleButton **tab; PopupWindow **popup; PixelNumber x, y; } popups[] =
+	{
+		{ "temperature", &tabControl, &setTempPopup, tempPopupX, popupY },
+		{ "move", &tabControl, &movePopup, movePopupX, movePopupY },
+		{ "areyousure", &tabControl, &areYouSurePopup, (DisplayX - areYouSurePopupWidth)/2, (DisplayY - areYouSurePopupHeight)/2 },
+		{ "filelist", &tabPrint, &fileListPopup, fileListPopupX, fileListPopupY },
+		{ "keyboard", &tabMsg, &keyboardPopup, keyboardPopupX, keyboardPopupY },
+		{ "baud", &tabSetup, &baudPopup, fullWidthPopupX, popupY },
+		{ "volume", &tabSetup, &volumePopup, fullWidthPopupX, popupY },
+		{ "language", &tabSetup, &languagePopup, fullWidthPopupX, popupY },
+	};
+	for (const auto& p : popups)
+	{
+		char name[40];
+		HostFirmware::ChangeTab(*p.tab);
+		HostLcd::ClearCounts();
+		mgr.SetPopup(*p.popup, p.x, p.y);
+		mgr.Refresh(false);
+		snprintf(name, sizeof(name), "popup-%s-open", p.name);
+		Record(name, 1);
+
+		mgr.ClearPopup();
+		mgr.Refresh(false);
+		snprintf(name, sizeof(name), "popup-%s-close", p.name);
+		Record(name, 1);
+	}
+}
+
+// Status poll responses while printing, as processed by ProcessReceivedValue in PanelDue.cpp
+static void BenchPrintingPoll()
+{
+	// Put the display into the state it has while printing, as SetStatus does when the status changes to 'P'
+	nameField->SetValue("calibration-cube.gcode");
+	statusField->SetValue("Printing");
+	Fields::ShowPauseButton();
+	mgr.Show(printProgressBar, true);
+	timeLeftField->SetValue("filament 1h 2m, file 1h 5m");
+	mgr.Show(timeLeftField, true);
+	HostFirmware::ChangeTab(tabPrint);
+
+	const unsigned int numPolls = 10;
+	const GlyphCache& glyphCache = lcd.getGlyphCache();
+	pollGlyphHits = glyphCache.GetHits();
+	pollGlyphMisses = glyphCache.GetMisses();
+	HostLcd::ClearCounts();
+	for (unsigned int i = 0; i < numPolls; ++i)
+	{
+		// The temperatures wobble, the head moves, and every few polls the progress and the time left change
+		currentTemps[0]->SetValue(60.0 + 0.1 * (i % 3));
+		currentTemps[1]->SetValue(210.0 + 0.3 * (i % 4));
+		xPos->SetValue(50.0 + 7.3 * i);
+		yPos->SetValue(80.0 - 4.1 * i);
+		zPos->SetValue(2.4 + 0.2 * (i/4));
+		fpFilamentField->SetValue(1200 + 15 * i);
+		if (i % 3 == 0)
+		{
+			printProgressBar->SetPercent(20 + i/3);
+			String<50> timeLeft;
+			timeLeft.sprintf("filament 1h %um, file 1h %um", 2 - i/6, 5 - i/3);
+			timeLeftField->SetValue(timeLeft.c_str());
+		}
+		HostFirmware::AdvanceTime(250);
+		mgr.Refresh(false);
+	}
+	pollGlyphHits = glyphCache.GetHits() - pollGlyphHits;
+	pollGlyphMisses = glyphCache.GetMisses() - pollGlyphMisses;
+	Record("poll-printing", numPolls);
+}
+
+// The temperature readings from the start of a print: the bed and hot end heat up, then hold at their set temperatures.
+// Each reading updates the current temperature field of one heater, which is the most frequent change to the display.
+static void BenchTemperatures()
+{
+	HostFirmware::ChangeTab(tabControl);
+
+	const unsigned int numPolls = 100;
+	float bed = 21.3, hotend = 22.1;
+	uint32_t noise = 12345;
+	HostLcd::ClearCounts();
+	for (unsigned int i = 0; i < numPolls; ++i)
+	{
+		noise = noise * 1103515245u + 12345u;
+		const float wobble = (float)((noise >> 16) % 7) * 0.1 - 0.3;		// the readings settle within 0.3C of the set temperature
+		bed = (bed < 59.0) ? bed + 1.7 : 60.0 + wobble;
+		hotend = (hotend < 205.0) ? hotend + 6.3 : 210.0 + wobble;
+		currentTemps[0]->SetValue(bed);
+		currentTemps[1]->SetValue(hotend);
+		HostFirmware::AdvanceTime(250);
+		mgr.Refresh(false);
+	}
+	Record("temperature-updates", 2 * numPolls);
+}
+
+// Redrawing the part of the Control tab that the move popup covers, with that as the clip rectangle
+static void RedrawClipped()
+{
+	lcd.pushClip(movePopupX, movePopupY, movePopupX + movePopup->GetWidth() - 1, movePopupY + movePopup->GetHeight() - 1);
+	mgr.ClearAll();
+	mgr.Refresh(true);
+	lcd.popClip();
+}
+
+static void BenchClipping()
+{
+	HostFirmware::ChangeTab(tabControl);
+	HostLcd::ClearCounts();
+	RedrawClipped();
+	Record("tab-control-clipped", 1);
+}
+
+// Pressing and releasing each button on the Control tab
+static void PressButtons()
+{
+	for (DisplayField *f = controlRoot; f != nullptr; f = f->next)
+	{
+		if (f->IsButton() && f->IsVisible())
+		{
+			const ButtonPress bp(static_cast<ButtonBase*>(f), 0);
+			mgr.Press(bp, true);
+			mgr.Press(bp, false);
+		}
+	}
+}
+
+static void BenchButtons()
+{
+	HostFirmware::ChangeTab(tabControl);
+
+	unsigned int numButtons = 0;
+	for (DisplayField *f = controlRoot; f != nullptr; f = f->next)
+	{
+		if (f->IsButton() && f->IsVisible())
+		{
+			++numButtons;
+		}
+	}
+	HostLcd::ClearCounts();
+	PressButtons();
+	Record("button-press-release", numButtons);
+}
+
+// Fastest of timingRepeats calls of 'f', in microseconds. The fastest run is the one least disturbed by whatever else the host is doing.
+static double Time(void (*f)())
+{
+	double fastest = 0.0;
+	for (unsigned int i = 0; i < timingRepeats; ++i)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		f();
+		const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+		if (i == 0 || elapsed.count() < fastest)
+		{
+			fastest = elapsed.count();
+		}
+	}
+	return fastest;
+}
+
+static void RedrawFull()
+{
+	mgr.ClearAll();
+	mgr.Refresh(true);
+}
+
+// The same with a clip rectangle that covers the whole display, which shows what checking for clipping costs
+static void RedrawClippedToDisplay()
+{
+	lcd.pushClip(0, 0, DisplayX - 1, DisplayY - 1);
+	mgr.ClearAll();
+	mgr.Refresh(true);
+	lcd.popClip();
+}
+
+// Host processor time for full redraws of each tab, as when a popup over the whole tab is closed, for pressing and releasing buttons,
+// and for redrawing with a clip rectangle
+static void TimeRedraws()
+{
+	const struct { const char *name; SingleButton **tab; } tabs[] =
+	{
+		{ "tab-control", &tabControl }, { "tab-print", &tabPrint }, { "tab-console", &tabMsg }, { "tab-setup", &tabSetup }
+	};
+	fprintf(report, ",\n  \"hostTimes\": [");
+	for (const auto& t : tabs)
+	{
+		HostFirmware::ChangeTab(*t.tab);
+		const double fastest = Time([]() { mgr.Refresh(true); });
+		fprintf(report, "%s\n    { \"name\": \"%s\", \"operations\": %u, \"fastestMicroseconds\": %.1f }",
+				(*t.tab == tabControl) ? "" : ",", t.name, timingRepeats, fastest);
+	}
+
+	HostFirmware::ChangeTab(tabControl);
+	const struct { const char *name; void (*f)(); } others[] =
+	{
+		{ "button-press-release", PressButtons }, { "tab-control-cleared", RedrawFull },
+		{ "tab-control-clipped-to-display", RedrawClippedToDisplay }, { "tab-control-clipped", RedrawClipped }
+	};
+	for (const auto& o : others)
+	{
+		fprintf(report, ",\n    { \"name\": \"%s\", \"operations\": %u, \"fastestMicroseconds\": %.1f }", o.name, timingRepeats, Time(o.f));
+	}
+	fprintf(report, "\n  ]");
+}
+
+// Printing the kind of text that the status fields show, a line at a time
+extern const uint8_t glcd19x21[], glcd28x32[];		// the old format fonts, which the firmware doesn't use
+extern const uint8_t dejavu16_1bpp[], dejavu16_2bpp[], dejavu16_4bpp[];		// the same characters at 1, 2 and 4 bits per pixel, from Fonts/
+
+// Text to print. Status text is the kind that the status fields show, which the glyph cache holds. The printable ASCII characters
+// are more than the glyph cache holds, so printing them in turn decodes every glyph from the font.
+static const char * const statusLines[] =
+{
+	"210.3 60.1 -12.5 100% 0.00", "210.3 60.1 -12.5 100% 0.00", "210.3 60.1 -12.5 100% 0.00", "210.3 60.1 -12.5 100% 0.00",
+	"210.3 60.1 -12.5 100% 0.00", "210.3 60.1 -12.5 100% 0.00", "210.3 60.1 -12.5 100% 0.00", "210.3 60.1 -12.5 100% 0.00",
+	"210.3 60.1 -12.5 100% 0.00", "210.3 60.1 -12.5 100% 0.00"
+};
+static const char * const asciiLines[] =
+{
+	"!\"#$%&'()*+,-./0123456789:;<=>?", "@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_", "`abcdefghijklmnopqrstuvwxyz{|}~",
+	"!\"#$%&'()*+,-./0123456789:;<=>?", "@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_", "`abcdefghijklmnopqrstuvwxyz{|}~"
+};
+static const char * const *textLines;
+static unsigned int numTextLines;
+static const uint8_t *textFont;
+
+static void PrintText()
+{
+	lcd.setFont(textFont);
+	lcd.setColor(white);
+	lcd.setBackColor(black);
+	for (unsigned int i = 0; i < numTextLines; ++i)
+	{
+		lcd.print(textLines[i], 0, i * lcd.getFontHeight(), DisplayX - 1);
+	}
+}
+
+static void MeasureText()
+{
+	lcd.setFont(textFont);
+	for (unsigned int i = 0; i < numTextLines; ++i)
+	{
+		(void)lcd.measure(textLines[i]);
+	}
+}
+
+// Host processor time for printing glyphs, including the bus writes to the display model, and for measuring them.
+// The default font is compared with the GLCD Font Creator font that MakeFont.py made it from, which is in the old fixed-width format,
+// and the 1 bit per pixel font made from DejaVu Sans is compared with the anti-aliased fonts made from it at 2 and 4 bits per pixel.
+static void TimeText()
+{
+	const struct { const char *name; const uint8_t *font; } fonts[] =
+	{
+#if DISPLAY_X == 480
+		{ "glcd19x21c", glcd19x21c }, { "glcd19x21", glcd19x21 },
+#else
+		{ "glcd28x32c", glcd28x32c }, { "glcd28x32", glcd28x32 },
+#endif
+		{ "dejavu16_1bpp", dejavu16_1bpp }, { "dejavu16_2bpp", dejavu16_2bpp }, { "dejavu16_4bpp", dejavu16_4bpp }
+	};
+	const struct { const char *name; const char * const *lines; unsigned int numLines; } texts[] =
+	{
+		{ "status-text", statusLines, sizeof(statusLines)/sizeof(statusLines[0]) },
+		{ "ascii-text", asciiLines, sizeof(asciiLines)/sizeof(asciiLines[0]) },
+	};
+	fprintf(report, ",\n  \"textTimes\": [");
+	bool first = true;
+	for (const auto& t : texts)
+	{
+		textLines = t.lines;
+		numTextLines = t.numLines;
+		unsigned int numGlyphs = 0;
+		for (unsigned int i = 0; i < t.numLines; ++i)
+		{
+			numGlyphs += strlen(t.lines[i]);
+		}
+		for (const auto& f : fonts)
+		{
+			textFont = f.font;
+			const double printing = Time(PrintText), measuring = Time(MeasureText);
+			fprintf(report, "%s\n    { \"name\": \"%s-%s\", \"glyphs\": %u, \"printNanosecondsPerGlyph\": %.0f, \"measureNanosecondsPerGlyph\": %.1f }",
+					(first) ? "" : ",", t.name, f.name, numGlyphs, printing * 1000.0/numGlyphs, measuring * 1000.0/numGlyphs);
+			first = false;
+		}
+	}
+	fprintf(report, "\n  ]");
+}
+
+// Main loop refreshes when nothing has changed, which is what most refreshes are. This is mostly the cost of deciding which fields need drawing.
+const unsigned int RefreshesPerRun = 1000;
+
+static void RefreshUnchanged()
+{
+	for (unsigned int i = 0; i < RefreshesPerRun; ++i)
+	{
+		mgr.Refresh(false);
+	}
+}
+
+// Host processor time for unchanged refreshes of the Control tab with no popup, and of the Print tab with one and with two popups open
+static void TimeIdleRefreshes()
+{
+	fprintf(report, ",\n  \"idleRefreshes\": [");
+	HostFirmware::ChangeTab(tabControl);
+	fprintf(report, "\n    { \"name\": \"refresh-no-popup\", \"refreshes\": %u, \"fastestMicroseconds\": %.1f }",
+			RefreshesPerRun, Time(RefreshUnchanged));
+
+	HostFirmware::ChangeTab(tabPrint);
+	mgr.SetPopup(fileListPopup, fileListPopupX, fileListPopupY);
+	fprintf(report, ",\n    { \"name\": \"refresh-one-popup\", \"refreshes\": %u, \"fastestMicroseconds\": %.1f }",
+			RefreshesPerRun, Time(RefreshUnchanged));
+
+	mgr.SetPopup(filePopup, (DisplayX - fileInfoPopupWidth)/2, (DisplayY - fileInfoPopupHeight)/2);
+	fprintf(report, ",\n    { \"name\": \"refresh-two-popups\", \"refreshes\": %u, \"fastestMicroseconds\": %.1f }",
+			RefreshesPerRun, Time(RefreshUnchanged));
+	mgr.ClearPopup();
+	mgr.ClearPopup();
+	fprintf(report, "\n  ]");
+}
+
+// Looking up the button at each point of a 4-pixel grid over the display, as the firmware does for each touch
+const unsigned int TouchGridStep = 4;
+const unsigned int TouchesPerRun = ((DisplayX + TouchGridStep - 1)/TouchGridStep) * ((DisplayY + TouchGridStep - 1)/TouchGridStep);
+static unsigned int touchesFound;
+
+static void FindTouches()
+{
+	for (PixelNumber y = 0; y < DisplayY; y += TouchGridStep)
+	{
+		for (PixelNumber x = 0; x < DisplayX; x += TouchGridStep)
+		{
+			if (mgr.FindEvent(x, y).IsValid())
+			{
+				++touchesFound;					// so that the compiler can't leave out the lookups
+			}
+		}
+	}
+}
+
+// Host processor time for touch lookups on the Control tab and on the keyboard popup
+static void TimeTouches()
+{
+	fprintf(report, ",\n  \"touchLookups\": [");
+	HostFirmware::ChangeTab(tabControl);
+	double fastest = Time(FindTouches);
+	fprintf(report, "\n    { \"name\": \"touch-control\", \"lookups\": %u, \"fastestMicroseconds\": %.1f, \"lookupsPerSecond\": %.0f }",
+			TouchesPerRun, fastest, TouchesPerRun * 1.0e6/fastest);
+
+	HostFirmware::ChangeTab(tabMsg);
+	mgr.SetPopup(keyboardPopup, keyboardPopupX, keyboardPopupY);
+	fastest = Time(FindTouches);
+	fprintf(report, ",\n    { \"name\": \"touch-keyboard\", \"lookups\": %u, \"fastestMicroseconds\": %.1f, \"lookupsPerSecond\": %.0f }",
+			TouchesPerRun, fastest, TouchesPerRun * 1.0e6/fastest);
+	mgr.ClearPopup();
+	fprintf(report, "\n  ]");
+}
+
+// How well the button skin cache did over all the scenarios
+static void ReportSkinCache()
+{
+	const ButtonSkinCache& cache = ButtonBase::GetSkinCache();
+	fprintf(report, ",\n  \"buttonSkinCache\": { \"entries\": %u, \"hits\": %lu, \"misses\": %lu, \"evictions\": %lu, \"tooBig\": %lu }",
+			ButtonSkinCache::NumEntries, (unsigned long)cache.GetHits(), (unsigned long)cache.GetMisses(),
+			(unsigned long)cache.GetEvictions(), (unsigned long)cache.GetTooBig());
+}
+
+// How well the glyph cache did over all the scenarios, and over the printing status polls
+static void ReportGlyphCache()
+{
+	const GlyphCache& cache = lcd.getGlyphCache();
+	fprintf(report, ",\n  \"glyphCache\": { \"entries\": %u, \"hits\": %lu, \"misses\": %lu, \"printingPollHits\": %lu, \"printingPollMisses\": %lu, "
+			"\"printingPollHitRate\": %.3f }",
+			GlyphCache::NumEntries, (unsigned long)cache.GetHits(), (unsigned long)cache.GetMisses(),
+			(unsigned long)pollGlyphHits, (unsigned long)pollGlyphMisses, (double)pollGlyphHits/(pollGlyphHits + pollGlyphMisses));
+}
+
+// Typing a command on the keyboard popup
+static void BenchKeyboard()
+{
+	HostFirmware::ChangeTab(tabMsg);
+	mgr.SetPopup(keyboardPopup, keyboardPopupX, keyboardPopupY);
+	mgr.Refresh(false);
+
+	static const char * const command = "G28 XY";
+	HostLcd::ClearCounts();
+	unsigned int numKeys = 0;
+	for (const char *p = command; *p != 0; ++p)
+	{
+		ButtonBase * const key = FindKey(*p);
+		if (key != nullptr)
+		{
+			// The firmware processes the touch and updates the command line on the same pass through the main loop
+			const ButtonPress bp(key, 0);
+			mgr.Press(bp, true);
+			userCommandBuffers[currentUserCommandBuffer].add(*p);
+			userCommandField->SetChanged();
+			mgr.Refresh(false);
+			mgr.Press(bp, false);
+			mgr.Refresh(false);
+			++numKeys;
+		}
+	}
+	Record("keyboard-typing", numKeys);
+
+	mgr.ClearPopup();
+	mgr.Refresh(false);
+}
+
+int main(int argc, char **argv)
+{
+	const char *reportFile = nullptr;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+		{
+			reportFile = argv[++i];
+		}
+		else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc
+				 && sscanf(argv[i + 1], "%u,%u,%u", &cyclesPerCommand, &cyclesPerData, &cyclesPerRepeat) == 3)
+		{
+			++i;
+		}
+		else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc && (clockMHz = strtoul(argv[i + 1], nullptr, 10)) != 0)
+		{
+			++i;
+		}
+		else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc && (timingRepeats = strtoul(argv[i + 1], nullptr, 10)) != 0)
+		{
+			++i;
+		}
+		else
+		{
+			fprintf(stderr, "Usage: renderbench [-o file] [-c command,data,repeat] [-m MHz] [-t repeats]\n");
+			return 1;
+		}
+	}
+
+	if (reportFile != nullptr)
+	{
+		report = fopen(reportFile, "w");
+		if (report == nullptr)
+		{
+			fprintf(stderr, "Failed to open %s\n", reportFile);
+			return 1;
+		}
+	}
+
+	HostLcd::Init(16, 17, 18, DISPLAY_X, DISPLAY_Y);
+	HostFirmware::Start(DefaultDisplayOrientAdjust);
+
+	fprintf(report,
+			"{\n  \"display\": { \"width\": %u, \"height\": %u },\n"
+			"  \"model\": { \"clockMHz\": %u, \"cyclesPerCommand\": %u, \"cyclesPerData\": %u, \"cyclesPerRepeat\": %u },\n"
+			"  \"scenarios\": [",
+			DisplayX, DisplayY, clockMHz, cyclesPerCommand, cyclesPerData, cyclesPerRepeat);
+	BenchTabs();
+	BenchPopups();
+	BenchPrintingPoll();
+	BenchTemperatures();
+	BenchKeyboard();
+	BenchButtons();
+	BenchClipping();
+	fprintf(report, "\n  ]");
+	ReportSkinCache();
+	ReportGlyphCache();
+	if (timingRepeats != 0)
+	{
+		TimeRedraws();
+		TimeText();
+		TimeIdleRefreshes();
+		TimeTouches();
+	}
+	fprintf(report, "\n}\n");
+
+	return (fclose(report) == 0) ? 0 : 1;
+}
+
+// End
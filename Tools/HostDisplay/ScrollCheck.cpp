@@ -0,0 +1,139 @@
+/*
+ * ScrollCheck.cpp
+ *
+ * Created: 20/10/2026 14:37:52
+ *
+ * Host build only. Checks the hardware scrolling of the message log. Messages of 1 to 3 lines arrive on the console tab, the times of
+ * the messages are updated, and the keyboard popup is opened and closed now and then. Every few messages, if no popup is open, the panel
+ * as shown through the scroll registers is compared with a full redraw, which cancels the scrolling. It also checks that nothing was drawn across the edge or
+ * the wrap row of the scrolled area, which setXY can't move correctly.
+ *
+ * Usage: scrollcheck [-i]
+ *   -i	draw the screens upside down, as after pressing the Invert Y button
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "Configuration.hpp"
+#include "Library/Vector.hpp"
+#include "PanelDue.hpp"
+#include "Fields.hpp"
+#include "MessageLog.hpp"
+#include "HostLcd.hpp"
+#include "HostFirmware.hpp"
+
+static DisplayOrientation orientation = DefaultDisplayOrientAdjust;
+
+static std::vector<uint16_t> GrabScreen()
+{
+	std::vector<uint16_t> pixels;
+	pixels.reserve(DisplayX * DisplayY);
+	for (unsigned int y = 0; y < DisplayY; ++y)
+	{
+		for (unsigned int x = 0; x < DisplayX; ++x)
+		{
+			pixels.push_back(HostLcd::GetPixel(x, y, orientation));
+		}
+	}
+	return pixels;
+}
+
+// A message of random words, long enough to need up to 3 lines
+static void RandomMessage(char *msg, size_t size)
+{
+	static const char * const words[] = { "M104", "S200", "Heater", "1", "reached", "target", "temperature", "Done", "printing", "file", "ok",
+										  "Error:", "G28", "homing", "X", "Y", "Z", "probe", "triggered", "before", "moving", "down" };
+	const unsigned int numWords = 1 + ((rand() % 4 == 0) ? rand() % 30 : rand() % 5);
+	msg[0] = 0;
+	for (unsigned int i = 0; i < numWords; ++i)
+	{
+		const char *word = words[rand() % (sizeof(words)/sizeof(words[0]))];
+		if (strlen(msg) + strlen(word) + 2 > size)
+		{
+			break;
+		}
+		if (i != 0)
+		{
+			strcat(msg, " ");
+		}
+		strcat(msg, word);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "-i") == 0)
+		{
+			orientation = static_cast<DisplayOrientation>(orientation ^ (ReverseX | ReverseY | InvertText | InvertBitmap));
+		}
+		else
+		{
+			fprintf(stderr, "Usage: scrollcheck [-i]\n");
+			return 1;
+		}
+	}
+
+	HostLcd::Init(16, 17, 18, DISPLAY_X, DISPLAY_Y);
+	HostFirmware::Start(orientation);
+	HostFirmware::ChangeTab(tabMsg);
+
+	srand(5);
+	unsigned int numChecks = 0, numFailures = 0, numScrolled = 0;
+	for (unsigned int step = 0; step < 400; ++step)
+	{
+		HostFirmware::AdvanceTime(rand() % 20000);
+		char msg[200];
+		RandomMessage(msg, sizeof(msg));
+		MessageLog::BeginNewMessage();
+		MessageLog::AppendMessage(msg);
+		MessageLog::DisplayNewMessage();
+		MessageLog::UpdateMessages(false);
+
+		if (rand() % 20 == 0)
+		{
+			if (mgr.HasPopup())
+			{
+				mgr.ClearPopup();
+			}
+			else
+			{
+				mgr.SetPopup(keyboardPopup, keyboardPopupX, keyboardPopupY);
+			}
+		}
+		mgr.Refresh(false);
+
+		// Fields partly covered by a popup aren't refreshed until it closes, so only compare without one
+		if (step % 5 == 4 && !mgr.HasPopup())
+		{
+			if (lcd.isScrolled())
+			{
+				++numScrolled;
+			}
+			const std::vector<uint16_t> shown = GrabScreen();
+			mgr.ClearAll();
+			mgr.Refresh(true);
+			++numChecks;
+			if (GrabScreen() != shown)
+			{
+				++numFailures;
+				printf("step %u: the panel differs from a full redraw\n", step);
+			}
+		}
+	}
+
+	++numChecks;
+	if (lcd.getScrollBoundaryCrossings() != 0)
+	{
+		++numFailures;
+		printf("%u windows were drawn across the edge or wrap row of the scrolled area\n", (unsigned int)lcd.getScrollBoundaryCrossings());
+	}
+
+	printf("scrollcheck: %u checks (%u while scrolled), %u failed\n", numChecks, numScrolled, numFailures);
+	return (numFailures == 0) ? 0 : 1;
+}
+
+// End
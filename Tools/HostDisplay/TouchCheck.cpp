@@ -0,0 +1,106 @@
+/*
+ * TouchCheck.cpp
+ *
+ * Created: 20/10/2026 10:21:37
+ *
+ * Host build only. Checks that DisplayField::FindEvent, which looks up touches in a grid index, finds the same button as checking every
+ * field in the list in turn, as it did before it had the index. Each round shows or hides some fields at random, which makes FindEvent
+ * rebuild its index, then looks up touches over the whole display and a little beyond it for each tab and popup.
+ *
+ * Usage: touchcheck [-i]
+ *   -i	set the display up upside down, as after pressing the Invert Y button
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "Configuration.hpp"
+#include "Library/Vector.hpp"
+#include "PanelDue.hpp"
+#include "Fields.hpp"
+#include "HostLcd.hpp"
+#include "HostFirmware.hpp"
+
+// The button that a touch selects, found by checking every field in the list. This must agree with the touch error limits in Display.cpp.
+static ButtonPress FindEventLinear(PixelNumber x, PixelNumber y, DisplayField * null p)
+{
+	const int maxXerror = 8, maxYerror = 8;
+	int bestError = maxXerror + maxYerror;
+	ButtonPress best;
+	for (; p != nullptr; p = p->next)
+	{
+		if (p->IsVisible() && p->GetEvent() != nullEvent)
+		{
+			const int xError = (x < p->GetMinX()) ? p->GetMinX() - x : (x > p->GetMaxX()) ? x - p->GetMaxX() : 0;
+			const int yError = (y < p->GetMinY()) ? p->GetMinY() - y : (y > p->GetMaxY()) ? y - p->GetMaxY() : 0;
+			if (xError < maxXerror && yError < maxYerror && xError + yError < bestError)
+			{
+				bestError = xError + yError;
+				best = ButtonPress(static_cast<ButtonBase*>(p), 0);
+			}
+		}
+	}
+	return best;
+}
+
+int main(int argc, char **argv)
+{
+	DisplayOrientation orientation = DefaultDisplayOrientAdjust;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "-i") == 0)
+		{
+			orientation = static_cast<DisplayOrientation>(orientation ^ (ReverseX | ReverseY | InvertText | InvertBitmap));
+		}
+		else
+		{
+			fprintf(stderr, "Usage: touchcheck [-i]\n");
+			return 1;
+		}
+	}
+
+	HostLcd::Init(16, 17, 18, DISPLAY_X, DISPLAY_Y);
+	HostFirmware::Start(orientation);
+
+	DisplayField * const lists[] =
+	{
+		controlRoot, printRoot, messageRoot, setupRoot, keyboardPopup->GetRoot(), movePopup->GetRoot(), setTempPopup->GetRoot(),
+		fileListPopup->GetRoot(), baudPopup->GetRoot()
+	};
+	srand(3);
+	unsigned long numChecks = 0, numFailures = 0;
+	for (unsigned int round = 0; round < 10; ++round)
+	{
+		for (DisplayField *list : lists)
+		{
+			for (DisplayField *f = list; f != nullptr; f = f->next)
+			{
+				if (rand() % 8 == 0)
+				{
+					f->Show(!f->IsVisible());
+				}
+			}
+
+			const unsigned int step = 1 + round % 3;
+			for (unsigned int y = 0; y < DisplayY + 20; y += step)
+			{
+				for (unsigned int x = 0; x < DisplayX + 20; x += step)
+				{
+					++numChecks;
+					if (DisplayField::FindEvent(x, y, list) != FindEventLinear(x, y, list))
+					{
+						if (numFailures++ < 10)
+						{
+							printf("round %u: touch at %u,%u finds a different button from checking every field\n", round, x, y);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	printf("touchcheck: %lu checks, %lu failed\n", numChecks, numFailures);
+	return (numFailures == 0) ? 0 : 1;
+}
+
+// End
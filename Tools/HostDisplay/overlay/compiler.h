@@ -0,0 +1,13 @@
+/*
+ * compiler.h
+ *
+ * Created: 19/10/2026 10:12:31
+ *
+ * Host build only. The ASF compiler.h defines min and max as macros, which breaks the C++ library headers.
+ */ 
+
+#include_next <compiler.h>
+#undef min
+#undef max
+
+// End
@@ -0,0 +1,442 @@
+#!/usr/bin/env python3
+#
+# MakeFont.py
+#
+# Converts fonts generated by MikroElektronika GLCD Font Creator (the src/Fonts/glcd*.cpp files) into the
+# compact variable-width font format understood by UTFT::setFont, optionally adding characters rendered from a
+# TrueType font, e.g. Greek and Cyrillic. It can also render a complete font from a TrueType font, including
+# anti-aliased fonts with 2 or 4 bits per pixel.
+#
+# Usage: MakeFont.py [--no-metrics] [--ttf font.ttf --ranges first-last,...] source.cpp output.cpp
+#        MakeFont.py --ttf font.ttf --ranges first-last,... --height pixels [--bpp 1|2|4] [--spaces n] output.cpp
+#        MakeFont.py --report source.cpp...
+#
+# The Greek and Cyrillic characters in the shipped compact fonts are rendered from DejaVu Sans version 2.37, which is
+# not in this repository. It is in the DejaVu fonts 2.37 release from https://dejavu-fonts.github.io/ and in the Debian
+# and Ubuntu package fonts-dejavu-core, which installs it as /usr/share/fonts/truetype/dejavu/DejaVuSans.ttf. The header of
+# each generated font has the SHA-256 hash of the file it was made from, which was the one in fonts-dejavu-core 2.37-6.
+# Run these from src/Fonts to regenerate the fonts:
+#   python3 ../../Tools/MakeFont.py --ttf /usr/share/fonts/truetype/dejavu/DejaVuSans.ttf --ranges 0x384-0x3CE,0x400-0x45F glcd19x21.cpp glcd19x21c.cpp
+#   python3 ../../Tools/MakeFont.py --ttf /usr/share/fonts/truetype/dejavu/DejaVuSans.ttf --ranges 0x384-0x3CE,0x400-0x45F glcd28x32.cpp glcd28x32c.cpp
+# The 168 added characters cost 7284 bytes of flash in glcd19x21c (4.3" builds) and 12288 bytes in glcd28x32c
+# (5" and 7" builds). MakeFont.py prints the cost when it adds TrueType characters. Leave out --ttf and --ranges to build the
+# fonts without them.
+#
+# Compact font layout (all multi-byte values little-endian):
+#   header, 8 bytes:
+#	  0	0x00, which distinguishes this format from the old one (whose first byte is the character width)
+#	  1	row height in pixels
+#	  2	space columns between characters before kerning
+#	  3,4	first and last character codes, or if flag bit 1 is set, the number of entries in the character range table
+#	  5	maximum character width in pixels
+#	  6	flags: bit 0 set if the glyph metrics table is present, bit 1 set if the character range table is present,
+#		bits 2-3 are log2(bits per pixel), so 0 for ordinary 1-bit fonts. Fonts with more than 1 bit per pixel must have
+#		the glyph metrics table.
+#	  7	reserved, 0
+#   character range table (if flag bit 1 is set), sorted by character code, for each range of consecutive characters:
+#	  first character code (16 bits), last character code (16 bits), glyph number of the first character (16 bits)
+#   glyph offset table: one 16-bit offset per glyph, relative to the start of the glyph data
+#   glyph metrics table (if flag bit 0 is set), for each glyph:
+#	  advance (total number of columns including bearings), then the column used for kerning against the previous
+#	  character, then the last ink column; each column is (height + 7)/8 bytes. This lets text be measured without
+#	  reading the glyph data. In anti-aliased fonts these columns have a bit set for each pixel that is at least half
+#	  covered.
+#   glyph data, for each glyph:
+#	  left bearing (blank columns before the ink), number of ink columns, right bearing (blank columns after the ink),
+#	  then the ink columns, each (height * bits per pixel + 7)/8 bytes with the top row in the least significant bits
+#	  of the first byte
+
+import os
+import re
+import sys
+
+HEADER_SIZE = 8
+FLAG_METRICS = 0x01
+FLAG_RANGES = 0x02
+FLAG_BPP_SHIFT = 2
+
+
+class Glyph:
+	def __init__(self, code, columns, bpp=1):
+		self.code = code
+		self.bpp = bpp
+		first = 0
+		while first < len(columns) and columns[first] == 0:
+			first += 1
+		last = len(columns)
+		while last > first and columns[last - 1] == 0:
+			last -= 1
+		self.lsb = first
+		self.ink = columns[first:last]
+		self.rsb = len(columns) - last
+
+	def advance(self):
+		return self.lsb + len(self.ink) + self.rsb
+
+	def mask(self, column):
+		"""Returns a column as a 1-bit mask. For an anti-aliased glyph, pixels that are at least half covered are set."""
+		if self.bpp == 1:
+			return column
+		levelMask = (1 << self.bpp) - 1
+		result = 0
+		row = 0
+		while column != 0:
+			if (column & levelMask) * 2 > levelMask:
+				result |= 1 << row
+			column >>= self.bpp
+			row += 1
+		return result
+
+	def masks(self):
+		return [0] * self.lsb + [self.mask(c) for c in self.ink] + [0] * self.rsb
+
+	def kernColumn(self):
+		# Must match UTFT::getGlyph: a character with a deliberate blank column at the start is kerned against its second column
+		m = self.masks()
+		if not m:
+			return 0
+		return m[0] if m[0] != 0 or len(m) == 1 else m[1]
+
+	def lastColumn(self):
+		return next((c for c in reversed(self.masks()) if c != 0), 0)
+
+
+class Font:
+	ttfDescription = None			# set if any of the glyphs were rendered from a TrueType font
+
+	def ranges(self):
+		"""Returns the runs of consecutive character codes as a list of (first, last, first glyph number)"""
+		result = []
+		for i, g in enumerate(self.glyphs):
+			if result and g.code == result[-1][1] + 1:
+				result[-1][1] = g.code
+			else:
+				result.append([g.code, g.code, i])
+		return result
+
+	def needsRangeTable(self):
+		return len(self.ranges()) > 1 or self.glyphs[-1].code > 0xFF
+
+
+class OldFont(Font):
+	"""A font in the original fixed-width format"""
+
+	bpp = 1
+
+	def __init__(self, path):
+		text = open(path, encoding='latin-1').read()
+		m = re.search(r'const\s+uint8_t\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*)\}', text, re.S)
+		if m is None:
+			raise ValueError("%s: no font array found" % path)
+		self.name = m.group(1)
+		body = m.group(2)
+		hasSpaces = 'space columns' in body
+		body = re.sub(r'//[^\n]*', '', body)
+		data = [int(t, 0) for t in re.findall(r'0[xX][0-9a-fA-F]+|\d+', body)]
+		self.size = len(data)
+
+		if data[0] == 0:
+			raise ValueError("%s: already in compact format" % path)
+		self.x_size = data[0]
+		self.y_size = data[1]
+		if hasSpaces:
+			self.spaces, firstChar, lastChar = data[2:5]
+			pos = 5
+		else:
+			# Older fonts have a 4-byte header with no kerning information
+			self.spaces = 1
+			firstChar, lastChar = data[2:4]
+			pos = 4
+
+		self.bytesPerColumn = self.maskBytes = (self.y_size + 7) // 8
+		bytesPerChar = self.bytesPerColumn * self.x_size + 1
+		self.glyphs = []
+		for code in range(firstChar, lastChar + 1):
+			nCols = data[pos]
+			columns = []
+			for col in range(nCols):
+				start = pos + 1 + col * self.bytesPerColumn
+				columns.append(int.from_bytes(bytes(data[start:start + self.bytesPerColumn]), 'little'))
+			self.glyphs.append(Glyph(code, columns))
+			pos += bytesPerChar
+
+	def glyph(self, code):
+		return next((g for g in self.glyphs if g.code == code), None)
+
+	def inkRows(self, code):
+		"""Returns the top and bottom rows of the ink in a character"""
+		bits = 0
+		for col in self.glyph(code).ink:
+			bits |= col
+		return (bits & -bits).bit_length() - 1, bits.bit_length() - 1
+
+	def addTrueTypeGlyphs(self, ttfPath, ranges):
+		"""Renders the characters in the given ranges that this font lacks from a TrueType font, scaled so that capital
+		letters have the same height and baseline as in this font"""
+		import TrueType
+		ttf = TrueType.TrueTypeFont(ttfPath)
+		self.ttfDescription = ttf.description()
+		top, bottom = self.inkRows(ord('H'))
+		capHeight = ttf.bounds(ord('H'))[3]
+		scale = (bottom - top + 1) / float(capHeight)
+		baseline = bottom + 1
+		existing = set(g.code for g in self.glyphs)
+		for first, last in ranges:
+			for code in range(first, last + 1):
+				if code in existing or code not in ttf.cmap:
+					continue
+				bounds = ttf.bounds(code)
+				if bounds is None:
+					continue		# we don't add blank characters other than the ones the original font has
+				xMin = bounds[0]
+				width = int((bounds[2] - xMin) * scale) + 2
+				coverage = TrueType.rasterise(ttf.contours(ttf.cmap[code]), scale, -xMin * scale, baseline, width, self.y_size)
+				columns = []
+				for col in range(width):
+					columns.append(sum(1 << row for row in range(self.y_size) if coverage[row][col] >= 0.5))
+				glyph = Glyph(code, columns)
+				glyph.lsb = glyph.rsb = 0		# spacing comes from the space columns and kerning, as in the original glyphs
+				self.glyphs.append(glyph)
+		self.glyphs.sort(key=lambda g: g.code)
+
+
+class TrueTypeSourceFont(Font):
+	"""A font rendered entirely from a TrueType font, scaled so that the ascender and descender fit the given height.
+	With more than 1 bit per pixel, each pixel holds the fraction of it covered by the outline."""
+
+	def __init__(self, ttfPath, height, ranges, bpp, spaces):
+		import TrueType
+		ttf = TrueType.TrueTypeFont(ttfPath)
+		self.ttfDescription = ttf.description()
+		self.name = os.path.splitext(os.path.basename(ttfPath))[0]
+		self.y_size = height
+		self.spaces = spaces
+		self.bpp = bpp
+		self.bytesPerColumn = (height * bpp + 7) // 8
+		self.maskBytes = (height + 7) // 8
+		scale = height / float(ttf.ascender - ttf.descender)
+		baseline = ttf.ascender * scale
+		maxLevel = (1 << bpp) - 1
+		self.glyphs = []
+		for first, last in ranges:
+			for code in range(first, last + 1):
+				if code not in ttf.cmap:
+					continue
+				bounds = ttf.bounds(code)
+				if bounds is None:
+					# A blank character such as space, so all we need is its width
+					columns = [0] * max(1, int(round(ttf.advanceWidth(code) * scale)) - spaces)
+				else:
+					xMin = bounds[0]
+					width = int((bounds[2] - xMin) * scale) + 2
+					coverage = TrueType.rasterise(ttf.contours(ttf.cmap[code]), scale, -xMin * scale, baseline, width, height)
+					columns = []
+					for col in range(width):
+						columns.append(sum(min(maxLevel, int(coverage[row][col] * maxLevel + 0.5)) << (row * bpp) for row in range(height)))
+				glyph = Glyph(code, columns, bpp)
+				if bounds is not None:
+					glyph.lsb = glyph.rsb = 0		# spacing comes from the space columns and kerning
+				self.glyphs.append(glyph)
+		if not self.glyphs:
+			raise ValueError("%s: none of the requested characters are in the font" % ttfPath)
+
+
+def charName(code):
+	if code == 0x7F:
+		return 'DEL'
+	if code == 0x5C:
+		return "'\\\\'"
+	if 0x20 <= code < 0x7F:
+		return "'%c'" % code
+	return '0x%02X' % code if code <= 0xFF else 'U+%04X' % code
+
+
+def hexBytes(values):
+	return ', '.join('0x%02X' % v for v in values)
+
+
+def compact(font):
+	"""Returns the offset table and glyph data of the compact form of a font"""
+	offsets = []
+	glyphData = []
+	for g in font.glyphs:
+		offsets.append(sum(len(d) for d in glyphData))
+		d = [g.lsb, len(g.ink), g.rsb]
+		for col in g.ink:
+			d += list(col.to_bytes(font.bytesPerColumn, 'little'))
+		glyphData.append(d)
+	if offsets[-1] > 0xFFFF:
+		raise ValueError("%s: glyph data too large for 16-bit offsets" % font.name)
+	return offsets, glyphData
+
+
+def metrics(font):
+	"""Returns the glyph metrics table of the compact form of a font"""
+	table = []
+	for g in font.glyphs:
+		table.append([g.advance()] + list(g.kernColumn().to_bytes(font.maskBytes, 'little'))
+							+ list(g.lastColumn().to_bytes(font.maskBytes, 'little')))
+	return table
+
+
+def compactSize(font, withMetrics):
+	offsets, glyphData = compact(font)
+	size = HEADER_SIZE + 2 * len(offsets) + sum(len(d) for d in glyphData)
+	if withMetrics:
+		size += sum(len(m) for m in metrics(font))
+	if font.needsRangeTable():
+		size += 6 * len(font.ranges())
+	return size
+
+
+def writeCompact(font, srcPath, outPath, name, withMetrics, command):
+	offsets, glyphData = compact(font)
+	maxWidth = max(g.advance() for g in font.glyphs)
+	ranges = font.ranges()
+	useRanges = font.needsRangeTable()
+	flags = (FLAG_METRICS if withMetrics else 0) | (FLAG_RANGES if useRanges else 0) | ({1: 0, 2: 1, 4: 2}[font.bpp] << FLAG_BPP_SHIFT)
+	out = []
+	out.append('/*')
+	out.append(' * %s' % os.path.basename(outPath))
+	out.append(' *')
+	out.append(' * Generated by Tools/MakeFont.py from %s - do not edit' % os.path.basename(srcPath))
+	out.append(' * Command: MakeFont.py %s' % command)
+	if font.ttfDescription is not None:
+		out.append(' * TrueType font: %s' % font.ttfDescription)
+	out.append(' */')
+	out.append('')
+	out.append('#include <asf.h>')
+	out.append('')
+	out.append('extern const uint8_t %s[] =' % name)
+	out.append('{')
+	out.append('\t0x00,\t// compact font format')
+	out.append('\t%d,\t\t// row height in pixels' % font.y_size)
+	out.append('\t%d,\t\t// space columns between characters before kerning' % font.spaces)
+	if useRanges:
+		out.append('\t0x%02X, 0x%02X,\t// number of character ranges' % (len(ranges) & 0xFF, len(ranges) >> 8))
+	else:
+		out.append('\t0x%02X,\t// first character code' % font.glyphs[0].code)
+		out.append('\t0x%02X,\t// last character code' % font.glyphs[-1].code)
+	out.append('\t%d,\t\t// maximum character width in pixels' % maxWidth)
+	out.append('\t0x%02X,\t// flags' % flags)
+	out.append('\t0x00,\t// reserved')
+	if useRanges:
+		out.append('')
+		out.append('\t// Character ranges: first code, last code, first glyph number')
+		for first, last, index in ranges:
+			out.append('\t%s,\t// %s-%s' % (hexBytes([first & 0xFF, first >> 8, last & 0xFF, last >> 8, index & 0xFF, index >> 8]),
+												charName(first), charName(last)))
+	out.append('')
+	out.append('\t// Glyph offsets')
+	for i in range(0, len(offsets), 8):
+		chunk = offsets[i:i + 8]
+		out.append('\t' + ' '.join('0x%02X, 0x%02X,' % (o & 0xFF, o >> 8) for o in chunk))
+	if withMetrics:
+		out.append('')
+		out.append('\t// Glyph metrics: advance, kerning column, last ink column')
+		for g, m in zip(font.glyphs, metrics(font)):
+			out.append('\t%s,\t// %s' % (hexBytes(m), charName(g.code)))
+	out.append('')
+	if font.bpp == 1:
+		out.append('\t// Glyph data: left bearing, number of ink columns, right bearing, ink columns')
+	else:
+		out.append('\t// Glyph data: left bearing, number of ink columns, right bearing, ink columns (%d bits per pixel)' % font.bpp)
+	for g, d in zip(font.glyphs, glyphData):
+		out.append('\t// %s' % charName(g.code))
+		for i in range(0, len(d), 16):
+			out.append('\t%s,' % hexBytes(d[i:i + 16]))
+	out.append('};')
+	out.append('')
+	out.append('// End')
+	out.append('')
+	with open(outPath, 'w') as f:
+		f.write('\n'.join(out))
+
+
+def parseRanges(text):
+	ranges = []
+	for item in text.split(','):
+		first, _, last = item.partition('-')
+		ranges.append((int(first, 0), int(last or first, 0)))
+	return ranges
+
+
+def main(args):
+	usage = 'Usage: MakeFont.py [--no-metrics] [--ttf font.ttf --ranges first-last,...] source.cpp output.cpp\n' \
+			'       MakeFont.py --ttf font.ttf --ranges first-last,... --height pixels [--bpp 1|2|4] [--spaces n] output.cpp\n' \
+			'       MakeFont.py --report source.cpp...'
+	if args and args[0] == '--report':
+		total = [0, 0, 0]
+		print('%-12s %8s %8s %8s %8s' % ('font', 'old', 'compact', 'saved', 'metrics'))
+		for path in args[1:]:
+			font = OldFont(path)
+			newSize = compactSize(font, False)
+			metricsSize = compactSize(font, True) - newSize
+			print('%-12s %8d %8d %7.1f%% %8d' % (font.name, font.size, newSize, 100.0 * (font.size - newSize) / font.size, metricsSize))
+			total[0] += font.size
+			total[1] += newSize
+			total[2] += metricsSize
+		print('%-12s %8d %8d %7.1f%% %8d' % ('total', total[0], total[1], 100.0 * (total[0] - total[1]) / total[0], total[2]))
+		return 0
+
+	command = ' '.join(os.path.basename(a) if a.endswith(('.cpp', '.ttf')) else a for a in args)
+	withMetrics = True
+	ttfPath = None
+	ranges = []
+	height = None
+	bpp = 1
+	spaces = 1
+	while args and args[0].startswith('--'):
+		if args[0] == '--no-metrics':
+			withMetrics = False
+			args = args[1:]
+		elif args[0] == '--ttf' and len(args) > 1:
+			ttfPath = args[1]
+			args = args[2:]
+		elif args[0] == '--ranges' and len(args) > 1:
+			ranges = parseRanges(args[1])
+			args = args[2:]
+		elif args[0] == '--height' and len(args) > 1:
+			height = int(args[1], 0)
+			args = args[2:]
+		elif args[0] == '--bpp' and len(args) > 1 and args[1] in ('1', '2', '4'):
+			bpp = int(args[1])
+			args = args[2:]
+		elif args[0] == '--spaces' and len(args) > 1:
+			spaces = int(args[1], 0)
+			args = args[2:]
+		else:
+			print(usage)
+			return 1
+	if (ttfPath is None) != (not ranges):
+		print(usage)
+		return 1
+	if height is not None:
+		# Render the whole font from the TrueType font
+		if len(args) != 1 or ttfPath is None or not 4 <= height <= 32:
+			print(usage)
+			return 1
+		if bpp != 1 and not withMetrics:
+			print('Fonts with more than 1 bit per pixel must have glyph metrics')
+			return 1
+		font = TrueTypeSourceFont(ttfPath, height, ranges, bpp, spaces)
+		srcPath = ttfPath
+	else:
+		if len(args) != 2 or bpp != 1:
+			print(usage)
+			return 1
+		font = OldFont(args[0])
+		if ttfPath is not None:
+			oldSize = compactSize(font, withMetrics)
+			font.addTrueTypeGlyphs(ttfPath, ranges)
+			newSize = compactSize(font, withMetrics)
+			print('%s: %d bytes, of which %d are for the characters from %s' % (font.name, newSize, newSize - oldSize, os.path.basename(ttfPath)))
+		srcPath = args[0]
+	outPath = args[-1]
+	name = os.path.splitext(os.path.basename(outPath))[0]
+	writeCompact(font, srcPath, outPath, name, withMetrics, command)
+	return 0
+
+
+if __name__ == '__main__':
+	sys.exit(main(sys.argv[1:]))
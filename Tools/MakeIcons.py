@@ -0,0 +1,230 @@
+#!/usr/bin/env python3
+#
+# MakeIcons.py
+#
+# Converts the icon bitmaps in src/Icons into the compressed icon formats drawn by UTFT::drawCompressedBitmap.
+# The bitmaps must be uncompressed 24-bit or 8-bit palette Windows BMP files. Pure white (0xFFFF after conversion to
+# RGB565) is treated as transparent.
+#
+# Usage: MakeIcons.py [--format auto|rle|indexed] output.cpp IconName=bitmap.bmp...
+#        MakeIcons.py --report output.cpp IconName=bitmap.bmp...
+#
+# Each icon is stored in whichever format is smaller, unless --format says otherwise.
+#
+# Icon layout (all values 16-bit):
+#   width, height, format
+#   if format is 0, the icon is run-length encoded. For each row from top to bottom there is a sequence of runs covering
+#   exactly width pixels. Each run starts with a code word whose top two bits give the run type and whose bottom 14 bits
+#   give the number of pixels:
+#	  0x0000 | n	n transparent pixels
+#	  0x4000 | n	n opaque pixels, followed by their n colours
+#	  0x8000 | n	n opaque pixels of the same colour, followed by that colour
+#   otherwise the icon is palette-indexed. Bits 0-3 of the format are the number of bits per pixel (1, 2, 4 or 8) and
+#   bits 8-15 are the number of palette entries minus 1. The palette follows, one colour per entry, where a 0xFFFF entry
+#   marks transparent pixels. Then come the pixel indices for each row from top to bottom, packed into 16-bit words
+#   starting at the least significant bits, with no padding between rows.
+#
+# --report prints the size of each icon in the old uncompressed format and in each of the compressed formats.
+
+import os
+import struct
+import sys
+
+TRANSPARENT = 0xFFFF
+RUN_SKIP = 0x0000
+RUN_LITERAL = 0x4000
+RUN_REPEAT = 0x8000
+MAX_RUN = 0x3FFF
+FORMAT_RLE = 0
+
+
+def toRgb565(r, g, b):
+	return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def readBmp(path):
+	"""Returns (width, height, rows) where rows is a list of lists of RGB565 colours, top row first"""
+	data = open(path, 'rb').read()
+	if data[0:2] != b'BM':
+		raise ValueError('%s is not a BMP file' % path)
+	pixelOffset = struct.unpack_from('<I', data, 10)[0]
+	headerSize, width, height, _, bitsPerPixel, compression = struct.unpack_from('<IiiHHI', data, 14)
+	if compression != 0 or bitsPerPixel not in (8, 24):
+		raise ValueError('%s must be an uncompressed 24-bit or 8-bit palette bitmap' % path)
+	palette = []
+	if bitsPerPixel == 8:
+		numColours = struct.unpack_from('<I', data, 46)[0] or 256
+		for i in range(numColours):
+			b, g, r = data[14 + headerSize + 4 * i:14 + headerSize + 4 * i + 3]
+			palette.append(toRgb565(r, g, b))
+	stride = (width * bitsPerPixel // 8 + 3) & ~3
+	rows = []
+	for row in range(abs(height)):
+		# Bitmaps with positive height are stored bottom row first
+		pos = pixelOffset + stride * (abs(height) - 1 - row if height > 0 else row)
+		if bitsPerPixel == 8:
+			rows.append([palette[data[pos + col]] for col in range(width)])
+		else:
+			rows.append([toRgb565(data[pos + 3 * col + 2], data[pos + 3 * col + 1], data[pos + 3 * col]) for col in range(width)])
+	return width, abs(height), rows
+
+
+def encodeOpaque(pixels):
+	"""Encodes a run of opaque pixels as literal and repeated-colour runs, using as few words as possible"""
+	n = len(pixels)
+	best = [0] + [None] * n				# best[i] = (words, runs) to encode the first i pixels
+	choice = [None] * (n + 1)
+	for end in range(1, n + 1):
+		for start in range(max(0, end - MAX_RUN), end):
+			same = all(p == pixels[end - 1] for p in pixels[start:end])
+			cost = 2 if same else end - start + 1
+			candidate = (best[start][0] + cost, best[start][1] + 1) if start else (cost, 1)
+			if best[end] is None or candidate < best[end]:
+				best[end] = candidate
+				choice[end] = (start, same)
+	runs = []
+	end = n
+	while end > 0:
+		start, same = choice[end]
+		if same:
+			runs.append([RUN_REPEAT | (end - start), pixels[start]])
+		else:
+			runs.append([RUN_LITERAL | (end - start)] + pixels[start:end])
+		end = start
+	return list(reversed(runs))
+
+
+def encodeRow(row):
+	runs = []
+	col = 0
+	while col < len(row):
+		start = col
+		transparent = row[col] == TRANSPARENT
+		while col < len(row) and col - start < MAX_RUN and (row[col] == TRANSPARENT) == transparent:
+			col += 1
+		if transparent:
+			runs.append([RUN_SKIP | (col - start)])
+		else:
+			runs.extend(encodeOpaque(row[start:col]))
+	return runs
+
+
+def encodeRle(rows):
+	words = [FORMAT_RLE]
+	for row in rows:
+		words.extend(w for run in encodeRow(row) for w in run)
+	return words
+
+
+def encodeIndexed(rows):
+	"""Returns the palette-indexed encoding of an icon, or None if it has too many colours"""
+	palette = sorted(set(p for row in rows for p in row))
+	if len(palette) > 256:
+		return None
+	bpp = next(b for b in (1, 2, 4, 8) if len(palette) <= 1 << b)
+	index = dict((c, i) for i, c in enumerate(palette))
+	words = [((len(palette) - 1) << 8) | bpp] + palette
+	pixels = [index[p] for row in rows for p in row]
+	perWord = 16 // bpp
+	for i in range(0, len(pixels), perWord):
+		words.append(sum(p << (bpp * j) for j, p in enumerate(pixels[i:i + perWord])))
+	return words
+
+
+def encodeIcon(rows, format):
+	rle = encodeRle(rows)
+	indexed = encodeIndexed(rows)
+	if format == 'rle' or indexed is None or (format == 'auto' and len(rle) <= len(indexed)):
+		return rle
+	return indexed
+
+
+def describe(words):
+	if words[0] == FORMAT_RLE:
+		return 'run-length encoded'
+	return '%d bits per pixel, %d colours' % (words[0] & 0x0F, (words[0] >> 8) + 1)
+
+
+def writeIcons(outPath, icons, format, command):
+	out = []
+	out.append('/*')
+	out.append(' * %s' % os.path.basename(outPath))
+	out.append(' *')
+	out.append(' * Generated by Tools/MakeIcons.py - do not edit')
+	out.append(' * Command: MakeIcons.py %s' % command)
+	out.append(' */')
+	out.append('')
+	out.append('#include "Display.hpp"')
+	out.append('#include "%s.hpp"' % os.path.splitext(os.path.basename(outPath))[0])
+	for name, bmpPath, (width, height, rows) in icons:
+		words = encodeIcon(rows, format)
+		out.append('')
+		out.append('// %s, %s' % (os.path.basename(bmpPath), describe(words)))
+		out.append('extern const uint16_t %s[] =' % name)
+		out.append('{\t%d, %d,\t\t// width, height' % (width, height))
+		out.append('\t0x%04x,\t\t// format' % words[0])
+		if words[0] == FORMAT_RLE:
+			for row in rows:
+				out.append('\t' + ' '.join(' '.join('0x%04x,' % w for w in run) for run in encodeRow(row)))
+		else:
+			numColours = (words[0] >> 8) + 1
+			palette = words[1:1 + numColours]
+			for i in range(0, len(palette), 8):
+				out.append('\t' + ' '.join('0x%04x,' % w for w in palette[i:i + 8]) + ('\t// palette' if i == 0 else ''))
+			data = words[1 + numColours:]
+			for i in range(0, len(data), 12):
+				out.append('\t' + ' '.join('0x%04x,' % w for w in data[i:i + 12]))
+		out.append('};')
+	out.append('')
+	out.append('// End')
+	out.append('')
+	with open(outPath, 'w') as f:
+		f.write('\n'.join(out))
+
+
+def main(args):
+	usage = 'Usage: MakeIcons.py [--format auto|rle|indexed] output.cpp IconName=bitmap.bmp...\n' \
+			'       MakeIcons.py --report output.cpp IconName=bitmap.bmp...'
+	command = ' '.join(os.path.basename(a) if a.endswith('.cpp') else a.split('=', 1)[0] + '=' + os.path.basename(a.split('=', 1)[1]) if '=' in a else a
+						for a in args)
+	report = False
+	format = 'auto'
+	while args and args[0].startswith('--'):
+		if args[0] == '--report':
+			report = True
+			args = args[1:]
+		elif args[0] == '--format' and len(args) > 1 and args[1] in ('auto', 'rle', 'indexed'):
+			format = args[1]
+			args = args[2:]
+		else:
+			print(usage)
+			return 1
+	if len(args) < 2 or not all('=' in a for a in args[1:]):
+		print(usage)
+		return 1
+	icons = []
+	for arg in args[1:]:
+		name, bmpPath = arg.split('=', 1)
+		icons.append((name, bmpPath, readBmp(bmpPath)))
+
+	if report:
+		total = [0, 0, 0, 0]
+		print('%-20s %8s %8s %8s %8s %8s' % ('icon', 'old', 'rle', 'indexed', 'best', 'saved'))
+		for name, _, (width, height, rows) in icons:
+			oldSize = 2 * (2 + width * height)
+			rleSize = 2 * (2 + len(encodeRle(rows)))
+			indexed = encodeIndexed(rows)
+			indexedSize = 2 * (2 + len(indexed)) if indexed is not None else 0
+			bestSize = min(rleSize, indexedSize) if indexedSize else rleSize
+			print('%-20s %8d %8d %8d %8d %7.1f%%' % (name, oldSize, rleSize, indexedSize, bestSize, 100.0 * (oldSize - bestSize) / oldSize))
+			for i, size in enumerate((oldSize, rleSize, indexedSize or rleSize, bestSize)):
+				total[i] += size
+		print('%-20s %8d %8d %8d %8d %7.1f%%' % ('total', total[0], total[1], total[2], total[3], 100.0 * (total[0] - total[3]) / total[0]))
+		return 0
+
+	writeIcons(args[0], icons, format, command)
+	return 0
+
+
+if __name__ == '__main__':
+	sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,251 @@
+#
+# TrueType.py
+#
+# Minimal TrueType reader and rasteriser used by MakeFont.py to render glyphs that the GLCD Font Creator fonts don't have.
+# It supports glyf-based fonts with a Unicode BMP (format 4) character map, including composite glyphs, which is
+# enough for the DejaVu and Liberation fonts. Hinting is ignored.
+
+import hashlib
+import struct
+
+
+class TrueTypeFont:
+	def __init__(self, path):
+		self.data = open(path, 'rb').read()
+		numTables = struct.unpack_from('>H', self.data, 4)[0]
+		self.tables = {}
+		for i in range(numTables):
+			tag, _, offset, length = struct.unpack_from('>4sIII', self.data, 12 + 16 * i)
+			self.tables[tag.decode('latin-1')] = (offset, length)
+
+		head = self.tables['head'][0]
+		self.unitsPerEm = struct.unpack_from('>H', self.data, head + 18)[0]
+		self.longLoca = struct.unpack_from('>h', self.data, head + 50)[0] != 0
+		self.numGlyphs = struct.unpack_from('>H', self.data, self.tables['maxp'][0] + 4)[0]
+		hhea = self.tables['hhea'][0]
+		self.ascender, self.descender = struct.unpack_from('>hh', self.data, hhea + 4)
+		self.numHMetrics = struct.unpack_from('>H', self.data, hhea + 34)[0]
+		self.cmap = self._readCmap()
+		self.sha256 = hashlib.sha256(self.data).hexdigest()
+
+	def nameString(self, nameId):
+		"""Returns a string from the name table, e.g. 4 for the full font name or 5 for the version, or None if it isn't there"""
+		base = self.tables['name'][0]
+		count, stringOffset = struct.unpack_from('>HH', self.data, base + 2)
+		for i in range(count):
+			platform, encoding, _, name, length, offset = struct.unpack_from('>HHHHHH', self.data, base + 6 + 12 * i)
+			if name == nameId and platform == 3 and encoding == 1:
+				start = base + stringOffset + offset
+				return self.data[start:start + length].decode('utf-16-be')
+		return None
+
+	def description(self):
+		"""Returns the full name, version and SHA-256 hash of the font file, so that a generated font says exactly what it came from"""
+		return '%s, %s, SHA-256 %s' % (self.nameString(4), self.nameString(5), self.sha256)
+
+	def _readCmap(self):
+		base = self.tables['cmap'][0]
+		numSubtables = struct.unpack_from('>H', self.data, base + 2)[0]
+		for i in range(numSubtables):
+			platform, encoding, offset = struct.unpack_from('>HHI', self.data, base + 4 + 8 * i)
+			if platform == 3 and encoding == 1:
+				return self._readCmapFormat4(base + offset)
+		raise ValueError('no Unicode BMP character map')
+
+	def _readCmapFormat4(self, pos):
+		if struct.unpack_from('>H', self.data, pos)[0] != 4:
+			raise ValueError('unsupported character map format')
+		segCount = struct.unpack_from('>H', self.data, pos + 6)[0] // 2
+		ends = struct.unpack_from('>%dH' % segCount, self.data, pos + 14)
+		startsPos = pos + 16 + 2 * segCount
+		starts = struct.unpack_from('>%dH' % segCount, self.data, startsPos)
+		deltas = struct.unpack_from('>%dh' % segCount, self.data, startsPos + 2 * segCount)
+		rangeOffsetsPos = startsPos + 4 * segCount
+		rangeOffsets = struct.unpack_from('>%dH' % segCount, self.data, rangeOffsetsPos)
+		cmap = {}
+		for seg in range(segCount):
+			for code in range(starts[seg], ends[seg] + 1):
+				if code == 0xFFFF:
+					continue
+				if rangeOffsets[seg] == 0:
+					glyph = (code + deltas[seg]) & 0xFFFF
+				else:
+					addr = rangeOffsetsPos + 2 * seg + rangeOffsets[seg] + 2 * (code - starts[seg])
+					glyph = struct.unpack_from('>H', self.data, addr)[0]
+					if glyph != 0:
+						glyph = (glyph + deltas[seg]) & 0xFFFF
+				if glyph != 0:
+					cmap[code] = glyph
+		return cmap
+
+	def _glyphRange(self, glyph):
+		loca = self.tables['loca'][0]
+		if self.longLoca:
+			start, end = struct.unpack_from('>II', self.data, loca + 4 * glyph)
+		else:
+			start, end = (2 * v for v in struct.unpack_from('>HH', self.data, loca + 2 * glyph))
+		glyf = self.tables['glyf'][0]
+		return glyf + start, end - start
+
+	def contours(self, glyph):
+		"""Returns the outline of a glyph as a list of contours, each a list of (x, y, onCurve) in font units"""
+		pos, length = self._glyphRange(glyph)
+		if length == 0:
+			return []
+		numContours = struct.unpack_from('>h', self.data, pos)[0]
+		if numContours >= 0:
+			return self._simpleContours(pos, numContours)
+		return self._compositeContours(pos)
+
+	def _simpleContours(self, pos, numContours):
+		ends = struct.unpack_from('>%dH' % numContours, self.data, pos + 10)
+		numPoints = ends[-1] + 1 if numContours else 0
+		p = pos + 10 + 2 * numContours
+		instructionLength = struct.unpack_from('>H', self.data, p)[0]
+		p += 2 + instructionLength
+
+		flags = []
+		while len(flags) < numPoints:
+			f = self.data[p]
+			p += 1
+			flags.append(f)
+			if f & 0x08:
+				repeat = self.data[p]
+				p += 1
+				flags.extend([f] * repeat)
+
+		def readCoords(shortBit, sameBit):
+			nonlocal p
+			coords = []
+			v = 0
+			for f in flags:
+				if f & shortBit:
+					d = self.data[p]
+					p += 1
+					v += d if f & sameBit else -d
+				elif not (f & sameBit):
+					v += struct.unpack_from('>h', self.data, p)[0]
+					p += 2
+				coords.append(v)
+			return coords
+
+		xs = readCoords(0x02, 0x10)
+		ys = readCoords(0x04, 0x20)
+		contours = []
+		start = 0
+		for end in ends:
+			contours.append([(xs[i], ys[i], bool(flags[i] & 1)) for i in range(start, end + 1)])
+			start = end + 1
+		return contours
+
+	def _compositeContours(self, pos):
+		p = pos + 10
+		contours = []
+		while True:
+			flags, glyph = struct.unpack_from('>HH', self.data, p)
+			p += 4
+			if flags & 0x0001:
+				dx, dy = struct.unpack_from('>hh', self.data, p)
+				p += 4
+			else:
+				dx, dy = struct.unpack_from('>bb', self.data, p)
+				p += 2
+			if not (flags & 0x0002):
+				raise ValueError('point-matched composite glyphs are not supported')
+			a, b, c, d = 1.0, 0.0, 0.0, 1.0
+			if flags & 0x0008:
+				a = d = struct.unpack_from('>h', self.data, p)[0] / 16384.0
+				p += 2
+			elif flags & 0x0040:
+				a, d = (v / 16384.0 for v in struct.unpack_from('>hh', self.data, p))
+				p += 4
+			elif flags & 0x0080:
+				a, b, c, d = (v / 16384.0 for v in struct.unpack_from('>hhhh', self.data, p))
+				p += 8
+			for contour in self.contours(glyph):
+				contours.append([(a * x + c * y + dx, b * x + d * y + dy, on) for x, y, on in contour])
+			if not (flags & 0x0020):
+				return contours
+
+	def advanceWidth(self, code):
+		"""Returns the advance width of a character in font units"""
+		glyph = min(self.cmap[code], self.numHMetrics - 1)
+		return struct.unpack_from('>H', self.data, self.tables['hmtx'][0] + 4 * glyph)[0]
+
+	def bounds(self, code):
+		"""Returns (xMin, yMin, xMax, yMax) of the outline of a character in font units, or None if it has no outline"""
+		points = [pt for contour in self.contours(self.cmap[code]) for pt in contour]
+		if not points:
+			return None
+		return (min(p[0] for p in points), min(p[1] for p in points), max(p[0] for p in points), max(p[1] for p in points))
+
+
+def _flatten(contour, steps=8):
+	"""Converts a TrueType contour (quadratic B-spline) to a closed polygon"""
+	n = len(contour)
+	# Start from an on-curve point, inventing one between two off-curve points if necessary
+	start = next((i for i in range(n) if contour[i][2]), None)
+	if start is None:
+		x0, y0, _ = contour[0]
+		x1, y1, _ = contour[1 % n]
+		pts = [((x0 + x1) / 2.0, (y0 + y1) / 2.0, True)] + contour[1:] + contour[:1]
+	else:
+		pts = contour[start:] + contour[:start]
+	poly = [(pts[0][0], pts[0][1])]
+	i = 1
+	pts = pts + [pts[0]]
+	prev = (pts[0][0], pts[0][1])
+	while i < len(pts):
+		x, y, on = pts[i]
+		if on:
+			poly.append((x, y))
+			prev = (x, y)
+			i += 1
+			continue
+		nx, ny, non = pts[i + 1] if i + 1 < len(pts) else pts[0]
+		end = (nx, ny) if non else ((x + nx) / 2.0, (y + ny) / 2.0)
+		for s in range(1, steps + 1):
+			t = s / float(steps)
+			mt = 1.0 - t
+			poly.append((mt * mt * prev[0] + 2 * mt * t * x + t * t * end[0], mt * mt * prev[1] + 2 * mt * t * y + t * t * end[1]))
+		prev = end
+		i += 2 if non else 1
+	return poly
+
+
+def rasterise(contours, scale, xOffset, baseline, width, height, subRows=16):
+	"""Renders an outline into a height x width grid of coverage values in the range 0..1.
+	Font unit (x, y) maps to pixel position (x * scale + xOffset, baseline - y * scale), with row 0 at the top."""
+	edges = []
+	for contour in contours:
+		poly = [(x * scale + xOffset, baseline - y * scale) for x, y in _flatten(contour)]
+		for (x0, y0), (x1, y1) in zip(poly, poly[1:] + poly[:1]):
+			if y0 != y1:
+				edges.append((x0, y0, x1, y1))
+
+	coverage = [[0.0] * width for _ in range(height)]
+	for row in range(height):
+		for sub in range(subRows):
+			sy = row + (sub + 0.5) / subRows
+			crossings = []
+			for x0, y0, x1, y1 in edges:
+				if (y0 <= sy < y1) or (y1 <= sy < y0):
+					crossings.append((x0 + (sy - y0) * (x1 - x0) / (y1 - y0), 1 if y1 > y0 else -1))
+			crossings.sort()
+			winding = 0
+			for i, (x, direction) in enumerate(crossings):
+				winding += direction
+				if winding != 0 and i + 1 < len(crossings):
+					_addSpan(coverage[row], x, crossings[i + 1][0], 1.0 / subRows)
+	return coverage
+
+
+def _addSpan(line, x0, x1, weight):
+	x0 = max(x0, 0.0)
+	x1 = min(x1, float(len(line)))
+	col = int(x0)
+	while col < len(line) and col < x1:
+		overlap = min(x1, col + 1.0) - max(x0, float(col))
+		if overlap > 0:
+			line[col] += overlap * weight
+		col += 1
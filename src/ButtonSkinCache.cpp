@@ -0,0 +1,91 @@
+/*
+ * ButtonSkinCache.cpp
+ *
+ * Created: 19/10/2026 16:05:12
+ */
+
+#include "ButtonSkinCache.hpp"
+
+extern UTFT lcd;
+
+bool ButtonSkinKey::operator==(const ButtonSkinKey& other) const
+{
+	return width == other.width && height == other.height && bandX == other.bandX && bandY == other.bandY
+		&& fill == other.fill && grad == other.grad && border == other.border && backdrop == other.backdrop && orient == other.orient;
+}
+
+ButtonSkinCache::ButtonSkinCache() : hits(0), misses(0), evictions(0), tooBig(0)
+{
+	Clear();
+}
+
+void ButtonSkinCache::Clear()
+{
+	for (unsigned int i = 0; i < NumEntries; ++i)
+	{
+		entries[i].numWords = 0;
+	}
+}
+
+// Look up a skin and draw it if we find it. The cache is small, so a linear search is faster than anything cleverer.
+bool ButtonSkinCache::Draw(const ButtonSkinKey& key)
+{
+	clock.Tick(entries, NumEntries);
+	for (unsigned int i = 0; i < NumEntries; ++i)
+	{
+		ButtonSkin& s = entries[i];
+		if (s.numWords != 0 && s.key == key && lcd.decodeBand(s.data, s.numWords))
+		{
+			s.lastUsed = clock.Now();
+			++hits;
+			return true;
+		}
+	}
+	++misses;
+	return false;
+}
+
+// Keep the band in the entry that was used longest ago, unless it doesn't fit in one
+void ButtonSkinCache::Store(const ButtonSkinKey& key)
+{
+	unsigned int victim = 0;
+	uint16_t oldest = 0;
+	for (unsigned int i = 0; i < NumEntries; ++i)
+	{
+		const ButtonSkin& s = entries[i];
+		if (s.numWords == 0 || s.key == key)
+		{
+			victim = i;
+			break;
+		}
+		const uint16_t age = clock.Age(s.lastUsed);
+		if (age >= oldest)
+		{
+			oldest = age;
+			victim = i;
+		}
+	}
+
+	ButtonSkin& s = entries[victim];
+	const size_t numWords = lcd.encodeBand(s.data, ButtonSkin::MaxWords);
+	if (numWords == 0)
+	{
+		// The victim's data may have been overwritten, so we lose it as well
+		if (s.numWords != 0)
+		{
+			s.numWords = 0;
+			++evictions;
+		}
+		++tooBig;
+		return;
+	}
+	if (s.numWords != 0 && !(s.key == key))
+	{
+		++evictions;
+	}
+	s.key = key;
+	s.numWords = numWords;
+	s.lastUsed = clock.Now();
+}
+
+// End
@@ -0,0 +1,70 @@
+/*
+ * ButtonSkinCache.hpp
+ *
+ * Created: 19/10/2026 16:05:12
+ */
+
+
+#ifndef BUTTONSKINCACHE_H_
+#define BUTTONSKINCACHE_H_
+
+#include "ecv.h"
+#include "Hardware/UTFT.hpp"
+#include "Library/LruClock.hpp"
+
+// Number of button background bands in the button skin cache. Each one takes sizeof(ButtonSkin) bytes of RAM, which is 136 on the SAM3S.
+// Define it as 0 to draw button backgrounds every time.
+#ifndef BUTTON_SKIN_CACHE_ENTRIES
+#define BUTTON_SKIN_CACHE_ENTRIES	(7)
+#endif
+
+// What a band of a button background looks like depends on these, and on nothing else
+struct ButtonSkinKey
+{
+	uint16_t width, height;				// size of the button
+	uint16_t bandX, bandY;				// position of the band within the button
+	Colour fill, grad, border, backdrop;
+	DisplayOrientation orient;
+
+	bool operator==(const ButtonSkinKey& other) const;
+};
+
+// A band of a button background as UTFT::encodeBand left it
+struct ButtonSkin
+{
+	static const unsigned int MaxWords = 56;		// enough for the buttons we use on all sizes of display
+
+	ButtonSkinKey key;
+	uint16_t lastUsed;					// LRU timestamp, see LruClock
+	uint16_t numWords;					// number of words used in data, or 0 if this entry is free
+	uint16_t data[MaxWords];
+};
+
+class ButtonSkinCache
+{
+public:
+	static const unsigned int NumEntries = BUTTON_SKIN_CACHE_ENTRIES;
+
+	ButtonSkinCache();
+
+	// Draw a band of a button background from the cache. Returns false if it isn't in the cache.
+	bool Draw(const ButtonSkinKey& key);
+
+	// Keep what has been drawn in the band as the background for this key, evicting the least recently used skin if necessary
+	void Store(const ButtonSkinKey& key);
+
+	void Clear();
+
+	uint32_t GetHits() const { return hits; }
+	uint32_t GetMisses() const { return misses; }
+	uint32_t GetEvictions() const { return evictions; }
+	uint32_t GetTooBig() const { return tooBig; }
+	void ResetStats() { hits = misses = evictions = tooBig = 0; }
+
+private:
+	ButtonSkin entries[NumEntries];
+	LruClock clock;
+	uint32_t hits, misses, evictions, tooBig;
+};
+
+#endif /* BUTTONSKINCACHE_H_ */
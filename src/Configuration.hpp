@@ -32,4 +32,8 @@
 
 #define DEFAULT_BAUD_RATE	(57600)
 
+// Define DISPLAY_TIMING_TEST as 1 to time filling the screen and printing text at startup, and show the results on the Console tab.
+// To see what running the display code from RAM gains, build it again with the display functions in RAM (see Hardware/Mem.hpp).
+#define DISPLAY_TIMING_TEST	(0)
+
 #endif /* CONFIGURATION_H_ */
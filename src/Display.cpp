@@ -27,10 +27,12 @@ Colour DisplayField::defaultButtonBorderColour = black;
 Colour DisplayField::defaultGradColour = 0;
 Colour DisplayField::defaultPressedBackColour = black;
 Colour DisplayField::defaultPressedGradColour = 0;
+Colour DisplayField::backdropColour = 0;
+uint32_t DisplayField::layoutVersion = 0;
 
 DisplayField::DisplayField(PixelNumber py, PixelNumber px, PixelNumber pw)
 	: y(py), x(px), width(pw), fcolour(defaultFcolour), bcolour(defaultBcolour),
-		changed(true), visible(true), next(NULL)
+		changed(true), visible(true), obscured(false), next(NULL)
 {
 }
 
@@ -46,9 +48,7 @@ DisplayField::DisplayField(PixelNumber py, PixelNumber px, PixelNumber pw)
 
 /*static*/ PixelNumber DisplayField::GetTextWidth(const char* array s, PixelNumber maxWidth)
 {
-	lcd.setTextPos(0, 9999, maxWidth);
-	lcd.print(s);    // dummy print to get text width
-	return lcd.getTextX();
+	return lcd.measure(s, maxWidth);
 }
 
 void DisplayField::Show(bool v)
@@ -56,39 +56,186 @@ void DisplayField::Show(bool v)
 	if (visible != v)
 	{
 		visible = changed = v;
+		++layoutVersion;
 	}
 }
 	
 // Find the best match to a touch event in a list of fields
+const int maxXerror = 8, maxYerror = 8;		// set these to how close a touch needs to be to a button to select it
+
+// Index of the buttons in a list of fields by position, so that finding the button that has been touched only checks the buttons near the touch.
+// The window is divided into square cells, and each cell lists the buttons that a touch in it could select, in the order they are in the list.
+// There is one index, for the list that was searched last. Fields are only ever added at the start of a list, so the index is rebuilt
+// when the list it is asked about starts with a different field, or when layoutVersion shows that a field has moved, been shown or hidden,
+// or been given an event.
+class TouchIndex
+{
+public:
+	static const unsigned int CellShift = 7;					// cells are 128 pixels square
+	static const unsigned int NumColumns = 8, NumRows = 4;		// enough for an 800x480 display, touches beyond that use the last column or row
+	static const unsigned int MaxEntries = 96;					// total number of times buttons are listed. More than that and we check every field.
+
+	TouchIndex() : fields(nullptr), version(0), complete(false) { }
+	bool IsFor(const DisplayField *p, uint32_t v) const { return p == fields && v == version; }
+	void Build(DisplayField * null p, uint32_t v);
+	bool IsComplete() const { return complete; }
+	unsigned int CellOf(PixelNumber x, PixelNumber y) const { return Row(y) * NumColumns + Column(x); }
+	unsigned int CellStart(unsigned int cell) const { return cellStart[cell]; }
+	ButtonBase *Entry(unsigned int i) const { return entries[i]; }
+
+private:
+	static unsigned int Column(int x) { return (x <= 0) ? 0 : std::min<unsigned int>((unsigned int)x >> CellShift, NumColumns - 1); }
+	static unsigned int Row(int y) { return (y <= 0) ? 0 : std::min<unsigned int>((unsigned int)y >> CellShift, NumRows - 1); }
+
+	const DisplayField * null fields;
+	uint32_t version;
+	bool complete;
+	uint8_t cellStart[NumColumns * NumRows + 1];	// the buttons for cell n are entries[cellStart[n]] to entries[cellStart[n + 1] - 1]
+	ButtonBase *entries[MaxEntries];
+};
+
+// Build the index for the list of fields starting at 'p'. A button is listed in every cell that a touch close enough to select it could be in.
+void TouchIndex::Build(DisplayField * null p, uint32_t v)
+{
+	fields = p;
+	version = v;
+
+	// Count the buttons in each cell, then turn the counts into where each cell's buttons start, then list the buttons
+	unsigned int counts[NumColumns * NumRows] = { 0 };
+	unsigned int total = 0;
+	for (const DisplayField *f = p; f != nullptr; f = f->next)
+	{
+		if (f->IsVisible() && f->GetEvent() != nullEvent)
+		{
+			for (unsigned int row = Row(f->GetMinY() - (maxYerror - 1)); row <= Row(f->GetMaxY() + (maxYerror - 1)); ++row)
+			{
+				for (unsigned int col = Column(f->GetMinX() - (maxXerror - 1)); col <= Column(f->GetMaxX() + (maxXerror - 1)); ++col)
+				{
+					++counts[row * NumColumns + col];
+					++total;
+				}
+			}
+		}
+	}
+	complete = (total <= MaxEntries);
+	if (!complete)
+	{
+		return;
+	}
+
+	unsigned int start = 0;
+	for (unsigned int cell = 0; cell < NumColumns * NumRows; ++cell)
+	{
+		cellStart[cell] = start;
+		start += counts[cell];
+		counts[cell] = cellStart[cell];							// now where the next button in this cell goes
+	}
+	cellStart[NumColumns * NumRows] = start;
+
+	for (DisplayField *f = p; f != nullptr; f = f->next)
+	{
+		if (f->IsVisible() && f->GetEvent() != nullEvent)
+		{
+			for (unsigned int row = Row(f->GetMinY() - (maxYerror - 1)); row <= Row(f->GetMaxY() + (maxYerror - 1)); ++row)
+			{
+				for (unsigned int col = Column(f->GetMinX() - (maxXerror - 1)); col <= Column(f->GetMaxX() + (maxXerror - 1)); ++col)
+				{
+					entries[counts[row * NumColumns + col]++] = static_cast<ButtonBase*>(f);
+				}
+			}
+		}
+	}
+}
+
+static TouchIndex touchIndex;
+
+// If field 'p' is a closer match to a touch at x, y than bestError, make it the best match so far
+static inline void CheckTouch(DisplayField *p, PixelNumber x, PixelNumber y, int& bestError, ButtonPress& best)
+{
+	int xError = (x < p->GetMinX()) ? p->GetMinX() - x
+							: (x > p->GetMaxX()) ? x - p->GetMaxX()
+								: 0;
+	if (xError < maxXerror)
+	{
+		int yError = (y < p->GetMinY()) ? p->GetMinY() - y
+								: (y > p->GetMaxY()) ? y - p->GetMaxY()
+									: 0;
+		if (yError < maxYerror && xError + yError < bestError)
+		{
+			bestError = xError + yError;
+			best = ButtonPress(static_cast<ButtonBase*>(p), 0);
+		}
+	}
+}
+
 ButtonPress DisplayField::FindEvent(PixelNumber x, PixelNumber y, DisplayField * null p)
 {	
-	const int maxXerror = 8, maxYerror = 8;		// set these to how close we need to be
 	int bestError = maxXerror + maxYerror;
-	ButtonPress best;;
+	ButtonPress best;
+	if (!touchIndex.IsFor(p, layoutVersion))
+	{
+		touchIndex.Build(p, layoutVersion);
+	}
+	if (touchIndex.IsComplete())
+	{
+		// The buttons in a cell are in list order, so when two are equally close we choose the same one as searching the list would
+		const unsigned int cell = touchIndex.CellOf(x, y);
+		for (unsigned int i = touchIndex.CellStart(cell); i < touchIndex.CellStart(cell + 1); ++i)
+		{
+			CheckTouch(touchIndex.Entry(i), x, y, bestError, best);
+		}
+		return best;
+	}
+
 	while (p != NULL)
 	{
 		if (p->visible && p->GetEvent() != nullEvent)
 		{
-			int xError = (x < p->GetMinX()) ? p->GetMinX() - x
-									: (x > p->GetMaxX()) ? x - p->GetMaxX()
-										: 0;
-			if (xError < maxXerror)
-			{
-				int yError = (y < p->GetMinY()) ? p->GetMinY() - y
-										: (y > p->GetMaxY()) ? y - p->GetMaxY()
-											: 0;
-				if (yError < maxYerror && xError + yError < bestError)
-				{
-					bestError = xError + yError;
-					best = ButtonPress(static_cast<ButtonBase*>(p), 0);
-				}
-			}
+			CheckTouch(p, x, y, bestError, best);
 		}
 		p = p->next;
 	}
 	return best;
 }
 
+// Draw the whole field. If the display has a band buffer then we compose the field in it a band of rows at a time,
+// so that each pixel is sent to the display once however many times the drawing overlaps. 'background' is the colour
+// of any pixels of the field that Draw doesn't write, such as the corners outside a rounded button.
+void DisplayField::Compose(PixelNumber xOffset, PixelNumber yOffset, Colour background) const
+{
+	Compose(xOffset, yOffset, background, 0, width - 1);
+}
+
+// Return true if Compose draws the whole field in the band buffer. The band starts out filled with the background, so every pixel gets written.
+bool DisplayField::IsComposed() const
+{
+	return lcd.getBandRows(width) != 0;
+}
+
+// Draw the field, but only change columns minCol to maxCol of it. Draw must not write outside those columns if there is no band buffer.
+void DisplayField::Compose(PixelNumber xOffset, PixelNumber yOffset, Colour background, PixelNumber minCol, PixelNumber maxCol) const
+{
+	const PixelNumber bandRows = lcd.getBandRows(maxCol - minCol + 1);
+	if (bandRows == 0)
+	{
+		Draw(xOffset, yOffset);
+		return;
+	}
+
+	// Fields along the bottom edge extend past the display, so clip them to it
+	const PixelNumber x1 = x + xOffset + minCol, y1 = y + yOffset;
+	const PixelNumber x2 = std::min<PixelNumber>(x + xOffset + maxCol, lcd.getDisplayXSize() - 1);
+	const PixelNumber y2 = std::min<PixelNumber>(y1 + GetHeight() - 1, lcd.getDisplayYSize() - 1);
+	for (PixelNumber bandY = y1; bandY <= y2; bandY += bandRows)
+	{
+		if (lcd.beginBand(x1, bandY, x2, std::min<PixelNumber>(bandY + bandRows - 1, y2), background))
+		{
+			Draw(xOffset, yOffset);
+			lcd.endBand();
+		}
+	}
+}
+
 void DisplayField::SetColours(Colour pf, Colour pb)
 {
 	if (fcolour != pf || bcolour != pb)
@@ -129,7 +276,7 @@ bool ButtonPress::operator==(const ButtonPress& other) const { return button ==
 
 // Window class methods
 Window::Window(Colour pb)
-	: root(nullptr), next(nullptr), backgroundColour(pb)
+	: root(nullptr), next(nullptr), backgroundColour(pb), occlusionRoot(nullptr), occlusionVersion(0)
 {
 }
 
@@ -140,17 +287,48 @@ void Window::AddField(DisplayField *d)
 	root = d;
 }
 
-bool Window::ObscuredByPopup(const DisplayField *p) const
+bool Window::CoveredByPopup(const DisplayField *p) const
 {
 	return next != nullptr
 			&& (  (   p->GetMaxY() >= next->Ypos() && p->GetMinY() < next->Ypos() + next->GetHeight() 
 				   && p->GetMaxX() >= next->Xpos() && p->GetMinX() < next->Xpos() + next->GetWidth()
 				  )
-				|| next->ObscuredByPopup(p)
+				|| next->CoveredByPopup(p)
 			   );
 }
 
-bool Window::Visible(const DisplayField *p) const
+// Work out which of our fields are covered by popups, and the same for each popup. This only changes when a popup is opened or closed,
+// a different field list is shown or a field is moved, so we do it then instead of on every refresh.
+void Window::UpdateOcclusion()
+{
+	for (DisplayField * null p = root; p != nullptr; p = p->next)
+	{
+		p->SetObscured(CoveredByPopup(p));
+	}
+	occlusionRoot = root;
+	occlusionVersion = DisplayField::GetLayoutVersion();
+	if (next != nullptr)
+	{
+		next->UpdateOcclusion();
+	}
+}
+
+// Bring the obscured flags up to date if a field has been moved or added since we last worked them out
+inline void Window::CheckOcclusion()
+{
+	if (occlusionRoot != root || occlusionVersion != DisplayField::GetLayoutVersion())
+	{
+		UpdateOcclusion();
+	}
+}
+
+bool Window::ObscuredByPopup(const DisplayField *p)
+{
+	CheckOcclusion();
+	return p->IsObscured();
+}
+
+bool Window::Visible(const DisplayField *p)
 {
 	return p->IsVisible() && !ObscuredByPopup(p);
 }
@@ -180,12 +358,28 @@ void Window::SetPopup(PopupWindow * p, PixelNumber px, PixelNumber py)
 	{
 		if (pw->next == p)
 		{
-			return;				// popup is already displayed
+			UpdateOcclusion();	// popup is already displayed, but it may have moved
+			return;
 		}
 		pw = pw->next;
 	}
 	p->next = nullptr;			// ensure no nested popup
+
+	// Popups aren't drawn in scrolled coordinates, so cancel any hardware scrolling first and redraw the fields that it moved
+	if (lcd.isScrolled())
+	{
+		lcd.resetScroll();
+		for (DisplayField * null pp = root; pp != nullptr; pp = pp->next)
+		{
+			if (pp->IsVisible())
+			{
+				RefreshField(pp, true);
+			}
+		}
+	}
+
 	pw->next = p;
+	UpdateOcclusion();
 	p->Refresh(true);
 }
 
@@ -200,24 +394,156 @@ void Window::ClearPopup()
 			pw = pw->next;		// find the innermost popup
 		}
 		
-		// Clear the area that was occupied by the last window to the background colour of the penultimate window
-		lcd.setColor(pw->backgroundColour);
-		lcd.fillRoundRect(pw->next->Xpos(), pw->next->Ypos(), pw->next->Xpos() + pw->next->GetWidth() - 1, pw->next->Ypos() + pw->next->GetHeight() - 1);
-		
 		// Detach the last window
+		const PixelNumber minX = pw->next->Xpos(), minY = pw->next->Ypos();
+		const PixelNumber maxX = minX + pw->next->GetWidth() - 1, maxY = minY + pw->next->GetHeight() - 1;
 		pw->next = nullptr;
-			
-		// Re-display the fields of the penultimate window that were obscured
+		UpdateOcclusion();
+
+		// Re-display the area that the last window occupied, clipped to it so that fields that it only partly covered don't get rewritten outside it.
+		// The display can't be read back, so this is our save-under: fields outside the popup were kept up to date while it was open and haven't been drawn over.
+		// First clear the parts that no field will draw over completely to the background colour of the penultimate window, then redraw the fields.
+		// A field that the popup partly covered wasn't refreshed while it was open, so if it has changed since then we redraw all of it.
+		lcd.pushClip(minX, minY, maxX, maxY);
+		pw->ClearUncovered(minX, minY, maxX, maxY);
 		for (DisplayField * null pp = pw->root; pp != nullptr; pp = pp->next)
 		{
-			if (pp->IsVisible())
+			const PixelNumber fieldMinX = pp->GetMinX() + pw->Xpos(), fieldMinY = pp->GetMinY() + pw->Ypos();
+			const PixelNumber fieldMaxX = pp->GetMaxX() + pw->Xpos(), fieldMaxY = pp->GetMaxY() + pw->Ypos();
+			if (pp->IsVisible() && fieldMaxX >= minX && fieldMinX <= maxX && fieldMaxY >= minY && fieldMinY <= maxY)
 			{
-				pp->Refresh(true, pw->Xpos(), pw->Ypos());
+				const bool redrawAll = pp->HasChanged() && (fieldMinX < minX || fieldMaxX > maxX || fieldMinY < minY || fieldMaxY > maxY);
+				if (redrawAll)
+				{
+					lcd.popClip();
+				}
+				pw->RefreshField(pp, true);
+				if (redrawAll)
+				{
+					lcd.pushClip(minX, minY, maxX, maxY);
+				}
 			}
 		}
+		lcd.popClip();
 	}
 }
 
+// A fill that needs a new address window costs about as much bus time as filling this many more pixels
+const uint32_t fillSetupPixels = 32;
+
+// Clear the parts of a rectangle of the display that none of our visible fields will completely redraw to our background colour.
+// If the fields break that up into so many pieces that setting up the fills would cost more than it saves, clear the whole rectangle instead.
+void Window::ClearUncovered(PixelNumber minX, PixelNumber minY, PixelNumber maxX, PixelNumber maxY) const
+{
+	lcd.setColor(backgroundColour);
+	const uint32_t area = (uint32_t)(maxX - minX + 1) * (maxY - minY + 1);
+	if (FillUncovered(minX, minY, maxX, maxY, false) < area + fillSetupPixels)
+	{
+		FillUncovered(minX, minY, maxX, maxY, true);
+	}
+	else
+	{
+		lcd.fillRect(minX, minY, maxX, maxY);
+	}
+}
+
+// Fill the parts of the rectangle that need clearing if 'doFill' is true, and return the bus time that takes in pixels.
+// We split the rectangle into strips at the top and bottom edges of the fields, so that each field covers either all of the rows of a strip or none of them,
+// then fill the gaps between the fields along each strip. The fields get redrawn afterwards, so when a field between two gaps is small enough that
+// filling over it costs less than starting another fill, we fill both gaps and the field as one. This needs no memory.
+uint32_t Window::FillUncovered(PixelNumber minX, PixelNumber minY, PixelNumber maxX, PixelNumber maxY, bool doFill) const
+{
+	uint32_t cost = 0;
+	PixelNumber top = minY;
+	while (top <= maxY)
+	{
+		// Find the last row of this strip
+		PixelNumber bottom = maxY;
+		for (const DisplayField * null p = root; p != nullptr; p = p->next)
+		{
+			if (p->IsVisible() && p->FillsArea() && p->GetMaxX() + Xpos() >= minX && p->GetMinX() + Xpos() <= maxX)
+			{
+				const PixelNumber fieldTop = p->GetMinY() + Ypos(), fieldBottom = p->GetMaxY() + Ypos();
+				if (fieldTop > top)
+				{
+					if (fieldTop - 1 < bottom)
+					{
+						bottom = fieldTop - 1;
+					}
+				}
+				else if (fieldBottom >= top && fieldBottom < bottom)
+				{
+					bottom = fieldBottom;
+				}
+			}
+		}
+		const uint32_t rows = bottom - top + 1;
+
+		// Find the gaps along the strip. Each time round, either skip over a field that covers 'left' or find the gap up to the next field.
+		// runLeft and runRight are the columns that we are going to fill next, if runLeft <= runRight.
+		PixelNumber left = minX, runLeft = 1, runRight = 0;
+		while (left <= maxX)
+		{
+			PixelNumber right = maxX;
+			bool covered = false;
+			for (const DisplayField * null p = root; p != nullptr; p = p->next)
+			{
+				if (   p->IsVisible() && p->FillsArea()
+					&& p->GetMinY() + Ypos() <= top && p->GetMaxY() + Ypos() >= top
+					&& p->GetMaxX() + Xpos() >= left && p->GetMinX() + Xpos() <= right
+				   )
+				{
+					if (p->GetMinX() + Xpos() <= left)
+					{
+						left = p->GetMaxX() + Xpos() + 1;
+						covered = true;
+						break;
+					}
+					right = p->GetMinX() + Xpos() - 1;
+				}
+			}
+			if (!covered)
+			{
+				if (runLeft <= runRight && (uint32_t)(left - runRight - 1) * rows < fillSetupPixels)
+				{
+					runRight = right;				// fill over the field between the last gap and this one
+				}
+				else
+				{
+					if (runLeft <= runRight)
+					{
+						cost += fillSetupPixels + (runRight - runLeft + 1) * rows;
+						if (doFill)
+						{
+							lcd.fillRect(runLeft, top, runRight, bottom);
+						}
+					}
+					runLeft = left;
+					runRight = right;
+				}
+				left = right + 1;
+			}
+		}
+		if (runLeft <= runRight)
+		{
+			cost += fillSetupPixels + (runRight - runLeft + 1) * rows;
+			if (doFill)
+			{
+				lcd.fillRect(runLeft, top, runRight, bottom);
+			}
+		}
+		top = bottom + 1;
+	}
+	return cost;
+}
+
+// Refresh a field of this window. Fields that are composed in the band buffer need to know the colour behind them.
+void Window::RefreshField(DisplayField *f, bool full) const
+{
+	DisplayField::SetBackdropColour(backgroundColour);
+	f->Refresh(full, Xpos(), Ypos());
+}
+
 // Redraw the specified field
 void Window::Redraw(DisplayField *f)
 {
@@ -230,7 +556,7 @@ void Window::Redraw(DisplayField *f)
 			{
 				if (p->IsVisible())
 				{
-					p->Refresh(true, Xpos(), Ypos());
+					RefreshField(p, true);
 				}
 				else
 				{
@@ -266,7 +592,7 @@ void Window::Show(DisplayField *f, bool v)
 				}
 				else if (v)
 				{
-					f->Refresh(true, Xpos(), Ypos());
+					RefreshField(f, true);
 				}
 				else
 				{
@@ -313,11 +639,12 @@ void MainWindow::ClearAll()
 // Refresh all fields. If 'full' is true then we rewrite them all, else we just rewrite those that have changed.
 void MainWindow::Refresh(bool full)
 {
+	CheckOcclusion();
 	for (DisplayField * null pp = root; pp != NULL; pp = pp->next)
 	{
-		if (Visible(pp))
+		if (pp->IsVisible() && !pp->IsObscured())
 		{
-			pp->Refresh(full, 0, 0);
+			RefreshField(pp, full);
 		}
 	}
 	if (next != nullptr)
@@ -333,6 +660,7 @@ PopupWindow::PopupWindow(PixelNumber ph, PixelNumber pw, Colour pb)
 
 void PopupWindow::Refresh(bool full)
 {
+	CheckOcclusion();
 	if (full)
 	{
 		// Draw a rectangle inside the border
@@ -347,9 +675,9 @@ void PopupWindow::Refresh(bool full)
 	
 	for (DisplayField * null p = root; p != NULL; p = p->next)
 	{
-		if (p->IsVisible() && (full || !ObscuredByPopup(p)))
+		if (p->IsVisible() && (full || !p->IsObscured()))
 		{
-			p->Refresh(full, xPos, yPos);
+			RefreshField(p, full);
 		}
 	}
 	
@@ -359,96 +687,341 @@ void PopupWindow::Refresh(bool full)
 	}
 }
 
+// A Print that keeps what is printed to it, so that a field can compare its text with the text that it last drew
+class TextRecorder : public Print
+{
+	char * array buffer;
+	size_t size, length;
+	bool overflowed;
+
+public:
+	TextRecorder(char * array buf, size_t sz) : buffer(buf), size(sz), length(0), overflowed(false)
+	{
+		buffer[0] = 0;
+	}
+
+	size_t write(uint8_t c) override
+	{
+		if (length + 1 < size)
+		{
+			buffer[length++] = (char)c;
+			buffer[length] = 0;
+			return 1;
+		}
+		overflowed = true;
+		return 0;
+	}
+
+	size_t GetLength() const { return length; }
+	bool Overflowed() const { return overflowed; }
+};
+
+static inline bool IsContinuationByte(char c)
+{
+	return (c & 0xC0) == 0x80;
+}
+
+// Static fields of class FieldWithText
+const char * array null FieldWithText::partialText = nullptr;
+size_t FieldWithText::partialStart = 0, FieldWithText::partialEnd = 0;
+PixelNumber FieldWithText::partialTextX = 0, FieldWithText::partialClearFrom = 0, FieldWithText::partialClearTo = 0;
+
 void FieldWithText::Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset)
 {
 	if (full || changed)
 	{
-		lcd.setFont(font);
-		lcd.setColor(fcolour);
-		lcd.setBackColor(bcolour);
-		lcd.setTextPos(x + xOffset, y + yOffset, x + xOffset + width);
-		if (align == TextAlignment::Left)
+		if (full || !RefreshChangedText(xOffset, yOffset))
 		{
-			PrintText();
+			// The text only needs measuring when it may have changed, because 'changed' is set whenever it does
+			if (changed && align != TextAlignment::Left)
+			{
+				lcd.setFont(font);
+				lcd.beginMeasure(width);
+				PrintText(lcd);
+				textWidth = lcd.endMeasure();
+			}
+			Compose(xOffset, yOffset, bcolour);
+			char * array null const drawn = DrawnText();
+			if (drawn != nullptr)
+			{
+				TextRecorder recorder(drawn, MaxDrawnTextLength + 1);
+				PrintText(recorder);
+				if (recorder.Overflowed())
+				{
+					drawn[0] = 0;			// too long to remember, so we will redraw all of it next time
+				}
+			}
+		}
+		changed = false;
+	}
+}
+
+// If the field remembers the text that it last drew, redraw only the characters that have changed since then, and any that they moved.
+// Return false if we need to redraw the whole field instead.
+// We don't store where we drew each character. Printing the same text from the same position and kerning state always puts the characters
+// in the same places, so we skip over the characters that we aren't drawing to find them again.
+bool FieldWithText::RefreshChangedText(PixelNumber xOffset, PixelNumber yOffset)
+{
+	char * array null const drawn = DrawnText();
+	if (drawn == nullptr || drawn[0] == 0)
+	{
+		return false;
+	}
+
+	static char newText[MaxDrawnTextLength + 1];
+	TextRecorder recorder(newText, sizeof(newText));
+	PrintText(recorder);
+	if (recorder.Overflowed())
+	{
+		return false;
+	}
+
+	// Find how much of the text is the same at the start and at the end, without splitting UTF8 characters
+	const size_t oldLength = strlen(drawn), newLength = recorder.GetLength();
+	size_t prefix = 0;
+	while (prefix < oldLength && prefix < newLength && drawn[prefix] == newText[prefix])
+	{
+		++prefix;
+	}
+	if (prefix == oldLength && prefix == newLength)
+	{
+		return true;					// nothing has changed
+	}
+	while (prefix != 0 && (IsContinuationByte(drawn[prefix]) || IsContinuationByte(newText[prefix])))
+	{
+		--prefix;
+	}
+	const size_t maxSuffix = std::min<size_t>(oldLength, newLength) - prefix;
+	size_t suffix = 0;
+	while (suffix < maxSuffix && drawn[oldLength - 1 - suffix] == newText[newLength - 1 - suffix])
+	{
+		++suffix;
+	}
+	while (suffix != 0 && IsContinuationByte(newText[newLength - suffix]))
+	{
+		--suffix;
+	}
+
+	// If the text is centred or right aligned and its width has changed, all of it has moved
+	lcd.setFont(font);
+	const PixelNumber oldWidth = lcd.measure(drawn, width), newWidth = lcd.measure(newText, width);
+	if (oldWidth >= width || newWidth >= width)
+	{
+		return false;					// it may have been cut off at the margin
+	}
+	const PixelNumber left = x + xOffset;
+	const PixelNumber oldTextX = left + AlignmentOffset(width - oldWidth), textX = left + AlignmentOffset(width - newWidth);
+	if (textX != oldTextX)
+	{
+		prefix = suffix = 0;
+	}
+
+	// Find where the changed characters end in the old text, and where the old text ends
+	lcd.setTextPos(oldTextX, y + yOffset, left + width);
+	lcd.beginSkip();
+	lcd.write(drawn, oldLength - suffix);
+	lcd.endSkip();
+	const PixelNumber oldChangeEnd = lcd.getTextX();
+	const uint32_t oldKernData = lcd.getKernData();
+	lcd.beginSkip();
+	lcd.write(drawn + oldLength - suffix, suffix);
+	lcd.endSkip();
+	const PixelNumber oldEnd = lcd.getTextX();
+
+	// Find where the changed characters start and end in the new text. If the end is in the same place with the same kerning, the characters after it haven't moved.
+	lcd.setTextPos(textX, y + yOffset, left + width);
+	lcd.beginSkip();
+	lcd.write(newText, prefix);
+	lcd.endSkip();
+	const PixelNumber changeStart = lcd.getTextX();
+	lcd.beginSkip();
+	lcd.write(newText + prefix, newLength - suffix - prefix);
+	lcd.endSkip();
+	PixelNumber changeEnd;
+	if (lcd.getTextX() == oldChangeEnd && lcd.getKernData() == oldKernData)
+	{
+		partialEnd = newLength - suffix;
+		partialClearTo = 0;
+		changeEnd = oldChangeEnd;
+	}
+	else
+	{
+		lcd.beginSkip();
+		lcd.write(newText + newLength - suffix, suffix);
+		lcd.endSkip();
+		partialEnd = newLength;
+		partialClearTo = oldEnd;		// clear whatever is left of the old text
+		changeEnd = std::max<PixelNumber>(lcd.getTextX(), oldEnd);
+	}
+
+	// If the text has moved right then we need to clear where the start of the old text was as well
+	const PixelNumber changeFrom = (textX != oldTextX) ? std::min<PixelNumber>(textX, oldTextX) : changeStart;
+	if (changeEnd > changeFrom)
+	{
+		partialText = newText;
+		partialStart = prefix;
+		partialTextX = textX;
+		partialClearFrom = changeFrom;
+		Compose(xOffset, yOffset, bcolour, changeFrom - left, changeEnd - 1 - left);
+		partialText = nullptr;
+	}
+	strcpy(drawn, newText);
+	textWidth = newWidth;
+	return true;
+}
+
+void FieldWithText::Draw(PixelNumber xOffset, PixelNumber yOffset) const
+{
+	lcd.setFont(font);
+	lcd.setColor(fcolour);
+	lcd.setBackColor(bcolour);
+	if (partialText != nullptr)
+	{
+		// Draw the part of the text that RefreshChangedText asked for
+		if (partialClearFrom < partialTextX)
+		{
+			lcd.setTextPos(partialClearFrom, y + yOffset, partialTextX);
 			lcd.clearToMargin();
 		}
-		else
+		lcd.setTextPos(partialTextX, y + yOffset, x + xOffset + width);
+		lcd.beginSkip();
+		lcd.write(partialText, partialStart);
+		lcd.endSkip();
+		lcd.write(partialText + partialStart, partialEnd - partialStart);
+		if (lcd.getTextX() < partialClearTo)
 		{
+			lcd.setTextPos(lcd.getTextX(), y + yOffset, partialClearTo);
 			lcd.clearToMargin();
-			lcd.setTextPos(0, 9999, width);
-			PrintText();    // dummy print to get text width
-			PixelNumber spare = width - lcd.getTextX();
-			lcd.setTextPos(x + xOffset + ((align == TextAlignment::Centre) ? spare/2 : spare), y + yOffset, x + xOffset + width);
-			PrintText();
 		}
-		changed = false;
+		return;
+	}
+
+	lcd.setTextPos(x + xOffset, y + yOffset, x + xOffset + width);
+	if (align == TextAlignment::Left)
+	{
+		PrintText(lcd);
+		lcd.clearToMargin();
+	}
+	else
+	{
+		lcd.clearToMargin();
+		lcd.setTextPos(x + xOffset + AlignmentOffset(width - textWidth), y + yOffset, x + xOffset + width);
+		PrintText(lcd);
+	}
+}
+
+// Get how far the text starts from the left of the field, given how much spare width there is
+PixelNumber FieldWithText::AlignmentOffset(PixelNumber spare) const
+{
+	return (align == TextAlignment::Centre) ? spare/2
+			: (align == TextAlignment::Right) ? spare
+				: 0;
+}
+
+// A change of colour means that none of the text that we drew can be kept
+void FieldWithText::SetColours(Colour pf, Colour pb)
+{
+	if (fcolour != pf || bcolour != pb)
+	{
+		char * array null const drawn = DrawnText();
+		if (drawn != nullptr)
+		{
+			drawn[0] = 0;
+		}
+		DisplayField::SetColours(pf, pb);
 	}
 }
 
-void TextField::PrintText() const
+void TextField::PrintText(Print& p) const
 {
 	if (label != NULL)
 	{
-		lcd.print(label);
+		p.print(label);
 	}
 	if (text != NULL)
 	{
-		lcd.print(text);
+		p.print(text);
 	}
 }
 
-void FloatField::PrintText() const
+void FloatField::PrintText(Print& p) const
 {
 	if (label != NULL)
 	{
-		lcd.print(label);
+		p.print(label);
 	}
-	lcd.print(val, numDecimals);
+	p.print(val, numDecimals);
 	if (units != NULL)
 	{
-		lcd.print(units);
+		p.print(units);
 	}
 }
 
-void IntegerField::PrintText() const
+void IntegerField::PrintText(Print& p) const
 {
 	if (label != NULL)
 	{
-		lcd.print(label);
+		p.print(label);
 	}
-	lcd.print(val);
+	p.print(val);
 	if (units != NULL)
 	{
-		lcd.print(units);
+		p.print(units);
 	}
 }
 
-void StaticTextField::PrintText() const
+void StaticTextField::PrintText(Print& p) const
 {
 	if (text != nullptr)
 	{
-		lcd.print(text);
+		p.print(text);
 	}
 }
 
 ButtonBase::ButtonBase(PixelNumber py, PixelNumber px, PixelNumber pw)
 	: DisplayField(py, px, pw),
 	  borderColour(defaultButtonBorderColour), gradColour(defaultGradColour),
-	  pressedBackColour(defaultPressedBackColour), pressedGradColour(defaultPressedGradColour), evt(nullEvent), pressed(false)
+	  pressedBackColour(defaultPressedBackColour), pressedGradColour(defaultPressedGradColour), evt(nullEvent), pressed(false), textWidth(0)
 {	
 }
 
 PixelNumber ButtonBase::textMargin = 1;
 PixelNumber ButtonBase::iconMargin = 1;
+ButtonSkinCache ButtonBase::skinCache;
 
 void ButtonBase::DrawOutline(PixelNumber xOffset, PixelNumber yOffset, bool isPressed) const
 {
+	// Most buttons share a few sizes and colours, so when we are composing a band we draw the background from the skin cache if we can.
+	// Scrolling can split a band across the ends of the scroll area, so we don't use the cache while the display is scrolled.
+	const bool useCache = ButtonSkinCache::NumEntries != 0 && lcd.isComposing() && !lcd.isScrolled();
+	ButtonSkinKey key;
+	if (useCache)
+	{
+		key.width = width;
+		key.height = GetHeight();
+		key.bandX = lcd.getBandX() - (x + xOffset);
+		key.bandY = lcd.getBandY() - (y + yOffset);
+		key.fill = (isPressed) ? pressedBackColour : bcolour;
+		key.grad = (isPressed) ? pressedGradColour : gradColour;
+		key.border = borderColour;
+		key.backdrop = backdropColour;
+		key.orient = lcd.getOrientation();
+		if (skinCache.Draw(key))
+		{
+			return;
+		}
+	}
+
 	lcd.setColor((isPressed) ? pressedBackColour : bcolour);
 	// Note that we draw the filled rounded rectangle with the full width but 2 pixels less height than the border.
 	// This means that we start with the requested colour inside the border.
 	lcd.fillRoundRect(x + xOffset, y + yOffset + 1, x + xOffset + width - 1, y + yOffset + GetHeight() - 2, (isPressed) ? pressedGradColour : gradColour, buttonGradStep);
 	lcd.setColor(borderColour);
 	lcd.drawRoundRect(x + xOffset, y + yOffset, x + xOffset + width - 1, y + yOffset + GetHeight() - 1);
+	if (useCache)
+	{
+		skinCache.Store(key);
+	}
 }
 
 SingleButton::SingleButton(PixelNumber py, PixelNumber px, PixelNumber pw)
@@ -466,20 +1039,30 @@ void ButtonWithText::Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset
 {
 	if (full || changed)
 	{
-		DrawOutline(xOffset, yOffset);
-		lcd.setTransparentBackground(true);
-		lcd.setColor(fcolour);
-		lcd.setFont(font);
-		lcd.setTextPos(0, 9999, width - 6);
-		PrintText();							// dummy print to get text width
-		PixelNumber spare = width - 6 - lcd.getTextX();
-		lcd.setTextPos(x + xOffset + 3 + spare/2, y + yOffset + textMargin + 1, x + xOffset + width - 3);	// text is always centre-aligned
-		PrintText();
-		lcd.setTransparentBackground(false);
+		if (changed)
+		{
+			lcd.setFont(font);
+			lcd.beginMeasure(width - 6);
+			PrintText();
+			textWidth = lcd.endMeasure();
+		}
+		Compose(xOffset, yOffset, backdropColour);
 		changed = false;
 	}
 }
 
+void ButtonWithText::Draw(PixelNumber xOffset, PixelNumber yOffset) const
+{
+	DrawOutline(xOffset, yOffset);
+	lcd.setTransparentBackground(true);
+	lcd.setColor(fcolour);
+	lcd.setFont(font);
+	const PixelNumber spare = width - 6 - textWidth;
+	lcd.setTextPos(x + xOffset + 3 + spare/2, y + yOffset + textMargin + 1, x + xOffset + width - 3);	// text is always centre-aligned
+	PrintText();
+	lcd.setTransparentBackground(false);
+}
+
 CharButton::CharButton(PixelNumber py, PixelNumber px, PixelNumber pw, char pc, event_t e)
 	: ButtonWithText(py, px, pw)
 {
@@ -521,15 +1104,20 @@ void IconButton::Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset)
 {
 	if (full || changed)
 	{
-		DrawOutline(xOffset, yOffset);
-		const uint16_t sx = GetIconWidth(icon), sy = GetIconHeight(icon);
-		lcd.setTransparentBackground(true);
-		lcd.drawBitmap(xOffset + x + (width - sx)/2, yOffset + y + iconMargin + 1, sx, sy, GetIconData(icon));
-		lcd.setTransparentBackground(false);
+		Compose(xOffset, yOffset, backdropColour);
 		changed = false;
 	}
 }
 
+void IconButton::Draw(PixelNumber xOffset, PixelNumber yOffset) const
+{
+	DrawOutline(xOffset, yOffset);
+	const uint16_t sx = GetIconWidth(icon), sy = GetIconHeight(icon);
+	lcd.setTransparentBackground(true);
+	lcd.drawCompressedBitmap(xOffset + x + (width - sx)/2, yOffset + y + iconMargin + 1, sx, sy, GetIconData(icon));
+	lcd.setTransparentBackground(false);
+}
+
 void IntegerButton::PrintText() const
 {
 	if (label != NULL)
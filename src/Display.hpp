@@ -11,6 +11,7 @@
 
 #include "ecv.h"
 #include "Hardware/UTFT.hpp"
+#include "ButtonSkinCache.hpp"
 
 // Fonts are held as arrays of 8-bit data in flash.
 typedef const uint8_t * array LcdFont;
@@ -75,25 +76,37 @@ protected:
 	Colour fcolour, bcolour;					// foreground and background colours
 	bool changed;
 	bool visible;
+	bool obscured;								// covered by a popup, set by the window that displays the field when its popups change
 	
 	static LcdFont defaultFont;
 	static Colour defaultFcolour, defaultBcolour;
 	static Colour defaultButtonBorderColour, defaultGradColour, defaultPressedBackColour, defaultPressedGradColour;
+	static Colour backdropColour;				// background colour of the window whose fields are being refreshed
+	static uint32_t layoutVersion;				// changed whenever a field is moved, shown, hidden or given an event, so that FindEvent rebuilds its index
 	
 protected:
 	DisplayField(PixelNumber py, PixelNumber px, PixelNumber pw);
 	
 	virtual PixelNumber GetHeight() const { return 1; }		// would like to make this pure virtual but then we get 50K of library that we don't want
+	virtual void Draw(PixelNumber /*xOffset*/, PixelNumber /*yOffset*/) const { }		// draw the whole field, used by Compose
+	bool IsComposed() const;
+	void Compose(PixelNumber xOffset, PixelNumber yOffset, Colour background) const;
+	void Compose(PixelNumber xOffset, PixelNumber yOffset, Colour background, PixelNumber minCol, PixelNumber maxCol) const;
 
 public:
 	DisplayField * null next;					// link to next field in list
 
 	virtual bool IsButton() const { return false; }
+	virtual bool FillsArea() const { return false; }	// true if a full refresh writes every pixel of the field, so the window needn't clear it first
 	bool IsVisible() const { return visible; }
+	bool IsObscured() const { return obscured; }
+	void SetObscured(bool o) { obscured = o; }
 	void Show(bool v);
 	virtual void Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset) { }		// would like to make this pure virtual but then we get 50K of library that we don't want
-	void SetColours(Colour pf, Colour pb);
+	virtual void SetColours(Colour pf, Colour pb);
 	void SetChanged() { changed = true; }
+	bool HasChanged() const { return changed; }
+	void SetYpos(PixelNumber py) { y = py; ++layoutVersion; }
 	PixelNumber GetMinX() const { return x; }
 	PixelNumber GetMaxX() const { return x + width - 1; }
 	PixelNumber GetMinY() const { return y; }
@@ -104,12 +117,14 @@ public:
 	static void SetDefaultColours(Colour pf, Colour pb) { defaultFcolour = pf; defaultBcolour = pb; }
 	static void SetDefaultColours(Colour pf, Colour pb, Colour pbb, Colour pg, Colour pbp, Colour pgp);
 	static void SetDefaultFont(LcdFont pf) { defaultFont = pf; }
+	static void SetBackdropColour(Colour pb) { backdropColour = pb; }
 	static ButtonPress FindEvent(PixelNumber x, PixelNumber y, DisplayField * null p);
+	static uint32_t GetLayoutVersion() { return layoutVersion; }
 	
 	// Icon management
 	static PixelNumber GetIconWidth(Icon ic) { return ic[0]; }
 	static PixelNumber GetIconHeight(Icon ic) { return ic[1]; }
-	static const uint16_t * array GetIconData(Icon ic) { return ic + 2; }
+	static const uint16_t * array GetIconData(Icon ic) { return ic + 2; }		// compressed, see Tools/MakeIcons.py
 		
 	static PixelNumber GetTextWidth(const char* array s, PixelNumber maxWidth);		// find out how much width we need to print this text
 };
@@ -122,6 +137,14 @@ protected:
 	DisplayField * null root;
 	PopupWindow * null next;
 	Colour backgroundColour;
+	const DisplayField * null occlusionRoot;	// the field list and layout version that the obscured flags of our fields were worked out for
+	uint32_t occlusionVersion;
+
+	bool CoveredByPopup(const DisplayField *p) const;
+	void ClearUncovered(PixelNumber minX, PixelNumber minY, PixelNumber maxX, PixelNumber maxY) const;
+	uint32_t FillUncovered(PixelNumber minX, PixelNumber minY, PixelNumber maxX, PixelNumber maxY, bool doFill) const;
+	void UpdateOcclusion();
+	void CheckOcclusion();
 	
 public:
 	Window(Colour pb);
@@ -131,13 +154,15 @@ public:
 	ButtonPress FindEvent(PixelNumber x, PixelNumber y);
 	ButtonPress FindEventOutsidePopup(PixelNumber x, PixelNumber y);
 	DisplayField * null GetRoot() const { return root; }
+	void RefreshField(DisplayField *f, bool full) const;
 	void Redraw(DisplayField *f);
 	void Show(DisplayField *f, bool v);
 	void Press(ButtonPress bp, bool v);
 	void SetPopup(PopupWindow * p, PixelNumber px = 0, PixelNumber py = 0);
 	void ClearPopup();
-	bool ObscuredByPopup(const DisplayField *p) const;
-	bool Visible(const DisplayField *p) const;
+	bool HasPopup() const { return next != nullptr; }
+	bool ObscuredByPopup(const DisplayField *p);
+	bool Visible(const DisplayField *p);
 };
 
 class MainWindow : public Window
@@ -147,7 +172,7 @@ public:
 	void Init(Colour pb);
 	void ClearAll();
 	void Refresh(bool full = 0);
-	void SetRoot(DisplayField * null r) { root = r; }
+	void SetRoot(DisplayField * null r) { root = r; UpdateOcclusion(); }
 };
 
 class PopupWindow : public Window
@@ -170,19 +195,34 @@ class FieldWithText : public DisplayField
 {
 	LcdFont font;
 	TextAlignment align;
+	PixelNumber textWidth;						// width of the text when we last drew it, so that we don't measure it again until it changes
 	
+	// While we redraw part of a field, the new text, the part of it to draw, where the text starts and the area that the old text covered
+	static const char * array null partialText;
+	static size_t partialStart, partialEnd;
+	static PixelNumber partialTextX, partialClearFrom, partialClearTo;
+
+	PixelNumber AlignmentOffset(PixelNumber spare) const;
+	bool RefreshChangedText(PixelNumber xOffset, PixelNumber yOffset);
+
 protected:
+	static const size_t MaxDrawnTextLength = 15;	// the longest text that a field that redraws only what has changed can remember
+
 	PixelNumber GetHeight() const override { return UTFT::GetFontHeight(font); }
 	
-	virtual void PrintText() const {}		// would ideally be pure virtual
+	virtual void PrintText(Print& /*p*/) const {}		// would ideally be pure virtual
+	virtual char * array null DrawnText() { return nullptr; }	// where a field that redraws only what has changed keeps the text that it last drew
+	void Draw(PixelNumber xOffset, PixelNumber yOffset) const override final;
 
 	FieldWithText(PixelNumber py, PixelNumber px, PixelNumber pw, TextAlignment pa)
-		: DisplayField(py, px, pw), font(DisplayField::defaultFont), align(pa)
+		: DisplayField(py, px, pw), font(DisplayField::defaultFont), align(pa), textWidth(0)
 	{
 	}
 		
 public:
+	bool FillsArea() const override { return IsComposed(); }
 	void Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset) override final;
+	void SetColours(Colour pf, Colour pb) override;
 };
 	
 class TextField : public FieldWithText
@@ -191,7 +231,7 @@ class TextField : public FieldWithText
 	const char* array null text;
 	
 protected:
-	void PrintText() const override;
+	void PrintText(Print& p) const override;
 
 public:
 	TextField(PixelNumber py, PixelNumber px, PixelNumber pw, TextAlignment pa, const char * array null pl, const char* array null pt = nullptr)
@@ -218,14 +258,17 @@ class FloatField : public FieldWithText
 	const char* array null units;
 	float val;
 	uint8_t numDecimals;
+	char drawnText[MaxDrawnTextLength + 1];
 
 protected:
-	void PrintText() const override;
+	void PrintText(Print& p) const override;
+	char * array null DrawnText() override { return drawnText; }
 
 public:
 	FloatField(PixelNumber py, PixelNumber px, PixelNumber pw, TextAlignment pa, uint8_t pd, const char * array pl = NULL, const char * array null pu = NULL)
 		: FieldWithText(py, px, pw, pa), label(pl), units(pu), val(0.0), numDecimals(pd)
 	{
+		drawnText[0] = 0;
 	}
 
 	void SetValue(float v)
@@ -240,14 +283,17 @@ class IntegerField : public FieldWithText
 	const char* array null label;
 	const char* array null units;
 	int val;
+	char drawnText[MaxDrawnTextLength + 1];
 
 protected:
-	void PrintText() const override;
+	void PrintText(Print& p) const override;
+	char * array null DrawnText() override { return drawnText; }
 
 public:
 	IntegerField(PixelNumber py, PixelNumber px, PixelNumber pw, TextAlignment pa, const char *pl = NULL, const char *pu = NULL)
 		: FieldWithText(py, px, pw, pa), label(pl), units(pu), val(0)
 	{
+		drawnText[0] = 0;
 	}
 
 	void SetValue(int v)
@@ -262,7 +308,7 @@ class StaticTextField : public FieldWithText
 	const char * array null text;
 
 protected:
-	void PrintText() const override;
+	void PrintText(Print& p) const override;
 
 public:
 	StaticTextField(PixelNumber py, PixelNumber px, PixelNumber pw, TextAlignment pa, const char * array null pt)
@@ -281,6 +327,7 @@ protected:
 	Colour borderColour, gradColour, pressedBackColour, pressedGradColour;
 	event_t evt;								// event number that is triggered by touching this field
 	bool pressed;								// putting this here instead of in SingleButton saves 4 byes per button
+	PixelNumber textWidth;						// width of the text of a ButtonWithText when we last drew it, here for the same reason
 
 	
 	ButtonBase(PixelNumber py, PixelNumber px, PixelNumber pw);
@@ -289,12 +336,15 @@ protected:
 	
 	static PixelNumber textMargin;
 	static PixelNumber iconMargin;
+	static ButtonSkinCache skinCache;
 
 public:
 	event_t GetEvent() const override { return evt; }
 	virtual const char* null GetSParam(unsigned int index) const { return nullptr; }
 	virtual int GetIParam(unsigned int index) const { return 0; }
 	virtual void Press(bool p, int index) { }
+
+	static ButtonSkinCache& GetSkinCache() { return skinCache; }
 };
 
 class SingleButton : public ButtonBase
@@ -314,8 +364,8 @@ protected:
 public:
 	bool IsButton() const override final { return true; }
 
-	void SetEvent(event_t e, const char* null sp ) { evt = e; param.sParam = sp; }
-	void SetEvent(event_t e, int ip ) { evt = e; param.iParam = ip; }
+	void SetEvent(event_t e, const char* null sp ) { evt = e; param.sParam = sp; ++layoutVersion; }
+	void SetEvent(event_t e, int ip ) { evt = e; param.iParam = ip; ++layoutVersion; }
 	//void SetEvent(event_t e, float fp ) { evt = e; param.fParam = fp; }
 
 	const char* null GetSParam(unsigned int index) const override { return param.sParam; }
@@ -343,11 +393,13 @@ protected:
 	PixelNumber GetHeight() const override { return UTFT::GetFontHeight(font) + 2 * textMargin + 2; }
 
 	virtual void PrintText() const {}		// ideally would be pure virtual
+	void Draw(PixelNumber xOffset, PixelNumber yOffset) const override final;
 
 public:
 	ButtonWithText(PixelNumber py, PixelNumber px, PixelNumber pw)
 		: SingleButton(py, px, pw), font(DisplayField::defaultFont) {}
 
+	bool FillsArea() const override { return IsComposed(); }
 	void Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset) override final;	
 };
 
@@ -419,10 +471,12 @@ class IconButton : public SingleButton
 	
 protected:
 	PixelNumber GetHeight() const override { return GetIconHeight(icon) + 2 * iconMargin + 2; }
+	void Draw(PixelNumber xOffset, PixelNumber yOffset) const override final;
 
 public:
 	IconButton(PixelNumber py, PixelNumber px, PixelNumber pw, Icon ic, event_t e, int param = 0);
 
+	bool FillsArea() const override { return IsComposed(); }
 	void Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset) override final;
 };
 
@@ -577,7 +577,10 @@ namespace Fields
 			currentTemps[i]->SetValue(0.0);
 			activeTemps[i]->SetValue(0.0);
 			standbyTemps[i]->SetValue(0.0);
-			extrusionFactors[i]->SetValue(100);
+			if (i + 1 < maxHeaters)
+			{
+				extrusionFactors[i]->SetValue(100);		// there is one extrusion factor per extruder, so one fewer than the number of heaters
+			}
 		}
 
 		xPos->SetValue(0.0);
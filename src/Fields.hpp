@@ -98,8 +98,8 @@ const PixelNumber firstMessageRow = margin + rowHeight + 3;		// adjust this to g
 const PixelNumber progressBarHeight = 10;
 const PixelNumber touchCalibMargin = 15;
 
-extern uint8_t glcd19x21[];				// declare which fonts we will be using
-#define DEFAULT_FONT	glcd19x21
+extern uint8_t glcd19x21c[];			// declare which fonts we will be using
+#define DEFAULT_FONT	glcd19x21c
 
 #elif DISPLAY_X == 800
 
@@ -141,9 +141,8 @@ const PixelNumber firstMessageRow = margin + rowHeight;		// adjust this to get a
 const PixelNumber progressBarHeight = 16;
 const PixelNumber touchCalibMargin = 22;
 
-extern uint8_t glcd28x32[];				// declare which fonts we will be using
-extern uint8_t glcd28x32[];				// declare which fonts we will be using
-#define DEFAULT_FONT	glcd28x32
+extern uint8_t glcd28x32c[];			// declare which fonts we will be using
+#define DEFAULT_FONT	glcd28x32c
 
 #else
 
@@ -0,0 +1,1825 @@
+/*
+ * glcd19x21c.cpp
+ *
+ * Generated by Tools/MakeFont.py from glcd19x21.cpp - do not edit
+ * Command: MakeFont.py --ttf DejaVuSans.ttf --ranges 0x384-0x3CE,0x400-0x45F glcd19x21.cpp glcd19x21c.cpp
+ * TrueType font: DejaVu Sans, Version 2.37, SHA-256 abdc775b21b1bc470d50c97e790d276f2054b7504e56e5bd3e64f48d68582322
+ */
+
+#include <asf.h>
+
+extern const uint8_t glcd19x21c[] =
+{
+	0x00,	// compact font format
+	21,		// row height in pixels
+	2,		// space columns between characters before kerning
+	0x06, 0x00,	// number of character ranges
+	20,		// maximum character width in pixels
+	0x03,	// flags
+	0x00,	// reserved
+
+	// Character ranges: first code, last code, first glyph number
+	0x20, 0x00, 0xFF, 0x00, 0x00, 0x00,	// ' '-0xFF
+	0x84, 0x03, 0x8A, 0x03, 0xE0, 0x00,	// U+0384-U+038A
+	0x8C, 0x03, 0x8C, 0x03, 0xE7, 0x00,	// U+038C-U+038C
+	0x8E, 0x03, 0xA1, 0x03, 0xE8, 0x00,	// U+038E-U+03A1
+	0xA3, 0x03, 0xCE, 0x03, 0xFC, 0x00,	// U+03A3-U+03CE
+	0x00, 0x04, 0x5F, 0x04, 0x28, 0x01,	// U+0400-U+045F
+
+	// Glyph offsets
+	0x00, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x1E, 0x00, 0x45, 0x00, 0x6C, 0x00, 0xA2, 0x00, 0xCC, 0x00,
+	0xD5, 0x00, 0xE7, 0x00, 0xF9, 0x00, 0x0E, 0x01, 0x2F, 0x01, 0x38, 0x01, 0x4A, 0x01, 0x53, 0x01,
+	0x68, 0x01, 0x89, 0x01, 0xA7, 0x01, 0xC8, 0x01, 0xE9, 0x01, 0x0D, 0x02, 0x2E, 0x02, 0x4F, 0x02,
+	0x70, 0x02, 0x91, 0x02, 0xB2, 0x02, 0xBB, 0x02, 0xC4, 0x02, 0xE5, 0x02, 0x06, 0x03, 0x27, 0x03,
+	0x48, 0x03, 0x7E, 0x03, 0xA8, 0x03, 0xCC, 0x03, 0xF6, 0x03, 0x1D, 0x04, 0x41, 0x04, 0x62, 0x04,
+	0x8C, 0x04, 0xAD, 0x04, 0xB6, 0x04, 0xD4, 0x04, 0xF8, 0x04, 0x16, 0x05, 0x40, 0x05, 0x61, 0x05,
+	0x8E, 0x05, 0xB2, 0x05, 0xDF, 0x05, 0x06, 0x06, 0x2D, 0x06, 0x54, 0x06, 0x7B, 0x06, 0xA5, 0x06,
+	0xE1, 0x06, 0x08, 0x07, 0x2F, 0x07, 0x53, 0x07, 0x62, 0x07, 0x77, 0x07, 0x86, 0x07, 0xA1, 0x07,
+	0xC8, 0x07, 0xD7, 0x07, 0xFB, 0x07, 0x19, 0x08, 0x37, 0x08, 0x55, 0x08, 0x76, 0x08, 0x8B, 0x08,
+	0xA9, 0x08, 0xC7, 0x08, 0xD0, 0x08, 0xDC, 0x08, 0xFA, 0x08, 0x03, 0x09, 0x30, 0x09, 0x4E, 0x09,
+	0x6F, 0x09, 0x8D, 0x09, 0xAB, 0x09, 0xC0, 0x09, 0xDE, 0x09, 0xF3, 0x09, 0x11, 0x0A, 0x35, 0x0A,
+	0x65, 0x0A, 0x80, 0x0A, 0xA4, 0x0A, 0xBC, 0x0A, 0xD4, 0x0A, 0xDD, 0x0A, 0xF5, 0x0A, 0x16, 0x0B,
+	0x28, 0x0B, 0x2B, 0x0B, 0x2E, 0x0B, 0x31, 0x0B, 0x34, 0x0B, 0x37, 0x0B, 0x3A, 0x0B, 0x3D, 0x0B,
+	0x40, 0x0B, 0x43, 0x0B, 0x46, 0x0B, 0x49, 0x0B, 0x4C, 0x0B, 0x4F, 0x0B, 0x52, 0x0B, 0x55, 0x0B,
+	0x58, 0x0B, 0x5B, 0x0B, 0x5E, 0x0B, 0x61, 0x0B, 0x64, 0x0B, 0x67, 0x0B, 0x6A, 0x0B, 0x6D, 0x0B,
+	0x70, 0x0B, 0x73, 0x0B, 0x76, 0x0B, 0x79, 0x0B, 0x7C, 0x0B, 0x7F, 0x0B, 0x82, 0x0B, 0x85, 0x0B,
+	0x88, 0x0B, 0x8B, 0x0B, 0x94, 0x0B, 0xB2, 0x0B, 0xD6, 0x0B, 0xF7, 0x0B, 0x1E, 0x0C, 0x27, 0x0C,
+	0x48, 0x0C, 0x5D, 0x0C, 0x8D, 0x0C, 0xA5, 0x0C, 0xC6, 0x0C, 0xE7, 0x0C, 0xF9, 0x0C, 0x29, 0x0D,
+	0x50, 0x0D, 0x65, 0x0D, 0x86, 0x0D, 0x9B, 0x0D, 0xAD, 0x0D, 0xBC, 0x0D, 0xDD, 0x0D, 0xFB, 0x0D,
+	0x04, 0x0E, 0x10, 0x0E, 0x25, 0x0E, 0x40, 0x0E, 0x61, 0x0E, 0x94, 0x0E, 0xC7, 0x0E, 0xFA, 0x0E,
+	0x1B, 0x0F, 0x45, 0x0F, 0x6F, 0x0F, 0x99, 0x0F, 0xC3, 0x0F, 0xED, 0x0F, 0x17, 0x10, 0x53, 0x10,
+	0x7D, 0x10, 0xA1, 0x10, 0xC5, 0x10, 0xE9, 0x10, 0x0D, 0x11, 0x19, 0x11, 0x25, 0x11, 0x37, 0x11,
+	0x4F, 0x11, 0x7C, 0x11, 0x9D, 0x11, 0xCA, 0x11, 0xF7, 0x11, 0x24, 0x12, 0x51, 0x12, 0x7E, 0x12,
+	0x99, 0x12, 0xC6, 0x12, 0xED, 0x12, 0x14, 0x13, 0x3B, 0x13, 0x62, 0x13, 0x89, 0x13, 0xAD, 0x13,
+	0xD1, 0x13, 0xF5, 0x13, 0x19, 0x14, 0x3D, 0x14, 0x61, 0x14, 0x85, 0x14, 0xA9, 0x14, 0xDF, 0x14,
+	0xFD, 0x14, 0x1E, 0x15, 0x3F, 0x15, 0x60, 0x15, 0x81, 0x15, 0x90, 0x15, 0x9F, 0x15, 0xB7, 0x15,
+	0xCC, 0x15, 0xED, 0x15, 0x0B, 0x16, 0x2C, 0x16, 0x4D, 0x16, 0x6E, 0x16, 0x8F, 0x16, 0xB0, 0x16,
+	0xD1, 0x16, 0xF2, 0x16, 0x10, 0x17, 0x2E, 0x17, 0x4C, 0x17, 0x6A, 0x17, 0x8E, 0x17, 0xAF, 0x17,
+	0xD3, 0x17, 0xE2, 0x17, 0xF7, 0x17, 0x21, 0x18, 0x2A, 0x18, 0x54, 0x18, 0x84, 0x18, 0x99, 0x18,
+	0xC9, 0x18, 0xFC, 0x18, 0x2C, 0x19, 0x41, 0x19, 0x6B, 0x19, 0x8C, 0x19, 0xAA, 0x19, 0xD4, 0x19,
+	0xF2, 0x19, 0x16, 0x1A, 0x3A, 0x1A, 0x64, 0x1A, 0x6D, 0x1A, 0x91, 0x1A, 0xBB, 0x1A, 0xE5, 0x1A,
+	0x09, 0x1B, 0x27, 0x1B, 0x51, 0x1B, 0x75, 0x1B, 0x93, 0x1B, 0xB1, 0x1B, 0xD8, 0x1B, 0xFC, 0x1B,
+	0x26, 0x1C, 0x4D, 0x1C, 0x77, 0x1C, 0xA1, 0x1C, 0xB6, 0x1C, 0xDA, 0x1C, 0xFE, 0x1C, 0x19, 0x1D,
+	0x37, 0x1D, 0x46, 0x1D, 0x64, 0x1D, 0x88, 0x1D, 0xA6, 0x1D, 0xC7, 0x1D, 0xE8, 0x1D, 0x03, 0x1E,
+	0x21, 0x1E, 0x3F, 0x1E, 0x60, 0x1E, 0x6F, 0x1E, 0x8D, 0x1E, 0xAE, 0x1E, 0xCF, 0x1E, 0xED, 0x1E,
+	0x0B, 0x1F, 0x2C, 0x1F, 0x4D, 0x1F, 0x6B, 0x1F, 0x86, 0x1F, 0xAA, 0x1F, 0xCB, 0x1F, 0xE9, 0x1F,
+	0x0D, 0x20, 0x2E, 0x20, 0x52, 0x20, 0x7C, 0x20, 0x91, 0x20, 0xAF, 0x20, 0xD0, 0x20, 0xEE, 0x20,
+	0x18, 0x21, 0x36, 0x21, 0x54, 0x21, 0x81, 0x21, 0x9F, 0x21, 0xC3, 0x21, 0xE4, 0x21, 0xED, 0x21,
+	0x02, 0x22, 0x14, 0x22, 0x50, 0x22, 0x86, 0x22, 0xB3, 0x22, 0xD7, 0x22, 0xFB, 0x22, 0x1F, 0x23,
+	0x43, 0x23, 0x6D, 0x23, 0x8E, 0x23, 0xAF, 0x23, 0xCD, 0x23, 0xF7, 0x23, 0x15, 0x24, 0x54, 0x24,
+	0x75, 0x24, 0x99, 0x24, 0xBD, 0x24, 0xE1, 0x24, 0x08, 0x25, 0x32, 0x25, 0x56, 0x25, 0x80, 0x25,
+	0xA4, 0x25, 0xC2, 0x25, 0xE6, 0x25, 0x0D, 0x26, 0x31, 0x26, 0x5E, 0x26, 0x85, 0x26, 0xAC, 0x26,
+	0xCD, 0x26, 0x03, 0x27, 0x3C, 0x27, 0x69, 0x27, 0x93, 0x27, 0xB4, 0x27, 0xD8, 0x27, 0x11, 0x28,
+	0x32, 0x28, 0x50, 0x28, 0x71, 0x28, 0x8C, 0x28, 0xA4, 0x28, 0xC8, 0x28, 0xE9, 0x28, 0x1C, 0x29,
+	0x37, 0x29, 0x55, 0x29, 0x73, 0x29, 0x91, 0x29, 0xB2, 0x29, 0xD6, 0x29, 0xF4, 0x29, 0x15, 0x2A,
+	0x33, 0x2A, 0x51, 0x2A, 0x6C, 0x2A, 0x8D, 0x2A, 0xAE, 0x2A, 0xDB, 0x2A, 0xFC, 0x2A, 0x1D, 0x2B,
+	0x38, 0x2B, 0x65, 0x2B, 0x95, 0x2B, 0xBC, 0x2B, 0xE3, 0x2B, 0xFE, 0x2B, 0x19, 0x2C, 0x43, 0x2C,
+	0x61, 0x2C, 0x82, 0x2C, 0xA3, 0x2C, 0xC7, 0x2C, 0xDF, 0x2C, 0xFA, 0x2C, 0x15, 0x2D, 0x1E, 0x2D,
+	0x33, 0x2D, 0x42, 0x2D, 0x72, 0x2D, 0x9F, 0x2D, 0xC0, 0x2D, 0xDE, 0x2D, 0xFC, 0x2D, 0x1D, 0x2E,
+
+	// Glyph metrics: advance, kerning column, last ink column
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// ' '
+	0x02, 0xF8, 0x9F, 0x01, 0xF8, 0x9F, 0x01,	// '!'
+	0x05, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,	// '"'
+	0x0C, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00,	// '#'
+	0x0C, 0x00, 0x20, 0x00, 0x00, 0x30, 0x00,	// '$'
+	0x11, 0xF0, 0x03, 0x00, 0x00, 0xFC, 0x00,	// '%'
+	0x0D, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x01,	// '&'
+	0x02, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,	// '''
+	0x05, 0x00, 0x3E, 0x00, 0x0C, 0x00, 0x18,	// '('
+	0x06, 0x0C, 0x00, 0x18, 0x00, 0x3E, 0x00,	// ')'
+	0x06, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00,	// '*'
+	0x0A, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00,	// '+'
+	0x02, 0x00, 0x80, 0x09, 0x00, 0x80, 0x07,	// ','
+	0x05, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,	// '-'
+	0x02, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01,	// '.'
+	0x06, 0x00, 0x80, 0x01, 0x0C, 0x00, 0x00,	// '/'
+	0x0A, 0xC0, 0x3F, 0x00, 0xC0, 0x3F, 0x00,	// '0'
+	0x09, 0x60, 0x00, 0x01, 0x00, 0x00, 0x01,	// '1'
+	0x0A, 0x40, 0x80, 0x01, 0xC0, 0x00, 0x01,	// '2'
+	0x0A, 0x60, 0x60, 0x00, 0x60, 0x78, 0x00,	// '3'
+	0x0B, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00,	// '4'
+	0x0A, 0x80, 0x63, 0x00, 0x00, 0x7C, 0x00,	// '5'
+	0x0A, 0x80, 0x1F, 0x00, 0x00, 0x7C, 0x00,	// '6'
+	0x0A, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00,	// '7'
+	0x0A, 0xE0, 0x78, 0x00, 0xE0, 0x78, 0x00,	// '8'
+	0x0A, 0xE0, 0x43, 0x00, 0xC0, 0x1F, 0x00,	// '9'
+	0x02, 0xC0, 0x80, 0x01, 0xC0, 0x80, 0x01,	// ':'
+	0x02, 0xC0, 0x80, 0x09, 0xC0, 0x80, 0x07,	// ';'
+	0x0A, 0x00, 0x07, 0x00, 0x30, 0x60, 0x00,	// '<'
+	0x0A, 0x80, 0x10, 0x00, 0x80, 0x10, 0x00,	// '='
+	0x0A, 0x30, 0x60, 0x00, 0x00, 0x07, 0x00,	// '>'
+	0x0A, 0x60, 0x00, 0x00, 0xE0, 0x01, 0x00,	// '?'
+	0x11, 0x00, 0xFF, 0x00, 0xC0, 0x1F, 0x00,	// '@'
+	0x0D, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,	// 'A'
+	0x0B, 0xF8, 0xFF, 0x01, 0x00, 0x78, 0x00,	// 'B'
+	0x0D, 0x80, 0x1F, 0x00, 0x60, 0x60, 0x00,	// 'C'
+	0x0C, 0xF8, 0xFF, 0x01, 0x80, 0x1F, 0x00,	// 'D'
+	0x0B, 0xF8, 0xFF, 0x01, 0x08, 0x00, 0x01,	// 'E'
+	0x0A, 0xF8, 0xFF, 0x01, 0x08, 0x04, 0x00,	// 'F'
+	0x0D, 0x80, 0x1F, 0x00, 0x60, 0x7C, 0x00,	// 'G'
+	0x0A, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,	// 'H'
+	0x02, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,	// 'I'
+	0x09, 0x00, 0x20, 0x00, 0xF8, 0x7F, 0x00,	// 'J'
+	0x0B, 0xF8, 0xFF, 0x01, 0x00, 0x00, 0x01,	// 'K'
+	0x09, 0xF8, 0xFF, 0x01, 0x00, 0x00, 0x01,	// 'L'
+	0x0D, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,	// 'M'
+	0x0A, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,	// 'N'
+	0x0E, 0x80, 0x1F, 0x00, 0x80, 0x1F, 0x00,	// 'O'
+	0x0B, 0xF8, 0xFF, 0x01, 0xE0, 0x01, 0x00,	// 'P'
+	0x0E, 0x80, 0x1F, 0x00, 0x80, 0x1F, 0x00,	// 'Q'
+	0x0C, 0xF8, 0xFF, 0x01, 0x00, 0x00, 0x01,	// 'R'
+	0x0C, 0x00, 0x60, 0x00, 0x00, 0x78, 0x00,	// 'S'
+	0x0C, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00,	// 'T'
+	0x0C, 0xF8, 0x0F, 0x00, 0xF8, 0x0F, 0x00,	// 'U'
+	0x0D, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00,	// 'V'
+	0x13, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00,	// 'W'
+	0x0C, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01,	// 'X'
+	0x0C, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,	// 'Y'
+	0x0B, 0x08, 0x80, 0x01, 0x08, 0x00, 0x01,	// 'Z'
+	0x04, 0xFC, 0xFF, 0x1F, 0x04, 0x00, 0x10,	// '['
+	0x06, 0x0C, 0x00, 0x00, 0x00, 0x80, 0x01,	// '\\'
+	0x04, 0x04, 0x00, 0x10, 0xFC, 0xFF, 0x1F,	// ']'
+	0x08, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00,	// '^'
+	0x0C, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10,	// '_'
+	0x04, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00,	// '`'
+	0x0B, 0x00, 0xF1, 0x00, 0x00, 0x00, 0x01,	// 'a'
+	0x09, 0xFC, 0xFF, 0x01, 0x00, 0x7F, 0x00,	// 'b'
+	0x09, 0x00, 0x3E, 0x00, 0x80, 0xC1, 0x00,	// 'c'
+	0x09, 0x00, 0x7F, 0x00, 0xFC, 0xFF, 0x01,	// 'd'
+	0x0A, 0x00, 0x3F, 0x00, 0x00, 0x4E, 0x00,	// 'e'
+	0x06, 0x40, 0x00, 0x00, 0x44, 0x00, 0x00,	// 'f'
+	0x09, 0x00, 0x7F, 0x04, 0xC0, 0xFF, 0x03,	// 'g'
+	0x09, 0xFC, 0xFF, 0x01, 0x00, 0xFF, 0x01,	// 'h'
+	0x02, 0xCC, 0xFF, 0x01, 0xCC, 0xFF, 0x01,	// 'i'
+	0x03, 0x00, 0x00, 0x10, 0xCC, 0xFF, 0x0F,	// 'j'
+	0x09, 0xFC, 0xFF, 0x01, 0x00, 0x00, 0x01,	// 'k'
+	0x02, 0xFC, 0xFF, 0x01, 0xFC, 0xFF, 0x01,	// 'l'
+	0x0E, 0xC0, 0xFF, 0x01, 0x00, 0xFF, 0x01,	// 'm'
+	0x09, 0xC0, 0xFF, 0x01, 0x00, 0xFF, 0x01,	// 'n'
+	0x0A, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00,	// 'o'
+	0x09, 0xC0, 0xFF, 0x1F, 0x00, 0x7F, 0x00,	// 'p'
+	0x09, 0x00, 0x7F, 0x00, 0xC0, 0xFF, 0x1F,	// 'q'
+	0x06, 0xC0, 0xFF, 0x01, 0xC0, 0x00, 0x00,	// 'r'
+	0x09, 0x80, 0xC3, 0x00, 0x80, 0xF1, 0x00,	// 's'
+	0x06, 0x40, 0x00, 0x00, 0x40, 0x00, 0x01,	// 't'
+	0x09, 0xC0, 0x7F, 0x00, 0xC0, 0xFF, 0x01,	// 'u'
+	0x0B, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00,	// 'v'
+	0x0F, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,	// 'w'
+	0x08, 0xC0, 0x80, 0x01, 0xC0, 0x80, 0x01,	// 'x'
+	0x0B, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00,	// 'y'
+	0x07, 0x40, 0x80, 0x01, 0xC0, 0x00, 0x01,	// 'z'
+	0x07, 0x00, 0x08, 0x00, 0x04, 0x00, 0x10,	// '{'
+	0x02, 0xFC, 0xFF, 0x1F, 0xFC, 0xFF, 0x1F,	// '|'
+	0x07, 0x04, 0x00, 0x10, 0x00, 0x08, 0x00,	// '}'
+	0x0A, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00,	// '~'
+	0x05, 0xFC, 0xFF, 0x00, 0xFC, 0xFF, 0x00,	// DEL
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x80
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x81
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x82
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x83
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x84
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x85
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x86
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x87
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x88
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x89
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x8A
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x8B
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x8C
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x8D
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x8E
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x8F
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x90
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x91
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x92
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x93
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x94
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x95
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x96
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x97
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x98
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x99
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x9A
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x9B
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x9C
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x9D
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x9E
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x9F
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0xA0
+	0x02, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F,	// 0xA1
+	0x09, 0x00, 0x06, 0x00, 0xC0, 0x38, 0x00,	// 0xA2
+	0x0B, 0x00, 0x82, 0x01, 0x00, 0x40, 0x00,	// 0xA3
+	0x0A, 0x00, 0x04, 0x00, 0x00, 0x0E, 0x00,	// 0xA4
+	0x0C, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00,	// 0xA5
+	0x02, 0xFC, 0xE3, 0x1F, 0xFC, 0xE3, 0x1F,	// 0xA6
+	0x0A, 0x00, 0x00, 0x01, 0x10, 0x86, 0x01,	// 0xA7
+	0x06, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00,	// 0xA8
+	0x0F, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00,	// 0xA9
+	0x07, 0x80, 0x03, 0x00, 0x00, 0x04, 0x00,	// 0xAA
+	0x0A, 0x00, 0x1C, 0x00, 0x80, 0x80, 0x00,	// 0xAB
+	0x0A, 0x00, 0x02, 0x00, 0x00, 0x7E, 0x00,	// 0xAC
+	0x05, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,	// 0xAD
+	0x0F, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00,	// 0xAE
+	0x0C, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00,	// 0xAF
+	0x06, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,	// 0xB0
+	0x0A, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01,	// 0xB1
+	0x06, 0x00, 0x08, 0x00, 0xF0, 0x08, 0x00,	// 0xB2
+	0x05, 0x10, 0x0C, 0x00, 0x70, 0x07, 0x00,	// 0xB3
+	0x04, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00,	// 0xB4
+	0x0A, 0xC0, 0xFF, 0x1F, 0x00, 0x00, 0x01,	// 0xB5
+	0x09, 0xF0, 0x01, 0x00, 0x08, 0x00, 0x00,	// 0xB6
+	0x02, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00,	// 0xB7
+	0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x18,	// 0xB8
+	0x06, 0x10, 0x08, 0x00, 0x00, 0x08, 0x00,	// 0xB9
+	0x08, 0xE0, 0x01, 0x00, 0xE0, 0x01, 0x00,	// 0xBA
+	0x0A, 0x80, 0x80, 0x00, 0x00, 0x1C, 0x00,	// 0xBB
+	0x10, 0x10, 0x08, 0x00, 0x00, 0x40, 0x00,	// 0xBC
+	0x10, 0x10, 0x08, 0x00, 0x00, 0x00, 0x01,	// 0xBD
+	0x10, 0x10, 0x0C, 0x00, 0x00, 0x40, 0x00,	// 0xBE
+	0x0A, 0x00, 0x80, 0x01, 0x00, 0x00, 0x03,	// 0xBF
+	0x0D, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,	// 0xC0
+	0x0D, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,	// 0xC1
+	0x0D, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,	// 0xC2
+	0x0D, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,	// 0xC3
+	0x0D, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,	// 0xC4
+	0x0D, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,	// 0xC5
+	0x13, 0x00, 0x80, 0x01, 0x08, 0x00, 0x01,	// 0xC6
+	0x0D, 0x80, 0x1F, 0x00, 0x60, 0x60, 0x00,	// 0xC7
+	0x0B, 0xF8, 0xFF, 0x01, 0x08, 0x00, 0x01,	// 0xC8
+	0x0B, 0xF8, 0xFF, 0x01, 0x08, 0x00, 0x01,	// 0xC9
+	0x0B, 0xF8, 0xFF, 0x01, 0x08, 0x00, 0x01,	// 0xCA
+	0x0B, 0xF8, 0xFF, 0x01, 0x08, 0x00, 0x01,	// 0xCB
+	0x03, 0x01, 0x00, 0x00, 0xFA, 0xFF, 0x01,	// 0xCC
+	0x03, 0xFA, 0xFF, 0x01, 0x01, 0x00, 0x00,	// 0xCD
+	0x05, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00,	// 0xCE
+	0x07, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,	// 0xCF
+	0x0E, 0x00, 0x02, 0x00, 0x80, 0x1F, 0x00,	// 0xD0
+	0x0A, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,	// 0xD1
+	0x0E, 0x80, 0x1F, 0x00, 0x80, 0x1F, 0x00,	// 0xD2
+	0x0E, 0x80, 0x1F, 0x00, 0x80, 0x1F, 0x00,	// 0xD3
+	0x0E, 0x80, 0x1F, 0x00, 0x80, 0x1F, 0x00,	// 0xD4
+	0x0E, 0x80, 0x1F, 0x00, 0x80, 0x1F, 0x00,	// 0xD5
+	0x0E, 0x80, 0x1F, 0x00, 0x80, 0x1F, 0x00,	// 0xD6
+	0x08, 0x60, 0x30, 0x00, 0x60, 0x30, 0x00,	// 0xD7
+	0x0E, 0x80, 0x1F, 0x01, 0x88, 0x1F, 0x00,	// 0xD8
+	0x0C, 0xF8, 0x0F, 0x00, 0xF8, 0x0F, 0x00,	// 0xD9
+	0x0C, 0xF8, 0x0F, 0x00, 0xF8, 0x0F, 0x00,	// 0xDA
+	0x0C, 0xF8, 0x0F, 0x00, 0xF8, 0x0F, 0x00,	// 0xDB
+	0x0C, 0xF8, 0x0F, 0x00, 0xF8, 0x0F, 0x00,	// 0xDC
+	0x0C, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,	// 0xDD
+	0x0B, 0xF8, 0xFF, 0x01, 0x80, 0x07, 0x00,	// 0xDE
+	0x0B, 0xC0, 0xFF, 0x01, 0x00, 0xF0, 0x00,	// 0xDF
+	0x0B, 0x00, 0xF1, 0x00, 0x00, 0x00, 0x01,	// 0xE0
+	0x0B, 0x00, 0xF1, 0x00, 0x00, 0x00, 0x01,	// 0xE1
+	0x0B, 0x00, 0xF1, 0x00, 0x00, 0x00, 0x01,	// 0xE2
+	0x0B, 0x00, 0xF1, 0x00, 0x00, 0x00, 0x01,	// 0xE3
+	0x0B, 0x00, 0xF1, 0x00, 0x00, 0x00, 0x01,	// 0xE4
+	0x0B, 0x00, 0xF1, 0x00, 0x00, 0x00, 0x01,	// 0xE5
+	0x11, 0x00, 0xF9, 0x00, 0x00, 0x4E, 0x00,	// 0xE6
+	0x09, 0x00, 0x3E, 0x00, 0x80, 0xC1, 0x00,	// 0xE7
+	0x0A, 0x00, 0x3F, 0x00, 0x00, 0x4E, 0x00,	// 0xE8
+	0x0A, 0x00, 0x3F, 0x00, 0x00, 0x4E, 0x00,	// 0xE9
+	0x0A, 0x00, 0x3F, 0x00, 0x00, 0x4E, 0x00,	// 0xEA
+	0x0A, 0x00, 0x3F, 0x00, 0x00, 0x4E, 0x00,	// 0xEB
+	0x04, 0x04, 0x00, 0x00, 0xD0, 0xFF, 0x01,	// 0xEC
+	0x04, 0xD0, 0xFF, 0x01, 0x04, 0x00, 0x00,	// 0xED
+	0x07, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00,	// 0xEE
+	0x06, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00,	// 0xEF
+	0x0A, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x00,	// 0xF0
+	0x09, 0xC0, 0xFF, 0x01, 0x00, 0xFF, 0x01,	// 0xF1
+	0x0A, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00,	// 0xF2
+	0x0A, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00,	// 0xF3
+	0x0A, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00,	// 0xF4
+	0x0A, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00,	// 0xF5
+	0x0A, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00,	// 0xF6
+	0x0A, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00,	// 0xF7
+	0x0A, 0x00, 0x1C, 0x01, 0x40, 0x1C, 0x00,	// 0xF8
+	0x09, 0xC0, 0x7F, 0x00, 0xC0, 0xFF, 0x01,	// 0xF9
+	0x09, 0xC0, 0x7F, 0x00, 0xC0, 0xFF, 0x01,	// 0xFA
+	0x09, 0xC0, 0x7F, 0x00, 0xC0, 0xFF, 0x01,	// 0xFB
+	0x09, 0xC0, 0x7F, 0x00, 0xC0, 0xFF, 0x01,	// 0xFC
+	0x0B, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00,	// 0xFD
+	0x0A, 0xFC, 0xFF, 0x1F, 0x00, 0x7F, 0x00,	// 0xFE
+	0x0B, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00,	// 0xFF
+	0x04, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00,	// U+0384
+	0x06, 0x0C, 0x00, 0x00, 0x08, 0x00, 0x00,	// U+0385
+	0x0D, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,	// U+0386
+	0x02, 0x00, 0x0E, 0x00, 0x00, 0x06, 0x00,	// U+0387
+	0x0D, 0x10, 0x00, 0x00, 0x18, 0x82, 0x01,	// U+0388
+	0x0F, 0x10, 0x00, 0x00, 0xF8, 0xFF, 0x01,	// U+0389
+	0x06, 0x10, 0x00, 0x00, 0xF8, 0xFF, 0x01,	// U+038A
+	0x0F, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00,	// U+038C
+	0x10, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,	// U+038E
+	0x0F, 0x10, 0x00, 0x00, 0x00, 0x87, 0x01,	// U+038F
+	0x06, 0x0C, 0x00, 0x00, 0x08, 0x00, 0x01,	// U+0390
+	0x0D, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,	// U+0391
+	0x0A, 0xF8, 0xFF, 0x01, 0x00, 0x78, 0x00,	// U+0392
+	0x09, 0xF8, 0xFF, 0x01, 0x08, 0x00, 0x00,	// U+0393
+	0x0D, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,	// U+0394
+	0x09, 0xF8, 0xFF, 0x01, 0x18, 0x82, 0x01,	// U+0395
+	0x0B, 0x08, 0x80, 0x01, 0x18, 0x80, 0x01,	// U+0396
+	0x0B, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,	// U+0397
+	0x0D, 0x80, 0x1F, 0x00, 0x80, 0x1F, 0x00,	// U+0398
+	0x02, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,	// U+0399
+	0x0B, 0xF8, 0xFF, 0x01, 0x00, 0x00, 0x01,	// U+039A
+	0x0D, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,	// U+039B
+	0x0D, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,	// U+039C
+	0x0B, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,	// U+039D
+	0x09, 0x18, 0x80, 0x01, 0x08, 0x00, 0x01,	// U+039E
+	0x0D, 0x80, 0x1F, 0x00, 0x80, 0x1F, 0x00,	// U+039F
+	0x0B, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,	// U+03A0
+	0x09, 0xF8, 0xFF, 0x01, 0xE0, 0x01, 0x00,	// U+03A1
+	0x09, 0x18, 0x80, 0x01, 0x18, 0x80, 0x01,	// U+03A3
+	0x0C, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,	// U+03A4
+	0x0B, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00,	// U+03A5
+	0x0D, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00,	// U+03A6
+	0x0C, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,	// U+03A7
+	0x0D, 0xF8, 0x03, 0x00, 0xF8, 0x03, 0x00,	// U+03A8
+	0x0D, 0x80, 0x8F, 0x01, 0x80, 0x8F, 0x01,	// U+03A9
+	0x06, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,	// U+03AA
+	0x0B, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00,	// U+03AB
+	0x0B, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01,	// U+03AC
+	0x08, 0x00, 0xF3, 0x00, 0x00, 0x80, 0x01,	// U+03AD
+	0x09, 0xC0, 0xFF, 0x01, 0x00, 0xFE, 0x1F,	// U+03AE
+	0x04, 0x80, 0xFF, 0x00, 0x04, 0x00, 0x01,	// U+03AF
+	0x09, 0x80, 0x7F, 0x00, 0x00, 0x0C, 0x00,	// U+03B0
+	0x0B, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01,	// U+03B1
+	0x09, 0xF0, 0xFF, 0x1F, 0x00, 0x78, 0x00,	// U+03B2
+	0x0A, 0xC0, 0x00, 0x00, 0xC0, 0x01, 0x00,	// U+03B3
+	0x0A, 0x00, 0x7C, 0x00, 0x00, 0x1C, 0x00,	// U+03B4
+	0x08, 0x00, 0xF3, 0x00, 0x00, 0x80, 0x01,	// U+03B5
+	0x09, 0x08, 0x7E, 0x00, 0x08, 0x00, 0x00,	// U+03B6
+	0x09, 0xC0, 0xFF, 0x01, 0x00, 0xFE, 0x1F,	// U+03B7
+	0x0A, 0xC0, 0x1F, 0x00, 0x00, 0x0F, 0x00,	// U+03B8
+	0x04, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x01,	// U+03B9
+	0x09, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0x01,	// U+03BA
+	0x0A, 0x00, 0x00, 0x01, 0x00, 0x80, 0x01,	// U+03BB
+	0x0A, 0xC0, 0xFF, 0x1F, 0x00, 0x00, 0x01,	// U+03BC
+	0x09, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x00,	// U+03BD
+	0x09, 0x00, 0x78, 0x00, 0x00, 0x00, 0x04,	// U+03BE
+	0x0A, 0x00, 0x7E, 0x00, 0x00, 0x1C, 0x00,	// U+03BF
+	0x0A, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x01,	// U+03C0
+	0x09, 0x00, 0xFE, 0x1F, 0x00, 0x7F, 0x00,	// U+03C1
+	0x08, 0x00, 0x3E, 0x00, 0x80, 0x00, 0x0E,	// U+03C2
+	0x0B, 0x00, 0x7E, 0x00, 0x80, 0x00, 0x00,	// U+03C3
+	0x0A, 0xC0, 0x00, 0x00, 0x80, 0x00, 0x00,	// U+03C4
+	0x09, 0x80, 0x7F, 0x00, 0x00, 0x0C, 0x00,	// U+03C5
+	0x0B, 0x00, 0x7E, 0x00, 0x00, 0x08, 0x00,	// U+03C6
+	0x0A, 0x80, 0x00, 0x10, 0x00, 0x00, 0x10,	// U+03C7
+	0x0B, 0xC0, 0x7F, 0x00, 0x80, 0x1F, 0x00,	// U+03C8
+	0x0D, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00,	// U+03C9
+	0x06, 0x0C, 0x00, 0x00, 0x08, 0x00, 0x01,	// U+03CA
+	0x09, 0x80, 0x7F, 0x00, 0x00, 0x0C, 0x00,	// U+03CB
+	0x0A, 0x00, 0x7E, 0x00, 0x00, 0x1C, 0x00,	// U+03CC
+	0x09, 0x80, 0x7F, 0x00, 0x00, 0x0C, 0x00,	// U+03CD
+	0x0D, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00,	// U+03CE
+	0x09, 0xF8, 0xFF, 0x01, 0x18, 0x82, 0x01,	// U+0400
+	0x09, 0xF8, 0xFF, 0x01, 0x18, 0x82, 0x01,	// U+0401
+	0x0E, 0x18, 0x00, 0x00, 0x00, 0xF0, 0x03,	// U+0402
+	0x09, 0xF8, 0xFF, 0x01, 0x08, 0x00, 0x00,	// U+0403
+	0x0B, 0x80, 0x1F, 0x00, 0x10, 0x80, 0x00,	// U+0404
+	0x0A, 0xE0, 0x81, 0x01, 0x00, 0x78, 0x00,	// U+0405
+	0x02, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,	// U+0406
+	0x06, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,	// U+0407
+	0x05, 0x00, 0x00, 0x18, 0xF8, 0xFF, 0x03,	// U+0408
+	0x13, 0x00, 0x80, 0x01, 0x00, 0x78, 0x00,	// U+0409
+	0x11, 0xF8, 0xFF, 0x01, 0x00, 0x78, 0x00,	// U+040A
+	0x0E, 0x18, 0x00, 0x00, 0x00, 0xF0, 0x01,	// U+040B
+	0x0B, 0xF8, 0xFF, 0x01, 0x08, 0x00, 0x01,	// U+040C
+	0x0B, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,	// U+040D
+	0x0B, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00,	// U+040E
+	0x0B, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,	// U+040F
+	0x0D, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,	// U+0410
+	0x0A, 0xF8, 0xFF, 0x01, 0x00, 0x78, 0x00,	// U+0411
+	0x0A, 0xF8, 0xFF, 0x01, 0x00, 0x78, 0x00,	// U+0412
+	0x09, 0xF8, 0xFF, 0x01, 0x08, 0x00, 0x00,	// U+0413
+	0x0D, 0x00, 0x80, 0x0F, 0x00, 0x80, 0x0F,	// U+0414
+	0x09, 0xF8, 0xFF, 0x01, 0x18, 0x82, 0x01,	// U+0415
+	0x14, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,	// U+0416
+	0x0A, 0x18, 0x80, 0x01, 0x00, 0x38, 0x00,	// U+0417
+	0x0B, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,	// U+0418
+	0x0B, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,	// U+0419
+	0x0B, 0xF8, 0xFF, 0x01, 0x08, 0x00, 0x01,	// U+041A
+	0x0C, 0x00, 0x80, 0x01, 0xF8, 0xFF, 0x01,	// U+041B
+	0x0D, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,	// U+041C
+	0x0B, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,	// U+041D
+	0x0D, 0x80, 0x1F, 0x00, 0x80, 0x1F, 0x00,	// U+041E
+	0x0B, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,	// U+041F
+	0x09, 0xF8, 0xFF, 0x01, 0xE0, 0x01, 0x00,	// U+0420
+	0x0B, 0x80, 0x1F, 0x00, 0x10, 0x80, 0x00,	// U+0421
+	0x0C, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,	// U+0422
+	0x0B, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00,	// U+0423
+	0x0E, 0x80, 0x0F, 0x00, 0x80, 0x1F, 0x00,	// U+0424
+	0x0C, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,	// U+0425
+	0x0C, 0xF8, 0xFF, 0x01, 0x00, 0x80, 0x0F,	// U+0426
+	0x0A, 0xF8, 0x01, 0x00, 0xF8, 0xFF, 0x01,	// U+0427
+	0x11, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,	// U+0428
+	0x12, 0xF8, 0xFF, 0x01, 0x00, 0x80, 0x0F,	// U+0429
+	0x0E, 0x18, 0x00, 0x00, 0x00, 0x78, 0x00,	// U+042A
+	0x0D, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,	// U+042B
+	0x0A, 0xF8, 0xFF, 0x01, 0x00, 0x78, 0x00,	// U+042C
+	0x0B, 0x30, 0xC0, 0x00, 0xC0, 0x3F, 0x00,	// U+042D
+	0x12, 0xF8, 0xFF, 0x01, 0x00, 0x0F, 0x00,	// U+042E
+	0x0A, 0x00, 0x00, 0x01, 0xF8, 0xFF, 0x01,	// U+042F
+	0x09, 0x00, 0xF0, 0x00, 0x00, 0xFE, 0x01,	// U+0430
+	0x0A, 0xC0, 0x3F, 0x00, 0x00, 0x3C, 0x00,	// U+0431
+	0x08, 0xC0, 0xFF, 0x01, 0x00, 0xF3, 0x00,	// U+0432
+	0x07, 0xC0, 0xFF, 0x01, 0xC0, 0x00, 0x00,	// U+0433
+	0x0B, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,	// U+0434
+	0x0A, 0x00, 0x3E, 0x00, 0x00, 0x0C, 0x00,	// U+0435
+	0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,	// U+0436
+	0x08, 0x80, 0x80, 0x01, 0x00, 0x60, 0x00,	// U+0437
+	0x09, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01,	// U+0438
+	0x09, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01,	// U+0439
+	0x09, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0x01,	// U+043A
+	0x0A, 0x00, 0x80, 0x01, 0x80, 0xFF, 0x01,	// U+043B
+	0x0B, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01,	// U+043C
+	0x09, 0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x01,	// U+043D
+	0x0A, 0x00, 0x7E, 0x00, 0x00, 0x1C, 0x00,	// U+043E
+	0x09, 0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x01,	// U+043F
+	0x09, 0xC0, 0xFF, 0x1F, 0x00, 0x7F, 0x00,	// U+0440
+	0x08, 0x00, 0x3E, 0x00, 0x80, 0x80, 0x01,	// U+0441
+	0x0A, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,	// U+0442
+	0x0A, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00,	// U+0443
+	0x0E, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x00,	// U+0444
+	0x0A, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,	// U+0445
+	0x0A, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0x0F,	// U+0446
+	0x08, 0xC0, 0x07, 0x00, 0xC0, 0xFF, 0x01,	// U+0447
+	0x0E, 0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x01,	// U+0448
+	0x0F, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0x0F,	// U+0449
+	0x0C, 0xC0, 0x00, 0x00, 0x00, 0x70, 0x00,	// U+044A
+	0x0C, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01,	// U+044B
+	0x08, 0xC0, 0xFF, 0x01, 0x00, 0xF0, 0x00,	// U+044C
+	0x08, 0x80, 0x80, 0x01, 0x00, 0x7E, 0x00,	// U+044D
+	0x0D, 0xC0, 0xFF, 0x01, 0x00, 0x7F, 0x00,	// U+044E
+	0x09, 0x00, 0x00, 0x01, 0x80, 0xFF, 0x01,	// U+044F
+	0x0A, 0x00, 0x3E, 0x00, 0x00, 0x0C, 0x00,	// U+0450
+	0x0A, 0x00, 0x3E, 0x00, 0x00, 0x0C, 0x00,	// U+0451
+	0x0B, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x00,	// U+0452
+	0x07, 0xC0, 0xFF, 0x01, 0xC4, 0x00, 0x00,	// U+0453
+	0x08, 0x00, 0x3E, 0x00, 0x80, 0x80, 0x01,	// U+0454
+	0x08, 0x00, 0x87, 0x01, 0x00, 0xF0, 0x00,	// U+0455
+	0x02, 0xDC, 0xFF, 0x01, 0x88, 0xFF, 0x01,	// U+0456
+	0x06, 0x0C, 0x00, 0x00, 0x08, 0x00, 0x00,	// U+0457
+	0x04, 0x00, 0x00, 0x10, 0x98, 0xFF, 0x07,	// U+0458
+	0x0F, 0x00, 0x80, 0x01, 0x00, 0xF0, 0x00,	// U+0459
+	0x0E, 0xC0, 0xFF, 0x01, 0x00, 0xF0, 0x00,	// U+045A
+	0x0A, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x01,	// U+045B
+	0x09, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0x01,	// U+045C
+	0x09, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01,	// U+045D
+	0x0A, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00,	// U+045E
+	0x09, 0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x01,	// U+045F
+
+	// Glyph data: left bearing, number of ink columns, right bearing, ink columns
+	// ' '
+	0x07, 0x00, 0x00,
+	// '!'
+	0x00, 0x02, 0x00, 0xF8, 0x9F, 0x01, 0xF8, 0x9F, 0x01,
+	// '"'
+	0x00, 0x05, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xF8,
+	0x00, 0x00,
+	// '#'
+	0x00, 0x0C, 0x00, 0x00, 0x10, 0x00, 0x80, 0x10, 0x00, 0x80, 0xF0, 0x01, 0x80, 0x1F, 0x00, 0xF8,
+	0x10, 0x00, 0x80, 0x10, 0x00, 0x80, 0x10, 0x00, 0x80, 0xF0, 0x01, 0x80, 0x1F, 0x00, 0xF8, 0x10,
+	0x00, 0x80, 0x10, 0x00, 0x80, 0x00, 0x00,
+	// '$'
+	0x00, 0x0C, 0x00, 0x00, 0x20, 0x00, 0xE0, 0xE0, 0x00, 0xF0, 0xC1, 0x00, 0x18, 0x83, 0x01, 0x08,
+	0x02, 0x01, 0xFE, 0xFF, 0x07, 0xFE, 0xFF, 0x07, 0x08, 0x06, 0x01, 0x18, 0x04, 0x01, 0x30, 0x8C,
+	0x00, 0x20, 0xF8, 0x00, 0x00, 0x30, 0x00,
+	// '%'
+	0x00, 0x11, 0x00, 0xF0, 0x03, 0x00, 0x18, 0x06, 0x00, 0x08, 0x04, 0x00, 0x08, 0x04, 0x01, 0x18,
+	0x86, 0x01, 0xF0, 0xE3, 0x00, 0x00, 0x30, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x06, 0x00, 0x80, 0x03,
+	0x00, 0xC0, 0x00, 0x00, 0x70, 0xFC, 0x00, 0x18, 0x86, 0x01, 0x08, 0x02, 0x01, 0x00, 0x02, 0x01,
+	0x00, 0x86, 0x01, 0x00, 0xFC, 0x00,
+	// '&'
+	0x00, 0x0D, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xDC, 0x00, 0x60, 0x86, 0x01, 0xF0, 0x03, 0x01, 0x18,
+	0x07, 0x01, 0x08, 0x1D, 0x01, 0x08, 0xB9, 0x01, 0x98, 0xE0, 0x00, 0xF0, 0xE0, 0x00, 0x00, 0xF0,
+	0x01, 0x00, 0x1C, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+	// '''
+	0x00, 0x02, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
+	// '('
+	0x00, 0x05, 0x00, 0x00, 0x3E, 0x00, 0xC0, 0xFF, 0x01, 0xF0, 0x80, 0x07, 0x18, 0x00, 0x0C, 0x0C,
+	0x00, 0x18,
+	// ')'
+	0x01, 0x05, 0x00, 0x0C, 0x00, 0x18, 0x18, 0x00, 0x0C, 0xF0, 0x80, 0x07, 0xC0, 0xFF, 0x01, 0x00,
+	0x3E, 0x00,
+	// '*'
+	0x00, 0x06, 0x00, 0x20, 0x00, 0x00, 0x40, 0x03, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x40,
+	0x03, 0x00, 0x20, 0x00, 0x00,
+	// '+'
+	0x00, 0x0A, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0xE0,
+	0x3F, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02,
+	0x00,
+	// ','
+	0x00, 0x02, 0x00, 0x00, 0x80, 0x09, 0x00, 0x80, 0x07,
+	// '-'
+	0x00, 0x05, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
+	0x18, 0x00,
+	// '.'
+	0x00, 0x02, 0x00, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01,
+	// '/'
+	0x00, 0x06, 0x00, 0x00, 0x80, 0x01, 0x00, 0xF0, 0x01, 0x00, 0x3F, 0x00, 0xE0, 0x07, 0x00, 0x7C,
+	0x00, 0x00, 0x0C, 0x00, 0x00,
+	// '0'
+	0x00, 0x0A, 0x00, 0xC0, 0x3F, 0x00, 0xF0, 0xFF, 0x00, 0x10, 0x80, 0x00, 0x08, 0x00, 0x01, 0x08,
+	0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x10, 0x80, 0x00, 0xF0, 0xFF, 0x00, 0xC0, 0x3F,
+	0x00,
+	// '1'
+	0x00, 0x09, 0x00, 0x60, 0x00, 0x01, 0x30, 0x00, 0x01, 0x10, 0x00, 0x01, 0xF8, 0xFF, 0x01, 0xF8,
+	0xFF, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+	// '2'
+	0x00, 0x0A, 0x00, 0x40, 0x80, 0x01, 0x70, 0xC0, 0x01, 0x10, 0x60, 0x01, 0x08, 0x30, 0x01, 0x08,
+	0x18, 0x01, 0x08, 0x08, 0x01, 0x08, 0x0C, 0x01, 0x18, 0x07, 0x01, 0xF0, 0x03, 0x01, 0xC0, 0x00,
+	0x01,
+	// '3'
+	0x00, 0x0A, 0x00, 0x60, 0x60, 0x00, 0x70, 0xE0, 0x00, 0x18, 0x80, 0x01, 0x08, 0x02, 0x01, 0x08,
+	0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x18, 0x85, 0x01, 0xF0, 0xFD, 0x00, 0x60, 0x78,
+	0x00,
+	// '4'
+	0x00, 0x0B, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x13, 0x00, 0x80,
+	0x11, 0x00, 0xE0, 0x10, 0x00, 0x70, 0x10, 0x00, 0x18, 0x10, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0x10,
+	0x00, 0x00, 0x10, 0x00,
+	// '5'
+	0x00, 0x0A, 0x00, 0x80, 0x63, 0x00, 0xF8, 0xE3, 0x00, 0x08, 0x82, 0x01, 0x08, 0x01, 0x01, 0x08,
+	0x01, 0x01, 0x08, 0x01, 0x01, 0x08, 0x01, 0x01, 0x08, 0x83, 0x01, 0x08, 0xFE, 0x00, 0x00, 0x7C,
+	0x00,
+	// '6'
+	0x00, 0x0A, 0x00, 0x80, 0x1F, 0x00, 0xE0, 0x7F, 0x00, 0x30, 0xC2, 0x00, 0x18, 0x81, 0x01, 0x08,
+	0x01, 0x01, 0x08, 0x01, 0x01, 0x08, 0x01, 0x01, 0x18, 0x83, 0x01, 0x30, 0xFE, 0x00, 0x00, 0x7C,
+	0x00,
+	// '7'
+	0x00, 0x0A, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0xE0, 0x01, 0x08,
+	0xFC, 0x01, 0x08, 0x0F, 0x00, 0xC8, 0x03, 0x00, 0xE8, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00,
+	0x00,
+	// '8'
+	0x00, 0x0A, 0x00, 0xE0, 0x78, 0x00, 0xF0, 0xFD, 0x00, 0x18, 0x85, 0x01, 0x08, 0x02, 0x01, 0x08,
+	0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x18, 0x85, 0x01, 0xF0, 0xFD, 0x00, 0xE0, 0x78,
+	0x00,
+	// '9'
+	0x00, 0x0A, 0x00, 0xE0, 0x43, 0x00, 0xF0, 0xC7, 0x00, 0x18, 0x8C, 0x01, 0x08, 0x08, 0x01, 0x08,
+	0x08, 0x01, 0x08, 0x08, 0x01, 0x08, 0x88, 0x01, 0x30, 0xC4, 0x00, 0xF0, 0x7F, 0x00, 0xC0, 0x1F,
+	0x00,
+	// ':'
+	0x00, 0x02, 0x00, 0xC0, 0x80, 0x01, 0xC0, 0x80, 0x01,
+	// ';'
+	0x00, 0x02, 0x00, 0xC0, 0x80, 0x09, 0xC0, 0x80, 0x07,
+	// '<'
+	0x00, 0x0A, 0x00, 0x00, 0x07, 0x00, 0x00, 0x05, 0x00, 0x80, 0x0D, 0x00, 0x80, 0x0D, 0x00, 0xC0,
+	0x18, 0x00, 0xC0, 0x18, 0x00, 0x40, 0x10, 0x00, 0x60, 0x30, 0x00, 0x20, 0x20, 0x00, 0x30, 0x60,
+	0x00,
+	// '='
+	0x00, 0x0A, 0x00, 0x80, 0x10, 0x00, 0x80, 0x10, 0x00, 0x80, 0x10, 0x00, 0x80, 0x10, 0x00, 0x80,
+	0x10, 0x00, 0x80, 0x10, 0x00, 0x80, 0x10, 0x00, 0x80, 0x10, 0x00, 0x80, 0x10, 0x00, 0x80, 0x10,
+	0x00,
+	// '>'
+	0x00, 0x0A, 0x00, 0x30, 0x60, 0x00, 0x20, 0x20, 0x00, 0x60, 0x30, 0x00, 0x40, 0x10, 0x00, 0xC0,
+	0x18, 0x00, 0xC0, 0x18, 0x00, 0x80, 0x0D, 0x00, 0x80, 0x0D, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07,
+	0x00,
+	// '?'
+	0x00, 0x0A, 0x00, 0x60, 0x00, 0x00, 0x70, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08,
+	0x98, 0x01, 0x08, 0x9C, 0x01, 0x08, 0x06, 0x00, 0x18, 0x02, 0x00, 0xF0, 0x03, 0x00, 0xE0, 0x01,
+	0x00,
+	// '@'
+	0x00, 0x11, 0x00, 0x00, 0xFF, 0x00, 0xC0, 0x81, 0x03, 0x60, 0x00, 0x02, 0x10, 0x18, 0x04, 0x18,
+	0x7F, 0x0C, 0x88, 0xC3, 0x08, 0xC4, 0x80, 0x08, 0x44, 0x80, 0x08, 0x44, 0x80, 0x08, 0x44, 0x40,
+	0x08, 0x84, 0x30, 0x08, 0x04, 0xFF, 0x04, 0xCC, 0x87, 0x04, 0x48, 0x80, 0x06, 0x18, 0xC0, 0x00,
+	0x70, 0x70, 0x00, 0xC0, 0x1F, 0x00,
+	// 'A'
+	0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0xE0, 0x01, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x00, 0xE0,
+	0x0B, 0x00, 0x78, 0x08, 0x00, 0x18, 0x08, 0x00, 0x78, 0x08, 0x00, 0xE0, 0x0B, 0x00, 0x00, 0x0F,
+	0x00, 0x00, 0x78, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x01,
+	// 'B'
+	0x00, 0x0B, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08,
+	0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x18, 0x03, 0x01, 0xF0, 0x85, 0x00, 0xF0, 0xFC,
+	0x00, 0x00, 0x78, 0x00,
+	// 'C'
+	0x00, 0x0D, 0x00, 0x80, 0x1F, 0x00, 0xE0, 0x7F, 0x00, 0x70, 0xE0, 0x00, 0x10, 0xC0, 0x00, 0x18,
+	0x80, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x18, 0x80,
+	0x01, 0x30, 0x80, 0x00, 0x70, 0xE0, 0x00, 0x60, 0x60, 0x00,
+	// 'D'
+	0x00, 0x0C, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08,
+	0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x18, 0x80, 0x01, 0x10, 0xC0, 0x00, 0x70, 0xE0,
+	0x00, 0xE0, 0x7F, 0x00, 0x80, 0x1F, 0x00,
+	// 'E'
+	0x00, 0x0B, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08,
+	0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02,
+	0x01, 0x08, 0x00, 0x01,
+	// 'F'
+	0x00, 0x0A, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x08, 0x04, 0x00, 0x08, 0x04, 0x00, 0x08,
+	0x04, 0x00, 0x08, 0x04, 0x00, 0x08, 0x04, 0x00, 0x08, 0x04, 0x00, 0x08, 0x04, 0x00, 0x08, 0x04,
+	0x00,
+	// 'G'
+	0x00, 0x0D, 0x00, 0x80, 0x1F, 0x00, 0xE0, 0x7F, 0x00, 0x70, 0xE0, 0x00, 0x10, 0x80, 0x00, 0x18,
+	0x80, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x18, 0x04,
+	0x01, 0x30, 0x84, 0x00, 0x70, 0xC4, 0x00, 0x60, 0x7C, 0x00,
+	// 'H'
+	0x00, 0x0A, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF,
+	0x01,
+	// 'I'
+	0x00, 0x02, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,
+	// 'J'
+	0x00, 0x09, 0x00, 0x00, 0x20, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x01, 0x08,
+	0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x80, 0x01, 0xF8, 0xFF, 0x00, 0xF8, 0x7F, 0x00,
+	// 'K'
+	0x00, 0x0B, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x80,
+	0x07, 0x00, 0xC0, 0x1C, 0x00, 0x60, 0x38, 0x00, 0x30, 0x70, 0x00, 0x18, 0xE0, 0x00, 0x08, 0xC0,
+	0x01, 0x00, 0x00, 0x01,
+	// 'L'
+	0x00, 0x09, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+	// 'M'
+	0x00, 0x0D, 0x00, 0xF8, 0xFF, 0x01, 0x18, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00,
+	0x1E, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x80, 0x01, 0x00, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x80, 0x07,
+	0x00, 0xF0, 0x00, 0x00, 0x18, 0x00, 0x00, 0xF8, 0xFF, 0x01,
+	// 'N'
+	0x00, 0x0A, 0x00, 0xF8, 0xFF, 0x01, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x01, 0xF8, 0xFF,
+	0x01,
+	// 'O'
+	0x00, 0x0E, 0x00, 0x80, 0x1F, 0x00, 0xE0, 0x7F, 0x00, 0x70, 0xE0, 0x00, 0x10, 0x80, 0x00, 0x18,
+	0x80, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x18, 0x80,
+	0x01, 0x10, 0x80, 0x00, 0x70, 0xE0, 0x00, 0xE0, 0x7F, 0x00, 0x80, 0x1F, 0x00,
+	// 'P'
+	0x00, 0x0B, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x08, 0x04, 0x00, 0x08, 0x04, 0x00, 0x08,
+	0x04, 0x00, 0x08, 0x04, 0x00, 0x08, 0x04, 0x00, 0x08, 0x04, 0x00, 0x18, 0x06, 0x00, 0xF0, 0x03,
+	0x00, 0xE0, 0x01, 0x00,
+	// 'Q'
+	0x00, 0x0E, 0x00, 0x80, 0x1F, 0x00, 0xE0, 0x7F, 0x00, 0x70, 0xE0, 0x00, 0x10, 0x80, 0x00, 0x18,
+	0x80, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x0F, 0x08, 0x00, 0x0D, 0x18, 0x80,
+	0x19, 0x10, 0x80, 0x10, 0x70, 0xE0, 0x10, 0xE0, 0x7F, 0x00, 0x80, 0x1F, 0x00,
+	// 'R'
+	0x00, 0x0C, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x08, 0x04, 0x00, 0x08, 0x04, 0x00, 0x08,
+	0x04, 0x00, 0x08, 0x04, 0x00, 0x08, 0x0C, 0x00, 0x08, 0x1C, 0x00, 0x18, 0x76, 0x00, 0xF0, 0xE3,
+	0x01, 0xF0, 0x83, 0x01, 0x00, 0x00, 0x01,
+	// 'S'
+	0x00, 0x0C, 0x00, 0x00, 0x60, 0x00, 0xF0, 0xE1, 0x00, 0xF0, 0x81, 0x00, 0x18, 0x83, 0x01, 0x08,
+	0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x18, 0x04, 0x01, 0x30, 0x8C,
+	0x00, 0x70, 0xFC, 0x00, 0x00, 0x78, 0x00,
+	// 'T'
+	0x00, 0x0C, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08,
+	0x00, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00,
+	0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00,
+	// 'U'
+	0x00, 0x0C, 0x00, 0xF8, 0x0F, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x80, 0x01, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0xE0,
+	0x00, 0xF8, 0x7F, 0x00, 0xF8, 0x0F, 0x00,
+	// 'V'
+	0x00, 0x0D, 0x00, 0x08, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x80, 0x0F, 0x00, 0x00,
+	0x3E, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x80, 0x01, 0x00, 0xF0, 0x01, 0x00, 0x3E, 0x00, 0x80, 0x0F,
+	0x00, 0xF0, 0x01, 0x00, 0x78, 0x00, 0x00, 0x08, 0x00, 0x00,
+	// 'W'
+	0x00, 0x13, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xFC, 0x00, 0x00,
+	0xC0, 0x01, 0x00, 0xE0, 0x01, 0x00, 0x7C, 0x00, 0xC0, 0x0F, 0x00, 0xF8, 0x01, 0x00, 0x18, 0x00,
+	0x00, 0xF8, 0x01, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xE0, 0x01, 0x00, 0xC0, 0x01,
+	0x00, 0xF8, 0x01, 0x80, 0x3F, 0x00, 0xF0, 0x03, 0x00, 0x78, 0x00, 0x00,
+	// 'X'
+	0x00, 0x0C, 0x00, 0x08, 0x00, 0x01, 0x18, 0xC0, 0x01, 0x30, 0xE0, 0x00, 0xE0, 0x30, 0x00, 0xC0,
+	0x1D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x00, 0xC0, 0x1D, 0x00, 0xE0, 0x38, 0x00, 0x70, 0xE0,
+	0x00, 0x18, 0xC0, 0x01, 0x08, 0x00, 0x01,
+	// 'Y'
+	0x00, 0x0C, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x80,
+	0x03, 0x00, 0x00, 0xFE, 0x01, 0x00, 0xFE, 0x01, 0x80, 0x03, 0x00, 0xC0, 0x01, 0x00, 0x70, 0x00,
+	0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00,
+	// 'Z'
+	0x00, 0x0B, 0x00, 0x08, 0x80, 0x01, 0x08, 0xC0, 0x01, 0x08, 0x70, 0x01, 0x08, 0x38, 0x01, 0x08,
+	0x0C, 0x01, 0x08, 0x07, 0x01, 0x88, 0x03, 0x01, 0xC8, 0x00, 0x01, 0x78, 0x00, 0x01, 0x38, 0x00,
+	0x01, 0x08, 0x00, 0x01,
+	// '['
+	0x00, 0x04, 0x00, 0xFC, 0xFF, 0x1F, 0x04, 0x00, 0x10, 0x04, 0x00, 0x10, 0x04, 0x00, 0x10,
+	// '\\'
+	0x00, 0x06, 0x00, 0x0C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x3F, 0x00, 0x00,
+	0xF0, 0x01, 0x00, 0x80, 0x01,
+	// ']'
+	0x00, 0x04, 0x00, 0x04, 0x00, 0x10, 0x04, 0x00, 0x10, 0x04, 0x00, 0x10, 0xFC, 0xFF, 0x1F,
+	// '^'
+	0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x80, 0x07, 0x00, 0xF0, 0x01, 0x00, 0x38, 0x00, 0x00, 0x38,
+	0x00, 0x00, 0xF0, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0x04, 0x00,
+	// '_'
+	0x00, 0x0C, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10,
+	// '`'
+	0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x10, 0x00, 0x00,
+	// 'a'
+	0x00, 0x0B, 0x00, 0x00, 0xF1, 0x00, 0x80, 0xF9, 0x01, 0xC0, 0x0C, 0x01, 0x40, 0x04, 0x01, 0x40,
+	0x04, 0x01, 0x40, 0x04, 0x01, 0x40, 0x84, 0x00, 0xC0, 0x7F, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01,
+	// 'b'
+	0x00, 0x09, 0x00, 0xFC, 0xFF, 0x01, 0xFC, 0xFF, 0x01, 0x80, 0xC1, 0x00, 0x40, 0x00, 0x01, 0x40,
+	0x00, 0x01, 0x40, 0x00, 0x01, 0xC0, 0x80, 0x01, 0x80, 0xFF, 0x00, 0x00, 0x7F, 0x00,
+	// 'c'
+	0x00, 0x09, 0x00, 0x00, 0x3E, 0x00, 0x80, 0xFF, 0x00, 0xC0, 0x80, 0x01, 0x40, 0x00, 0x01, 0x40,
+	0x00, 0x01, 0x40, 0x00, 0x01, 0x40, 0x00, 0x01, 0x80, 0xC1, 0x00, 0x80, 0xC1, 0x00,
+	// 'd'
+	0x00, 0x09, 0x00, 0x00, 0x7F, 0x00, 0x80, 0xFF, 0x00, 0xC0, 0x80, 0x01, 0x40, 0x00, 0x01, 0x40,
+	0x00, 0x01, 0x40, 0x00, 0x01, 0x80, 0xC1, 0x00, 0xFC, 0xFF, 0x01, 0xFC, 0xFF, 0x01,
+	// 'e'
+	0x00, 0x0A, 0x00, 0x00, 0x3F, 0x00, 0x80, 0xFF, 0x00, 0xC0, 0x88, 0x00, 0x40, 0x08, 0x01, 0x40,
+	0x08, 0x01, 0x40, 0x08, 0x01, 0x40, 0x08, 0x01, 0xC0, 0x88, 0x01, 0x80, 0xCF, 0x00, 0x00, 0x4E,
+	0x00,
+	// 'f'
+	0x00, 0x06, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0xFC, 0xFF, 0x01, 0x44,
+	0x00, 0x00, 0x44, 0x00, 0x00,
+	// 'g'
+	0x00, 0x09, 0x00, 0x00, 0x7F, 0x04, 0x80, 0xFF, 0x0C, 0xC0, 0x80, 0x19, 0x40, 0x00, 0x11, 0x40,
+	0x00, 0x11, 0x40, 0x80, 0x10, 0x80, 0x41, 0x18, 0xC0, 0xFF, 0x0F, 0xC0, 0xFF, 0x03,
+	// 'h'
+	0x00, 0x09, 0x00, 0xFC, 0xFF, 0x01, 0xFC, 0xFF, 0x01, 0x80, 0x01, 0x00, 0x40, 0x00, 0x00, 0x40,
+	0x00, 0x00, 0x40, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0xFF, 0x01,
+	// 'i'
+	0x00, 0x02, 0x00, 0xCC, 0xFF, 0x01, 0xCC, 0xFF, 0x01,
+	// 'j'
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0xCC, 0xFF, 0x1F, 0xCC, 0xFF, 0x0F,
+	// 'k'
+	0x00, 0x09, 0x00, 0xFC, 0xFF, 0x01, 0xFC, 0xFF, 0x01, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00,
+	0x3E, 0x00, 0x80, 0x73, 0x00, 0xC0, 0xE1, 0x00, 0x40, 0x80, 0x01, 0x00, 0x00, 0x01,
+	// 'l'
+	0x00, 0x02, 0x00, 0xFC, 0xFF, 0x01, 0xFC, 0xFF, 0x01,
+	// 'm'
+	0x00, 0x0E, 0x00, 0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x01, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40,
+	0x00, 0x00, 0x40, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x80, 0x00, 0x00, 0x40, 0x00,
+	0x00, 0x40, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00, 0xFF, 0x01,
+	// 'n'
+	0x00, 0x09, 0x00, 0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x01, 0x80, 0x01, 0x00, 0x40, 0x00, 0x00, 0x40,
+	0x00, 0x00, 0x40, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00, 0xFF, 0x01,
+	// 'o'
+	0x00, 0x0A, 0x00, 0x00, 0x7F, 0x00, 0x80, 0xFF, 0x00, 0xC0, 0x80, 0x01, 0x40, 0x00, 0x01, 0x40,
+	0x00, 0x01, 0x40, 0x00, 0x01, 0x40, 0x00, 0x01, 0xC0, 0x80, 0x01, 0x80, 0xFF, 0x00, 0x00, 0x7F,
+	0x00,
+	// 'p'
+	0x00, 0x09, 0x00, 0xC0, 0xFF, 0x1F, 0xC0, 0xFF, 0x1F, 0x80, 0xC1, 0x00, 0x40, 0x00, 0x01, 0x40,
+	0x00, 0x01, 0x40, 0x00, 0x01, 0xC0, 0x80, 0x01, 0x80, 0xFF, 0x00, 0x00, 0x7F, 0x00,
+	// 'q'
+	0x00, 0x09, 0x00, 0x00, 0x7F, 0x00, 0x80, 0xFF, 0x00, 0xC0, 0x80, 0x01, 0x40, 0x00, 0x01, 0x40,
+	0x00, 0x01, 0x40, 0x00, 0x01, 0x80, 0xC1, 0x00, 0xC0, 0xFF, 0x1F, 0xC0, 0xFF, 0x1F,
+	// 'r'
+	0x00, 0x06, 0x00, 0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x01, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0xC0, 0x00, 0x00,
+	// 's'
+	0x00, 0x09, 0x00, 0x80, 0xC3, 0x00, 0x80, 0x87, 0x00, 0x40, 0x0C, 0x01, 0x40, 0x0C, 0x01, 0x40,
+	0x0C, 0x01, 0x40, 0x08, 0x01, 0xC0, 0x18, 0x01, 0x80, 0xF9, 0x00, 0x80, 0xF1, 0x00,
+	// 't'
+	0x00, 0x06, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0xF0, 0xFF, 0x01, 0x40,
+	0x00, 0x01, 0x40, 0x00, 0x01,
+	// 'u'
+	0x00, 0x09, 0x00, 0xC0, 0x7F, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0xC0, 0x00, 0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x01,
+	// 'v'
+	0x00, 0x0B, 0x00, 0x40, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x00,
+	0xE0, 0x01, 0x00, 0x80, 0x01, 0x00, 0xF0, 0x01, 0x00, 0x7C, 0x00, 0x80, 0x0F, 0x00, 0xC0, 0x03,
+	0x00, 0x40, 0x00, 0x00,
+	// 'w'
+	0x00, 0x0F, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xE0, 0x01, 0x00,
+	0xC0, 0x01, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0xFC,
+	0x00, 0x00, 0xC0, 0x01, 0x00, 0xE0, 0x01, 0x00, 0x7E, 0x00, 0xC0, 0x07, 0x00, 0xC0, 0x00, 0x00,
+	// 'x'
+	0x00, 0x08, 0x00, 0xC0, 0x80, 0x01, 0xC0, 0xC1, 0x01, 0x00, 0x77, 0x00, 0x00, 0x1E, 0x00, 0x00,
+	0x1E, 0x00, 0x00, 0x77, 0x00, 0xC0, 0xC1, 0x01, 0xC0, 0x80, 0x01,
+	// 'y'
+	0x00, 0x0B, 0x00, 0x40, 0x00, 0x00, 0xC0, 0x01, 0x10, 0x80, 0x0F, 0x10, 0x00, 0x3C, 0x18, 0x00,
+	0xF0, 0x0E, 0x00, 0x80, 0x07, 0x00, 0xE0, 0x01, 0x00, 0x3C, 0x00, 0x80, 0x0F, 0x00, 0xC0, 0x03,
+	0x00, 0x40, 0x00, 0x00,
+	// 'z'
+	0x00, 0x07, 0x00, 0x40, 0x80, 0x01, 0x40, 0xE0, 0x01, 0x40, 0x78, 0x01, 0x40, 0x1E, 0x01, 0xC0,
+	0x07, 0x01, 0xC0, 0x03, 0x01, 0xC0, 0x00, 0x01,
+	// '{'
+	0x00, 0x07, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x36, 0x00, 0xF8, 0xF7, 0x0F, 0x0C,
+	0x00, 0x18, 0x04, 0x00, 0x10, 0x04, 0x00, 0x10,
+	// '|'
+	0x00, 0x02, 0x00, 0xFC, 0xFF, 0x1F, 0xFC, 0xFF, 0x1F,
+	// '}'
+	0x00, 0x07, 0x00, 0x04, 0x00, 0x10, 0x04, 0x00, 0x10, 0x0C, 0x00, 0x18, 0xF8, 0xF7, 0x0F, 0x00,
+	0x36, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00,
+	// '~'
+	0x00, 0x0A, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02,
+	0x00,
+	// DEL
+	0x00, 0x05, 0x00, 0xFC, 0xFF, 0x00, 0x04, 0x80, 0x00, 0x04, 0x80, 0x00, 0x04, 0x80, 0x00, 0xFC,
+	0xFF, 0x00,
+	// 0x80
+	0x02, 0x00, 0x00,
+	// 0x81
+	0x01, 0x00, 0x00,
+	// 0x82
+	0x01, 0x00, 0x00,
+	// 0x83
+	0x01, 0x00, 0x00,
+	// 0x84
+	0x01, 0x00, 0x00,
+	// 0x85
+	0x01, 0x00, 0x00,
+	// 0x86
+	0x01, 0x00, 0x00,
+	// 0x87
+	0x01, 0x00, 0x00,
+	// 0x88
+	0x01, 0x00, 0x00,
+	// 0x89
+	0x01, 0x00, 0x00,
+	// 0x8A
+	0x01, 0x00, 0x00,
+	// 0x8B
+	0x01, 0x00, 0x00,
+	// 0x8C
+	0x01, 0x00, 0x00,
+	// 0x8D
+	0x01, 0x00, 0x00,
+	// 0x8E
+	0x01, 0x00, 0x00,
+	// 0x8F
+	0x01, 0x00, 0x00,
+	// 0x90
+	0x01, 0x00, 0x00,
+	// 0x91
+	0x01, 0x00, 0x00,
+	// 0x92
+	0x01, 0x00, 0x00,
+	// 0x93
+	0x01, 0x00, 0x00,
+	// 0x94
+	0x01, 0x00, 0x00,
+	// 0x95
+	0x01, 0x00, 0x00,
+	// 0x96
+	0x01, 0x00, 0x00,
+	// 0x97
+	0x01, 0x00, 0x00,
+	// 0x98
+	0x01, 0x00, 0x00,
+	// 0x99
+	0x01, 0x00, 0x00,
+	// 0x9A
+	0x01, 0x00, 0x00,
+	// 0x9B
+	0x01, 0x00, 0x00,
+	// 0x9C
+	0x01, 0x00, 0x00,
+	// 0x9D
+	0x01, 0x00, 0x00,
+	// 0x9E
+	0x01, 0x00, 0x00,
+	// 0x9F
+	0x01, 0x00, 0x00,
+	// 0xA0
+	0x01, 0x00, 0x00,
+	// 0xA1
+	0x00, 0x02, 0x00, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F,
+	// 0xA2
+	0x00, 0x09, 0x00, 0x00, 0x06, 0x00, 0xC0, 0x3F, 0x00, 0xC0, 0x30, 0x00, 0x20, 0x60, 0x00, 0x20,
+	0x40, 0x00, 0x38, 0xC0, 0x01, 0x20, 0x40, 0x00, 0x60, 0x60, 0x00, 0xC0, 0x38, 0x00,
+	// 0xA3
+	0x00, 0x0B, 0x00, 0x00, 0x82, 0x01, 0x00, 0xE2, 0x01, 0xF0, 0x7F, 0x01, 0x38, 0x02, 0x01, 0x08,
+	0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x18, 0x02, 0x01, 0x30, 0x80, 0x01, 0x00, 0xC0,
+	0x00, 0x00, 0x40, 0x00,
+	// 0xA4
+	0x00, 0x0A, 0x00, 0x00, 0x04, 0x00, 0xC0, 0x7F, 0x00, 0x80, 0x31, 0x00, 0x40, 0x40, 0x00, 0x40,
+	0x40, 0x00, 0x40, 0x40, 0x00, 0x40, 0x40, 0x00, 0x80, 0x31, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x0E,
+	0x00,
+	// 0xA5
+	0x00, 0x0C, 0x00, 0x08, 0x00, 0x00, 0x18, 0x24, 0x00, 0x70, 0x24, 0x00, 0xE0, 0x25, 0x00, 0x80,
+	0x27, 0x00, 0x00, 0xFE, 0x01, 0x00, 0xFE, 0x01, 0x80, 0x27, 0x00, 0xE0, 0x24, 0x00, 0x70, 0x24,
+	0x00, 0x18, 0x24, 0x00, 0x08, 0x00, 0x00,
+	// 0xA6
+	0x00, 0x02, 0x00, 0xFC, 0xE3, 0x1F, 0xFC, 0xE3, 0x1F,
+	// 0xA7
+	0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x78, 0x0F, 0x03, 0x7C, 0x19, 0x06, 0xC4, 0x10, 0x04, 0x84,
+	0x10, 0x04, 0x84, 0x10, 0x04, 0x84, 0x31, 0x04, 0x8C, 0x31, 0x06, 0x18, 0xDF, 0x03, 0x10, 0x86,
+	0x01,
+	// 0xA8
+	0x00, 0x06, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+	0x00, 0x00, 0x0C, 0x00, 0x00,
+	// 0xA9
+	0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0xC0, 0x30, 0x00, 0x20, 0x40, 0x00, 0x10, 0x80, 0x00, 0x90,
+	0x9F, 0x00, 0xC8, 0x30, 0x01, 0x48, 0x20, 0x01, 0x48, 0x20, 0x01, 0x48, 0x20, 0x01, 0xC8, 0x30,
+	0x01, 0x90, 0x90, 0x00, 0x10, 0x80, 0x00, 0x20, 0x40, 0x00, 0xC0, 0x30, 0x00, 0x00, 0x0F, 0x00,
+	// 0xAA
+	0x00, 0x07, 0x00, 0x80, 0x03, 0x00, 0xD8, 0x07, 0x00, 0x48, 0x04, 0x00, 0x48, 0x04, 0x00, 0x58,
+	0x02, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x04, 0x00,
+	// 0xAB
+	0x00, 0x0A, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x63, 0x00, 0x80, 0xC1, 0x00, 0x80,
+	0x80, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x63, 0x00, 0x80, 0xC1, 0x00, 0x80, 0x80,
+	0x00,
+	// 0xAC
+	0x00, 0x0A, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E,
+	0x00,
+	// 0xAD
+	0x00, 0x05, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
+	0x18, 0x00,
+	// 0xAE
+	0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0xC0, 0x30, 0x00, 0x20, 0x40, 0x00, 0x10, 0x80, 0x00, 0x10,
+	0x80, 0x00, 0xC8, 0x3F, 0x01, 0x48, 0x04, 0x01, 0x48, 0x04, 0x01, 0x48, 0x1C, 0x01, 0xC8, 0x37,
+	0x01, 0x10, 0xA1, 0x00, 0x10, 0x80, 0x00, 0x20, 0x40, 0x00, 0xC0, 0x30, 0x00, 0x00, 0x0F, 0x00,
+	// 0xAF
+	0x00, 0x0C, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00,
+	// 0xB0
+	0x00, 0x06, 0x00, 0x60, 0x00, 0x00, 0x98, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x98,
+	0x01, 0x00, 0x60, 0x00, 0x00,
+	// 0xB1
+	0x00, 0x0A, 0x00, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0xE0,
+	0x3F, 0x01, 0xE0, 0x3F, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02,
+	0x01,
+	// 0xB2
+	0x00, 0x06, 0x00, 0x00, 0x08, 0x00, 0x30, 0x0C, 0x00, 0x08, 0x0A, 0x00, 0x08, 0x09, 0x00, 0x88,
+	0x09, 0x00, 0xF0, 0x08, 0x00,
+	// 0xB3
+	0x00, 0x05, 0x00, 0x10, 0x0C, 0x00, 0x08, 0x08, 0x00, 0x88, 0x08, 0x00, 0xC8, 0x08, 0x00, 0x70,
+	0x07, 0x00,
+	// 0xB4
+	0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x04, 0x00, 0x00,
+	// 0xB5
+	0x00, 0x0A, 0x00, 0xC0, 0xFF, 0x1F, 0xC0, 0xFF, 0x1F, 0x00, 0x80, 0x01, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x00, 0x80, 0x01, 0xC0, 0x7F, 0x00, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01,
+	// 0xB6
+	0x00, 0x09, 0x00, 0xF0, 0x01, 0x00, 0xF8, 0x03, 0x00, 0xF8, 0x03, 0x00, 0xF8, 0xFF, 0x0F, 0xF8,
+	0xFF, 0x0F, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x08, 0x00, 0x00,
+	// 0xB7
+	0x00, 0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00,
+	// 0xB8
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x14, 0x00, 0x00, 0x18,
+	// 0xB9
+	0x00, 0x06, 0x00, 0x10, 0x08, 0x00, 0x18, 0x08, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x08, 0x00, 0x00,
+	0x08, 0x00, 0x00, 0x08, 0x00,
+	// 0xBA
+	0x00, 0x08, 0x00, 0xE0, 0x01, 0x00, 0xF0, 0x03, 0x00, 0x18, 0x06, 0x00, 0x08, 0x04, 0x00, 0x08,
+	0x04, 0x00, 0x08, 0x04, 0x00, 0xF0, 0x03, 0x00, 0xE0, 0x01, 0x00,
+	// 0xBB
+	0x00, 0x0A, 0x00, 0x80, 0x80, 0x00, 0x80, 0xC1, 0x00, 0x00, 0x63, 0x00, 0x00, 0x3E, 0x00, 0x00,
+	0x1C, 0x00, 0x80, 0x80, 0x00, 0x80, 0xC1, 0x00, 0x00, 0x63, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1C,
+	0x00,
+	// 0xBC
+	0x00, 0x10, 0x00, 0x10, 0x08, 0x00, 0x18, 0x08, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x08, 0x01, 0x00,
+	0xC8, 0x01, 0x00, 0x60, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x07, 0x00, 0x80, 0x61,
+	0x00, 0xE0, 0x70, 0x00, 0x30, 0x4C, 0x00, 0x18, 0x46, 0x00, 0x00, 0xFF, 0x01, 0x00, 0xFF, 0x01,
+	0x00, 0x40, 0x00,
+	// 0xBD
+	0x00, 0x10, 0x00, 0x10, 0x08, 0x00, 0x18, 0x08, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x08, 0x01, 0x00,
+	0xC8, 0x01, 0x00, 0x60, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x07, 0x00, 0x80, 0x01,
+	0x01, 0xE0, 0x86, 0x01, 0x30, 0x41, 0x01, 0x18, 0x21, 0x01, 0x00, 0x31, 0x01, 0x00, 0x1E, 0x01,
+	0x00, 0x00, 0x01,
+	// 0xBE
+	0x00, 0x10, 0x00, 0x10, 0x0C, 0x00, 0x08, 0x08, 0x00, 0x88, 0x08, 0x00, 0xC8, 0x08, 0x01, 0x70,
+	0xC7, 0x01, 0x00, 0x60, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x07, 0x00, 0x80, 0x61,
+	0x00, 0xE0, 0x70, 0x00, 0x30, 0x4C, 0x00, 0x18, 0x46, 0x00, 0x00, 0xFF, 0x01, 0x00, 0xFF, 0x01,
+	0x00, 0x40, 0x00,
+	// 0xBF
+	0x00, 0x0A, 0x00, 0x00, 0x80, 0x01, 0x00, 0xC0, 0x07, 0x00, 0x60, 0x04, 0x00, 0x30, 0x08, 0x00,
+	0x18, 0x08, 0xC0, 0x1C, 0x08, 0xC0, 0x04, 0x08, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00,
+	0x03,
+	// 0xC0
+	0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0xE0, 0x01, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x00, 0xE0,
+	0x0B, 0x00, 0x79, 0x08, 0x00, 0x19, 0x08, 0x00, 0x7A, 0x08, 0x00, 0xE0, 0x0B, 0x00, 0x00, 0x0F,
+	0x00, 0x00, 0x78, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x01,
+	// 0xC1
+	0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0xE0, 0x01, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x00, 0xE0,
+	0x0B, 0x00, 0x78, 0x08, 0x00, 0x1A, 0x08, 0x00, 0x79, 0x08, 0x00, 0xE1, 0x0B, 0x00, 0x00, 0x0F,
+	0x00, 0x00, 0x78, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x01,
+	// 0xC2
+	0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0xE0, 0x01, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x00, 0xE2,
+	0x0B, 0x00, 0x7B, 0x08, 0x00, 0x19, 0x08, 0x00, 0x7B, 0x08, 0x00, 0xE2, 0x0B, 0x00, 0x00, 0x0F,
+	0x00, 0x00, 0x78, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x01,
+	// 0xC3
+	0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0xE0, 0x01, 0x00, 0xF8, 0x00, 0x03, 0x0F, 0x00, 0xE1,
+	0x0B, 0x00, 0x79, 0x08, 0x00, 0x1B, 0x08, 0x00, 0x7A, 0x08, 0x00, 0xE2, 0x0B, 0x00, 0x03, 0x0F,
+	0x00, 0x00, 0x78, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x01,
+	// 0xC4
+	0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0xE0, 0x01, 0x00, 0xF8, 0x00, 0x03, 0x0F, 0x00, 0xE3,
+	0x0B, 0x00, 0x78, 0x08, 0x00, 0x18, 0x08, 0x00, 0x78, 0x08, 0x00, 0xE3, 0x0B, 0x00, 0x03, 0x0F,
+	0x00, 0x00, 0x78, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x01,
+	// 0xC5
+	0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0xE0, 0x01, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x00, 0xE0,
+	0x0B, 0x00, 0x7E, 0x08, 0x00, 0x19, 0x08, 0x00, 0x79, 0x08, 0x00, 0xEE, 0x0B, 0x00, 0x00, 0x0F,
+	0x00, 0x00, 0x78, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x01,
+	// 0xC6
+	0x00, 0x13, 0x00, 0x00, 0x80, 0x01, 0x00, 0xE0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0E, 0x00, 0x80,
+	0x0B, 0x00, 0xE0, 0x08, 0x00, 0x38, 0x08, 0x00, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00, 0xF8, 0xFF,
+	0x01, 0xF8, 0xFF, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01,
+	0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x00, 0x01,
+	// 0xC7
+	0x00, 0x0D, 0x00, 0x80, 0x1F, 0x00, 0xE0, 0x7F, 0x00, 0x70, 0xE0, 0x00, 0x10, 0xC0, 0x00, 0x18,
+	0x80, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x07, 0x08, 0x00, 0x15, 0x08, 0x00, 0x19, 0x18, 0x80,
+	0x01, 0x30, 0x80, 0x00, 0x70, 0xE0, 0x00, 0x60, 0x60, 0x00,
+	// 0xC8
+	0x00, 0x0B, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x09,
+	0x02, 0x01, 0x09, 0x02, 0x01, 0x0A, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02,
+	0x01, 0x08, 0x00, 0x01,
+	// 0xC9
+	0x00, 0x0B, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x0A,
+	0x02, 0x01, 0x09, 0x02, 0x01, 0x09, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02,
+	0x01, 0x08, 0x00, 0x01,
+	// 0xCA
+	0x00, 0x0B, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x08, 0x02, 0x01, 0x0A, 0x02, 0x01, 0x0B,
+	0x02, 0x01, 0x09, 0x02, 0x01, 0x0B, 0x02, 0x01, 0x0A, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02,
+	0x01, 0x08, 0x00, 0x01,
+	// 0xCB
+	0x00, 0x0B, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x0B, 0x02, 0x01, 0x0B, 0x02, 0x01, 0x08,
+	0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x0B, 0x02, 0x01, 0x0B, 0x02, 0x01, 0x08, 0x02,
+	0x01, 0x08, 0x00, 0x01,
+	// 0xCC
+	0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0xF9, 0xFF, 0x01, 0xFA, 0xFF, 0x01,
+	// 0xCD
+	0x00, 0x03, 0x00, 0xFA, 0xFF, 0x01, 0xF9, 0xFF, 0x01, 0x01, 0x00, 0x00,
+	// 0xCE
+	0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0xFB, 0xFF, 0x01, 0xF9, 0xFF, 0x01, 0x03, 0x00, 0x00, 0x02,
+	0x00, 0x00,
+	// 0xCF
+	0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
+	// 0xD0
+	0x00, 0x0E, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x08,
+	0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x00, 0x01, 0x18, 0x80,
+	0x01, 0x10, 0xC0, 0x00, 0x70, 0xE0, 0x00, 0xE0, 0x7F, 0x00, 0x80, 0x1F, 0x00,
+	// 0xD1
+	0x00, 0x0A, 0x00, 0xF8, 0xFF, 0x01, 0x38, 0x00, 0x00, 0x73, 0x00, 0x00, 0xC1, 0x01, 0x00, 0x01,
+	0x07, 0x00, 0x03, 0x1E, 0x00, 0x02, 0x38, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xC0, 0x01, 0xF8, 0xFF,
+	0x01,
+	// 0xD2
+	0x00, 0x0E, 0x00, 0x80, 0x1F, 0x00, 0xE0, 0x7F, 0x00, 0x70, 0xE0, 0x00, 0x10, 0x80, 0x00, 0x18,
+	0x80, 0x01, 0x08, 0x00, 0x01, 0x09, 0x00, 0x01, 0x09, 0x00, 0x01, 0x0A, 0x00, 0x01, 0x18, 0x80,
+	0x01, 0x10, 0x80, 0x00, 0x70, 0xE0, 0x00, 0xE0, 0x7F, 0x00, 0x80, 0x1F, 0x00,
+	// 0xD3
+	0x00, 0x0E, 0x00, 0x80, 0x1F, 0x00, 0xE0, 0x7F, 0x00, 0x70, 0xE0, 0x00, 0x10, 0x80, 0x00, 0x18,
+	0x80, 0x01, 0x08, 0x00, 0x01, 0x0A, 0x00, 0x01, 0x09, 0x00, 0x01, 0x09, 0x00, 0x01, 0x18, 0x80,
+	0x01, 0x10, 0x80, 0x00, 0x70, 0xE0, 0x00, 0xE0, 0x7F, 0x00, 0x80, 0x1F, 0x00,
+	// 0xD4
+	0x00, 0x0E, 0x00, 0x80, 0x1F, 0x00, 0xE0, 0x7F, 0x00, 0x70, 0xE0, 0x00, 0x10, 0x80, 0x00, 0x18,
+	0x80, 0x01, 0x0A, 0x00, 0x01, 0x0B, 0x00, 0x01, 0x09, 0x00, 0x01, 0x0B, 0x00, 0x01, 0x1A, 0x80,
+	0x01, 0x10, 0x80, 0x00, 0x70, 0xE0, 0x00, 0xE0, 0x7F, 0x00, 0x80, 0x1F, 0x00,
+	// 0xD5
+	0x00, 0x0E, 0x00, 0x80, 0x1F, 0x00, 0xE0, 0x7F, 0x00, 0x70, 0xE0, 0x00, 0x10, 0x80, 0x00, 0x1B,
+	0x80, 0x01, 0x09, 0x00, 0x01, 0x09, 0x00, 0x01, 0x0B, 0x00, 0x01, 0x0A, 0x00, 0x01, 0x1A, 0x80,
+	0x01, 0x13, 0x80, 0x00, 0x70, 0xE0, 0x00, 0xE0, 0x7F, 0x00, 0x80, 0x1F, 0x00,
+	// 0xD6
+	0x00, 0x0E, 0x00, 0x80, 0x1F, 0x00, 0xE0, 0x7F, 0x00, 0x70, 0xE0, 0x00, 0x10, 0x80, 0x00, 0x1B,
+	0x80, 0x01, 0x0B, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x1B, 0x80,
+	0x01, 0x13, 0x80, 0x00, 0x70, 0xE0, 0x00, 0xE0, 0x7F, 0x00, 0x80, 0x1F, 0x00,
+	// 0xD7
+	0x00, 0x08, 0x00, 0x60, 0x30, 0x00, 0xC0, 0x18, 0x00, 0x80, 0x0D, 0x00, 0x00, 0x07, 0x00, 0x00,
+	0x07, 0x00, 0x80, 0x0D, 0x00, 0xC0, 0x18, 0x00, 0x60, 0x30, 0x00,
+	// 0xD8
+	0x00, 0x0E, 0x00, 0x80, 0x1F, 0x01, 0xE0, 0xFF, 0x01, 0x70, 0xE0, 0x00, 0x10, 0xE0, 0x00, 0x18,
+	0xB0, 0x01, 0x08, 0x18, 0x01, 0x08, 0x0E, 0x01, 0x08, 0x07, 0x01, 0x88, 0x01, 0x01, 0xD8, 0x80,
+	0x01, 0x70, 0x80, 0x00, 0x70, 0xE0, 0x00, 0xF8, 0x7F, 0x00, 0x88, 0x1F, 0x00,
+	// 0xD9
+	0x00, 0x0C, 0x00, 0xF8, 0x0F, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x80, 0x01, 0x00,
+	0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x02, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0xE0,
+	0x00, 0xF8, 0x7F, 0x00, 0xF8, 0x0F, 0x00,
+	// 0xDA
+	0x00, 0x0C, 0x00, 0xF8, 0x0F, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x80, 0x01, 0x00,
+	0x00, 0x01, 0x02, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0xE0,
+	0x00, 0xF8, 0x7F, 0x00, 0xF8, 0x0F, 0x00,
+	// 0xDB
+	0x00, 0x0C, 0x00, 0xF8, 0x0F, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x80, 0x01, 0x02,
+	0x00, 0x01, 0x03, 0x00, 0x01, 0x01, 0x00, 0x01, 0x03, 0x00, 0x01, 0x02, 0x80, 0x01, 0x00, 0xE0,
+	0x00, 0xF8, 0x7F, 0x00, 0xF8, 0x0F, 0x00,
+	// 0xDC
+	0x00, 0x0C, 0x00, 0xF8, 0x0F, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x01, 0x03,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x03, 0x80, 0x01, 0x03, 0xE0,
+	0x00, 0xF8, 0x7F, 0x00, 0xF8, 0x0F, 0x00,
+	// 0xDD
+	0x00, 0x0C, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x80,
+	0x03, 0x00, 0x02, 0xFE, 0x01, 0x01, 0xFE, 0x01, 0x81, 0x03, 0x00, 0xC0, 0x01, 0x00, 0x70, 0x00,
+	0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00,
+	// 0xDE
+	0x00, 0x0B, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x20, 0x20, 0x00, 0x20, 0x20, 0x00, 0x20,
+	0x20, 0x00, 0x20, 0x20, 0x00, 0x20, 0x20, 0x00, 0x20, 0x20, 0x00, 0x60, 0x18, 0x00, 0xC0, 0x1F,
+	0x00, 0x80, 0x07, 0x00,
+	// 0xDF
+	0x00, 0x0B, 0x00, 0xC0, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x18, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04,
+	0x80, 0x01, 0x04, 0x00, 0x01, 0x84, 0x07, 0x01, 0xCC, 0x0E, 0x01, 0x78, 0x0C, 0x01, 0x30, 0xF8,
+	0x01, 0x00, 0xF0, 0x00,
+	// 0xE0
+	0x00, 0x0B, 0x00, 0x00, 0xF1, 0x00, 0x80, 0xF9, 0x01, 0xC4, 0x0C, 0x01, 0x44, 0x04, 0x01, 0x4C,
+	0x04, 0x01, 0x50, 0x04, 0x01, 0x40, 0x84, 0x00, 0xC0, 0x7F, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01,
+	// 0xE1
+	0x00, 0x0B, 0x00, 0x00, 0xF1, 0x00, 0x80, 0xF9, 0x01, 0xC0, 0x0C, 0x01, 0x40, 0x04, 0x01, 0x50,
+	0x04, 0x01, 0x48, 0x04, 0x01, 0x4C, 0x84, 0x00, 0xC4, 0x7F, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01,
+	// 0xE2
+	0x00, 0x0B, 0x00, 0x00, 0xF1, 0x00, 0x80, 0xF9, 0x01, 0xD0, 0x0C, 0x01, 0x58, 0x04, 0x01, 0x4C,
+	0x04, 0x01, 0x44, 0x04, 0x01, 0x4C, 0x84, 0x00, 0xD8, 0x7F, 0x00, 0x90, 0xFF, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01,
+	// 0xE3
+	0x00, 0x0B, 0x00, 0x00, 0xF1, 0x00, 0x80, 0xF9, 0x01, 0xD8, 0x0C, 0x01, 0x48, 0x04, 0x01, 0x48,
+	0x04, 0x01, 0x58, 0x04, 0x01, 0x50, 0x84, 0x00, 0xD0, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01,
+	// 0xE4
+	0x00, 0x0B, 0x00, 0x00, 0xF1, 0x00, 0x80, 0xF9, 0x01, 0xCC, 0x0C, 0x01, 0x4C, 0x04, 0x01, 0x40,
+	0x04, 0x01, 0x40, 0x04, 0x01, 0x4C, 0x84, 0x00, 0xCC, 0x7F, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01,
+	// 0xE5
+	0x00, 0x0B, 0x00, 0x00, 0xF1, 0x00, 0x80, 0xF9, 0x01, 0xC0, 0x0C, 0x01, 0x4E, 0x04, 0x01, 0x51,
+	0x04, 0x01, 0x51, 0x04, 0x01, 0x4E, 0x84, 0x00, 0xC0, 0x7F, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01,
+	// 0xE6
+	0x00, 0x11, 0x00, 0x00, 0xF9, 0x00, 0x80, 0xF9, 0x01, 0xC0, 0x0C, 0x01, 0x40, 0x04, 0x01, 0x40,
+	0x04, 0x01, 0x40, 0x84, 0x01, 0x40, 0xC4, 0x00, 0x80, 0x7F, 0x00, 0x80, 0xFF, 0x00, 0x80, 0xC9,
+	0x00, 0x40, 0x08, 0x01, 0x40, 0x08, 0x01, 0x40, 0x08, 0x01, 0x40, 0x08, 0x01, 0xC0, 0x88, 0x01,
+	0x80, 0xCF, 0x00, 0x00, 0x4E, 0x00,
+	// 0xE7
+	0x00, 0x09, 0x00, 0x00, 0x3E, 0x00, 0x80, 0xFF, 0x00, 0xC0, 0x80, 0x01, 0x40, 0x00, 0x01, 0x40,
+	0x00, 0x07, 0x40, 0x00, 0x15, 0x40, 0x00, 0x19, 0x80, 0xC1, 0x00, 0x80, 0xC1, 0x00,
+	// 0xE8
+	0x00, 0x0A, 0x00, 0x00, 0x3F, 0x00, 0x80, 0xFF, 0x00, 0xC0, 0x88, 0x00, 0x44, 0x08, 0x01, 0x44,
+	0x08, 0x01, 0x4C, 0x08, 0x01, 0x50, 0x08, 0x01, 0xC0, 0x88, 0x01, 0x80, 0xCF, 0x00, 0x00, 0x4E,
+	0x00,
+	// 0xE9
+	0x00, 0x0A, 0x00, 0x00, 0x3F, 0x00, 0x80, 0xFF, 0x00, 0xC0, 0x88, 0x00, 0x40, 0x08, 0x01, 0x50,
+	0x08, 0x01, 0x48, 0x08, 0x01, 0x4C, 0x08, 0x01, 0xC4, 0x88, 0x01, 0x80, 0xCF, 0x00, 0x00, 0x4E,
+	0x00,
+	// 0xEA
+	0x00, 0x0A, 0x00, 0x00, 0x3F, 0x00, 0x80, 0xFF, 0x00, 0xD0, 0x88, 0x00, 0x58, 0x08, 0x01, 0x4C,
+	0x08, 0x01, 0x44, 0x08, 0x01, 0x4C, 0x08, 0x01, 0xD8, 0x88, 0x01, 0x90, 0xCF, 0x00, 0x00, 0x4E,
+	0x00,
+	// 0xEB
+	0x00, 0x0A, 0x00, 0x00, 0x3F, 0x00, 0x80, 0xFF, 0x00, 0xCC, 0x88, 0x00, 0x4C, 0x08, 0x01, 0x40,
+	0x08, 0x01, 0x40, 0x08, 0x01, 0x4C, 0x08, 0x01, 0xCC, 0x88, 0x01, 0x80, 0xCF, 0x00, 0x00, 0x4E,
+	0x00,
+	// 0xEC
+	0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x0C, 0x00, 0x00, 0xC8, 0xFF, 0x01, 0xD0, 0xFF, 0x01,
+	// 0xED
+	0x00, 0x04, 0x00, 0xD0, 0xFF, 0x01, 0xC8, 0xFF, 0x01, 0x0C, 0x00, 0x00, 0x04, 0x00, 0x00,
+	// 0xEE
+	0x00, 0x07, 0x00, 0x10, 0x00, 0x00, 0x18, 0x00, 0x00, 0xCC, 0xFF, 0x01, 0xC4, 0xFF, 0x01, 0x0C,
+	0x00, 0x00, 0x18, 0x00, 0x00, 0x10, 0x00, 0x00,
+	// 0xEF
+	0x00, 0x06, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x01, 0x0C,
+	0x00, 0x00, 0x0C, 0x00, 0x00,
+	// 0xF0
+	0x00, 0x0A, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0xA4, 0x81, 0x01, 0x94, 0x00, 0x01, 0x98,
+	0x00, 0x01, 0x98, 0x00, 0x01, 0xB8, 0x00, 0x01, 0xEC, 0x81, 0x01, 0xC4, 0xFF, 0x00, 0x00, 0x7F,
+	0x00,
+	// 0xF1
+	0x00, 0x09, 0x00, 0xC0, 0xFF, 0x01, 0xD8, 0xFF, 0x01, 0x88, 0x01, 0x00, 0x48, 0x00, 0x00, 0x58,
+	0x00, 0x00, 0x50, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xC8, 0xFF, 0x01, 0x00, 0xFF, 0x01,
+	// 0xF2
+	0x00, 0x0A, 0x00, 0x00, 0x7F, 0x00, 0x80, 0xFF, 0x00, 0xC0, 0x80, 0x01, 0x44, 0x00, 0x01, 0x4C,
+	0x00, 0x01, 0x48, 0x00, 0x01, 0x50, 0x00, 0x01, 0xC0, 0x80, 0x01, 0x80, 0xFF, 0x00, 0x00, 0x7F,
+	0x00,
+	// 0xF3
+	0x00, 0x0A, 0x00, 0x00, 0x7F, 0x00, 0x80, 0xFF, 0x00, 0xC0, 0x80, 0x01, 0x40, 0x00, 0x01, 0x50,
+	0x00, 0x01, 0x48, 0x00, 0x01, 0x4C, 0x00, 0x01, 0xC4, 0x80, 0x01, 0x80, 0xFF, 0x00, 0x00, 0x7F,
+	0x00,
+	// 0xF4
+	0x00, 0x0A, 0x00, 0x00, 0x7F, 0x00, 0x80, 0xFF, 0x00, 0xD0, 0x80, 0x01, 0x58, 0x00, 0x01, 0x4C,
+	0x00, 0x01, 0x44, 0x00, 0x01, 0x4C, 0x00, 0x01, 0xD8, 0x80, 0x01, 0x90, 0xFF, 0x00, 0x00, 0x7F,
+	0x00,
+	// 0xF5
+	0x00, 0x0A, 0x00, 0x00, 0x7F, 0x00, 0x80, 0xFF, 0x00, 0xD8, 0x80, 0x01, 0x48, 0x00, 0x01, 0x48,
+	0x00, 0x01, 0x58, 0x00, 0x01, 0x50, 0x00, 0x01, 0xD0, 0x80, 0x01, 0x88, 0xFF, 0x00, 0x00, 0x7F,
+	0x00,
+	// 0xF6
+	0x00, 0x0A, 0x00, 0x00, 0x7F, 0x00, 0x80, 0xFF, 0x00, 0xCC, 0x80, 0x01, 0x4C, 0x00, 0x01, 0x40,
+	0x00, 0x01, 0x40, 0x00, 0x01, 0x4C, 0x00, 0x01, 0xCC, 0x80, 0x01, 0x80, 0xFF, 0x00, 0x00, 0x7F,
+	0x00,
+	// 0xF7
+	0x00, 0x0A, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x60,
+	0x32, 0x00, 0x60, 0x32, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02,
+	0x00,
+	// 0xF8
+	0x00, 0x0A, 0x00, 0x00, 0x1C, 0x01, 0x80, 0xFF, 0x01, 0x80, 0xC1, 0x00, 0x40, 0x70, 0x01, 0x40,
+	0x18, 0x01, 0x40, 0x0C, 0x01, 0x40, 0x07, 0x01, 0x80, 0xC1, 0x00, 0xC0, 0xFF, 0x00, 0x40, 0x1C,
+	0x00,
+	// 0xF9
+	0x00, 0x09, 0x00, 0xC0, 0x7F, 0x00, 0xC0, 0xFF, 0x00, 0x04, 0x80, 0x01, 0x0C, 0x00, 0x01, 0x08,
+	0x00, 0x01, 0x10, 0x00, 0x01, 0x00, 0xC0, 0x00, 0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x01,
+	// 0xFA
+	0x00, 0x09, 0x00, 0xC0, 0x7F, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x80, 0x01, 0x10, 0x00, 0x01, 0x08,
+	0x00, 0x01, 0x0C, 0x00, 0x01, 0x04, 0xC0, 0x00, 0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x01,
+	// 0xFB
+	0x00, 0x09, 0x00, 0xC0, 0x7F, 0x00, 0xD0, 0xFF, 0x00, 0x18, 0x80, 0x01, 0x0C, 0x00, 0x01, 0x04,
+	0x00, 0x01, 0x0C, 0x00, 0x01, 0x18, 0xC0, 0x00, 0xD0, 0xFF, 0x01, 0xC0, 0xFF, 0x01,
+	// 0xFC
+	0x00, 0x09, 0x00, 0xC0, 0x7F, 0x00, 0xCC, 0xFF, 0x00, 0x0C, 0x80, 0x01, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x0C, 0x00, 0x01, 0x0C, 0xC0, 0x00, 0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x01,
+	// 0xFD
+	0x00, 0x0B, 0x00, 0x40, 0x00, 0x00, 0xC0, 0x01, 0x10, 0x80, 0x0F, 0x10, 0x00, 0x3C, 0x18, 0x10,
+	0xF0, 0x0E, 0x08, 0x80, 0x07, 0x0C, 0xE0, 0x01, 0x04, 0x3C, 0x00, 0x80, 0x0F, 0x00, 0xC0, 0x03,
+	0x00, 0x40, 0x00, 0x00,
+	// 0xFE
+	0x00, 0x0A, 0x00, 0xFC, 0xFF, 0x1F, 0xFC, 0xFF, 0x1F, 0x00, 0xC1, 0x00, 0x80, 0x80, 0x00, 0x40,
+	0x00, 0x01, 0x40, 0x00, 0x01, 0x40, 0x00, 0x01, 0xC0, 0x80, 0x01, 0x80, 0xFF, 0x00, 0x00, 0x7F,
+	0x00,
+	// 0xFF
+	0x00, 0x0B, 0x00, 0x40, 0x00, 0x00, 0xC0, 0x01, 0x10, 0x8C, 0x0F, 0x10, 0x0C, 0x3C, 0x18, 0x00,
+	0xF0, 0x0E, 0x00, 0x80, 0x07, 0x0C, 0xE0, 0x01, 0x0C, 0x3C, 0x00, 0x80, 0x0F, 0x00, 0xC0, 0x03,
+	0x00, 0x40, 0x00, 0x00,
+	// U+0384
+	0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x04, 0x00, 0x00,
+	// U+0385
+	0x00, 0x06, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0C,
+	0x00, 0x00, 0x08, 0x00, 0x00,
+	// U+0386
+	0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x10, 0xE0, 0x01, 0x18, 0xFC, 0x00, 0x04, 0x3F, 0x00, 0xE0,
+	0x13, 0x00, 0x78, 0x10, 0x00, 0x38, 0x10, 0x00, 0xF8, 0x10, 0x00, 0xC0, 0x17, 0x00, 0x00, 0x3F,
+	0x00, 0x00, 0xF8, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x01,
+	// U+0387
+	0x00, 0x02, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x06, 0x00,
+	// U+0388
+	0x00, 0x0D, 0x00, 0x10, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x04, 0x00, 0x00, 0xF8,
+	0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x18, 0x82, 0x01, 0x18, 0x82, 0x01, 0x18, 0x82, 0x01, 0x18, 0x82,
+	0x01, 0x18, 0x82, 0x01, 0x18, 0x82, 0x01, 0x18, 0x82, 0x01,
+	// U+0389
+	0x00, 0x0F, 0x00, 0x10, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x04, 0x00, 0x00, 0xF8,
+	0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,
+	// U+038A
+	0x00, 0x06, 0x00, 0x10, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x04, 0x00, 0x00, 0xF8,
+	0xFF, 0x01, 0xF8, 0xFF, 0x01,
+	// U+038C
+	0x00, 0x0F, 0x00, 0x10, 0x00, 0x00, 0x18, 0x00, 0x00, 0xCC, 0x3F, 0x00, 0xE4, 0x7F, 0x00, 0x30,
+	0xC0, 0x00, 0x18, 0x80, 0x01, 0x18, 0x80, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x18, 0x00,
+	0x01, 0x18, 0x80, 0x01, 0x30, 0xC0, 0x00, 0xF0, 0xF9, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x06, 0x00,
+	// U+038E
+	0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xFF,
+	0x01, 0x00, 0xFF, 0x01, 0x80, 0x03, 0x00, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x18, 0x00, 0x00,
+	0x08, 0x00, 0x00,
+	// U+038F
+	0x00, 0x0F, 0x00, 0x10, 0x00, 0x00, 0x18, 0x00, 0x00, 0xCC, 0x9F, 0x01, 0xE4, 0xBF, 0x01, 0x30,
+	0xE0, 0x01, 0x18, 0xC0, 0x01, 0x18, 0x80, 0x01, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x18, 0x80,
+	0x01, 0x18, 0xC0, 0x01, 0x30, 0xE0, 0x01, 0xF0, 0xF8, 0x01, 0xC0, 0x9F, 0x01, 0x00, 0x87, 0x01,
+	// U+0390
+	0x00, 0x06, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0xC3, 0xFF, 0x00, 0x01, 0xC0, 0x01, 0x0C,
+	0x80, 0x01, 0x08, 0x00, 0x01,
+	// U+0391
+	0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0xE0, 0x01, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xE0,
+	0x13, 0x00, 0x78, 0x10, 0x00, 0x38, 0x10, 0x00, 0xF8, 0x10, 0x00, 0xC0, 0x17, 0x00, 0x00, 0x3F,
+	0x00, 0x00, 0xF8, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x01,
+	// U+0392
+	0x00, 0x0A, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x18, 0x82, 0x01, 0x18, 0x82, 0x01, 0x18,
+	0x82, 0x01, 0x18, 0x82, 0x01, 0x18, 0x87, 0x01, 0xF0, 0xC7, 0x01, 0xF0, 0xFD, 0x00, 0x00, 0x78,
+	0x00,
+	// U+0393
+	0x00, 0x09, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
+	0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00,
+	// U+0394
+	0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0xE0, 0x01, 0x00, 0xFC, 0x01, 0x00, 0x9F, 0x01, 0xE0,
+	0x83, 0x01, 0x78, 0x80, 0x01, 0x38, 0x80, 0x01, 0xF8, 0x80, 0x01, 0xC0, 0x87, 0x01, 0x00, 0x9F,
+	0x01, 0x00, 0xF8, 0x01, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x01,
+	// U+0395
+	0x00, 0x09, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x18, 0x82, 0x01, 0x18, 0x82, 0x01, 0x18,
+	0x82, 0x01, 0x18, 0x82, 0x01, 0x18, 0x82, 0x01, 0x18, 0x82, 0x01, 0x18, 0x82, 0x01,
+	// U+0396
+	0x00, 0x0B, 0x00, 0x08, 0x80, 0x01, 0x18, 0xC0, 0x01, 0x18, 0xF0, 0x01, 0x18, 0xB8, 0x01, 0x18,
+	0x9C, 0x01, 0x18, 0x8E, 0x01, 0x18, 0x83, 0x01, 0xD8, 0x81, 0x01, 0xF8, 0x80, 0x01, 0x78, 0x80,
+	0x01, 0x18, 0x80, 0x01,
+	// U+0397
+	0x00, 0x0B, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0xF8, 0xFF,
+	0x01, 0xF8, 0xFF, 0x01,
+	// U+0398
+	0x00, 0x0D, 0x00, 0x80, 0x1F, 0x00, 0xE0, 0x7F, 0x00, 0x70, 0xE0, 0x00, 0x38, 0xC2, 0x01, 0x18,
+	0x82, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x18, 0x82, 0x01, 0x38, 0xC2,
+	0x01, 0x70, 0xE0, 0x00, 0xE0, 0x7F, 0x00, 0x80, 0x1F, 0x00,
+	// U+0399
+	0x00, 0x02, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,
+	// U+039A
+	0x00, 0x0B, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0x07, 0x00, 0x80, 0x0F, 0x00, 0xC0,
+	0x1D, 0x00, 0xC0, 0x38, 0x00, 0x60, 0x70, 0x00, 0x30, 0xE0, 0x00, 0x18, 0xC0, 0x01, 0x08, 0x80,
+	0x01, 0x00, 0x00, 0x01,
+	// U+039B
+	0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0xE0, 0x01, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0xE0,
+	0x03, 0x00, 0x78, 0x00, 0x00, 0x38, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x1F,
+	0x00, 0x00, 0xF8, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x01,
+	// U+039C
+	0x00, 0x0D, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x38, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x80,
+	0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x30, 0x00, 0x00, 0x3C, 0x00, 0x80, 0x07, 0x00, 0xF0, 0x01,
+	0x00, 0x38, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,
+	// U+039D
+	0x00, 0x0B, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x78, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x80,
+	0x03, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xC0, 0x01, 0xF8, 0xFF,
+	0x01, 0xF8, 0xFF, 0x01,
+	// U+039E
+	0x00, 0x09, 0x00, 0x18, 0x80, 0x01, 0x18, 0x82, 0x01, 0x18, 0x82, 0x01, 0x18, 0x82, 0x01, 0x18,
+	0x82, 0x01, 0x18, 0x82, 0x01, 0x18, 0x82, 0x01, 0x18, 0x82, 0x01, 0x08, 0x00, 0x01,
+	// U+039F
+	0x00, 0x0D, 0x00, 0x80, 0x1F, 0x00, 0xE0, 0x7F, 0x00, 0x70, 0xE0, 0x00, 0x38, 0xC0, 0x01, 0x18,
+	0x80, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x18, 0x80, 0x01, 0x38, 0xC0,
+	0x01, 0x70, 0xE0, 0x00, 0xE0, 0x7F, 0x00, 0x80, 0x1F, 0x00,
+	// U+03A0
+	0x00, 0x0B, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
+	0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0xF8, 0xFF,
+	0x01, 0xF8, 0xFF, 0x01,
+	// U+03A1
+	0x00, 0x09, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x18, 0x04, 0x00, 0x18, 0x04, 0x00, 0x18,
+	0x04, 0x00, 0x18, 0x04, 0x00, 0x18, 0x06, 0x00, 0xF0, 0x07, 0x00, 0xE0, 0x01, 0x00,
+	// U+03A3
+	0x00, 0x09, 0x00, 0x18, 0x80, 0x01, 0x38, 0xE0, 0x01, 0x78, 0xF0, 0x01, 0xD8, 0xB8, 0x01, 0x98,
+	0x8F, 0x01, 0x18, 0x87, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0x01,
+	// U+03A4
+	0x00, 0x0C, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
+	0x00, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
+	0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
+	// U+03A5
+	0x00, 0x0B, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x80,
+	0x03, 0x00, 0x00, 0xFF, 0x01, 0x00, 0xFF, 0x01, 0xC0, 0x01, 0x00, 0xE0, 0x00, 0x00, 0x38, 0x00,
+	0x00, 0x18, 0x00, 0x00,
+	// U+03A6
+	0x00, 0x0D, 0x00, 0x00, 0x0F, 0x00, 0xC0, 0x3F, 0x00, 0xE0, 0x70, 0x00, 0x60, 0x60, 0x00, 0x20,
+	0x40, 0x00, 0x70, 0xE0, 0x00, 0xF8, 0xFF, 0x01, 0x70, 0xC0, 0x00, 0x20, 0x40, 0x00, 0x60, 0x60,
+	0x00, 0xE0, 0x70, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x0F, 0x00,
+	// U+03A7
+	0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x08, 0x80, 0x01, 0x38, 0xE0, 0x00, 0x70, 0x70, 0x00, 0xC0,
+	0x1D, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0xC0, 0x1D, 0x00, 0xE0, 0x70, 0x00, 0x38, 0xE0,
+	0x00, 0x18, 0x80, 0x01, 0x00, 0x00, 0x01,
+	// U+03A8
+	0x00, 0x0D, 0x00, 0xF8, 0x03, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00,
+	0x30, 0x00, 0x00, 0x30, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x38,
+	0x00, 0x00, 0x1C, 0x00, 0xF8, 0x0F, 0x00, 0xF8, 0x03, 0x00,
+	// U+03A9
+	0x00, 0x0D, 0x00, 0x80, 0x8F, 0x01, 0xE0, 0xBF, 0x01, 0x70, 0xF0, 0x01, 0x30, 0xC0, 0x01, 0x18,
+	0x80, 0x01, 0x18, 0x80, 0x01, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x80, 0x01, 0x18, 0xC0,
+	0x01, 0x70, 0xF0, 0x01, 0xE0, 0xBF, 0x01, 0x80, 0x8F, 0x01,
+	// U+03AA
+	0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x01,
+	0x00, 0x00, 0x01, 0x00, 0x00,
+	// U+03AB
+	0x00, 0x0B, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE1, 0x00, 0x00, 0x81,
+	0x03, 0x00, 0x00, 0xFF, 0x01, 0x00, 0xFF, 0x01, 0xC1, 0x01, 0x00, 0xE1, 0x00, 0x00, 0x38, 0x00,
+	0x00, 0x18, 0x00, 0x00,
+	// U+03AC
+	0x00, 0x0B, 0x00, 0x00, 0x7E, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x81, 0x01, 0xC0, 0x00, 0x01, 0xD0,
+	0x00, 0x01, 0xCC, 0x80, 0x01, 0x84, 0xE3, 0x00, 0x00, 0xFF, 0x00, 0x80, 0xEF, 0x01, 0xC0, 0x81,
+	0x01, 0x00, 0x00, 0x01,
+	// U+03AD
+	0x00, 0x08, 0x00, 0x00, 0xF3, 0x00, 0x80, 0xF7, 0x01, 0xC0, 0x9C, 0x01, 0xD0, 0x08, 0x01, 0xD8,
+	0x08, 0x01, 0xCC, 0x08, 0x01, 0xC4, 0x00, 0x01, 0x00, 0x80, 0x01,
+	// U+03AE
+	0x00, 0x09, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x80, 0x01, 0x00, 0x80, 0x00, 0x00, 0xD0,
+	0x00, 0x00, 0xD8, 0x00, 0x00, 0xC4, 0x01, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0xFE, 0x1F,
+	// U+03AF
+	0x00, 0x04, 0x00, 0x80, 0xFF, 0x00, 0x98, 0xFF, 0x01, 0x0C, 0x80, 0x01, 0x04, 0x00, 0x01,
+	// U+03B0
+	0x00, 0x09, 0x00, 0x80, 0x7F, 0x00, 0x8C, 0xFF, 0x01, 0x08, 0x80, 0x01, 0x03, 0x00, 0x01, 0x01,
+	0x00, 0x01, 0x0C, 0x80, 0x01, 0xC0, 0xE0, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x0C, 0x00,
+	// U+03B1
+	0x00, 0x0B, 0x00, 0x00, 0x7E, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x81, 0x01, 0xC0, 0x00, 0x01, 0xC0,
+	0x00, 0x01, 0xC0, 0x80, 0x01, 0x80, 0xE3, 0x00, 0x00, 0xFF, 0x00, 0x80, 0xEF, 0x01, 0xC0, 0x81,
+	0x01, 0x00, 0x00, 0x01,
+	// U+03B2
+	0x00, 0x09, 0x00, 0xF0, 0xFF, 0x1F, 0xF8, 0xFF, 0x1F, 0x0C, 0x80, 0x01, 0x0C, 0x02, 0x01, 0x0C,
+	0x02, 0x01, 0x0C, 0x07, 0x01, 0xF8, 0x87, 0x01, 0xF0, 0xFC, 0x00, 0x00, 0x78, 0x00,
+	// U+03B3
+	0x00, 0x0A, 0x00, 0xC0, 0x00, 0x00, 0x80, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0x3E, 0x00, 0x00,
+	0xF0, 0x01, 0x00, 0xC0, 0x1F, 0x00, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x80, 0x07, 0x00, 0xC0, 0x01,
+	0x00,
+	// U+03B4
+	0x00, 0x0A, 0x00, 0x00, 0x7C, 0x00, 0x70, 0xFF, 0x00, 0xF8, 0x81, 0x01, 0xC8, 0x80, 0x01, 0xC8,
+	0x00, 0x01, 0x88, 0x00, 0x01, 0x88, 0x81, 0x01, 0x88, 0xC3, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x1C,
+	0x00,
+	// U+03B5
+	0x00, 0x08, 0x00, 0x00, 0xF3, 0x00, 0x80, 0xF7, 0x01, 0xC0, 0x9C, 0x01, 0xC0, 0x08, 0x01, 0xC0,
+	0x08, 0x01, 0xC0, 0x08, 0x01, 0xC0, 0x00, 0x01, 0x00, 0x80, 0x01,
+	// U+03B6
+	0x00, 0x09, 0x00, 0x08, 0x7E, 0x00, 0x0C, 0xFF, 0x00, 0xCC, 0x81, 0x01, 0xEC, 0x80, 0x01, 0x6C,
+	0x00, 0x01, 0x3C, 0x00, 0x11, 0x1C, 0x00, 0x1B, 0x1C, 0x00, 0x0F, 0x08, 0x00, 0x00,
+	// U+03B7
+	0x00, 0x09, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x80, 0x01, 0x00, 0x80, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0xFE, 0x1F,
+	// U+03B8
+	0x00, 0x0A, 0x00, 0xC0, 0x1F, 0x00, 0xF0, 0xFF, 0x00, 0x18, 0xC2, 0x00, 0x0C, 0x82, 0x01, 0x0C,
+	0x02, 0x01, 0x0C, 0x02, 0x01, 0x08, 0x82, 0x01, 0x78, 0xE2, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x0F,
+	0x00,
+	// U+03B9
+	0x00, 0x04, 0x00, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x01,
+	// U+03BA
+	0x00, 0x09, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x00, 0x0C, 0x00, 0x00, 0x0E, 0x00, 0x00,
+	0x3B, 0x00, 0x80, 0x71, 0x00, 0x80, 0xE0, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x01,
+	// U+03BB
+	0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0xC0, 0x01, 0x0C, 0xF0, 0x00, 0x08, 0x1E, 0x00, 0xF8,
+	0x07, 0x00, 0xF0, 0x03, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x80,
+	0x01,
+	// U+03BC
+	0x00, 0x0A, 0x00, 0xC0, 0xFF, 0x1F, 0x80, 0xFF, 0x1F, 0x00, 0x80, 0x01, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x80, 0x01, 0x80, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x00, 0x00,
+	0x01,
+	// U+03BD
+	0x00, 0x09, 0x00, 0x80, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xF0, 0x01, 0x00,
+	0x80, 0x01, 0x00, 0xC0, 0x01, 0x00, 0x60, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x1F, 0x00,
+	// U+03BE
+	0x00, 0x09, 0x00, 0x00, 0x78, 0x00, 0xEC, 0xFD, 0x00, 0x3C, 0x87, 0x01, 0x1C, 0x87, 0x01, 0x1C,
+	0x02, 0x01, 0x0C, 0x02, 0x01, 0x0C, 0x02, 0x1B, 0x0C, 0x00, 0x1F, 0x00, 0x00, 0x04,
+	// U+03BF
+	0x00, 0x0A, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x80, 0x81, 0x01, 0xC0, 0x80, 0x01, 0xC0,
+	0x00, 0x01, 0xC0, 0x00, 0x01, 0x80, 0x80, 0x01, 0x80, 0xC3, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x1C,
+	0x00,
+	// U+03C0
+	0x00, 0x0A, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x01, 0xC0, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x01, 0xC0, 0x00,
+	0x01,
+	// U+03C1
+	0x00, 0x09, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0xFF, 0x1F, 0x80, 0x81, 0x00, 0xC0, 0x00, 0x01, 0xC0,
+	0x00, 0x01, 0xC0, 0x00, 0x01, 0x80, 0x80, 0x01, 0x80, 0xE7, 0x00, 0x00, 0x7F, 0x00,
+	// U+03C2
+	0x00, 0x08, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xFF, 0x00, 0x80, 0xC1, 0x01, 0xC0, 0x80, 0x01, 0xC0,
+	0x00, 0x01, 0xC0, 0x00, 0x11, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x0E,
+	// U+03C3
+	0x00, 0x0B, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x80, 0x81, 0x01, 0x80, 0x80, 0x01, 0x80,
+	0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x80, 0x01, 0xC0, 0xC3, 0x01, 0xC0, 0xFF, 0x00, 0xC0, 0x1C,
+	0x00, 0x80, 0x00, 0x00,
+	// U+03C4
+	0x00, 0x0A, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
+	0xFF, 0x00, 0xC0, 0xFF, 0x01, 0xC0, 0x80, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x80, 0x00,
+	0x00,
+	// U+03C5
+	0x00, 0x09, 0x00, 0x80, 0x7F, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x00, 0x80, 0x01, 0xC0, 0xE0, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x0C, 0x00,
+	// U+03C6
+	0x00, 0x0B, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x80, 0x81, 0x01, 0x80, 0x80, 0x01, 0x00,
+	0xFF, 0x1F, 0x80, 0xFF, 0x1F, 0xC0, 0x00, 0x01, 0x80, 0x80, 0x01, 0x80, 0xE3, 0x00, 0x00, 0x7F,
+	0x00, 0x00, 0x08, 0x00,
+	// U+03C7
+	0x00, 0x0A, 0x00, 0x80, 0x00, 0x10, 0x80, 0x00, 0x1C, 0x80, 0x03, 0x0F, 0x00, 0x8F, 0x03, 0x00,
+	0xFC, 0x01, 0x00, 0xF8, 0x01, 0x00, 0x9E, 0x0F, 0x80, 0x07, 0x1C, 0xC0, 0x01, 0x18, 0x00, 0x00,
+	0x10,
+	// U+03C8
+	0x00, 0x0B, 0x00, 0xC0, 0x7F, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80,
+	0xFF, 0x1F, 0xC0, 0xFF, 0x1F, 0x00, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0xC0, 0x00, 0xC0, 0xFF,
+	0x00, 0x80, 0x1F, 0x00,
+	// U+03C9
+	0x00, 0x0D, 0x00, 0x00, 0x7E, 0x00, 0x80, 0xFF, 0x00, 0xC0, 0x81, 0x01, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x00, 0xC0, 0x01, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x80, 0x01, 0xC0, 0xE7, 0x01, 0x00, 0xFF, 0x00,
+	// U+03CA
+	0x00, 0x06, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0xC0, 0x01, 0x0C,
+	0x80, 0x01, 0x08, 0x00, 0x01,
+	// U+03CB
+	0x00, 0x09, 0x00, 0x80, 0x7F, 0x00, 0x8C, 0xFF, 0x01, 0x08, 0x80, 0x01, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x0C, 0x80, 0x01, 0xC0, 0xE0, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x0C, 0x00,
+	// U+03CC
+	0x00, 0x0A, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x80, 0x81, 0x01, 0xC0, 0x80, 0x01, 0xD0,
+	0x00, 0x01, 0xD8, 0x00, 0x01, 0x84, 0x80, 0x01, 0x80, 0xC3, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x1C,
+	0x00,
+	// U+03CD
+	0x00, 0x09, 0x00, 0x80, 0x7F, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x80, 0x01, 0x10, 0x00, 0x01, 0x0C,
+	0x00, 0x01, 0x04, 0x80, 0x01, 0xC0, 0xE0, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x0C, 0x00,
+	// U+03CE
+	0x00, 0x0D, 0x00, 0x00, 0x7E, 0x00, 0x80, 0xFF, 0x00, 0xC0, 0x81, 0x01, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x00, 0xC0, 0x01, 0x10, 0xF8, 0x00, 0x0C, 0xF8, 0x00, 0x04, 0x80, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x80, 0x01, 0xC0, 0xE7, 0x01, 0x00, 0xFF, 0x00,
+	// U+0400
+	0x00, 0x09, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x18, 0x82, 0x01, 0x18, 0x82, 0x01, 0x19,
+	0x82, 0x01, 0x1B, 0x82, 0x01, 0x18, 0x82, 0x01, 0x18, 0x82, 0x01, 0x18, 0x82, 0x01,
+	// U+0401
+	0x00, 0x09, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x19, 0x82, 0x01, 0x19, 0x82, 0x01, 0x18,
+	0x82, 0x01, 0x19, 0x82, 0x01, 0x19, 0x82, 0x01, 0x18, 0x82, 0x01, 0x18, 0x82, 0x01,
+	// U+0402
+	0x00, 0x0E, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0xF8,
+	0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x18, 0x02, 0x00, 0x18, 0x02, 0x00, 0x18, 0x02, 0x00, 0x18, 0x02,
+	0x18, 0x18, 0x06, 0x18, 0x00, 0x0E, 0x1C, 0x00, 0xFC, 0x0F, 0x00, 0xF0, 0x03,
+	// U+0403
+	0x00, 0x09, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1B,
+	0x00, 0x00, 0x19, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00,
+	// U+0404
+	0x00, 0x0B, 0x00, 0x80, 0x1F, 0x00, 0xE0, 0x7F, 0x00, 0x70, 0xE6, 0x00, 0x18, 0x86, 0x01, 0x18,
+	0x86, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x18, 0x86, 0x01, 0x18, 0x80,
+	0x01, 0x10, 0x80, 0x00,
+	// U+0405
+	0x00, 0x0A, 0x00, 0xE0, 0x81, 0x01, 0xF0, 0x83, 0x01, 0x18, 0x83, 0x01, 0x18, 0x03, 0x01, 0x08,
+	0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x86, 0x01, 0x18, 0x8C, 0x01, 0x18, 0xFC, 0x00, 0x00, 0x78,
+	0x00,
+	// U+0406
+	0x00, 0x02, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,
+	// U+0407
+	0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x01,
+	0x00, 0x00, 0x01, 0x00, 0x00,
+	// U+0408
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1C, 0xF8, 0xFF, 0x0F, 0xF8,
+	0xFF, 0x03,
+	// U+0409
+	0x00, 0x13, 0x00, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0xE0, 0x00, 0xF8, 0x7F, 0x00, 0xF8,
+	0x3F, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
+	0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0x82, 0x01, 0x00, 0x82, 0x01, 0x00, 0x82, 0x01,
+	0x00, 0x86, 0x01, 0x00, 0xC6, 0x01, 0x00, 0xFC, 0x00, 0x00, 0x78, 0x00,
+	// U+040A
+	0x00, 0x11, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF,
+	0x01, 0x00, 0x82, 0x01, 0x00, 0x82, 0x01, 0x00, 0x82, 0x01, 0x00, 0x86, 0x01, 0x00, 0xC6, 0x01,
+	0x00, 0xFC, 0x00, 0x00, 0x78, 0x00,
+	// U+040B
+	0x00, 0x0E, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0xF8,
+	0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x18, 0x02, 0x00, 0x18, 0x02, 0x00, 0x18, 0x02, 0x00, 0x18, 0x02,
+	0x00, 0x18, 0x06, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xFC, 0x01, 0x00, 0xF0, 0x01,
+	// U+040C
+	0x00, 0x0B, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x82,
+	0x03, 0x00, 0xC1, 0x07, 0x00, 0xE0, 0x1C, 0x00, 0x70, 0x38, 0x00, 0x38, 0xE0, 0x00, 0x18, 0xC0,
+	0x01, 0x08, 0x00, 0x01,
+	// U+040D
+	0x00, 0x0B, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0xE0, 0x01, 0x00, 0x70, 0x00, 0x01,
+	0x1C, 0x00, 0x02, 0x07, 0x00, 0xC0, 0x03, 0x00, 0xF0, 0x00, 0x00, 0x38, 0x00, 0x00, 0xF8, 0xFF,
+	0x01, 0xF8, 0xFF, 0x01,
+	// U+040E
+	0x00, 0x0B, 0x00, 0x08, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x81, 0x01, 0xC1, 0x87, 0x01, 0x01,
+	0xFE, 0x01, 0x01, 0xF8, 0x00, 0x01, 0x3E, 0x00, 0x81, 0x07, 0x00, 0xF0, 0x01, 0x00, 0x78, 0x00,
+	0x00, 0x08, 0x00, 0x00,
+	// U+040F
+	0x00, 0x0B, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00,
+	0x80, 0x01, 0x00, 0x80, 0x0F, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0xF8, 0xFF,
+	0x01, 0xF8, 0xFF, 0x01,
+	// U+0410
+	0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0xE0, 0x01, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xE0,
+	0x13, 0x00, 0x78, 0x10, 0x00, 0x38, 0x10, 0x00, 0xF8, 0x10, 0x00, 0xC0, 0x17, 0x00, 0x00, 0x3F,
+	0x00, 0x00, 0xF8, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x01,
+	// U+0411
+	0x00, 0x0A, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x18, 0x82, 0x01, 0x18, 0x82, 0x01, 0x18,
+	0x82, 0x01, 0x18, 0x82, 0x01, 0x18, 0x86, 0x01, 0x18, 0xC6, 0x01, 0x18, 0xFC, 0x00, 0x00, 0x78,
+	0x00,
+	// U+0412
+	0x00, 0x0A, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x18, 0x82, 0x01, 0x18, 0x82, 0x01, 0x18,
+	0x82, 0x01, 0x18, 0x82, 0x01, 0x18, 0x87, 0x01, 0xF0, 0xC7, 0x01, 0xF0, 0xFD, 0x00, 0x00, 0x78,
+	0x00,
+	// U+0413
+	0x00, 0x09, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
+	0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00,
+	// U+0414
+	0x00, 0x0D, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x80, 0x0F, 0x00, 0xE0, 0x01, 0xF8, 0xFF, 0x01, 0xF8,
+	0x9F, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80,
+	0x01, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0x80, 0x0F,
+	// U+0415
+	0x00, 0x09, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x18, 0x82, 0x01, 0x18, 0x82, 0x01, 0x18,
+	0x82, 0x01, 0x18, 0x82, 0x01, 0x18, 0x82, 0x01, 0x18, 0x82, 0x01, 0x18, 0x82, 0x01,
+	// U+0416
+	0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x08, 0x80, 0x01, 0x18, 0xE0, 0x00, 0x30, 0x70, 0x00, 0xE0,
+	0x1C, 0x00, 0xC0, 0x0F, 0x00, 0x80, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0xF8, 0xFF,
+	0x01, 0xF8, 0xFF, 0x01, 0x00, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x80, 0x03, 0x00, 0xC0, 0x0F, 0x00,
+	0x60, 0x1C, 0x00, 0x30, 0x70, 0x00, 0x18, 0xE0, 0x00, 0x08, 0x80, 0x01, 0x00, 0x00, 0x01,
+	// U+0417
+	0x00, 0x0A, 0x00, 0x18, 0x80, 0x01, 0x18, 0x80, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08,
+	0x02, 0x01, 0x08, 0x02, 0x01, 0x18, 0x87, 0x01, 0xB8, 0xCF, 0x01, 0xF0, 0xFD, 0x00, 0x00, 0x38,
+	0x00,
+	// U+0418
+	0x00, 0x0B, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0xE0, 0x01, 0x00, 0x70, 0x00, 0x00,
+	0x1C, 0x00, 0x00, 0x07, 0x00, 0xC0, 0x03, 0x00, 0xF0, 0x00, 0x00, 0x38, 0x00, 0x00, 0xF8, 0xFF,
+	0x01, 0xF8, 0xFF, 0x01,
+	// U+0419
+	0x00, 0x0B, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0xE0, 0x01, 0x01, 0x70, 0x00, 0x01,
+	0x1C, 0x00, 0x01, 0x07, 0x00, 0xC1, 0x03, 0x00, 0xF1, 0x00, 0x00, 0x38, 0x00, 0x00, 0xF8, 0xFF,
+	0x01, 0xF8, 0xFF, 0x01,
+	// U+041A
+	0x00, 0x0B, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x80,
+	0x03, 0x00, 0xC0, 0x07, 0x00, 0xE0, 0x1C, 0x00, 0x70, 0x38, 0x00, 0x38, 0xE0, 0x00, 0x18, 0xC0,
+	0x01, 0x08, 0x00, 0x01,
+	// U+041B
+	0x00, 0x0C, 0x00, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0xC0, 0x00, 0xF8, 0x7F, 0x00, 0xF8,
+	0x3F, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
+	0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,
+	// U+041C
+	0x00, 0x0D, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x38, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x80,
+	0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x30, 0x00, 0x00, 0x3C, 0x00, 0x80, 0x07, 0x00, 0xF0, 0x01,
+	0x00, 0x38, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,
+	// U+041D
+	0x00, 0x0B, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0xF8, 0xFF,
+	0x01, 0xF8, 0xFF, 0x01,
+	// U+041E
+	0x00, 0x0D, 0x00, 0x80, 0x1F, 0x00, 0xE0, 0x7F, 0x00, 0x70, 0xE0, 0x00, 0x38, 0xC0, 0x01, 0x18,
+	0x80, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x18, 0x80, 0x01, 0x38, 0xC0,
+	0x01, 0x70, 0xE0, 0x00, 0xE0, 0x7F, 0x00, 0x80, 0x1F, 0x00,
+	// U+041F
+	0x00, 0x0B, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
+	0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0xF8, 0xFF,
+	0x01, 0xF8, 0xFF, 0x01,
+	// U+0420
+	0x00, 0x09, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x18, 0x04, 0x00, 0x18, 0x04, 0x00, 0x18,
+	0x04, 0x00, 0x18, 0x04, 0x00, 0x18, 0x06, 0x00, 0xF0, 0x07, 0x00, 0xE0, 0x01, 0x00,
+	// U+0421
+	0x00, 0x0B, 0x00, 0x80, 0x1F, 0x00, 0xE0, 0x7F, 0x00, 0x70, 0xE0, 0x00, 0x38, 0xC0, 0x01, 0x18,
+	0x80, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x18, 0x00, 0x01, 0x18, 0x80,
+	0x01, 0x10, 0x80, 0x00,
+	// U+0422
+	0x00, 0x0C, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
+	0x00, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
+	0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
+	// U+0423
+	0x00, 0x0B, 0x00, 0x08, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x81, 0x01, 0xC0, 0x87, 0x01, 0x00,
+	0xFE, 0x01, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x80, 0x07, 0x00, 0xF0, 0x01, 0x00, 0x78, 0x00,
+	0x00, 0x08, 0x00, 0x00,
+	// U+0424
+	0x00, 0x0E, 0x00, 0x80, 0x0F, 0x00, 0xC0, 0x3F, 0x00, 0xE0, 0x30, 0x00, 0x60, 0x60, 0x00, 0x20,
+	0x60, 0x00, 0x30, 0x40, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x30, 0x40, 0x00, 0x30, 0x40,
+	0x00, 0x60, 0x60, 0x00, 0x60, 0x30, 0x00, 0xC0, 0x3F, 0x00, 0x80, 0x1F, 0x00,
+	// U+0425
+	0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x08, 0x80, 0x01, 0x38, 0xE0, 0x00, 0x70, 0x70, 0x00, 0xC0,
+	0x1D, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0xC0, 0x1D, 0x00, 0xE0, 0x70, 0x00, 0x38, 0xE0,
+	0x00, 0x18, 0x80, 0x01, 0x00, 0x00, 0x01,
+	// U+0426
+	0x00, 0x0C, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00,
+	0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0xF8, 0xFF,
+	0x01, 0xF8, 0xFF, 0x01, 0x00, 0x80, 0x0F,
+	// U+0427
+	0x00, 0x0A, 0x00, 0xF8, 0x01, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF,
+	0x01,
+	// U+0428
+	0x00, 0x11, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00,
+	0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0x80,
+	0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01,
+	0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,
+	// U+0429
+	0x00, 0x12, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00,
+	0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0x80,
+	0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01,
+	0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0x80, 0x0F,
+	// U+042A
+	0x00, 0x0E, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0xF8,
+	0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0x82, 0x01, 0x00, 0x82, 0x01, 0x00, 0x82, 0x01, 0x00, 0x82,
+	0x01, 0x00, 0x86, 0x01, 0x00, 0x86, 0x01, 0x00, 0xFC, 0x00, 0x00, 0x78, 0x00,
+	// U+042B
+	0x00, 0x0D, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0x82, 0x01, 0x00, 0x82, 0x01, 0x00,
+	0x82, 0x01, 0x00, 0x82, 0x01, 0x00, 0x86, 0x01, 0x00, 0xC6, 0x01, 0x00, 0xFC, 0x00, 0x00, 0x78,
+	0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01,
+	// U+042C
+	0x00, 0x0A, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0x82, 0x01, 0x00, 0x82, 0x01, 0x00,
+	0x82, 0x01, 0x00, 0x82, 0x01, 0x00, 0x86, 0x01, 0x00, 0xC6, 0x01, 0x00, 0xFC, 0x00, 0x00, 0x78,
+	0x00,
+	// U+042D
+	0x00, 0x0B, 0x00, 0x30, 0xC0, 0x00, 0x18, 0x80, 0x01, 0x18, 0x86, 0x01, 0x08, 0x06, 0x01, 0x08,
+	0x06, 0x01, 0x08, 0x06, 0x01, 0x18, 0x86, 0x01, 0x18, 0x86, 0x01, 0x30, 0xC6, 0x00, 0xE0, 0x7F,
+	0x00, 0xC0, 0x3F, 0x00,
+	// U+042E
+	0x00, 0x12, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF, 0x01, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00,
+	0x06, 0x00, 0xC0, 0x3F, 0x00, 0xE0, 0x7F, 0x00, 0x30, 0xC0, 0x00, 0x18, 0x80, 0x01, 0x18, 0x80,
+	0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x18, 0x80, 0x01, 0x30, 0xC0, 0x00,
+	0xF0, 0xF0, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x0F, 0x00,
+	// U+042F
+	0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x83, 0x01, 0xF0, 0xE3, 0x00, 0x18, 0x7E, 0x00, 0x18,
+	0x1E, 0x00, 0x18, 0x0E, 0x00, 0x18, 0x06, 0x00, 0x18, 0x06, 0x00, 0xF8, 0xFF, 0x01, 0xF8, 0xFF,
+	0x01,
+	// U+0430
+	0x00, 0x09, 0x00, 0x00, 0xF0, 0x00, 0x80, 0xF8, 0x01, 0xC0, 0x88, 0x01, 0xC0, 0x0C, 0x01, 0xC0,
+	0x0C, 0x01, 0xC0, 0x8C, 0x01, 0x80, 0xCD, 0x00, 0x80, 0xFF, 0x01, 0x00, 0xFE, 0x01,
+	// U+0431
+	0x00, 0x0A, 0x00, 0xC0, 0x3F, 0x00, 0xF0, 0xFF, 0x00, 0x98, 0xC1, 0x01, 0xD8, 0x80, 0x01, 0xCC,
+	0x00, 0x01, 0xCC, 0x00, 0x01, 0xCC, 0x80, 0x01, 0x8C, 0xC3, 0x01, 0x0C, 0xFF, 0x00, 0x00, 0x3C,
+	0x00,
+	// U+0432
+	0x00, 0x08, 0x00, 0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x01, 0xC0, 0x08, 0x01, 0xC0, 0x08, 0x01, 0x80,
+	0x08, 0x01, 0x80, 0x8C, 0x01, 0x80, 0xDF, 0x01, 0x00, 0xF3, 0x00,
+	// U+0433
+	0x00, 0x07, 0x00, 0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x01, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,
+	// U+0434
+	0x00, 0x0B, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x01, 0x00, 0xF0, 0x01, 0xC0, 0xFF, 0x01, 0xC0,
+	0x03, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0xFF, 0x01, 0x80, 0xFF,
+	0x01, 0x00, 0x00, 0x0F,
+	// U+0435
+	0x00, 0x0A, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xFF, 0x00, 0x80, 0xC9, 0x01, 0xC0, 0x88, 0x01, 0xC0,
+	0x08, 0x01, 0xC0, 0x08, 0x01, 0xC0, 0x08, 0x01, 0x80, 0x09, 0x01, 0x00, 0x8F, 0x01, 0x00, 0x0C,
+	0x00,
+	// U+0436
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x80, 0x01, 0x80, 0xE1, 0x00, 0x00, 0x73, 0x00, 0x00,
+	0x1E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x80, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x00, 0x18,
+	0x00, 0x00, 0x0C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x73, 0x00, 0x80, 0xE1, 0x00, 0xC0, 0x80, 0x01,
+	0x00, 0x00, 0x01,
+	// U+0437
+	0x00, 0x08, 0x00, 0x80, 0x80, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x08, 0x01, 0xC0, 0x08, 0x01, 0xC0,
+	0x08, 0x01, 0x80, 0x9C, 0x01, 0x80, 0xF7, 0x00, 0x00, 0x60, 0x00,
+	// U+0438
+	0x00, 0x09, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x00, 0xC0, 0x01, 0x00, 0x70, 0x00, 0x00,
+	0x1C, 0x00, 0x00, 0x0E, 0x00, 0x80, 0x03, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01,
+	// U+0439
+	0x00, 0x09, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x08, 0xC0, 0x01, 0x10, 0x70, 0x00, 0x10,
+	0x1C, 0x00, 0x10, 0x0E, 0x00, 0x88, 0x03, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01,
+	// U+043A
+	0x00, 0x09, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00,
+	0x1E, 0x00, 0x00, 0x33, 0x00, 0x80, 0xE1, 0x00, 0xC0, 0x80, 0x01, 0x00, 0x00, 0x01,
+	// U+043B
+	0x00, 0x0A, 0x00, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0xE0, 0x00, 0xC0, 0x7F, 0x00, 0xC0,
+	0x07, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF,
+	0x01,
+	// U+043C
+	0x00, 0x0B, 0x00, 0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x01, 0x80, 0x03, 0x00, 0x00, 0x0E, 0x00, 0x00,
+	0x78, 0x00, 0x00, 0x60, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0E, 0x00, 0x80, 0x03, 0x00, 0xC0, 0xFF,
+	0x01, 0x80, 0xFF, 0x01,
+	// U+043D
+	0x00, 0x09, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00,
+	0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x80, 0xFF, 0x01, 0xC0, 0xFF, 0x01,
+	// U+043E
+	0x00, 0x0A, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x80, 0x81, 0x01, 0xC0, 0x80, 0x01, 0xC0,
+	0x00, 0x01, 0xC0, 0x00, 0x01, 0x80, 0x80, 0x01, 0x80, 0xC3, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x1C,
+	0x00,
+	// U+043F
+	0x00, 0x09, 0x00, 0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x01, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x01,
+	// U+0440
+	0x00, 0x09, 0x00, 0xC0, 0xFF, 0x1F, 0x80, 0xFF, 0x1F, 0x80, 0x81, 0x00, 0x80, 0x00, 0x01, 0xC0,
+	0x00, 0x01, 0xC0, 0x00, 0x01, 0x80, 0x80, 0x01, 0x80, 0xE7, 0x00, 0x00, 0x7F, 0x00,
+	// U+0441
+	0x00, 0x08, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xFF, 0x00, 0x80, 0xC1, 0x01, 0xC0, 0x80, 0x01, 0xC0,
+	0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0x80, 0x80, 0x01,
+	// U+0442
+	0x00, 0x0A, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0,
+	0xFF, 0x01, 0xC0, 0xFF, 0x01, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00,
+	0x00,
+	// U+0443
+	0x00, 0x0A, 0x00, 0x80, 0x00, 0x00, 0x80, 0x03, 0x10, 0x00, 0x1F, 0x18, 0x00, 0x78, 0x18, 0x00,
+	0xE0, 0x0F, 0x00, 0xC0, 0x03, 0x00, 0xF8, 0x00, 0x00, 0x1E, 0x00, 0x80, 0x07, 0x00, 0xC0, 0x00,
+	0x00,
+	// U+0444
+	0x00, 0x0E, 0x00, 0x00, 0x7E, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x81, 0x01, 0xC0, 0x00, 0x01, 0xC0,
+	0x00, 0x01, 0x80, 0x80, 0x01, 0xF8, 0xFF, 0x1F, 0xF8, 0xFF, 0x1F, 0x80, 0x81, 0x00, 0xC0, 0x00,
+	0x01, 0xC0, 0x00, 0x01, 0xC0, 0x80, 0x01, 0x80, 0xE7, 0x01, 0x00, 0x7F, 0x00,
+	// U+0445
+	0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x80, 0x01, 0x80, 0xC1, 0x00, 0x00, 0x77, 0x00, 0x00,
+	0x3E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x77, 0x00, 0x80, 0xE3, 0x00, 0xC0, 0x80, 0x01, 0x00, 0x00,
+	0x01,
+	// U+0446
+	0x00, 0x0A, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x80, 0xFF, 0x01, 0xC0, 0xFF, 0x01, 0x00, 0x00,
+	0x0F,
+	// U+0447
+	0x00, 0x08, 0x00, 0xC0, 0x07, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x18, 0x00, 0x80, 0xFF, 0x01, 0xC0, 0xFF, 0x01,
+	// U+0448
+	0x00, 0x0E, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x80, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x80, 0xFF, 0x01, 0xC0, 0xFF, 0x01,
+	// U+0449
+	0x00, 0x0F, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x80, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x80, 0xFF, 0x01, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0x0F,
+	// U+044A
+	0x00, 0x0C, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0xC0,
+	0xFF, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x98,
+	0x01, 0x00, 0xF8, 0x00, 0x00, 0x70, 0x00,
+	// U+044B
+	0x00, 0x0C, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00,
+	0x08, 0x01, 0x00, 0x88, 0x01, 0x00, 0xD8, 0x01, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01,
+	// U+044C
+	0x00, 0x08, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00,
+	0x08, 0x01, 0x00, 0x88, 0x01, 0x00, 0xD8, 0x01, 0x00, 0xF0, 0x00,
+	// U+044D
+	0x00, 0x08, 0x00, 0x80, 0x80, 0x01, 0xC0, 0x08, 0x01, 0xC0, 0x08, 0x01, 0xC0, 0x08, 0x01, 0xC0,
+	0x88, 0x01, 0x80, 0x89, 0x01, 0x80, 0xFF, 0x00, 0x00, 0x7E, 0x00,
+	// U+044E
+	0x00, 0x0D, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00,
+	0x7F, 0x00, 0x80, 0xF7, 0x00, 0x80, 0x81, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00,
+	0x01, 0x80, 0x81, 0x01, 0x80, 0xFF, 0x00, 0x00, 0x7F, 0x00,
+	// U+044F
+	0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x80, 0x8F, 0x01, 0x80, 0xED, 0x00, 0x80, 0x78, 0x00, 0xC0,
+	0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0x18, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01,
+	// U+0450
+	0x00, 0x0A, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xFF, 0x00, 0x84, 0xC9, 0x01, 0xCC, 0x88, 0x01, 0xD8,
+	0x08, 0x01, 0xC0, 0x08, 0x01, 0xC0, 0x08, 0x01, 0x80, 0x09, 0x01, 0x00, 0x8F, 0x01, 0x00, 0x0C,
+	0x00,
+	// U+0451
+	0x00, 0x0A, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xFF, 0x00, 0x88, 0xC9, 0x01, 0xCC, 0x88, 0x01, 0xC0,
+	0x08, 0x01, 0xC0, 0x08, 0x01, 0xCC, 0x08, 0x01, 0x8C, 0x09, 0x01, 0x00, 0x8F, 0x01, 0x00, 0x0C,
+	0x00,
+	// U+0452
+	0x00, 0x0B, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0xC0, 0x38, 0x00, 0xC0,
+	0x0C, 0x00, 0xC0, 0x04, 0x10, 0xC0, 0x04, 0x18, 0xC0, 0x04, 0x0C, 0x00, 0x1C, 0x07, 0x00, 0xF8,
+	0x03, 0x00, 0x40, 0x00,
+	// U+0453
+	0x00, 0x07, 0x00, 0xC0, 0xFF, 0x01, 0xC0, 0xFF, 0x01, 0xC0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD8,
+	0x00, 0x00, 0xCC, 0x00, 0x00, 0xC4, 0x00, 0x00,
+	// U+0454
+	0x00, 0x08, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xFF, 0x00, 0x80, 0xC9, 0x01, 0xC0, 0x88, 0x01, 0xC0,
+	0x08, 0x01, 0xC0, 0x08, 0x01, 0xC0, 0x08, 0x01, 0x80, 0x80, 0x01,
+	// U+0455
+	0x00, 0x08, 0x00, 0x00, 0x87, 0x01, 0x80, 0x8F, 0x01, 0xC0, 0x0C, 0x01, 0xC0, 0x08, 0x01, 0xC0,
+	0x18, 0x01, 0xC0, 0x98, 0x01, 0x80, 0xF0, 0x01, 0x00, 0xF0, 0x00,
+	// U+0456
+	0x00, 0x02, 0x00, 0xDC, 0xFF, 0x01, 0x88, 0xFF, 0x01,
+	// U+0457
+	0x00, 0x06, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x0C,
+	0x00, 0x00, 0x08, 0x00, 0x00,
+	// U+0458
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x18, 0x98, 0xFF, 0x1F, 0x98, 0xFF, 0x07,
+	// U+0459
+	0x00, 0x0F, 0x00, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0xE0, 0x00, 0xC0, 0x7F, 0x00, 0xC0,
+	0x07, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF,
+	0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x88, 0x01, 0x00, 0x98, 0x01, 0x00, 0xF0, 0x00,
+	// U+045A
+	0x00, 0x0E, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00,
+	0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x00, 0x08,
+	0x01, 0x00, 0x08, 0x01, 0x00, 0x88, 0x01, 0x00, 0xF8, 0x01, 0x00, 0xF0, 0x00,
+	// U+045B
+	0x00, 0x0A, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0xC0, 0x38, 0x00, 0xC0,
+	0x0C, 0x00, 0xC0, 0x04, 0x00, 0xC0, 0x04, 0x00, 0xC0, 0x04, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xF8,
+	0x01,
+	// U+045C
+	0x00, 0x09, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x00, 0x18, 0x00, 0x10, 0x0C, 0x00, 0x18,
+	0x1E, 0x00, 0x0C, 0x33, 0x00, 0x80, 0xE1, 0x00, 0xC0, 0x80, 0x01, 0x00, 0x00, 0x01,
+	// U+045D
+	0x00, 0x09, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x0C, 0xC0, 0x01, 0x18, 0x70, 0x00, 0x10,
+	0x1C, 0x00, 0x00, 0x0E, 0x00, 0x80, 0x03, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01,
+	// U+045E
+	0x00, 0x0A, 0x00, 0x80, 0x00, 0x00, 0x80, 0x03, 0x10, 0x08, 0x1F, 0x18, 0x18, 0x78, 0x18, 0x10,
+	0xE0, 0x0F, 0x10, 0xC0, 0x03, 0x18, 0xF8, 0x00, 0x0C, 0x1E, 0x00, 0x80, 0x07, 0x00, 0xC0, 0x00,
+	0x00,
+	// U+045F
+	0x00, 0x09, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x0F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x80, 0xFF, 0x01, 0xC0, 0xFF, 0x01,
+};
+
+// End
@@ -0,0 +1,2387 @@
+/*
+ * glcd28x32c.cpp
+ *
+ * Generated by Tools/MakeFont.py from glcd28x32.cpp - do not edit
+ * Command: MakeFont.py --ttf DejaVuSans.ttf --ranges 0x384-0x3CE,0x400-0x45F glcd28x32.cpp glcd28x32c.cpp
+ * TrueType font: DejaVu Sans, Version 2.37, SHA-256 abdc775b21b1bc470d50c97e790d276f2054b7504e56e5bd3e64f48d68582322
+ */
+
+#include <asf.h>
+
+extern const uint8_t glcd28x32c[] =
+{
+	0x00,	// compact font format
+	32,		// row height in pixels
+	3,		// space columns between characters before kerning
+	0x06, 0x00,	// number of character ranges
+	28,		// maximum character width in pixels
+	0x03,	// flags
+	0x00,	// reserved
+
+	// Character ranges: first code, last code, first glyph number
+	0x20, 0x00, 0xFF, 0x00, 0x00, 0x00,	// ' '-0xFF
+	0x84, 0x03, 0x8A, 0x03, 0xE0, 0x00,	// U+0384-U+038A
+	0x8C, 0x03, 0x8C, 0x03, 0xE7, 0x00,	// U+038C-U+038C
+	0x8E, 0x03, 0xA1, 0x03, 0xE8, 0x00,	// U+038E-U+03A1
+	0xA3, 0x03, 0xCE, 0x03, 0xFC, 0x00,	// U+03A3-U+03CE
+	0x00, 0x04, 0x5F, 0x04, 0x28, 0x01,	// U+0400-U+045F
+
+	// Glyph offsets
+	0x00, 0x00, 0x03, 0x00, 0x12, 0x00, 0x35, 0x00, 0x78, 0x00, 0xBB, 0x00, 0x1E, 0x01, 0x69, 0x01,
+	0x74, 0x01, 0x93, 0x01, 0xB2, 0x01, 0xE1, 0x01, 0x20, 0x02, 0x2B, 0x02, 0x4E, 0x02, 0x59, 0x02,
+	0x7C, 0x02, 0xB7, 0x02, 0xEE, 0x02, 0x29, 0x03, 0x64, 0x03, 0x9F, 0x03, 0xDA, 0x03, 0x11, 0x04,
+	0x4C, 0x04, 0x87, 0x04, 0xC2, 0x04, 0xCD, 0x04, 0xD8, 0x04, 0x17, 0x05, 0x56, 0x05, 0x95, 0x05,
+	0xD0, 0x05, 0x37, 0x06, 0x86, 0x06, 0xC5, 0x06, 0x14, 0x07, 0x5F, 0x07, 0xA2, 0x07, 0xE1, 0x07,
+	0x34, 0x08, 0x7B, 0x08, 0x8A, 0x08, 0xC1, 0x08, 0x04, 0x09, 0x3B, 0x09, 0x8A, 0x09, 0xD1, 0x09,
+	0x28, 0x0A, 0x67, 0x0A, 0xBE, 0x0A, 0x05, 0x0B, 0x4C, 0x0B, 0x93, 0x0B, 0xDA, 0x0B, 0x29, 0x0C,
+	0x9C, 0x0C, 0xE3, 0x0C, 0x2A, 0x0D, 0x6D, 0x0D, 0x88, 0x0D, 0xAB, 0x0D, 0xC6, 0x0D, 0x01, 0x0E,
+	0x44, 0x0E, 0x5F, 0x0E, 0x9E, 0x0E, 0xD5, 0x0E, 0x0C, 0x0F, 0x43, 0x0F, 0x7E, 0x0F, 0xA1, 0x0F,
+	0xD8, 0x0F, 0x0B, 0x10, 0x1A, 0x10, 0x31, 0x10, 0x64, 0x10, 0x73, 0x10, 0xCA, 0x10, 0xFD, 0x10,
+	0x38, 0x11, 0x6F, 0x11, 0xA6, 0x11, 0xC9, 0x11, 0x00, 0x12, 0x23, 0x12, 0x56, 0x12, 0x8D, 0x12,
+	0xE4, 0x12, 0x13, 0x13, 0x4A, 0x13, 0x7D, 0x13, 0xA4, 0x13, 0xAF, 0x13, 0xD6, 0x13, 0x15, 0x14,
+	0x2C, 0x14, 0x2F, 0x14, 0x32, 0x14, 0x35, 0x14, 0x38, 0x14, 0x3B, 0x14, 0x3E, 0x14, 0x41, 0x14,
+	0x44, 0x14, 0x47, 0x14, 0x4A, 0x14, 0x4D, 0x14, 0x50, 0x14, 0x53, 0x14, 0x56, 0x14, 0x59, 0x14,
+	0x5C, 0x14, 0x5F, 0x14, 0x62, 0x14, 0x65, 0x14, 0x68, 0x14, 0x6B, 0x14, 0x6E, 0x14, 0x71, 0x14,
+	0x74, 0x14, 0x77, 0x14, 0x7A, 0x14, 0x7D, 0x14, 0x80, 0x14, 0x83, 0x14, 0x86, 0x14, 0x89, 0x14,
+	0x8C, 0x14, 0x8F, 0x14, 0x9E, 0x14, 0xD1, 0x14, 0x0C, 0x15, 0x3F, 0x15, 0x82, 0x15, 0x8D, 0x15,
+	0xC0, 0x15, 0xE3, 0x15, 0x3A, 0x16, 0x69, 0x16, 0xA4, 0x16, 0xE3, 0x16, 0x06, 0x17, 0x5D, 0x17,
+	0xA0, 0x17, 0xC3, 0x17, 0xFE, 0x17, 0x21, 0x18, 0x44, 0x18, 0x5F, 0x18, 0x9A, 0x18, 0xD5, 0x18,
+	0xE0, 0x18, 0xF7, 0x18, 0x1A, 0x19, 0x49, 0x19, 0x84, 0x19, 0xDF, 0x19, 0x3A, 0x1A, 0x91, 0x1A,
+	0xCC, 0x1A, 0x1B, 0x1B, 0x6A, 0x1B, 0xB9, 0x1B, 0x08, 0x1C, 0x57, 0x1C, 0xA6, 0x1C, 0x15, 0x1D,
+	0x64, 0x1D, 0xA7, 0x1D, 0xEA, 0x1D, 0x2D, 0x1E, 0x70, 0x1E, 0x8B, 0x1E, 0xA6, 0x1E, 0xC9, 0x1E,
+	0xE8, 0x1E, 0x3B, 0x1F, 0x82, 0x1F, 0xD9, 0x1F, 0x30, 0x20, 0x87, 0x20, 0xDE, 0x20, 0x35, 0x21,
+	0x6C, 0x21, 0xC3, 0x21, 0x0A, 0x22, 0x51, 0x22, 0x98, 0x22, 0xDF, 0x22, 0x26, 0x23, 0x65, 0x23,
+	0xA4, 0x23, 0xE3, 0x23, 0x22, 0x24, 0x61, 0x24, 0xA0, 0x24, 0xDF, 0x24, 0x1E, 0x25, 0x81, 0x25,
+	0xB8, 0x25, 0xF3, 0x25, 0x2E, 0x26, 0x69, 0x26, 0xA4, 0x26, 0xBF, 0x26, 0xDA, 0x26, 0x05, 0x27,
+	0x28, 0x27, 0x63, 0x27, 0x96, 0x27, 0xD1, 0x27, 0x0C, 0x28, 0x47, 0x28, 0x82, 0x28, 0xBD, 0x28,
+	0xF8, 0x28, 0x3B, 0x29, 0x6E, 0x29, 0xA1, 0x29, 0xD4, 0x29, 0x07, 0x2A, 0x3E, 0x2A, 0x75, 0x2A,
+	0xAC, 0x2A, 0xC7, 0x2A, 0xEA, 0x2A, 0x35, 0x2B, 0x44, 0x2B, 0x93, 0x2B, 0xEA, 0x2B, 0x11, 0x2C,
+	0x68, 0x2C, 0xC7, 0x2C, 0x1E, 0x2D, 0x41, 0x2D, 0x8C, 0x2D, 0xC7, 0x2D, 0xFA, 0x2D, 0x45, 0x2E,
+	0x7C, 0x2E, 0xBF, 0x2E, 0xFE, 0x2E, 0x49, 0x2F, 0x58, 0x2F, 0x97, 0x2F, 0xE2, 0x2F, 0x2D, 0x30,
+	0x6C, 0x30, 0x9F, 0x30, 0xEA, 0x30, 0x29, 0x31, 0x60, 0x31, 0x97, 0x31, 0xDE, 0x31, 0x25, 0x32,
+	0x70, 0x32, 0xB7, 0x32, 0x06, 0x33, 0x55, 0x33, 0x78, 0x33, 0xBF, 0x33, 0xFE, 0x33, 0x2D, 0x34,
+	0x64, 0x34, 0x7F, 0x34, 0xB2, 0x34, 0xF1, 0x34, 0x28, 0x35, 0x67, 0x35, 0xA2, 0x35, 0xD1, 0x35,
+	0x04, 0x36, 0x3B, 0x36, 0x76, 0x36, 0x91, 0x36, 0xC8, 0x36, 0x03, 0x37, 0x3E, 0x37, 0x75, 0x37,
+	0xA8, 0x37, 0xE3, 0x37, 0x22, 0x38, 0x59, 0x38, 0x8C, 0x38, 0xCB, 0x38, 0x06, 0x39, 0x39, 0x39,
+	0x78, 0x39, 0xB3, 0x39, 0xF2, 0x39, 0x41, 0x3A, 0x64, 0x3A, 0x97, 0x3A, 0xD2, 0x3A, 0x05, 0x3B,
+	0x54, 0x3B, 0x8B, 0x3B, 0xC2, 0x3B, 0x15, 0x3C, 0x48, 0x3C, 0x8B, 0x3C, 0xC6, 0x3C, 0xD5, 0x3C,
+	0xF8, 0x3C, 0x17, 0x3D, 0x86, 0x3D, 0xE9, 0x3D, 0x3C, 0x3E, 0x7F, 0x3E, 0xBE, 0x3E, 0x01, 0x3F,
+	0x40, 0x3F, 0x8B, 0x3F, 0xC6, 0x3F, 0x01, 0x40, 0x34, 0x40, 0x83, 0x40, 0xBA, 0x40, 0x2D, 0x41,
+	0x68, 0x41, 0xA7, 0x41, 0xE6, 0x41, 0x29, 0x42, 0x70, 0x42, 0xBB, 0x42, 0xFA, 0x42, 0x45, 0x43,
+	0x84, 0x43, 0xBB, 0x43, 0xFE, 0x43, 0x45, 0x44, 0x88, 0x44, 0xDB, 0x44, 0x22, 0x45, 0x6D, 0x45,
+	0xA8, 0x45, 0x0B, 0x46, 0x76, 0x46, 0xC9, 0x46, 0x18, 0x47, 0x53, 0x47, 0x96, 0x47, 0xFD, 0x47,
+	0x3C, 0x48, 0x73, 0x48, 0xAE, 0x48, 0xE1, 0x48, 0x10, 0x49, 0x53, 0x49, 0x8E, 0x49, 0xED, 0x49,
+	0x1C, 0x4A, 0x53, 0x4A, 0x8A, 0x4A, 0xC1, 0x4A, 0xFC, 0x4A, 0x3F, 0x4B, 0x76, 0x4B, 0xB1, 0x4B,
+	0xE8, 0x4B, 0x1F, 0x4C, 0x52, 0x4C, 0x8D, 0x4C, 0xC8, 0x4C, 0x1B, 0x4D, 0x56, 0x4D, 0x95, 0x4D,
+	0xC8, 0x4D, 0x1B, 0x4E, 0x76, 0x4E, 0xBD, 0x4E, 0x04, 0x4F, 0x37, 0x4F, 0x6A, 0x4F, 0xB9, 0x4F,
+	0xF0, 0x4F, 0x2B, 0x50, 0x66, 0x50, 0xA5, 0x50, 0xD4, 0x50, 0x07, 0x51, 0x36, 0x51, 0x41, 0x51,
+	0x64, 0x51, 0x7F, 0x51, 0xDA, 0x51, 0x31, 0x52, 0x70, 0x52, 0xA7, 0x52, 0xDE, 0x52, 0x19, 0x53,
+
+	// Glyph metrics: advance, kerning column, last ink column
+	0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// ' '
+	0x03, 0xC0, 0xFF, 0x8F, 0x03, 0xC0, 0x7F, 0x80, 0x03,	// '!'
+	0x08, 0xC0, 0x0F, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00,	// '"'
+	0x10, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,	// '#'
+	0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00,	// '$'
+	0x18, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,	// '%'
+	0x12, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x03,	// '&'
+	0x02, 0xC0, 0x0F, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00,	// '''
+	0x07, 0x00, 0xE0, 0xFF, 0x00, 0x60, 0x00, 0x00, 0xC0,	// '('
+	0x07, 0x60, 0x00, 0x00, 0xC0, 0x00, 0xE0, 0xFF, 0x00,	// ')'
+	0x0B, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,	// '*'
+	0x0F, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00,	// '+'
+	0x02, 0x00, 0x00, 0x80, 0x33, 0x00, 0x00, 0x80, 0x3F,	// ','
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00,	// '-'
+	0x02, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x03,	// '.'
+	0x08, 0x00, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x00,	// '/'
+	0x0E, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00,	// '0'
+	0x0D, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,	// '1'
+	0x0E, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,	// '2'
+	0x0E, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x38, 0x00,	// '3'
+	0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x18, 0x00,	// '4'
+	0x0E, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3E, 0x00,	// '5'
+	0x0D, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x1E, 0x00,	// '6'
+	0x0E, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,	// '7'
+	0x0E, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00,	// '8'
+	0x0E, 0x00, 0x38, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00,	// '9'
+	0x02, 0x00, 0x1C, 0x80, 0x03, 0x00, 0x1C, 0x80, 0x03,	// ':'
+	0x02, 0x00, 0x1C, 0x80, 0x33, 0x00, 0x1C, 0x80, 0x3F,	// ';'
+	0x0F, 0x00, 0x80, 0x03, 0x00, 0x00, 0x06, 0xC0, 0x00,	// '<'
+	0x0F, 0x00, 0x30, 0x18, 0x00, 0x00, 0x30, 0x18, 0x00,	// '='
+	0x0F, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x80, 0x03, 0x00,	// '>'
+	0x0E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00,	// '?'
+	0x19, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x80, 0x01, 0x00,	// '@'
+	0x13, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,	// 'A'
+	0x0F, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x7E, 0x00,	// 'B'
+	0x13, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00,	// 'C'
+	0x12, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0xC0, 0x03, 0x00,	// 'D'
+	0x10, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x03,	// 'E'
+	0x0F, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x00,	// 'F'
+	0x14, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x7F, 0x00,	// 'G'
+	0x11, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,	// 'H'
+	0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,	// 'I'
+	0x0D, 0x00, 0x00, 0x10, 0x00, 0xC0, 0xFF, 0x3F, 0x00,	// 'J'
+	0x10, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x02,	// 'K'
+	0x0D, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x03,	// 'L'
+	0x13, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,	// 'M'
+	0x11, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,	// 'N'
+	0x15, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x01, 0x00,	// 'O'
+	0x0F, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x7F, 0x00, 0x00,	// 'P'
+	0x15, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x01, 0x00,	// 'Q'
+	0x11, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x3C, 0x00, 0x03,	// 'R'
+	0x11, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x38, 0x00,	// 'S'
+	0x11, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,	// 'T'
+	0x11, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00,	// 'U'
+	0x13, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,	// 'V'
+	0x1C, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00,	// 'W'
+	0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,	// 'X'
+	0x11, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,	// 'Y'
+	0x10, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x03,	// 'Z'
+	0x06, 0xE0, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0xC0,	// '['
+	0x08, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,	// '\\'
+	0x06, 0x60, 0x00, 0x00, 0xC0, 0xE0, 0xFF, 0xFF, 0xFF,	// ']'
+	0x0E, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,	// '^'
+	0x10, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,	// '_'
+	0x06, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,	// '`'
+	0x0F, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x03,	// 'a'
+	0x0D, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x80, 0x1F, 0x00,	// 'b'
+	0x0D, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x60, 0x60, 0x00,	// 'c'
+	0x0D, 0x00, 0x80, 0x1F, 0x00, 0xE0, 0xFF, 0xFF, 0x03,	// 'd'
+	0x0E, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x07, 0x00,	// 'e'
+	0x08, 0x00, 0x0C, 0x00, 0x00, 0x60, 0x0C, 0x00, 0x00,	// 'f'
+	0x0D, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xFC, 0xFF, 0x1F,	// 'g'
+	0x0C, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0xF0, 0xFF, 0x03,	// 'h'
+	0x03, 0x60, 0xFC, 0xFF, 0x03, 0x60, 0xFC, 0xFF, 0x03,	// 'i'
+	0x05, 0x00, 0x00, 0x00, 0xC0, 0x60, 0xFC, 0xFF, 0x1F,	// 'j'
+	0x0C, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x02,	// 'k'
+	0x03, 0xE0, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x03,	// 'l'
+	0x15, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0xF0, 0xFF, 0x03,	// 'm'
+	0x0C, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0xF0, 0xFF, 0x03,	// 'n'
+	0x0E, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x80, 0x1F, 0x00,	// 'o'
+	0x0D, 0x00, 0xFC, 0xFF, 0xFF, 0x00, 0x80, 0x1F, 0x00,	// 'p'
+	0x0D, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xFC, 0xFF, 0xFF,	// 'q'
+	0x08, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0x0C, 0x00, 0x00,	// 'r'
+	0x0D, 0x00, 0x40, 0xC0, 0x00, 0x00, 0x20, 0x70, 0x00,	// 's'
+	0x08, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x03,	// 't'
+	0x0C, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0xFC, 0xFF, 0x03,	// 'u'
+	0x0D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,	// 'v'
+	0x15, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00,	// 'w'
+	0x0B, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x03,	// 'x'
+	0x0D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,	// 'y'
+	0x0C, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,	// 'z'
+	0x09, 0x00, 0x00, 0x06, 0x00, 0x60, 0x00, 0x00, 0xC0,	// '{'
+	0x02, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,	// '|'
+	0x09, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x06, 0x00,	// '}'
+	0x0F, 0x00, 0x80, 0x03, 0x00, 0x00, 0xC0, 0x01, 0x00,	// '~'
+	0x05, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01,	// DEL
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x80
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x81
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x82
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x83
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x84
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x85
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x86
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x87
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x88
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x89
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x8A
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x8B
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x8C
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x8D
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x8E
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x8F
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x90
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x91
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x92
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x93
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x94
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x95
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x96
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x97
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x98
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x99
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x9A
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x9B
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x9C
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x9D
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x9E
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0x9F
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// 0xA0
+	0x03, 0x00, 0x1C, 0xFE, 0x7F, 0x00, 0x1C, 0xFF, 0x7F,	// 0xA1
+	0x0C, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x18, 0x38, 0x00,	// 0xA2
+	0x0E, 0x00, 0x80, 0x01, 0x03, 0x00, 0x00, 0xE0, 0x00,	// 0xA3
+	0x0C, 0x00, 0xEC, 0x37, 0x00, 0x00, 0xEC, 0x37, 0x00,	// 0xA4
+	0x10, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,	// 0xA5
+	0x02, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF,	// 0xA6
+	0x0C, 0x00, 0x83, 0x03, 0x03, 0x80, 0xC1, 0xE7, 0x03,	// 0xA7
+	0x08, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,	// 0xA8
+	0x15, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00,	// 0xA9
+	0x0B, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,	// 0xAA
+	0x0E, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0x80, 0x00,	// 0xAB
+	0x0F, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x7F, 0x00,	// 0xAC
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00,	// 0xAD
+	0x15, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00,	// 0xAE
+	0x10, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,	// 0xAF
+	0x08, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,	// 0xB0
+	0x0E, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03,	// 0xB1
+	0x08, 0x00, 0x01, 0x03, 0x00, 0x80, 0x0F, 0x02, 0x00,	// 0xB2
+	0x08, 0x80, 0x81, 0x01, 0x00, 0x80, 0xF3, 0x01, 0x00,	// 0xB3
+	0x06, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,	// 0xB4
+	0x0E, 0x00, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03,	// 0xB5
+	0x0E, 0x00, 0x1E, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,	// 0xB6
+	0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00,	// 0xB7
+	0x05, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x70,	// 0xB8
+	0x08, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00,	// 0xB9
+	0x0B, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00,	// 0xBA
+	0x0E, 0x00, 0x20, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00,	// 0xBB
+	0x16, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00,	// 0xBC
+	0x16, 0x00, 0x03, 0x02, 0x00, 0x00, 0x80, 0x0F, 0x02,	// 0xBD
+	0x15, 0x80, 0x81, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00,	// 0xBE
+	0x0E, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x06,	// 0xBF
+	0x13, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,	// 0xC0
+	0x13, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,	// 0xC1
+	0x13, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,	// 0xC2
+	0x13, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,	// 0xC3
+	0x13, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,	// 0xC4
+	0x13, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,	// 0xC5
+	0x1B, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,	// 0xC6
+	0x13, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00,	// 0xC7
+	0x10, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x03,	// 0xC8
+	0x10, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x03,	// 0xC9
+	0x10, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x03,	// 0xCA
+	0x10, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x03,	// 0xCB
+	0x06, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,	// 0xCC
+	0x06, 0xC8, 0xFF, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x00,	// 0xCD
+	0x08, 0x0C, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,	// 0xCE
+	0x07, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,	// 0xCF
+	0x14, 0x00, 0x80, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00,	// 0xD0
+	0x11, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,	// 0xD1
+	0x15, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x01, 0x00,	// 0xD2
+	0x15, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x01, 0x00,	// 0xD3
+	0x15, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x01, 0x00,	// 0xD4
+	0x15, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x01, 0x00,	// 0xD5
+	0x15, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x01, 0x00,	// 0xD6
+	0x0D, 0x00, 0x08, 0x20, 0x00, 0x00, 0x08, 0x20, 0x00,	// 0xD7
+	0x15, 0x00, 0xC0, 0x03, 0x00, 0x20, 0xC0, 0x01, 0x00,	// 0xD8
+	0x11, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00,	// 0xD9
+	0x11, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00,	// 0xDA
+	0x11, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00,	// 0xDB
+	0x11, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00,	// 0xDC
+	0x11, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,	// 0xDD
+	0x0F, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0xF0, 0x07, 0x00,	// 0xDE
+	0x0F, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x70, 0x00,	// 0xDF
+	0x0F, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x03,	// 0xE0
+	0x0F, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x03,	// 0xE1
+	0x0F, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x03,	// 0xE2
+	0x0F, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x03,	// 0xE3
+	0x0F, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x03,	// 0xE4
+	0x0F, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x03,	// 0xE5
+	0x18, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0x00,	// 0xE6
+	0x0D, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x60, 0x60, 0x00,	// 0xE7
+	0x0E, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x07, 0x00,	// 0xE8
+	0x0E, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x07, 0x00,	// 0xE9
+	0x0E, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x07, 0x00,	// 0xEA
+	0x0E, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x07, 0x00,	// 0xEB
+	0x06, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,	// 0xEC
+	0x06, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,	// 0xED
+	0x0A, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,	// 0xEE
+	0x08, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,	// 0xEF
+	0x0E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x80, 0x3F, 0x00,	// 0xF0
+	0x0C, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0xF0, 0xFF, 0x03,	// 0xF1
+	0x0E, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x80, 0x1F, 0x00,	// 0xF2
+	0x0E, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x80, 0x1F, 0x00,	// 0xF3
+	0x0E, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x80, 0x1F, 0x00,	// 0xF4
+	0x0E, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x80, 0x1F, 0x00,	// 0xF5
+	0x0E, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x80, 0x1F, 0x00,	// 0xF6
+	0x0E, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00,	// 0xF7
+	0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00,	// 0xF8
+	0x0C, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0xFC, 0xFF, 0x03,	// 0xF9
+	0x0C, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0xFC, 0xFF, 0x03,	// 0xFA
+	0x0C, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0xFC, 0xFF, 0x03,	// 0xFB
+	0x0C, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0xFC, 0xFF, 0x03,	// 0xFC
+	0x0D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,	// 0xFD
+	0x0D, 0xE0, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0x1F, 0x00,	// 0xFE
+	0x0D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,	// 0xFF
+	0x06, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,	// U+0384
+	0x08, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,	// U+0385
+	0x12, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,	// U+0386
+	0x03, 0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00,	// U+0387
+	0x13, 0x00, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x03,	// U+0388
+	0x15, 0x00, 0x01, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03,	// U+0389
+	0x09, 0x00, 0x01, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03,	// U+038A
+	0x15, 0x00, 0x01, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00,	// U+038C
+	0x17, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,	// U+038E
+	0x15, 0x00, 0x01, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x03,	// U+038F
+	0x08, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x03,	// U+0390
+	0x12, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,	// U+0391
+	0x0E, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x7C, 0x00,	// U+0392
+	0x0C, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x00,	// U+0393
+	0x12, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,	// U+0394
+	0x0D, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x03,	// U+0395
+	0x10, 0xC0, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x00, 0x03,	// U+0396
+	0x0F, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,	// U+0397
+	0x12, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF8, 0x1F, 0x00,	// U+0398
+	0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,	// U+0399
+	0x0F, 0xC0, 0xFF, 0xFF, 0x03, 0x40, 0x00, 0x00, 0x02,	// U+039A
+	0x12, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,	// U+039B
+	0x12, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,	// U+039C
+	0x0F, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,	// U+039D
+	0x0C, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03,	// U+039E
+	0x12, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF8, 0x1F, 0x00,	// U+039F
+	0x0F, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,	// U+03A0
+	0x0D, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x3E, 0x00, 0x00,	// U+03A1
+	0x0D, 0xC0, 0x01, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x03,	// U+03A3
+	0x11, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,	// U+03A4
+	0x11, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,	// U+03A5
+	0x12, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00,	// U+03A6
+	0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,	// U+03A7
+	0x13, 0xC0, 0x7F, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00,	// U+03A8
+	0x13, 0x00, 0xE0, 0x03, 0x03, 0x00, 0xE0, 0x01, 0x03,	// U+03A9
+	0x08, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,	// U+03AA
+	0x11, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,	// U+03AB
+	0x0F, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x08, 0x00, 0x03,	// U+03AC
+	0x0B, 0x00, 0x40, 0xF0, 0x00, 0x00, 0x18, 0x00, 0x03,	// U+03AD
+	0x0D, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0xFF, 0x7F,	// U+03AE
+	0x06, 0x00, 0xF8, 0xFF, 0x00, 0x10, 0x00, 0x00, 0x03,	// U+03AF
+	0x0C, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0xE0, 0x3F, 0x00,	// U+03B0
+	0x0F, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x08, 0x00, 0x03,	// U+03B1
+	0x0D, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7C, 0x00,	// U+03B2
+	0x0F, 0x00, 0x18, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,	// U+03B3
+	0x0E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x00,	// U+03B4
+	0x0B, 0x00, 0x40, 0xF0, 0x00, 0x00, 0x18, 0x00, 0x03,	// U+03B5
+	0x0C, 0x00, 0x00, 0x3F, 0x00, 0xE0, 0x00, 0x00, 0x3C,	// U+03B6
+	0x0D, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0xFF, 0x7F,	// U+03B7
+	0x0E, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xF0, 0x07, 0x00,	// U+03B8
+	0x06, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03,	// U+03B9
+	0x0D, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x02,	// U+03BA
+	0x0E, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x03,	// U+03BB
+	0x0E, 0x00, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03,	// U+03BC
+	0x0D, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00,	// U+03BD
+	0x0C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x3C,	// U+03BE
+	0x0E, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x00,	// U+03BF
+	0x0F, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,	// U+03C0
+	0x0D, 0x00, 0x80, 0xFF, 0xFF, 0x00, 0xC0, 0x7F, 0x00,	// U+03C1
+	0x0C, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x38, 0x00, 0x18,	// U+03C2
+	0x0F, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x18, 0x00, 0x00,	// U+03C3
+	0x0E, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,	// U+03C4
+	0x0C, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0xE0, 0x3F, 0x00,	// U+03C5
+	0x0F, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x80, 0x3F, 0x00,	// U+03C6
+	0x0E, 0x00, 0x18, 0x00, 0x80, 0x00, 0x08, 0x00, 0xC0,	// U+03C7
+	0x0F, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0xF8, 0x7F, 0x00,	// U+03C8
+	0x13, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xC0, 0x7F, 0x00,	// U+03C9
+	0x08, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x03,	// U+03CA
+	0x0C, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0xE0, 0x3F, 0x00,	// U+03CB
+	0x0E, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x00,	// U+03CC
+	0x0C, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0xE0, 0x3F, 0x00,	// U+03CD
+	0x13, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xC0, 0x7F, 0x00,	// U+03CE
+	0x0D, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x03,	// U+0400
+	0x0D, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x03,	// U+0401
+	0x14, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03,	// U+0402
+	0x0C, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x00,	// U+0403
+	0x10, 0x00, 0xF0, 0x0F, 0x00, 0x80, 0x03, 0xC0, 0x01,	// U+0404
+	0x0E, 0x00, 0x3E, 0x80, 0x01, 0x00, 0x00, 0x7C, 0x00,	// U+0405
+	0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,	// U+0406
+	0x08, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,	// U+0407
+	0x07, 0x00, 0x00, 0x00, 0xE0, 0xC0, 0xFF, 0xFF, 0x0F,	// U+0408
+	0x1B, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x7C, 0x00,	// U+0409
+	0x18, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x7E, 0x00,	// U+040A
+	0x14, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03,	// U+040B
+	0x10, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x02,	// U+040C
+	0x0F, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,	// U+040D
+	0x10, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,	// U+040E
+	0x0F, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,	// U+040F
+	0x12, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,	// U+0410
+	0x0E, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x7E, 0x00,	// U+0411
+	0x0E, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x7C, 0x00,	// U+0412
+	0x0C, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x00,	// U+0413
+	0x13, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,	// U+0414
+	0x0D, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x03,	// U+0415
+	0x1C, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x03,	// U+0416
+	0x0E, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x7C, 0x00,	// U+0417
+	0x0F, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,	// U+0418
+	0x0F, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,	// U+0419
+	0x10, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x02,	// U+041A
+	0x11, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xFF, 0xFF, 0x03,	// U+041B
+	0x12, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,	// U+041C
+	0x0F, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,	// U+041D
+	0x12, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF8, 0x1F, 0x00,	// U+041E
+	0x0F, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,	// U+041F
+	0x0D, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x3E, 0x00, 0x00,	// U+0420
+	0x10, 0x00, 0xF0, 0x0F, 0x00, 0x80, 0x03, 0xC0, 0x01,	// U+0421
+	0x11, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,	// U+0422
+	0x10, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,	// U+0423
+	0x14, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00,	// U+0424
+	0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,	// U+0425
+	0x12, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x3F,	// U+0426
+	0x0E, 0xC0, 0x7F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03,	// U+0427
+	0x18, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,	// U+0428
+	0x1A, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x3F,	// U+0429
+	0x14, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,	// U+042A
+	0x13, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,	// U+042B
+	0x0E, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x7E, 0x00,	// U+042C
+	0x10, 0x80, 0x03, 0xC0, 0x01, 0x00, 0xF0, 0x0F, 0x00,	// U+042D
+	0x19, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0xF8, 0x1F, 0x00,	// U+042E
+	0x0F, 0x00, 0x00, 0x00, 0x02, 0xC0, 0xFF, 0xFF, 0x03,	// U+042F
+	0x0D, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x80, 0xFF, 0x03,	// U+0430
+	0x0E, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x80, 0x3F, 0x00,	// U+0431
+	0x0C, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0x00,	// U+0432
+	0x0B, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x18, 0x00, 0x00,	// U+0433
+	0x10, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,	// U+0434
+	0x0E, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x80, 0x07, 0x00,	// U+0435
+	0x17, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,	// U+0436
+	0x0B, 0x00, 0x00, 0x00, 0x03, 0x00, 0xE0, 0xF0, 0x00,	// U+0437
+	0x0D, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03,	// U+0438
+	0x0D, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03,	// U+0439
+	0x0D, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x02,	// U+043A
+	0x0E, 0x00, 0x00, 0x00, 0x03, 0x00, 0xF8, 0xFF, 0x03,	// U+043B
+	0x10, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03,	// U+043C
+	0x0D, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03,	// U+043D
+	0x0E, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x00,	// U+043E
+	0x0D, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03,	// U+043F
+	0x0D, 0x00, 0xF8, 0xFF, 0xFF, 0x00, 0xC0, 0x7F, 0x00,	// U+0440
+	0x0C, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x38, 0x80, 0x03,	// U+0441
+	0x0E, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,	// U+0442
+	0x0E, 0x00, 0x08, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,	// U+0443
+	0x14, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xC0, 0x7F, 0x00,	// U+0444
+	0x0E, 0x00, 0x00, 0x00, 0x02, 0x00, 0x08, 0x00, 0x02,	// U+0445
+	0x0F, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x3F,	// U+0446
+	0x0C, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xF8, 0xFF, 0x03,	// U+0447
+	0x14, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03,	// U+0448
+	0x16, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x3F,	// U+0449
+	0x11, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,	// U+044A
+	0x11, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03,	// U+044B
+	0x0C, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0xF8, 0x00,	// U+044C
+	0x0C, 0x00, 0x38, 0x80, 0x03, 0x00, 0x00, 0x1F, 0x00,	// U+044D
+	0x13, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x80, 0x3F, 0x00,	// U+044E
+	0x0D, 0x00, 0x00, 0x00, 0x02, 0x00, 0xF8, 0xFF, 0x03,	// U+044F
+	0x0E, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x80, 0x07, 0x00,	// U+0450
+	0x0E, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x80, 0x07, 0x00,	// U+0451
+	0x0F, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01,	// U+0452
+	0x0B, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x18, 0x00, 0x00,	// U+0453
+	0x0C, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x38, 0x80, 0x03,	// U+0454
+	0x0B, 0x00, 0xE0, 0x81, 0x03, 0x00, 0x10, 0xF8, 0x01,	// U+0455
+	0x02, 0xE0, 0xF8, 0xFF, 0x03, 0xE0, 0xF8, 0xFF, 0x03,	// U+0456
+	0x08, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,	// U+0457
+	0x06, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xF8, 0xFF, 0x07,	// U+0458
+	0x16, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xF8, 0x00,	// U+0459
+	0x15, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x20, 0x00,	// U+045A
+	0x0F, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,	// U+045B
+	0x0D, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x02,	// U+045C
+	0x0D, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03,	// U+045D
+	0x0E, 0x00, 0x08, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,	// U+045E
+	0x0D, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03,	// U+045F
+
+	// Glyph data: left bearing, number of ink columns, right bearing, ink columns
+	// ' '
+	0x0B, 0x00, 0x00,
+	// '!'
+	0x00, 0x03, 0x00, 0xC0, 0xFF, 0x8F, 0x03, 0xC0, 0xFF, 0x8F, 0x03, 0xC0, 0x7F, 0x80, 0x03,
+	// '"'
+	0x00, 0x08, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0xC0,
+	0x0F, 0x00, 0x00,
+	// '#'
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x98, 0x03, 0x00,
+	0x18, 0xFC, 0x01, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xFF, 0x18, 0x00, 0xC0, 0x1B, 0x18, 0x00, 0x00,
+	0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x02, 0x00, 0x18, 0xF8, 0x03, 0x00, 0x18, 0xFF, 0x00, 0x00,
+	0xFC, 0x1F, 0x00, 0xC0, 0x1F, 0x18, 0x00, 0xC0, 0x19, 0x18, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00,
+	0x18, 0x00, 0x00,
+	// '$'
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1E, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0x80,
+	0x7F, 0xC0, 0x01, 0xC0, 0xE1, 0x80, 0x03, 0xC0, 0xC0, 0x00, 0x03, 0xC0, 0xC0, 0x00, 0x03, 0xF0,
+	0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0x0F, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0,
+	0x81, 0x83, 0x03, 0x80, 0x03, 0x87, 0x01, 0x00, 0x07, 0xFF, 0x01, 0x00, 0x06, 0xFE, 0x00, 0x00,
+	0x00, 0x10, 0x00,
+	// '%'
+	0x00, 0x18, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0xC0, 0x81, 0x03, 0x00, 0xC0,
+	0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x03, 0xC0, 0x81, 0x83, 0x03, 0x80,
+	0xFF, 0xE1, 0x01, 0x00, 0x7F, 0x70, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00,
+	0x80, 0x03, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+	0x0E, 0xFF, 0x00, 0x00, 0x87, 0xFF, 0x01, 0xC0, 0xC1, 0x81, 0x03, 0xC0, 0xC0, 0x00, 0x03, 0x00,
+	0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x81, 0x03, 0x00, 0x80, 0xFF, 0x01, 0x00,
+	0x00, 0x7E, 0x00,
+	// '&'
+	0x00, 0x12, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0x01, 0x00,
+	0x80, 0x83, 0x03, 0x00, 0xBF, 0x01, 0x03, 0x80, 0xFF, 0x01, 0x03, 0xC0, 0xE1, 0x03, 0x03, 0xC0,
+	0xE0, 0x07, 0x03, 0xC0, 0x60, 0x1E, 0x03, 0xC0, 0x70, 0xB8, 0x01, 0xC0, 0x31, 0xF0, 0x01, 0x80,
+	0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x01, 0x00, 0x00, 0xBE, 0x03, 0x00, 0x80, 0x0F, 0x03, 0x00,
+	0x80, 0x01, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+	// '''
+	0x00, 0x02, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00,
+	// '('
+	0x00, 0x07, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x00, 0xFE, 0xF1, 0x0F, 0x80,
+	0x0F, 0x00, 0x3E, 0xC0, 0x03, 0x00, 0x78, 0xE0, 0x00, 0x00, 0xE0, 0x60, 0x00, 0x00, 0xC0,
+	// ')'
+	0x00, 0x07, 0x00, 0x60, 0x00, 0x00, 0xC0, 0xE0, 0x00, 0x00, 0xE0, 0xC0, 0x03, 0x00, 0x78, 0x80,
+	0x0F, 0x00, 0x3E, 0x00, 0xFE, 0xF1, 0x0F, 0x00, 0xFC, 0xFF, 0x07, 0x00, 0xE0, 0xFF, 0x00,
+	// '*'
+	0x00, 0x0B, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+	0xE4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
+	0xE4, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+	// '+'
+	0x00, 0x0F, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+	0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+	0xFE, 0x7F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+	0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00,
+	// ','
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x33, 0x00, 0x00, 0x80, 0x3F,
+	// '-'
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+	0x00, 0x06, 0x00,
+	// '.'
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x03,
+	// '/'
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0xFE, 0x01, 0x00,
+	0xE0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x60,
+	0x00, 0x00, 0x00,
+	// '0'
+	0x00, 0x0E, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x80,
+	0x03, 0xC0, 0x01, 0xC0, 0x01, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+	0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x01, 0x80, 0x03, 0x80, 0x03, 0xE0, 0x01, 0x00,
+	0xFF, 0xFF, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xF0, 0x0F, 0x00,
+	// '1'
+	0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x03, 0x00, 0x07, 0x00, 0x03, 0x80,
+	0x03, 0x00, 0x03, 0x80, 0x01, 0x00, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+	// '2'
+	0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0xC0, 0x03, 0x80, 0x07, 0xE0, 0x03, 0x80,
+	0x03, 0xF0, 0x03, 0xC0, 0x01, 0x38, 0x03, 0xC0, 0x00, 0x1C, 0x03, 0xC0, 0x00, 0x0E, 0x03, 0xC0,
+	0x00, 0x06, 0x03, 0xC0, 0x00, 0x03, 0x03, 0xC0, 0x81, 0x03, 0x03, 0x80, 0xE3, 0x01, 0x03, 0x80,
+	0xFF, 0x00, 0x03, 0x00, 0x3F, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+	// '3'
+	0x00, 0x0E, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x80, 0x07, 0xF0, 0x01, 0x80,
+	0x03, 0x80, 0x01, 0xC0, 0x01, 0x80, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0,
+	0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0xC1, 0x83, 0x03, 0x80, 0x77, 0x87, 0x01, 0x80,
+	0x7F, 0xFE, 0x01, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x38, 0x00,
+	// '4'
+	0x00, 0x0E, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x80, 0x1B, 0x00, 0x00,
+	0xC0, 0x19, 0x00, 0x00, 0xF0, 0x18, 0x00, 0x00, 0x38, 0x18, 0x00, 0x00, 0x1E, 0x18, 0x00, 0x00,
+	0x07, 0x18, 0x00, 0xC0, 0x03, 0x18, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00,
+	0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00,
+	// '5'
+	0x00, 0x0E, 0x00, 0x00, 0x00, 0x20, 0x00, 0xC0, 0xFF, 0xE0, 0x00, 0xC0, 0xFF, 0xE0, 0x01, 0xC0,
+	0xCF, 0x80, 0x01, 0xC0, 0xC0, 0x80, 0x03, 0xC0, 0x60, 0x00, 0x03, 0xC0, 0x60, 0x00, 0x03, 0xC0,
+	0x60, 0x00, 0x03, 0xC0, 0x60, 0x00, 0x03, 0xC0, 0xE0, 0x80, 0x03, 0xC0, 0xC0, 0xC1, 0x01, 0xC0,
+	0xC0, 0xFF, 0x01, 0xC0, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x3E, 0x00,
+	// '6'
+	0x00, 0x0D, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x80, 0x8F, 0xE1, 0x01, 0x80,
+	0xC1, 0x80, 0x01, 0xC0, 0x61, 0x00, 0x03, 0xC0, 0x60, 0x00, 0x03, 0xC0, 0x60, 0x00, 0x03, 0xC0,
+	0x60, 0x00, 0x03, 0xC0, 0xE1, 0x80, 0x03, 0x80, 0xC3, 0xC1, 0x01, 0x80, 0xC3, 0xFF, 0x01, 0x00,
+	0x83, 0xFF, 0x00, 0x00, 0x00, 0x1E, 0x00,
+	// '7'
+	0x00, 0x0E, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x03, 0xC0, 0x00, 0xFC, 0x03, 0xC0, 0x00, 0xFF, 0x03, 0xC0,
+	0xC0, 0x0F, 0x00, 0xC0, 0xF0, 0x01, 0x00, 0xC0, 0x7C, 0x00, 0x00, 0xC0, 0x1E, 0x00, 0x00, 0xC0,
+	0x07, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,
+	// '8'
+	0x00, 0x0E, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x80, 0x7F, 0xFE, 0x01, 0x80,
+	0xE3, 0x83, 0x01, 0xC0, 0xC1, 0x83, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0,
+	0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0xC1, 0x03, 0x03, 0x80, 0xE3, 0x83, 0x01, 0x80,
+	0x7F, 0xFE, 0x01, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x38, 0x00,
+	// '9'
+	0x00, 0x0E, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xFF, 0xC1, 0x00, 0x80, 0xFF, 0xC3, 0x01, 0x80,
+	0x83, 0xC3, 0x01, 0xC0, 0x01, 0x87, 0x03, 0xC0, 0x00, 0x06, 0x03, 0xC0, 0x00, 0x06, 0x03, 0xC0,
+	0x00, 0x06, 0x03, 0xC0, 0x00, 0x86, 0x03, 0xC0, 0x01, 0x83, 0x01, 0x80, 0x87, 0xE1, 0x01, 0x00,
+	0xFF, 0xFF, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0xE0, 0x03, 0x00,
+	// ':'
+	0x00, 0x02, 0x00, 0x00, 0x1C, 0x80, 0x03, 0x00, 0x1C, 0x80, 0x03,
+	// ';'
+	0x00, 0x02, 0x00, 0x00, 0x1C, 0x80, 0x33, 0x00, 0x1C, 0x80, 0x3F,
+	// '<'
+	0x00, 0x0F, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0xC0, 0x06, 0x00, 0x00,
+	0xC0, 0x06, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x60, 0x0C, 0x00, 0x00, 0x70, 0x1C, 0x00, 0x00,
+	0x30, 0x18, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00,
+	0x1C, 0x70, 0x00, 0x00, 0x0C, 0x60, 0x00, 0x00, 0x0E, 0xE0, 0x00, 0x00, 0x06, 0xC0, 0x00,
+	// '='
+	0x00, 0x0F, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00,
+	0x30, 0x18, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00,
+	0x30, 0x18, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00,
+	0x30, 0x18, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0x30, 0x18, 0x00,
+	// '>'
+	0x00, 0x0F, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x0E, 0xE0, 0x00, 0x00, 0x0C, 0x60, 0x00, 0x00,
+	0x1C, 0x60, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00,
+	0x30, 0x18, 0x00, 0x00, 0x70, 0x1C, 0x00, 0x00, 0x60, 0x0C, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0x00,
+	0xC0, 0x06, 0x00, 0x00, 0xC0, 0x06, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00,
+	// '?'
+	0x00, 0x0E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x80,
+	0x03, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x88, 0x03, 0xC0, 0x00, 0x8E, 0x03, 0xC0,
+	0x00, 0x8F, 0x03, 0xC0, 0x80, 0x03, 0x00, 0xC0, 0x80, 0x01, 0x00, 0x80, 0xC1, 0x00, 0x00, 0x80,
+	0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00,
+	// '@'
+	0x00, 0x19, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0xF8, 0xE0, 0x03, 0x00,
+	0x1C, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x03, 0x00, 0x1C, 0x80, 0x81, 0x7F, 0x18, 0xC0,
+	0xE1, 0xFF, 0x18, 0xC0, 0xF0, 0xC0, 0x31, 0xC0, 0x38, 0x80, 0x31, 0x60, 0x1C, 0x80, 0x31, 0x60,
+	0x0C, 0x80, 0x31, 0x60, 0x0C, 0xC0, 0x30, 0x60, 0x0C, 0xC0, 0x30, 0x60, 0x0C, 0x70, 0x30, 0x60,
+	0x18, 0xFC, 0x38, 0x60, 0xF0, 0xFF, 0x19, 0xE0, 0xFC, 0xCF, 0x19, 0xC0, 0x7C, 0x80, 0x1D, 0xC0,
+	0x05, 0x80, 0x0D, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00,
+	0xF8, 0x1F, 0x00, 0x00, 0x80, 0x01, 0x00,
+	// 'A'
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF0, 0x03, 0x00,
+	0x00, 0xFE, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFC, 0x0C, 0x00, 0x80,
+	0x3F, 0x0C, 0x00, 0xC0, 0x07, 0x0C, 0x00, 0xC0, 0x00, 0x0C, 0x00, 0xC0, 0x07, 0x0C, 0x00, 0x80,
+	0x3F, 0x0C, 0x00, 0x00, 0xFC, 0x0C, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00,
+	0x00, 0xFE, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x02,
+	// 'B'
+	0x00, 0x0F, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xC0, 0x00, 0x03, 0xC0, 0xC0, 0x00, 0x03, 0xC0, 0xC0, 0x00, 0x03, 0xC0, 0xC0, 0x00, 0x03, 0xC0,
+	0xC0, 0x00, 0x03, 0xC0, 0xC0, 0x00, 0x03, 0xC0, 0xC0, 0x00, 0x03, 0xC0, 0xE1, 0x00, 0x03, 0x80,
+	0xF3, 0x81, 0x03, 0x80, 0xBF, 0xC3, 0x01, 0x00, 0x1F, 0xFF, 0x01, 0x00, 0x00, 0x7E, 0x00,
+	// 'C'
+	0x00, 0x13, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+	0x1F, 0xFC, 0x00, 0x80, 0x07, 0xE0, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x01, 0xC0,
+	0x00, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+	0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x01, 0x80, 0x03, 0x80, 0x01, 0x80, 0x01, 0x80,
+	0x07, 0xC0, 0x01, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x00, 0x20, 0x00,
+	// 'D'
+	0x00, 0x12, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+	0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x01, 0x80, 0x03, 0x80,
+	0x01, 0x80, 0x01, 0x80, 0x03, 0xC0, 0x01, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
+	0xFE, 0x7F, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xC0, 0x03, 0x00,
+	// 'E'
+	0x00, 0x10, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0,
+	0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0,
+	0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03,
+	// 'F'
+	0x00, 0x0F, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0,
+	0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0,
+	0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x00, 0x00,
+	// 'G'
+	0x00, 0x14, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+	0x1F, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x01, 0xC0,
+	0x00, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+	0x00, 0x03, 0x03, 0xC0, 0x00, 0x03, 0x03, 0xC0, 0x01, 0x03, 0x03, 0x80, 0x01, 0x83, 0x03, 0x80,
+	0x03, 0x83, 0x01, 0x80, 0x07, 0xC3, 0x01, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00,
+	0x00, 0x7F, 0x00,
+	// 'H'
+	0x00, 0x11, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00,
+	0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+	0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+	0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// 'I'
+	0x00, 0x03, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// 'J'
+	0x00, 0x0D, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00,
+	0x00, 0xC0, 0x01, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+	0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x80, 0x01, 0xC0, 0xFF, 0xFF, 0x01, 0xC0,
+	0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0x3F, 0x00,
+	// 'K'
+	0x00, 0x10, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00,
+	0xB8, 0x07, 0x00, 0x00, 0x1C, 0x0F, 0x00, 0x00, 0x0E, 0x1E, 0x00, 0x00, 0x07, 0x38, 0x00, 0x80,
+	0x03, 0xF0, 0x00, 0xC0, 0x01, 0xE0, 0x01, 0xC0, 0x00, 0xC0, 0x03, 0x40, 0x00, 0x80, 0x03, 0x00,
+	0x00, 0x00, 0x02,
+	// 'L'
+	0x00, 0x0D, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+	// 'M'
+	0x00, 0x13, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x0F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00,
+	0x00, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0xF0, 0x03, 0x00,
+	0x00, 0x7E, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xC0,
+	0x0F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// 'N'
+	0x00, 0x11, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x03, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+	0xF0, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00,
+	0x00, 0x78, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xC0, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// 'O'
+	0x00, 0x15, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+	0x1F, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x01, 0xC0,
+	0x00, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+	0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x01, 0x80, 0x01, 0x80,
+	0x03, 0xC0, 0x01, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+	0xF8, 0x1F, 0x00, 0x00, 0xC0, 0x01, 0x00,
+	// 'P'
+	0x00, 0x0F, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0,
+	0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0,
+	0x81, 0x03, 0x00, 0x80, 0xC3, 0x01, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x7F, 0x00, 0x00,
+	// 'Q'
+	0x00, 0x15, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+	0x1F, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x01, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x01, 0xC0,
+	0x00, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xC0,
+	0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x73, 0x80, 0x01, 0x80, 0x61, 0x80,
+	0x03, 0xC0, 0x61, 0x00, 0x07, 0xE0, 0x60, 0x00, 0x1F, 0xF8, 0x60, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+	0xF8, 0x1F, 0x00, 0x00, 0xC0, 0x01, 0x00,
+	// 'R'
+	0x00, 0x11, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0,
+	0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x0F, 0x00, 0xC0,
+	0x00, 0x1F, 0x00, 0xC0, 0x81, 0x7F, 0x00, 0x80, 0xC3, 0xF1, 0x00, 0x80, 0xFF, 0xE1, 0x03, 0x00,
+	0xFF, 0x80, 0x03, 0x00, 0x3C, 0x00, 0x03,
+	// 'S'
+	0x00, 0x11, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1E, 0x60, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x80,
+	0x7F, 0xC0, 0x01, 0x80, 0xE1, 0x80, 0x01, 0xC0, 0xE1, 0x80, 0x03, 0xC0, 0xC0, 0x00, 0x03, 0xC0,
+	0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0,
+	0x80, 0x03, 0x03, 0xC0, 0x81, 0x83, 0x01, 0x80, 0x07, 0xC7, 0x01, 0x00, 0x07, 0xFF, 0x01, 0x00,
+	0x06, 0xFE, 0x00, 0x00, 0x00, 0x38, 0x00,
+	// 'T'
+	0x00, 0x11, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,
+	// 'U'
+	0x00, 0x11, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x7F, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0xE0, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xE0, 0x01, 0xC0, 0xFF, 0xFF, 0x00, 0xC0,
+	0xFF, 0x7F, 0x00, 0xC0, 0xFF, 0x1F, 0x00,
+	// 'V'
+	0x00, 0x13, 0x00, 0x40, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x80,
+	0x3F, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00,
+	0x00, 0xFC, 0x01, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xE0, 0x03, 0x00,
+	0x00, 0xFC, 0x01, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x80,
+	0x3F, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	// 'W'
+	0x00, 0x1C, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+	0xF8, 0x07, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xF0, 0x03, 0x00,
+	0x00, 0x80, 0x03, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00,
+	0xFC, 0x03, 0x00, 0x80, 0x7F, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x80,
+	0x3F, 0x00, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+	0x00, 0xF8, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xFE, 0x01, 0x00,
+	0xC0, 0x3F, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0xC0,
+	0x03, 0x00, 0x00,
+	// 'X'
+	0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x80, 0x03, 0xC0, 0x01, 0xC0, 0x03, 0xC0,
+	0x07, 0xE0, 0x01, 0x00, 0x0F, 0x78, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0x78, 0x0F, 0x00, 0x00,
+	0xF0, 0x07, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x78, 0x0F, 0x00, 0x00,
+	0x3C, 0x3E, 0x00, 0x00, 0x0F, 0x78, 0x00, 0x80, 0x07, 0xF0, 0x01, 0xC0, 0x01, 0xC0, 0x03, 0xC0,
+	0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x02,
+	// 'Y'
+	0x00, 0x11, 0x00, 0x40, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x80,
+	0x0F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00,
+	0xC0, 0xFF, 0x03, 0x00, 0x80, 0xFF, 0x03, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0xF0, 0x01, 0x00, 0x00,
+	0x78, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0,
+	0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	// 'Z'
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x03, 0xC0, 0x00, 0xC0, 0x03, 0xC0, 0x00, 0xE0, 0x03, 0xC0,
+	0x00, 0x70, 0x03, 0xC0, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x1E, 0x03, 0xC0, 0x00, 0x07, 0x03, 0xC0,
+	0xC0, 0x03, 0x03, 0xC0, 0xE0, 0x01, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x03, 0xC0,
+	0x1E, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x03, 0xC0, 0x03, 0x00, 0x03, 0xC0, 0x01, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03,
+	// '['
+	0x00, 0x06, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x60,
+	0x00, 0x00, 0xC0, 0x60, 0x00, 0x00, 0xC0, 0x60, 0x00, 0x00, 0xC0,
+	// '\\'
+	0x00, 0x08, 0x00, 0x60, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00,
+	0xFC, 0x03, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xE0, 0x03, 0x00,
+	0x00, 0x00, 0x03,
+	// ']'
+	0x00, 0x06, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x60, 0x00, 0x00, 0xC0, 0x60, 0x00, 0x00, 0xC0, 0xE0,
+	0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
+	// '^'
+	0x00, 0x0E, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
+	0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
+	0xF0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+	// '_'
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00,
+	0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00,
+	0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00,
+	0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00,
+	0x00, 0x00, 0xC0,
+	// '`'
+	0x00, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	// 'a'
+	0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x30, 0xFC, 0x01, 0x00, 0x38, 0xFE, 0x03, 0x00,
+	0x38, 0x86, 0x03, 0x00, 0x0C, 0x07, 0x03, 0x00, 0x0C, 0x03, 0x03, 0x00, 0x0C, 0x03, 0x03, 0x00,
+	0x0C, 0x03, 0x01, 0x00, 0x0C, 0x83, 0x01, 0x00, 0x1C, 0xC3, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+	// 'b'
+	0x00, 0x0D, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0xE0, 0x79, 0x00, 0x00,
+	0x18, 0x80, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x03, 0x00,
+	0x0C, 0x00, 0x03, 0x00, 0x1C, 0x80, 0x03, 0x00, 0x3C, 0xC0, 0x03, 0x00, 0xF8, 0xFF, 0x01, 0x00,
+	0xF0, 0xFF, 0x00, 0x00, 0x80, 0x1F, 0x00,
+	// 'c'
+	0x00, 0x0D, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00,
+	0x38, 0xC0, 0x01, 0x00, 0x1C, 0x80, 0x03, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x03, 0x00,
+	0x0C, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x1C, 0x80, 0x03, 0x00, 0x78, 0xC0, 0x01, 0x00,
+	0x70, 0xE0, 0x00, 0x00, 0x60, 0x60, 0x00,
+	// 'd'
+	0x00, 0x0D, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00,
+	0x3C, 0xC0, 0x03, 0x00, 0x1C, 0x80, 0x03, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x03, 0x00,
+	0x0C, 0x00, 0x03, 0x00, 0x08, 0x00, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0xE0, 0x79, 0x00, 0xE0,
+	0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x03,
+	// 'e'
+	0x00, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00,
+	0x38, 0xC6, 0x01, 0x00, 0x1C, 0x86, 0x03, 0x00, 0x0C, 0x06, 0x03, 0x00, 0x0C, 0x06, 0x03, 0x00,
+	0x0C, 0x06, 0x03, 0x00, 0x0C, 0x06, 0x03, 0x00, 0x1C, 0x06, 0x03, 0x00, 0x38, 0x86, 0x01, 0x00,
+	0xF0, 0xC7, 0x01, 0x00, 0xE0, 0xC7, 0x00, 0x00, 0x00, 0x07, 0x00,
+	// 'f'
+	0x00, 0x08, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0xC0,
+	0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x03, 0x60, 0x0C, 0x00, 0x00, 0x60, 0x0C, 0x00, 0x00, 0x60,
+	0x0C, 0x00, 0x00,
+	// 'g'
+	0x00, 0x0D, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xF0, 0xFF, 0x30, 0x00, 0xF8, 0xFF, 0x71, 0x00,
+	0x3C, 0xC0, 0x73, 0x00, 0x1C, 0x80, 0xE3, 0x00, 0x0C, 0x00, 0xC3, 0x00, 0x0C, 0x00, 0xC3, 0x00,
+	0x0C, 0x00, 0xC3, 0x00, 0x18, 0x80, 0xC1, 0x00, 0x38, 0xC0, 0xE0, 0x00, 0xE0, 0x79, 0x7C, 0x00,
+	0xFC, 0xFF, 0x3F, 0x00, 0xFC, 0xFF, 0x1F,
+	// 'h'
+	0x00, 0x0C, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x03, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+	0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0xF0, 0xFF, 0x03,
+	// 'i'
+	0x00, 0x03, 0x00, 0x60, 0xFC, 0xFF, 0x03, 0x60, 0xFC, 0xFF, 0x03, 0x60, 0xFC, 0xFF, 0x03,
+	// 'j'
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x60, 0xFC, 0xFF, 0xFF, 0x60,
+	0xFC, 0xFF, 0x7F, 0x60, 0xFC, 0xFF, 0x1F,
+	// 'k'
+	0x00, 0x0C, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00,
+	0x00, 0x07, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0xE0, 0x3C, 0x00, 0x00,
+	0x70, 0xF8, 0x00, 0x00, 0x3C, 0xE0, 0x01, 0x00, 0x1C, 0xC0, 0x03, 0x00, 0x04, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x02,
+	// 'l'
+	0x00, 0x03, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x03,
+	// 'm'
+	0x00, 0x15, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0xE0, 0xFF, 0x03, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+	0x0C, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0xE0, 0xFF, 0x03, 0x00, 0x30, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+	0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0xF0, 0xFF, 0x03,
+	// 'n'
+	0x00, 0x0C, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0xE0, 0xFF, 0x03, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+	0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0xF0, 0xFF, 0x03,
+	// 'o'
+	0x00, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00,
+	0x38, 0xC0, 0x01, 0x00, 0x1C, 0x80, 0x03, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x03, 0x00,
+	0x0C, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x1C, 0x80, 0x03, 0x00, 0x38, 0xC0, 0x01, 0x00,
+	0xF8, 0xFF, 0x01, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x80, 0x1F, 0x00,
+	// 'p'
+	0x00, 0x0D, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x00, 0xFC, 0xFF, 0xFF, 0x00, 0xE0, 0x79, 0x00, 0x00,
+	0x18, 0x80, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x03, 0x00,
+	0x0C, 0x00, 0x03, 0x00, 0x1C, 0x80, 0x03, 0x00, 0x3C, 0xC0, 0x03, 0x00, 0xF8, 0xFF, 0x01, 0x00,
+	0xF0, 0xFF, 0x00, 0x00, 0x80, 0x1F, 0x00,
+	// 'q'
+	0x00, 0x0D, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00,
+	0x3C, 0xC0, 0x03, 0x00, 0x1C, 0x80, 0x03, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x03, 0x00,
+	0x0C, 0x00, 0x03, 0x00, 0x08, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0xE0, 0x79, 0x00, 0x00,
+	0xFC, 0xFF, 0xFF, 0x00, 0xFC, 0xFF, 0xFF,
+	// 'r'
+	0x00, 0x08, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0xE0, 0xFF, 0x03, 0x00,
+	0x38, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+	0x0C, 0x00, 0x00,
+	// 's'
+	0x00, 0x0D, 0x00, 0x00, 0x40, 0xC0, 0x00, 0x00, 0xF0, 0xC1, 0x01, 0x00, 0xF8, 0x83, 0x01, 0x00,
+	0x9C, 0x83, 0x03, 0x00, 0x0C, 0x03, 0x03, 0x00, 0x0C, 0x07, 0x03, 0x00, 0x0C, 0x06, 0x03, 0x00,
+	0x0C, 0x06, 0x03, 0x00, 0x0C, 0x06, 0x03, 0x00, 0x1C, 0x8E, 0x03, 0x00, 0x38, 0xFC, 0x01, 0x00,
+	0x30, 0xFC, 0x01, 0x00, 0x20, 0x70, 0x00,
+	// 't'
+	0x00, 0x08, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x80,
+	0xFF, 0xFF, 0x03, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x03, 0x00,
+	0x0C, 0x00, 0x03,
+	// 'u'
+	0x00, 0x0C, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x00, 0x00, 0xE0, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x00,
+	0xFC, 0xFF, 0x03,
+	// 'v'
+	0x00, 0x0D, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00,
+	0xE0, 0x1F, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0xF0, 0x03, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00,
+	0x7C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+	// 'w'
+	0x00, 0x15, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00,
+	0xC0, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0xE0, 0x03, 0x00,
+	0x00, 0xFE, 0x01, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+	0xFC, 0x01, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xE0, 0x03, 0x00,
+	0x00, 0x80, 0x03, 0x00, 0x00, 0xFC, 0x03, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00,
+	0xFC, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00,
+	// 'x'
+	0x00, 0x0B, 0x00, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x1C, 0xC0, 0x03, 0x00, 0x7C, 0xF0, 0x01, 0x00,
+	0xF0, 0x79, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00,
+	0xF0, 0x79, 0x00, 0x00, 0x7C, 0xF0, 0x01, 0x00, 0x1C, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x03,
+	// 'y'
+	0x00, 0x0D, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xC0, 0x00, 0xFC, 0x01, 0xC0, 0x00,
+	0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x70, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x80, 0x1F, 0x00,
+	0x00, 0xF0, 0x07, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00,
+	0x3C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+	// 'z'
+	0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0xC0, 0x03, 0x00, 0x0C, 0xE0, 0x03, 0x00,
+	0x0C, 0x78, 0x03, 0x00, 0x0C, 0x3C, 0x03, 0x00, 0x0C, 0x1F, 0x03, 0x00, 0x8C, 0x07, 0x03, 0x00,
+	0xEC, 0x03, 0x03, 0x00, 0xFC, 0x00, 0x03, 0x00, 0x7C, 0x00, 0x03, 0x00, 0x1C, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03,
+	// '{'
+	0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
+	0x80, 0x1F, 0x00, 0xC0, 0xFF, 0xF9, 0x7F, 0xE0, 0xFF, 0xF0, 0xFF, 0xE0, 0x00, 0x00, 0xE0, 0x60,
+	0x00, 0x00, 0xC0, 0x60, 0x00, 0x00, 0xC0,
+	// '|'
+	0x00, 0x02, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
+	// '}'
+	0x00, 0x09, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x60, 0x00, 0x00, 0xC0, 0x60, 0x00, 0x00, 0xC0, 0xE0,
+	0x00, 0x00, 0xE0, 0xE0, 0xFF, 0xF1, 0xFF, 0xC0, 0xFF, 0xFD, 0x7F, 0x00, 0x80, 0x1F, 0x00, 0x00,
+	0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00,
+	// '~'
+	0x00, 0x0F, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,
+	0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00,
+	0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00,
+	// DEL
+	0x00, 0x05, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80,
+	0x00, 0x00, 0x01, 0x80, 0xFF, 0xFF, 0x01,
+	// 0x80
+	0x03, 0x00, 0x00,
+	// 0x81
+	0x01, 0x00, 0x00,
+	// 0x82
+	0x01, 0x00, 0x00,
+	// 0x83
+	0x01, 0x00, 0x00,
+	// 0x84
+	0x01, 0x00, 0x00,
+	// 0x85
+	0x01, 0x00, 0x00,
+	// 0x86
+	0x01, 0x00, 0x00,
+	// 0x87
+	0x01, 0x00, 0x00,
+	// 0x88
+	0x01, 0x00, 0x00,
+	// 0x89
+	0x01, 0x00, 0x00,
+	// 0x8A
+	0x01, 0x00, 0x00,
+	// 0x8B
+	0x01, 0x00, 0x00,
+	// 0x8C
+	0x01, 0x00, 0x00,
+	// 0x8D
+	0x01, 0x00, 0x00,
+	// 0x8E
+	0x01, 0x00, 0x00,
+	// 0x8F
+	0x01, 0x00, 0x00,
+	// 0x90
+	0x01, 0x00, 0x00,
+	// 0x91
+	0x01, 0x00, 0x00,
+	// 0x92
+	0x01, 0x00, 0x00,
+	// 0x93
+	0x01, 0x00, 0x00,
+	// 0x94
+	0x01, 0x00, 0x00,
+	// 0x95
+	0x01, 0x00, 0x00,
+	// 0x96
+	0x01, 0x00, 0x00,
+	// 0x97
+	0x01, 0x00, 0x00,
+	// 0x98
+	0x01, 0x00, 0x00,
+	// 0x99
+	0x01, 0x00, 0x00,
+	// 0x9A
+	0x01, 0x00, 0x00,
+	// 0x9B
+	0x01, 0x00, 0x00,
+	// 0x9C
+	0x01, 0x00, 0x00,
+	// 0x9D
+	0x01, 0x00, 0x00,
+	// 0x9E
+	0x01, 0x00, 0x00,
+	// 0x9F
+	0x01, 0x00, 0x00,
+	// 0xA0
+	0x01, 0x00, 0x00,
+	// 0xA1
+	0x00, 0x03, 0x00, 0x00, 0x1C, 0xFE, 0x7F, 0x00, 0x1C, 0xFF, 0x7F, 0x00, 0x1C, 0xFF, 0x7F,
+	// 0xA2
+	0x00, 0x0C, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+	0x06, 0x70, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xC0, 0x03, 0xC0, 0x03, 0x00,
+	0x03, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x1E, 0x78, 0x00, 0x00,
+	0x18, 0x38, 0x00,
+	// 0xA3
+	0x00, 0x0E, 0x00, 0x00, 0x80, 0x01, 0x03, 0x00, 0x80, 0x81, 0x03, 0x00, 0xFC, 0xFF, 0x03, 0x00,
+	0xFF, 0x7F, 0x03, 0x80, 0xFF, 0x3F, 0x03, 0xC0, 0x81, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0,
+	0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x81, 0x01, 0x03, 0x80,
+	0x03, 0x80, 0x03, 0x00, 0x03, 0xE0, 0x01, 0x00, 0x00, 0xE0, 0x00,
+	// 0xA4
+	0x00, 0x0C, 0x00, 0x00, 0xEC, 0x37, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x00,
+	0x18, 0x18, 0x00, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x0C, 0x30, 0x00, 0x00,
+	0x0C, 0x30, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00,
+	0xEC, 0x37, 0x00,
+	// 0xA5
+	0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x33, 0x00, 0xC0, 0x03, 0x33, 0x00, 0x80,
+	0x0F, 0x33, 0x00, 0x00, 0x3E, 0x33, 0x00, 0x00, 0x78, 0x33, 0x00, 0x00, 0xE0, 0x33, 0x00, 0x00,
+	0xC0, 0xFF, 0x03, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0xE0, 0x33, 0x00, 0x00, 0x78, 0x33, 0x00, 0x00,
+	0x3E, 0x33, 0x00, 0x80, 0x0F, 0x33, 0x00, 0xC0, 0x03, 0x33, 0x00, 0xC0, 0x01, 0x33, 0x00, 0x40,
+	0x00, 0x00, 0x00,
+	// 0xA6
+	0x00, 0x02, 0x00, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF,
+	// 0xA7
+	0x00, 0x0C, 0x00, 0x00, 0x83, 0x03, 0x03, 0xC0, 0xC7, 0x07, 0x07, 0xC0, 0x6F, 0x0E, 0x06, 0xE0,
+	0x3C, 0x0C, 0x0C, 0x60, 0x38, 0x0C, 0x0C, 0x60, 0x18, 0x18, 0x0C, 0x60, 0x30, 0x18, 0x0C, 0x60,
+	0x30, 0x18, 0x0C, 0x60, 0x30, 0x38, 0x0C, 0xC0, 0x70, 0x3C, 0x06, 0xC0, 0xE1, 0xF7, 0x07, 0x80,
+	0xC1, 0xE7, 0x03,
+	// 0xA8
+	0x00, 0x08, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80,
+	0x01, 0x00, 0x00,
+	// 0xA9
+	0x00, 0x15, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x0C, 0x30, 0x00, 0x00,
+	0x06, 0x60, 0x00, 0x00, 0x01, 0x80, 0x00, 0x80, 0xE1, 0x83, 0x01, 0x80, 0xF0, 0x0F, 0x01, 0xC0,
+	0x18, 0x18, 0x03, 0x40, 0x0C, 0x30, 0x02, 0x40, 0x04, 0x20, 0x02, 0x40, 0x04, 0x20, 0x02, 0x40,
+	0x04, 0x20, 0x02, 0x40, 0x0C, 0x30, 0x02, 0xC0, 0x18, 0x18, 0x03, 0x80, 0x10, 0x08, 0x01, 0x80,
+	0x01, 0x80, 0x01, 0x00, 0x01, 0x80, 0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0x0C, 0x30, 0x00, 0x00,
+	0xF0, 0x0F, 0x00, 0x00, 0x80, 0x01, 0x00,
+	// 0xAA
+	0x00, 0x0B, 0x00, 0x00, 0x60, 0x00, 0x00, 0x80, 0xF9, 0x00, 0x00, 0x80, 0xFD, 0x01, 0x00, 0xC0,
+	0x0C, 0x01, 0x00, 0x40, 0x04, 0x01, 0x00, 0x40, 0x04, 0x01, 0x00, 0x40, 0x84, 0x00, 0x00, 0xC0,
+	0x65, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+	// 0xAB
+	0x00, 0x0E, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
+	0x80, 0x73, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0x60, 0xC0, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00,
+	0x00, 0x0E, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x80, 0x3B, 0x00, 0x00, 0xC0, 0x71, 0x00, 0x00,
+	0xE0, 0xE0, 0x00, 0x00, 0x60, 0xC0, 0x00, 0x00, 0x20, 0x80, 0x00,
+	// 0xAC
+	0x00, 0x0F, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+	0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+	0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+	0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x80, 0x7F, 0x00,
+	// 0xAD
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+	0x00, 0x06, 0x00,
+	// 0xAE
+	0x00, 0x15, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x0C, 0x30, 0x00, 0x00,
+	0x06, 0x60, 0x00, 0x00, 0x01, 0x80, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00, 0x01, 0xC0,
+	0xFC, 0x3F, 0x03, 0x40, 0x04, 0x01, 0x02, 0x40, 0x04, 0x01, 0x02, 0x40, 0x04, 0x01, 0x02, 0x40,
+	0x04, 0x07, 0x02, 0x40, 0x8C, 0x1F, 0x02, 0xC0, 0xF8, 0x38, 0x03, 0x80, 0x70, 0x20, 0x01, 0x80,
+	0x01, 0x80, 0x01, 0x00, 0x01, 0x80, 0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0x0C, 0x30, 0x00, 0x00,
+	0xF0, 0x0F, 0x00, 0x00, 0x80, 0x01, 0x00,
+	// 0xAF
+	0x00, 0x10, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18,
+	0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18,
+	0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18,
+	0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18,
+	0x00, 0x00, 0x00,
+	// 0xB0
+	0x00, 0x08, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x19, 0x00, 0x00, 0xC0, 0x30, 0x00, 0x00, 0xC0,
+	0x30, 0x00, 0x00, 0xC0, 0x30, 0x00, 0x00, 0xC0, 0x30, 0x00, 0x00, 0x80, 0x19, 0x00, 0x00, 0x00,
+	0x0F, 0x00, 0x00,
+	// 0xB1
+	0x00, 0x0E, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00,
+	0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xFF, 0x3F, 0x03, 0x00,
+	0xFF, 0x3F, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00,
+	0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03,
+	// 0xB2
+	0x00, 0x08, 0x00, 0x00, 0x01, 0x03, 0x00, 0x80, 0x81, 0x03, 0x00, 0xC0, 0xC0, 0x02, 0x00, 0x40,
+	0x60, 0x02, 0x00, 0x40, 0x30, 0x02, 0x00, 0x40, 0x38, 0x02, 0x00, 0xC0, 0x1F, 0x02, 0x00, 0x80,
+	0x0F, 0x02, 0x00,
+	// 0xB3
+	0x00, 0x08, 0x00, 0x80, 0x81, 0x01, 0x00, 0x80, 0x81, 0x03, 0x00, 0x40, 0x00, 0x02, 0x00, 0x40,
+	0x08, 0x02, 0x00, 0x40, 0x08, 0x02, 0x00, 0x40, 0x0C, 0x02, 0x00, 0xC0, 0xF7, 0x03, 0x00, 0x80,
+	0xF3, 0x01, 0x00,
+	// 0xB4
+	0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x60,
+	0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+	// 0xB5
+	0x00, 0x0E, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x00, 0xFC, 0xFF, 0xFF, 0x00, 0xFC, 0xFF, 0xFF, 0x00,
+	0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x00,
+	0xFC, 0xFF, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x03,
+	// 0xB6
+	0x00, 0x0E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0xC0,
+	0xFF, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x3F, 0xC0, 0xFF, 0xFF, 0x3F, 0x40,
+	0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x3F, 0xC0,
+	0xFF, 0xFF, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	// 0xB7
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00,
+	// 0xB8
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0xCC, 0x00,
+	0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x70,
+	// 0xB9
+	0x00, 0x08, 0x00, 0x00, 0x03, 0x02, 0x00, 0x80, 0x01, 0x02, 0x00, 0x80, 0x00, 0x02, 0x00, 0xC0,
+	0xFF, 0x03, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x02, 0x00,
+	// 0xBA
+	0x00, 0x0B, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x80, 0xFF, 0x00, 0x00, 0xC0,
+	0x80, 0x01, 0x00, 0x40, 0x00, 0x01, 0x00, 0x40, 0x00, 0x01, 0x00, 0x40, 0x00, 0x01, 0x00, 0xC0,
+	0x80, 0x01, 0x00, 0x80, 0xF7, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00,
+	// 0xBB
+	0x00, 0x0E, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x60, 0xC0, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0x00,
+	0xC0, 0x71, 0x00, 0x00, 0x80, 0x3B, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00,
+	0x20, 0x80, 0x00, 0x00, 0x60, 0xC0, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0x80, 0x33, 0x00, 0x00,
+	0x00, 0x1F, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x04, 0x00,
+	// 0xBC
+	0x00, 0x16, 0x00, 0x00, 0x03, 0x02, 0x00, 0x80, 0x01, 0x02, 0x00, 0x80, 0x00, 0x02, 0x00, 0xC0,
+	0xFF, 0x03, 0x00, 0xC0, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0xC2, 0x03, 0x00,
+	0x00, 0xE2, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+	0xC0, 0x03, 0x00, 0x00, 0xE0, 0x40, 0x00, 0x00, 0x38, 0x70, 0x00, 0x00, 0x1C, 0x58, 0x00, 0x00,
+	0x07, 0x4E, 0x00, 0xC0, 0x03, 0x47, 0x00, 0xC0, 0x80, 0x41, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00,
+	0xC0, 0xFF, 0x03, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00,
+	// 0xBD
+	0x00, 0x16, 0x00, 0x00, 0x03, 0x02, 0x00, 0x80, 0x01, 0x02, 0x00, 0x80, 0x00, 0x02, 0x00, 0xC0,
+	0xFF, 0x03, 0x00, 0xC0, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0xC2, 0x03, 0x00,
+	0x00, 0xE2, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+	0xC0, 0x03, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1C, 0x01, 0x03, 0x00,
+	0x87, 0x81, 0x03, 0xC0, 0xC3, 0xC0, 0x02, 0xC0, 0x40, 0x60, 0x02, 0x00, 0x40, 0x30, 0x02, 0x00,
+	0x40, 0x38, 0x02, 0x00, 0xC0, 0x1F, 0x02, 0x00, 0x80, 0x0F, 0x02,
+	// 0xBE
+	0x00, 0x15, 0x00, 0x80, 0x81, 0x01, 0x00, 0x80, 0x81, 0x03, 0x00, 0x40, 0x00, 0x02, 0x00, 0x40,
+	0x08, 0x02, 0x02, 0x40, 0x08, 0x02, 0x03, 0x40, 0x0C, 0xC2, 0x03, 0xC0, 0xF7, 0xE3, 0x00, 0x80,
+	0xF3, 0x39, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00,
+	0xE0, 0x40, 0x00, 0x00, 0x38, 0x70, 0x00, 0x00, 0x1C, 0x58, 0x00, 0x00, 0x07, 0x4E, 0x00, 0xC0,
+	0x03, 0x47, 0x00, 0xC0, 0x80, 0x41, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0xC0, 0xFF, 0x03, 0x00,
+	0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00,
+	// 0xBF
+	0x00, 0x0E, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0xF0, 0x3E, 0x00,
+	0x00, 0x38, 0x30, 0x00, 0x00, 0x1C, 0x60, 0x00, 0x00, 0x0E, 0x60, 0x00, 0x9C, 0x07, 0x60, 0x00,
+	0x9C, 0x07, 0x60, 0x00, 0x9C, 0x01, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x38, 0x00,
+	0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x06,
+	// 0xC0
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF0, 0x03, 0x00,
+	0x00, 0xFE, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFC, 0x0C, 0x00, 0x82,
+	0x3F, 0x0C, 0x00, 0xC2, 0x07, 0x0C, 0x00, 0xC6, 0x00, 0x0C, 0x00, 0xCC, 0x07, 0x0C, 0x00, 0x88,
+	0x3F, 0x0C, 0x00, 0x08, 0xFC, 0x0C, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00,
+	0x00, 0xFE, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x02,
+	// 0xC1
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF0, 0x03, 0x00,
+	0x00, 0xFE, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFC, 0x0C, 0x00, 0x80,
+	0x3F, 0x0C, 0x00, 0xC8, 0x07, 0x0C, 0x00, 0xC8, 0x00, 0x0C, 0x00, 0xCC, 0x07, 0x0C, 0x00, 0x86,
+	0x3F, 0x0C, 0x00, 0x02, 0xFC, 0x0C, 0x00, 0x02, 0xF0, 0x0F, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00,
+	0x00, 0xFE, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x02,
+	// 0xC2
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF0, 0x03, 0x00,
+	0x00, 0xFE, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x08, 0xF0, 0x0F, 0x00, 0x0C, 0xFC, 0x0C, 0x00, 0x86,
+	0x3F, 0x0C, 0x00, 0xC7, 0x07, 0x0C, 0x00, 0xC3, 0x00, 0x0C, 0x00, 0xC3, 0x07, 0x0C, 0x00, 0x87,
+	0x3F, 0x0C, 0x00, 0x0C, 0xFC, 0x0C, 0x00, 0x08, 0xF0, 0x0F, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00,
+	0x00, 0xFE, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x02,
+	// 0xC3
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF0, 0x03, 0x00,
+	0x00, 0xFE, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x0E, 0xF0, 0x0F, 0x00, 0x07, 0xFC, 0x0C, 0x00, 0x83,
+	0x3F, 0x0C, 0x00, 0xC3, 0x07, 0x0C, 0x00, 0xC6, 0x00, 0x0C, 0x00, 0xC6, 0x07, 0x0C, 0x00, 0x8C,
+	0x3F, 0x0C, 0x00, 0x0C, 0xFC, 0x0C, 0x00, 0x0E, 0xF0, 0x0F, 0x00, 0x07, 0x80, 0x1F, 0x00, 0x00,
+	0x00, 0xFE, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x02,
+	// 0xC4
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF0, 0x03, 0x00,
+	0x00, 0xFE, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x0C, 0xFC, 0x0C, 0x00, 0x8C,
+	0x3F, 0x0C, 0x00, 0xC0, 0x07, 0x0C, 0x00, 0xC0, 0x00, 0x0C, 0x00, 0xC0, 0x07, 0x0C, 0x00, 0x8C,
+	0x3F, 0x0C, 0x00, 0x0C, 0xFC, 0x0C, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00,
+	0x00, 0xFE, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x02,
+	// 0xC5
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF0, 0x03, 0x00,
+	0x00, 0xFE, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x7C, 0xFC, 0x0C, 0x00, 0xEE,
+	0x3F, 0x0C, 0x00, 0xC6, 0x07, 0x0C, 0x00, 0xC6, 0x00, 0x0C, 0x00, 0xC6, 0x07, 0x0C, 0x00, 0xFC,
+	0x3F, 0x0C, 0x00, 0x38, 0xFC, 0x0C, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00,
+	0x00, 0xFE, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x02,
+	// 0xC6
+	0x00, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF8, 0x01, 0x00,
+	0x00, 0x7E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0xF8, 0x0D, 0x00, 0x00,
+	0x7E, 0x0C, 0x00, 0x80, 0x0F, 0x0C, 0x00, 0xC0, 0x03, 0x0C, 0x00, 0xC0, 0x00, 0x0C, 0x00, 0xC0,
+	0x00, 0x0C, 0x00, 0xC0, 0x00, 0x0C, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0,
+	0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0,
+	0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+	// 0xC7
+	0x00, 0x13, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+	0x1F, 0xFC, 0x00, 0x80, 0x07, 0xE0, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x01, 0xC0,
+	0x00, 0x80, 0x03, 0xC0, 0x00, 0x00, 0xC3, 0xC0, 0x00, 0x00, 0xCF, 0xC0, 0x00, 0x00, 0xCF, 0xC0,
+	0x00, 0x00, 0xFB, 0xC0, 0x00, 0x00, 0x73, 0xC0, 0x01, 0x80, 0x03, 0x80, 0x01, 0x80, 0x01, 0x80,
+	0x07, 0xC0, 0x01, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x00, 0x20, 0x00,
+	// 0xC8
+	0x00, 0x10, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x80, 0x01, 0x03, 0xC2, 0x80, 0x01, 0x03, 0xC2, 0x80, 0x01, 0x03, 0xC6, 0x80, 0x01, 0x03, 0xCC,
+	0x80, 0x01, 0x03, 0xC8, 0x80, 0x01, 0x03, 0xC8, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0,
+	0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03,
+	// 0xC9
+	0x00, 0x10, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC8, 0x80, 0x01, 0x03, 0xC8,
+	0x80, 0x01, 0x03, 0xCC, 0x80, 0x01, 0x03, 0xC6, 0x80, 0x01, 0x03, 0xC2, 0x80, 0x01, 0x03, 0xC2,
+	0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03,
+	// 0xCA
+	0x00, 0x10, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x80, 0x01, 0x03, 0xC8, 0x80, 0x01, 0x03, 0xCC, 0x80, 0x01, 0x03, 0xC6, 0x80, 0x01, 0x03, 0xC7,
+	0x80, 0x01, 0x03, 0xC3, 0x80, 0x01, 0x03, 0xC3, 0x80, 0x01, 0x03, 0xC7, 0x80, 0x01, 0x03, 0xCC,
+	0x80, 0x01, 0x03, 0xC8, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03,
+	// 0xCB
+	0x00, 0x10, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xCC, 0x80, 0x01, 0x03, 0xCC, 0x80, 0x01, 0x03, 0xC0,
+	0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xCC, 0x80, 0x01, 0x03, 0xCC,
+	0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03,
+	// 0xCC
+	0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xC6, 0xFF, 0xFF, 0x03, 0xCC,
+	0xFF, 0xFF, 0x03, 0xC8, 0xFF, 0xFF, 0x03, 0x08, 0x00, 0x00, 0x00,
+	// 0xCD
+	0x00, 0x06, 0x00, 0xC8, 0xFF, 0xFF, 0x03, 0xC8, 0xFF, 0xFF, 0x03, 0xCC, 0xFF, 0xFF, 0x03, 0x06,
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	// 0xCE
+	0x00, 0x08, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xC7, 0xFF, 0xFF, 0x03, 0xC3,
+	0xFF, 0xFF, 0x03, 0xC3, 0xFF, 0xFF, 0x03, 0x07, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x08,
+	0x00, 0x00, 0x00,
+	// 0xCF
+	0x00, 0x07, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+	// 0xD0
+	0x00, 0x14, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0,
+	0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0,
+	0x00, 0x00, 0x03, 0xC0, 0x01, 0x80, 0x03, 0x80, 0x01, 0x80, 0x01, 0x80, 0x03, 0xC0, 0x01, 0x00,
+	0x07, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00,
+	0xC0, 0x03, 0x00,
+	// 0xD1
+	0x00, 0x11, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x03, 0x00, 0x00, 0x0E, 0x0F, 0x00, 0x00, 0x07, 0x1E, 0x00, 0x00, 0x03, 0x78, 0x00, 0x00, 0x03,
+	0xF0, 0x01, 0x00, 0x06, 0xC0, 0x03, 0x00, 0x06, 0x80, 0x0F, 0x00, 0x0C, 0x00, 0x1E, 0x00, 0x0C,
+	0x00, 0x78, 0x00, 0x0E, 0x00, 0xF0, 0x01, 0x07, 0x00, 0xC0, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// 0xD2
+	0x00, 0x15, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+	0x1F, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x01, 0xC2,
+	0x00, 0x80, 0x03, 0xC2, 0x00, 0x00, 0x03, 0xC6, 0x00, 0x00, 0x03, 0xCC, 0x00, 0x00, 0x03, 0xC8,
+	0x00, 0x00, 0x03, 0xC8, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x01, 0x80, 0x01, 0x80,
+	0x03, 0xC0, 0x01, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+	0xF8, 0x1F, 0x00, 0x00, 0xC0, 0x01, 0x00,
+	// 0xD3
+	0x00, 0x15, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+	0x1F, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x01, 0xC0,
+	0x00, 0x80, 0x03, 0xC8, 0x00, 0x00, 0x03, 0xC8, 0x00, 0x00, 0x03, 0xCC, 0x00, 0x00, 0x03, 0xC6,
+	0x00, 0x00, 0x03, 0xC2, 0x00, 0x00, 0x03, 0xC2, 0x00, 0x00, 0x03, 0x80, 0x01, 0x80, 0x01, 0x80,
+	0x03, 0xC0, 0x01, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+	0xF8, 0x1F, 0x00, 0x00, 0xC0, 0x01, 0x00,
+	// 0xD4
+	0x00, 0x15, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+	0x1F, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x88, 0x01, 0x80, 0x01, 0xCC,
+	0x00, 0x80, 0x03, 0xC6, 0x00, 0x00, 0x03, 0xC7, 0x00, 0x00, 0x03, 0xC3, 0x00, 0x00, 0x03, 0xC3,
+	0x00, 0x00, 0x03, 0xC7, 0x00, 0x00, 0x03, 0xCC, 0x00, 0x00, 0x03, 0x88, 0x01, 0x80, 0x01, 0x80,
+	0x03, 0xC0, 0x01, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+	0xF8, 0x1F, 0x00, 0x00, 0xC0, 0x01, 0x00,
+	// 0xD5
+	0x00, 0x15, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+	0x1F, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x8E, 0x01, 0x80, 0x01, 0xC7,
+	0x00, 0x80, 0x03, 0xC3, 0x00, 0x00, 0x03, 0xC3, 0x00, 0x00, 0x03, 0xC6, 0x00, 0x00, 0x03, 0xC6,
+	0x00, 0x00, 0x03, 0xCC, 0x00, 0x00, 0x03, 0xCC, 0x00, 0x00, 0x03, 0x8E, 0x01, 0x80, 0x01, 0x87,
+	0x03, 0xC0, 0x01, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+	0xF8, 0x1F, 0x00, 0x00, 0xC0, 0x01, 0x00,
+	// 0xD6
+	0x00, 0x15, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+	0x1F, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x01, 0xCC,
+	0x00, 0x80, 0x03, 0xCC, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+	0x00, 0x00, 0x03, 0xCC, 0x00, 0x00, 0x03, 0xCC, 0x00, 0x00, 0x03, 0x80, 0x01, 0x80, 0x01, 0x80,
+	0x03, 0xC0, 0x01, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+	0xF8, 0x1F, 0x00, 0x00, 0xC0, 0x01, 0x00,
+	// 0xD7
+	0x00, 0x0D, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x1C, 0x70, 0x00, 0x00, 0x38, 0x38, 0x00, 0x00,
+	0x70, 0x1C, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00,
+	0xC0, 0x07, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x70, 0x1C, 0x00, 0x00, 0x38, 0x38, 0x00, 0x00,
+	0x1C, 0x70, 0x00, 0x00, 0x08, 0x20, 0x00,
+	// 0xD8
+	0x00, 0x15, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF8, 0x1F, 0x02, 0x00, 0xFE, 0x7F, 0x03, 0x00,
+	0x1F, 0xF8, 0x03, 0x00, 0x07, 0xE0, 0x00, 0x80, 0x03, 0xF0, 0x01, 0x80, 0x01, 0xB8, 0x01, 0xC0,
+	0x00, 0x9C, 0x03, 0xC0, 0x00, 0x0E, 0x03, 0xC0, 0x00, 0x07, 0x03, 0xC0, 0xC0, 0x03, 0x03, 0xC0,
+	0xE0, 0x00, 0x03, 0xC0, 0x70, 0x00, 0x03, 0xC0, 0x39, 0x00, 0x03, 0x80, 0x1D, 0x80, 0x01, 0x80,
+	0x0F, 0xC0, 0x01, 0x00, 0x07, 0xE0, 0x00, 0xC0, 0x1F, 0xF8, 0x00, 0xE0, 0xFE, 0x7F, 0x00, 0x60,
+	0xF8, 0x1F, 0x00, 0x20, 0xC0, 0x01, 0x00,
+	// 0xD9
+	0x00, 0x11, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x7F, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0xE0, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x03, 0x02, 0x00, 0x00, 0x03, 0x02,
+	0x00, 0x00, 0x03, 0x06, 0x00, 0x00, 0x03, 0x0C, 0x00, 0x00, 0x03, 0x08, 0x00, 0x00, 0x03, 0x08,
+	0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xE0, 0x01, 0xC0, 0xFF, 0xFF, 0x00, 0xC0,
+	0xFF, 0x7F, 0x00, 0xC0, 0xFF, 0x1F, 0x00,
+	// 0xDA
+	0x00, 0x11, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x7F, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0xE0, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x03, 0x08, 0x00, 0x00, 0x03, 0x08,
+	0x00, 0x00, 0x03, 0x0C, 0x00, 0x00, 0x03, 0x06, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x03, 0x02,
+	0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xE0, 0x01, 0xC0, 0xFF, 0xFF, 0x00, 0xC0,
+	0xFF, 0x7F, 0x00, 0xC0, 0xFF, 0x1F, 0x00,
+	// 0xDB
+	0x00, 0x11, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x7F, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0xE0, 0x01, 0x08, 0x00, 0x80, 0x01, 0x0C, 0x00, 0x80, 0x03, 0x06, 0x00, 0x00, 0x03, 0x03,
+	0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x03, 0x06, 0x00, 0x00, 0x03, 0x0C,
+	0x00, 0x80, 0x03, 0x08, 0x00, 0x80, 0x01, 0x00, 0x00, 0xE0, 0x01, 0xC0, 0xFF, 0xFF, 0x00, 0xC0,
+	0xFF, 0x7F, 0x00, 0xC0, 0xFF, 0x1F, 0x00,
+	// 0xDC
+	0x00, 0x11, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x7F, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0xE0, 0x01, 0x00, 0x00, 0x80, 0x01, 0x0C, 0x00, 0x80, 0x03, 0x0C, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x0C, 0x00, 0x00, 0x03, 0x0C,
+	0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xE0, 0x01, 0xC0, 0xFF, 0xFF, 0x00, 0xC0,
+	0xFF, 0x7F, 0x00, 0xC0, 0xFF, 0x1F, 0x00,
+	// 0xDD
+	0x00, 0x11, 0x00, 0x40, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x80,
+	0x0F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x08, 0xF0, 0x01, 0x00, 0x08,
+	0xC0, 0xFF, 0x03, 0x0C, 0x80, 0xFF, 0x03, 0x06, 0xC0, 0xFF, 0x03, 0x02, 0xF0, 0x01, 0x00, 0x02,
+	0x78, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0,
+	0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	// 0xDE
+	0x00, 0x0F, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00,
+	0x0C, 0x30, 0x00, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x0C, 0x30, 0x00, 0x00,
+	0x0C, 0x30, 0x00, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x0C, 0x30, 0x00, 0x00,
+	0x1C, 0x38, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xF0, 0x07, 0x00,
+	// 0xDF
+	0x00, 0x0F, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x80, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80, 0x03, 0x60,
+	0xE0, 0x00, 0x03, 0x60, 0xF0, 0x03, 0x03, 0xE0, 0xB8, 0x03, 0x03, 0xC0, 0x1F, 0x07, 0x03, 0xC0,
+	0x0F, 0x0E, 0x03, 0x00, 0x07, 0xFC, 0x01, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x70, 0x00,
+	// 0xE0
+	0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x30, 0xFC, 0x01, 0x00, 0x38, 0xFE, 0x03, 0x00,
+	0x38, 0x86, 0x03, 0x10, 0x0C, 0x07, 0x03, 0x30, 0x0C, 0x03, 0x03, 0x70, 0x0C, 0x03, 0x03, 0x60,
+	0x0C, 0x03, 0x01, 0xC0, 0x0C, 0x83, 0x01, 0x80, 0x1C, 0xC3, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+	// 0xE1
+	0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x30, 0xFC, 0x01, 0x00, 0x38, 0xFE, 0x03, 0x00,
+	0x38, 0x86, 0x03, 0x00, 0x0C, 0x07, 0x03, 0x80, 0x0C, 0x03, 0x03, 0xC0, 0x0C, 0x03, 0x03, 0x60,
+	0x0C, 0x03, 0x01, 0x30, 0x0C, 0x83, 0x01, 0x30, 0x1C, 0xC3, 0x00, 0x10, 0xF8, 0xFF, 0x00, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+	// 0xE2
+	0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x30, 0xFC, 0x01, 0x80, 0x38, 0xFE, 0x03, 0xC0,
+	0x38, 0x86, 0x03, 0x60, 0x0C, 0x07, 0x03, 0x70, 0x0C, 0x03, 0x03, 0x30, 0x0C, 0x03, 0x03, 0x30,
+	0x0C, 0x03, 0x01, 0x70, 0x0C, 0x83, 0x01, 0xE0, 0x1C, 0xC3, 0x00, 0xC0, 0xF8, 0xFF, 0x00, 0x80,
+	0xF8, 0xFF, 0x03, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+	// 0xE3
+	0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x30, 0xFC, 0x01, 0x00, 0x38, 0xFE, 0x03, 0xE0,
+	0x38, 0x86, 0x03, 0x30, 0x0C, 0x07, 0x03, 0x30, 0x0C, 0x03, 0x03, 0x30, 0x0C, 0x03, 0x03, 0x60,
+	0x0C, 0x03, 0x01, 0xC0, 0x0C, 0x83, 0x01, 0xC0, 0x1C, 0xC3, 0x00, 0xE0, 0xF8, 0xFF, 0x00, 0x70,
+	0xF8, 0xFF, 0x03, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+	// 0xE4
+	0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x30, 0xFC, 0x01, 0x00, 0x38, 0xFE, 0x03, 0xC0,
+	0x38, 0x86, 0x03, 0xC0, 0x0C, 0x07, 0x03, 0x00, 0x0C, 0x03, 0x03, 0x00, 0x0C, 0x03, 0x03, 0x00,
+	0x0C, 0x03, 0x01, 0x00, 0x0C, 0x83, 0x01, 0xC0, 0x1C, 0xC3, 0x00, 0xC0, 0xF8, 0xFF, 0x00, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+	// 0xE5
+	0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x30, 0xFC, 0x01, 0x00, 0x38, 0xFE, 0x03, 0x00,
+	0x38, 0x86, 0x03, 0x7C, 0x0C, 0x07, 0x03, 0xEE, 0x0C, 0x03, 0x03, 0xC6, 0x0C, 0x03, 0x03, 0xC6,
+	0x0C, 0x03, 0x01, 0xC6, 0x0C, 0x83, 0x01, 0x7C, 0x1C, 0xC3, 0x00, 0x38, 0xF8, 0xFF, 0x00, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+	// 0xE6
+	0x00, 0x18, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x30, 0xFC, 0x01, 0x00, 0x38, 0xFE, 0x03, 0x00,
+	0x1C, 0x86, 0x03, 0x00, 0x0C, 0x03, 0x03, 0x00, 0x0C, 0x03, 0x03, 0x00, 0x0C, 0x03, 0x03, 0x00,
+	0x0C, 0x03, 0x03, 0x00, 0x0C, 0x83, 0x01, 0x00, 0x1C, 0xC3, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00,
+	0xF8, 0x7F, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0x38, 0xC6, 0x01, 0x00, 0x1C, 0x86, 0x03, 0x00,
+	0x0C, 0x06, 0x03, 0x00, 0x0C, 0x06, 0x03, 0x00, 0x0C, 0x06, 0x03, 0x00, 0x0C, 0x06, 0x03, 0x00,
+	0x1C, 0x06, 0x03, 0x00, 0x38, 0x86, 0x01, 0x00, 0xF0, 0xC7, 0x01, 0x00, 0xE0, 0xC7, 0x00, 0x00,
+	0x00, 0x07, 0x00,
+	// 0xE7
+	0x00, 0x0D, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00,
+	0x38, 0xC0, 0x01, 0x00, 0x1C, 0x80, 0x03, 0x00, 0x0C, 0x00, 0xC3, 0x00, 0x0C, 0x00, 0xCF, 0x00,
+	0x0C, 0x00, 0xCF, 0x00, 0x0C, 0x00, 0xFB, 0x00, 0x1C, 0x80, 0x73, 0x00, 0x78, 0xC0, 0x01, 0x00,
+	0x70, 0xE0, 0x00, 0x00, 0x60, 0x60, 0x00,
+	// 0xE8
+	0x00, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00,
+	0x38, 0xC6, 0x01, 0x10, 0x1C, 0x86, 0x03, 0x30, 0x0C, 0x06, 0x03, 0x70, 0x0C, 0x06, 0x03, 0x60,
+	0x0C, 0x06, 0x03, 0xC0, 0x0C, 0x06, 0x03, 0x80, 0x1C, 0x06, 0x03, 0x00, 0x38, 0x86, 0x01, 0x00,
+	0xF0, 0xC7, 0x01, 0x00, 0xE0, 0xC7, 0x00, 0x00, 0x00, 0x07, 0x00,
+	// 0xE9
+	0x00, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00,
+	0x38, 0xC6, 0x01, 0x00, 0x1C, 0x86, 0x03, 0x80, 0x0C, 0x06, 0x03, 0xC0, 0x0C, 0x06, 0x03, 0x60,
+	0x0C, 0x06, 0x03, 0x30, 0x0C, 0x06, 0x03, 0x30, 0x1C, 0x06, 0x03, 0x10, 0x38, 0x86, 0x01, 0x00,
+	0xF0, 0xC7, 0x01, 0x00, 0xE0, 0xC7, 0x00, 0x00, 0x00, 0x07, 0x00,
+	// 0xEA
+	0x00, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x80, 0xF0, 0xFF, 0x00, 0xC0,
+	0x38, 0xC6, 0x01, 0x60, 0x1C, 0x86, 0x03, 0x70, 0x0C, 0x06, 0x03, 0x30, 0x0C, 0x06, 0x03, 0x30,
+	0x0C, 0x06, 0x03, 0x70, 0x0C, 0x06, 0x03, 0xE0, 0x1C, 0x06, 0x03, 0xC0, 0x38, 0x86, 0x01, 0x80,
+	0xF0, 0xC7, 0x01, 0x00, 0xE0, 0xC7, 0x00, 0x00, 0x00, 0x07, 0x00,
+	// 0xEB
+	0x00, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00,
+	0x38, 0xC6, 0x01, 0xC0, 0x1C, 0x86, 0x03, 0xC0, 0x0C, 0x06, 0x03, 0x00, 0x0C, 0x06, 0x03, 0x00,
+	0x0C, 0x06, 0x03, 0x00, 0x0C, 0x06, 0x03, 0x00, 0x1C, 0x06, 0x03, 0xC0, 0x38, 0x86, 0x01, 0xC0,
+	0xF0, 0xC7, 0x01, 0x00, 0xE0, 0xC7, 0x00, 0x00, 0x00, 0x07, 0x00,
+	// 0xEC
+	0x00, 0x06, 0x00, 0x10, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x70, 0xFC, 0xFF, 0x03, 0x60,
+	0xFC, 0xFF, 0x03, 0xC0, 0xFC, 0xFF, 0x03, 0x80, 0x00, 0x00, 0x00,
+	// 0xED
+	0x00, 0x06, 0x00, 0x80, 0x00, 0x00, 0x00, 0xC0, 0xFC, 0xFF, 0x03, 0x60, 0xFC, 0xFF, 0x03, 0x30,
+	0xFC, 0xFF, 0x03, 0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	// 0xEE
+	0x00, 0x0A, 0x00, 0x80, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x70,
+	0xFC, 0xFF, 0x03, 0x30, 0xFC, 0xFF, 0x03, 0x30, 0xFC, 0xFF, 0x03, 0x70, 0x00, 0x00, 0x00, 0xE0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+	// 0xEF
+	0x00, 0x08, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x00,
+	0xFC, 0xFF, 0x03, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00,
+	// 0xF0
+	0x00, 0x0E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x20,
+	0xE3, 0xC0, 0x01, 0x20, 0x71, 0x80, 0x03, 0x60, 0x31, 0x00, 0x03, 0xC0, 0x31, 0x00, 0x03, 0xC0,
+	0x31, 0x00, 0x03, 0xC0, 0x33, 0x00, 0x03, 0x40, 0x37, 0x80, 0x03, 0x40, 0x7E, 0x80, 0x01, 0x60,
+	0xFC, 0xFF, 0x01, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x80, 0x3F, 0x00,
+	// 0xF1
+	0x00, 0x0C, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0xFC, 0xFF, 0x03, 0xE0, 0xE0, 0xFF, 0x03, 0x30,
+	0x18, 0x00, 0x00, 0x30, 0x08, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x00, 0x60, 0x0C, 0x00, 0x00, 0xC0,
+	0x0C, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0xE0, 0x7C, 0x00, 0x00, 0x70, 0xF8, 0xFF, 0x03, 0x00,
+	0xF0, 0xFF, 0x03,
+	// 0xF2
+	0x00, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00,
+	0x38, 0xC0, 0x01, 0x10, 0x1C, 0x80, 0x03, 0x30, 0x0C, 0x00, 0x03, 0x70, 0x0C, 0x00, 0x03, 0x60,
+	0x0C, 0x00, 0x03, 0xC0, 0x0C, 0x00, 0x03, 0x80, 0x1C, 0x80, 0x03, 0x00, 0x38, 0xC0, 0x01, 0x00,
+	0xF8, 0xFF, 0x01, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x80, 0x1F, 0x00,
+	// 0xF3
+	0x00, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00,
+	0x38, 0xC0, 0x01, 0x00, 0x1C, 0x80, 0x03, 0x80, 0x0C, 0x00, 0x03, 0xC0, 0x0C, 0x00, 0x03, 0x60,
+	0x0C, 0x00, 0x03, 0x30, 0x0C, 0x00, 0x03, 0x30, 0x1C, 0x80, 0x03, 0x10, 0x38, 0xC0, 0x01, 0x00,
+	0xF8, 0xFF, 0x01, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x80, 0x1F, 0x00,
+	// 0xF4
+	0x00, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x80, 0xF8, 0xFF, 0x01, 0xC0,
+	0x38, 0xC0, 0x01, 0x60, 0x1C, 0x80, 0x03, 0x70, 0x0C, 0x00, 0x03, 0x30, 0x0C, 0x00, 0x03, 0x30,
+	0x0C, 0x00, 0x03, 0x70, 0x0C, 0x00, 0x03, 0xE0, 0x1C, 0x80, 0x03, 0xC0, 0x38, 0xC0, 0x01, 0x80,
+	0xF8, 0xFF, 0x01, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x80, 0x1F, 0x00,
+	// 0xF5
+	0x00, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0xE0,
+	0x38, 0xC0, 0x01, 0x30, 0x1C, 0x80, 0x03, 0x30, 0x0C, 0x00, 0x03, 0x30, 0x0C, 0x00, 0x03, 0x60,
+	0x0C, 0x00, 0x03, 0xC0, 0x0C, 0x00, 0x03, 0xC0, 0x1C, 0x80, 0x03, 0xE0, 0x38, 0xC0, 0x01, 0x70,
+	0xF8, 0xFF, 0x01, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x80, 0x1F, 0x00,
+	// 0xF6
+	0x00, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00,
+	0x38, 0xC0, 0x01, 0xC0, 0x1C, 0x80, 0x03, 0xC0, 0x0C, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x03, 0x00,
+	0x0C, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x1C, 0x80, 0x03, 0xC0, 0x38, 0xC0, 0x01, 0xC0,
+	0xF8, 0xFF, 0x01, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x80, 0x1F, 0x00,
+	// 0xF7
+	0x00, 0x0E, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+	0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x9C, 0x39, 0x00, 0x00,
+	0x9C, 0x39, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+	0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00,
+	// 0xF8
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x1F, 0x03, 0x00, 0xF0, 0xFF, 0x03, 0x00,
+	0xF8, 0xFF, 0x01, 0x00, 0x38, 0xE0, 0x01, 0x00, 0x1C, 0xB8, 0x03, 0x00, 0x0C, 0x1C, 0x03, 0x00,
+	0x0C, 0x0E, 0x03, 0x00, 0x0C, 0x07, 0x03, 0x00, 0x8C, 0x03, 0x03, 0x00, 0xDC, 0x81, 0x03, 0x00,
+	0x78, 0xC0, 0x01, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0xCC, 0x3F, 0x00, 0x00,
+	0x04, 0x00, 0x00,
+	// 0xF9
+	0x00, 0x0C, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x00, 0x00, 0xE0, 0x03, 0x10,
+	0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x03, 0x70, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x03, 0xC0,
+	0x00, 0x80, 0x01, 0x80, 0x00, 0x80, 0x01, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x00,
+	0xFC, 0xFF, 0x03,
+	// 0xFA
+	0x00, 0x0C, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x00, 0x00, 0xE0, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x03, 0x30,
+	0x00, 0x80, 0x01, 0x30, 0x00, 0x80, 0x01, 0x10, 0xFC, 0x7F, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x00,
+	0xFC, 0xFF, 0x03,
+	// 0xFB
+	0x00, 0x0C, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x80, 0xFC, 0xFF, 0x01, 0xC0, 0x00, 0xE0, 0x03, 0x60,
+	0x00, 0x00, 0x03, 0x70, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x03, 0x70,
+	0x00, 0x80, 0x01, 0xE0, 0x00, 0x80, 0x01, 0xC0, 0xFC, 0x7F, 0x00, 0x80, 0xFC, 0xFF, 0x03, 0x00,
+	0xFC, 0xFF, 0x03,
+	// 0xFC
+	0x00, 0x0C, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0xC0, 0x00, 0xE0, 0x03, 0xC0,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x80, 0x01, 0xC0, 0x00, 0x80, 0x01, 0xC0, 0xFC, 0x7F, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x00,
+	0xFC, 0xFF, 0x03,
+	// 0xFD
+	0x00, 0x0D, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xC0, 0x00, 0xFC, 0x01, 0xC0, 0x00,
+	0xF0, 0x0F, 0xE0, 0x80, 0x00, 0x7F, 0x70, 0xC0, 0x00, 0xF8, 0x7F, 0x60, 0x00, 0x80, 0x1F, 0x30,
+	0x00, 0xF0, 0x07, 0x30, 0x00, 0xFF, 0x00, 0x10, 0xE0, 0x1F, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00,
+	0x3C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+	// 0xFE
+	0x00, 0x0D, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x00, 0xE0, 0x79, 0x00, 0x00,
+	0x18, 0x80, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x03, 0x00,
+	0x0C, 0x00, 0x03, 0x00, 0x1C, 0x80, 0x03, 0x00, 0x3C, 0xC0, 0x03, 0x00, 0xF8, 0xFF, 0x01, 0x00,
+	0xF0, 0xFF, 0x00, 0x00, 0x80, 0x1F, 0x00,
+	// 0xFF
+	0x00, 0x0D, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xC0, 0x00, 0xFC, 0x01, 0xC0, 0xC0,
+	0xF0, 0x0F, 0xE0, 0xC0, 0x00, 0x7F, 0x70, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x80, 0x1F, 0x00,
+	0x00, 0xF0, 0x07, 0x00, 0x00, 0xFF, 0x00, 0xC0, 0xE0, 0x1F, 0x00, 0xC0, 0xFC, 0x03, 0x00, 0x00,
+	0x3C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+	// U+0384
+	0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x70,
+	0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	// U+0385
+	0x00, 0x08, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x0C,
+	0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0xE1, 0x00, 0x00, 0x00, 0xE0,
+	0x00, 0x00, 0x00,
+	// U+0386
+	0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0xC0, 0x03, 0x80, 0x01, 0xF8, 0x03, 0xE0,
+	0x00, 0xFE, 0x00, 0x70, 0xC0, 0x1F, 0x00, 0x30, 0xF0, 0x1F, 0x00, 0x10, 0xFE, 0x18, 0x00, 0xC0,
+	0x1F, 0x18, 0x00, 0xC0, 0x03, 0x18, 0x00, 0xC0, 0x03, 0x18, 0x00, 0xC0, 0x0F, 0x18, 0x00, 0x00,
+	0x7F, 0x18, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
+	0x00, 0xF8, 0x03, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x03,
+	// U+0387
+	0x00, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00,
+	// U+0388
+	0x00, 0x13, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x70,
+	0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0,
+	0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0,
+	0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0x00, 0x00, 0x03,
+	// U+0389
+	0x00, 0x15, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x70,
+	0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00,
+	0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00,
+	0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// U+038A
+	0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x70,
+	0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// U+038C
+	0x00, 0x15, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xC0, 0xE1, 0x07, 0x00, 0x70,
+	0xFC, 0x3F, 0x00, 0x30, 0xFE, 0x7F, 0x00, 0x10, 0x1F, 0xF8, 0x00, 0x80, 0x07, 0xE0, 0x01, 0xC0,
+	0x01, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+	0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x01, 0x80, 0x03, 0xC0,
+	0x01, 0x80, 0x03, 0x80, 0x03, 0xC0, 0x01, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+	0xFC, 0x3F, 0x00, 0x00, 0xE0, 0x07, 0x00,
+	// U+038E
+	0x00, 0x17, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x70,
+	0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
+	0x3C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0xC0, 0xFF, 0x03, 0x00,
+	0xE0, 0xFF, 0x03, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x80,
+	0x07, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	// U+038F
+	0x00, 0x15, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xC0, 0x81, 0x00, 0x03, 0x70,
+	0xF8, 0x0F, 0x03, 0x30, 0xFE, 0x1F, 0x03, 0x10, 0x1F, 0x7E, 0x03, 0x80, 0x07, 0xF0, 0x03, 0x80,
+	0x03, 0xE0, 0x03, 0xC0, 0x01, 0xC0, 0x03, 0xC0, 0x00, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x03, 0xC0,
+	0x01, 0xC0, 0x03, 0x80, 0x03, 0xE0, 0x03, 0x00, 0x0F, 0xF8, 0x03, 0x00, 0xFE, 0x3F, 0x03, 0x00,
+	0xFC, 0x1F, 0x03, 0x00, 0xF0, 0x03, 0x03,
+	// U+0390
+	0x00, 0x08, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0xF8, 0x3F, 0x00, 0x0C,
+	0xF8, 0xFF, 0x01, 0x0E, 0xF8, 0xFF, 0x01, 0xE7, 0x00, 0x80, 0x03, 0xE1, 0x00, 0x00, 0x03, 0xE0,
+	0x00, 0x00, 0x03,
+	// U+0391
+	0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF8, 0x03, 0x00,
+	0x00, 0xFE, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xFE, 0x18, 0x00, 0xC0,
+	0x1F, 0x18, 0x00, 0xC0, 0x03, 0x18, 0x00, 0xC0, 0x03, 0x18, 0x00, 0xC0, 0x0F, 0x18, 0x00, 0x00,
+	0x7F, 0x18, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
+	0x00, 0xF8, 0x03, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x03,
+	// U+0392
+	0x00, 0x0E, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xC0, 0x00, 0x03, 0xC0, 0xC0, 0x00, 0x03, 0xC0, 0xC0, 0x00, 0x03, 0xC0, 0xC0, 0x00, 0x03, 0xC0,
+	0xC0, 0x00, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC1, 0x81, 0x03, 0x80, 0xF3, 0x83, 0x03, 0x80,
+	0x7F, 0xFF, 0x01, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x7C, 0x00,
+	// U+0393
+	0x00, 0x0C, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00,
+	// U+0394
+	0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF8, 0x03, 0x00,
+	0x00, 0xFE, 0x03, 0x00, 0xC0, 0x1F, 0x03, 0x00, 0xF0, 0x07, 0x03, 0x00, 0xFE, 0x00, 0x03, 0xC0,
+	0x1F, 0x00, 0x03, 0xC0, 0x03, 0x00, 0x03, 0xC0, 0x03, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x03, 0x00,
+	0x7F, 0x00, 0x03, 0x00, 0xF8, 0x03, 0x03, 0x00, 0xE0, 0x1F, 0x03, 0x00, 0x00, 0xFF, 0x03, 0x00,
+	0x00, 0xF8, 0x03, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x03,
+	// U+0395
+	0x00, 0x0D, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0,
+	0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0,
+	0xC0, 0x01, 0x03, 0xC0, 0x00, 0x00, 0x03,
+	// U+0396
+	0x00, 0x10, 0x00, 0xC0, 0x00, 0x80, 0x03, 0xC0, 0x00, 0xC0, 0x03, 0xC0, 0x00, 0xE0, 0x03, 0xC0,
+	0x00, 0xF0, 0x03, 0xC0, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x1E, 0x03, 0xC0, 0x00, 0x0F, 0x03, 0xC0,
+	0x80, 0x07, 0x03, 0xC0, 0xE0, 0x01, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0x78, 0x00, 0x03, 0xC0,
+	0x3C, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x03, 0xC0, 0x07, 0x00, 0x03, 0xC0, 0x03, 0x00, 0x03, 0xC0,
+	0x01, 0x00, 0x03,
+	// U+0397
+	0x00, 0x0F, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00,
+	0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00,
+	0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00,
+	0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// U+0398
+	0x00, 0x12, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00,
+	0x0F, 0xF0, 0x00, 0x80, 0x03, 0xC0, 0x01, 0xC0, 0xC1, 0x81, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0,
+	0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0,
+	0xC0, 0x01, 0x03, 0xC0, 0xC1, 0x81, 0x03, 0x80, 0xC3, 0xC0, 0x01, 0x80, 0x07, 0xE0, 0x01, 0x00,
+	0x3F, 0xFC, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xF8, 0x1F, 0x00,
+	// U+0399
+	0x00, 0x03, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// U+039A
+	0x00, 0x0F, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00,
+	0xC0, 0x01, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00,
+	0x1C, 0x1C, 0x00, 0x00, 0x0E, 0x38, 0x00, 0x00, 0x07, 0x70, 0x00, 0x80, 0x03, 0xE0, 0x00, 0xC0,
+	0x01, 0xC0, 0x01, 0xC0, 0x01, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x02,
+	// U+039B
+	0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF8, 0x03, 0x00,
+	0x00, 0xFE, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xC0,
+	0x1F, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00,
+	0x7F, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
+	0x00, 0xF8, 0x03, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x03,
+	// U+039C
+	0x00, 0x12, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x07, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00,
+	0x80, 0x1F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
+	0xE0, 0x0F, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0xC0,
+	0x03, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// U+039D
+	0x00, 0x0F, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x07, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00,
+	0xE0, 0x03, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+	0x00, 0xE0, 0x03, 0x00, 0x00, 0xE0, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// U+039E
+	0x00, 0x0C, 0x00, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x80, 0x00, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0,
+	0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0,
+	0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x00, 0x03, 0xC0,
+	0x00, 0x00, 0x03,
+	// U+039F
+	0x00, 0x12, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00,
+	0x0F, 0xF0, 0x00, 0x80, 0x03, 0xC0, 0x01, 0xC0, 0x01, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+	0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+	0x00, 0x00, 0x03, 0xC0, 0x01, 0x80, 0x03, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x07, 0xE0, 0x01, 0x00,
+	0x3F, 0xFC, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xF8, 0x1F, 0x00,
+	// U+03A0
+	0x00, 0x0F, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// U+03A1
+	0x00, 0x0D, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0,
+	0x00, 0x03, 0x00, 0xC0, 0x81, 0x03, 0x00, 0x80, 0xC3, 0x01, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00,
+	0xFF, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
+	// U+03A3
+	0x00, 0x0D, 0x00, 0xC0, 0x01, 0x80, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xF0, 0x03, 0xC0,
+	0x0F, 0xF8, 0x03, 0xC0, 0x1C, 0x3C, 0x03, 0xC0, 0x38, 0x1E, 0x03, 0xC0, 0xF0, 0x07, 0x03, 0xC0,
+	0xE0, 0x03, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+	0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03,
+	// U+03A4
+	0x00, 0x11, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,
+	// U+03A5
+	0x00, 0x11, 0x00, 0x40, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x80,
+	0x07, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+	0xE0, 0xFF, 0x03, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x78, 0x00, 0x00, 0x00,
+	0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	// U+03A6
+	0x00, 0x12, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00,
+	0x1C, 0x38, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
+	0x07, 0xC0, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00,
+	0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00,
+	0x7C, 0x3E, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xF0, 0x0F, 0x00,
+	// U+03A7
+	0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xC0, 0x03, 0xC0,
+	0x03, 0xE0, 0x01, 0x80, 0x07, 0xF8, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00,
+	0xF0, 0x07, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x78, 0x0F, 0x00, 0x00,
+	0x3E, 0x3E, 0x00, 0x00, 0x0F, 0x78, 0x00, 0xC0, 0x07, 0xE0, 0x01, 0xC0, 0x01, 0xC0, 0x03, 0xC0,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02,
+	// U+03A8
+	0x00, 0x13, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0x00,
+	0x80, 0x0F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
+	0x00, 0x38, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00,
+	0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00,
+	0xC0, 0x0F, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0xC0, 0xFF, 0x01, 0x00, 0xC0, 0x0F, 0x00, 0x00,
+	// U+03A9
+	0x00, 0x13, 0x00, 0x00, 0xE0, 0x03, 0x03, 0x00, 0xFC, 0x0F, 0x03, 0x00, 0xFE, 0x3F, 0x03, 0x00,
+	0x0F, 0x7C, 0x03, 0x80, 0x03, 0xF0, 0x03, 0x80, 0x01, 0xC0, 0x03, 0xC0, 0x01, 0x80, 0x03, 0xC0,
+	0x00, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x80, 0x03, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x01, 0xE0, 0x03, 0x80, 0x07, 0xF0, 0x03, 0x00,
+	0x1F, 0x7C, 0x03, 0x00, 0xFE, 0x3F, 0x03, 0x00, 0xFC, 0x0F, 0x03, 0x00, 0xE0, 0x01, 0x03,
+	// U+03AA
+	0x00, 0x08, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xC0,
+	0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E,
+	0x00, 0x00, 0x00,
+	// U+03AB
+	0x00, 0x11, 0x00, 0x40, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x80,
+	0x07, 0x00, 0x00, 0x06, 0x1F, 0x00, 0x00, 0x0E, 0x3C, 0x00, 0x00, 0x0E, 0xF8, 0x00, 0x00, 0x00,
+	0xE0, 0xFF, 0x03, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0xE0, 0xFF, 0x03, 0x0E, 0x78, 0x00, 0x00, 0x0E,
+	0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	// U+03AC
+	0x00, 0x0F, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00,
+	0x38, 0x80, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x19, 0x00, 0x03, 0x80, 0x19, 0x00, 0x03, 0xC0,
+	0x18, 0x00, 0x03, 0x70, 0x38, 0x80, 0x03, 0x30, 0xF0, 0xF1, 0x01, 0x10, 0xE0, 0xFF, 0x00, 0x00,
+	0xC0, 0xFF, 0x01, 0x00, 0xF8, 0xC3, 0x03, 0x00, 0x78, 0x00, 0x03, 0x00, 0x08, 0x00, 0x03,
+	// U+03AD
+	0x00, 0x0B, 0x00, 0x00, 0x40, 0xF0, 0x00, 0x00, 0xF0, 0xF9, 0x01, 0x00, 0xF8, 0xDF, 0x03, 0x00,
+	0x38, 0x0F, 0x03, 0x00, 0x18, 0x06, 0x03, 0x80, 0x19, 0x06, 0x03, 0xC0, 0x19, 0x06, 0x03, 0xE0,
+	0x18, 0x06, 0x03, 0x70, 0x18, 0x00, 0x03, 0x10, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03,
+	// U+03AE
+	0x00, 0x0D, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF0, 0x01, 0x00, 0x00,
+	0x30, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x80, 0x19, 0x00, 0x00, 0xC0,
+	0x19, 0x00, 0x00, 0xE0, 0x18, 0x00, 0x00, 0x30, 0x38, 0x00, 0x00, 0x10, 0xF0, 0xFF, 0xFF, 0x00,
+	0xE0, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x7F,
+	// U+03AF
+	0x00, 0x06, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x80, 0xF9, 0xFF, 0x01, 0xC0, 0xF9, 0xFF, 0x03, 0xE0,
+	0x00, 0x00, 0x03, 0x70, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03,
+	// U+03B0
+	0x00, 0x0C, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0xE0, 0xF8, 0xFF, 0x01, 0xE0, 0xF8, 0xFF, 0x03, 0xE0,
+	0x00, 0x00, 0x03, 0x08, 0x00, 0x00, 0x03, 0x0E, 0x00, 0x00, 0x03, 0x47, 0x00, 0x00, 0x03, 0xE3,
+	0x00, 0x80, 0x03, 0xE1, 0x08, 0xC0, 0x01, 0x00, 0x38, 0xF8, 0x01, 0x00, 0xF8, 0x7F, 0x00, 0x00,
+	0xE0, 0x3F, 0x00,
+	// U+03B1
+	0x00, 0x0F, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00,
+	0x38, 0x80, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00,
+	0x18, 0x00, 0x03, 0x00, 0x38, 0x80, 0x03, 0x00, 0xF0, 0xF1, 0x01, 0x00, 0xE0, 0xFF, 0x00, 0x00,
+	0xC0, 0xFF, 0x01, 0x00, 0xF8, 0xC3, 0x03, 0x00, 0x78, 0x00, 0x03, 0x00, 0x08, 0x00, 0x03,
+	// U+03B2
+	0x00, 0x0D, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xC0, 0x03, 0xE0,
+	0x00, 0x80, 0x03, 0x60, 0xC0, 0x00, 0x03, 0x60, 0xC0, 0x01, 0x03, 0x60, 0xC0, 0x01, 0x03, 0x60,
+	0xE0, 0x01, 0x03, 0xE0, 0xF0, 0x01, 0x03, 0xC0, 0xFF, 0x83, 0x03, 0x80, 0x3F, 0xFF, 0x01, 0x00,
+	0x04, 0xFF, 0x00, 0x00, 0x00, 0x7C, 0x00,
+	// U+03B3
+	0x00, 0x0F, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+	0xF0, 0x03, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x7F, 0x00,
+	0x00, 0xC0, 0xFF, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x3F, 0x00, 0x00,
+	0xE0, 0x0F, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+	// U+03B4
+	0x00, 0x0E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xC2, 0xFF, 0x00, 0x80, 0xE7, 0xFF, 0x01, 0xC0,
+	0x7F, 0xC0, 0x03, 0xC0, 0x1C, 0x00, 0x03, 0xC0, 0x18, 0x00, 0x03, 0xC0, 0x18, 0x00, 0x03, 0xC0,
+	0x18, 0x00, 0x03, 0xC0, 0x38, 0x00, 0x03, 0xC0, 0x30, 0x80, 0x03, 0xC0, 0xF0, 0xC0, 0x01, 0xC0,
+	0xE0, 0xFF, 0x01, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0x00,
+	// U+03B5
+	0x00, 0x0B, 0x00, 0x00, 0x40, 0xF0, 0x00, 0x00, 0xF0, 0xF9, 0x01, 0x00, 0xF8, 0xDF, 0x03, 0x00,
+	0x38, 0x0F, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00,
+	0x18, 0x06, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03,
+	// U+03B6
+	0x00, 0x0C, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xE0, 0xE0, 0xFF, 0x00, 0xE0, 0xF0, 0xFF, 0x01, 0xE0,
+	0x78, 0xC0, 0x01, 0xE0, 0x1C, 0x80, 0x03, 0xE0, 0x0E, 0x00, 0x03, 0xE0, 0x07, 0x00, 0x03, 0xE0,
+	0x07, 0x00, 0x03, 0xE0, 0x03, 0x00, 0xC3, 0xE0, 0x01, 0x00, 0xE6, 0xE0, 0x01, 0x00, 0x7E, 0xE0,
+	0x00, 0x00, 0x3C,
+	// U+03B7
+	0x00, 0x0D, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF0, 0x01, 0x00, 0x00,
+	0x30, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x00,
+	0xE0, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x7F,
+	// U+03B8
+	0x00, 0x0E, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x80, 0xFF, 0xFF, 0x00, 0xC0,
+	0xC3, 0xC1, 0x01, 0xE0, 0xC0, 0x81, 0x03, 0x60, 0xC0, 0x01, 0x03, 0x60, 0xC0, 0x01, 0x03, 0x60,
+	0xC0, 0x01, 0x03, 0x60, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x81, 0x03, 0xC0, 0xC3, 0xE1, 0x01, 0x80,
+	0xFF, 0xFF, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0xF0, 0x07, 0x00,
+	// U+03B9
+	0x00, 0x06, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+	// U+03BA
+	0x00, 0x0D, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0x00, 0x07, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0xE0, 0x1E, 0x00, 0x00,
+	0x70, 0x78, 0x00, 0x00, 0x38, 0xF0, 0x00, 0x00, 0x18, 0xE0, 0x01, 0x00, 0x08, 0x80, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02,
+	// U+03BB
+	0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x03, 0x60, 0x00, 0xE0, 0x03, 0x60,
+	0x00, 0xFC, 0x00, 0xE0, 0x00, 0x3F, 0x00, 0xE0, 0xC1, 0x0F, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0x80,
+	0xFF, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00,
+	0x00, 0xFC, 0x01, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x80, 0x03,
+	// U+03BC
+	0x00, 0x0E, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x00, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0xE0, 0x01, 0x00,
+	0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00, 0xF8, 0xFF, 0x01, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x03,
+	// U+03BD
+	0x00, 0x0D, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00,
+	0xC0, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00,
+	0x00, 0xC0, 0x03, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x18, 0xF0, 0x00, 0x00, 0xF8, 0x3E, 0x00, 0x00,
+	0xF0, 0x1F, 0x00, 0x00, 0xC0, 0x07, 0x00,
+	// U+03BE
+	0x00, 0x0C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xE0, 0x3E, 0xFE, 0x00, 0xE0, 0x7F, 0xFF, 0x01, 0xE0,
+	0x63, 0x83, 0x03, 0xE0, 0xE1, 0x01, 0x03, 0xE0, 0xC0, 0x01, 0x03, 0xE0, 0xC0, 0x01, 0x03, 0xE0,
+	0xC0, 0x01, 0x03, 0xE0, 0xC0, 0x01, 0xC3, 0xE0, 0xC0, 0x01, 0xE7, 0xE0, 0x00, 0x00, 0x7E, 0x00,
+	0x00, 0x00, 0x3C,
+	// U+03BF
+	0x00, 0x0E, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00,
+	0x78, 0xC0, 0x03, 0x00, 0x38, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00,
+	0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x38, 0x80, 0x03, 0x00, 0x70, 0xC0, 0x01, 0x00,
+	0xF0, 0xFF, 0x01, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0x00,
+	// U+03C0
+	0x00, 0x0F, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0x38, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0x38, 0x80, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02,
+	// U+03C1
+	0x00, 0x0D, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x00, 0xE0, 0xFF, 0xFF, 0x00, 0xF0, 0xFB, 0x01, 0x00,
+	0x38, 0x80, 0x01, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00,
+	0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x38, 0x80, 0x03, 0x00, 0xF0, 0xE0, 0x01, 0x00,
+	0xE0, 0xFF, 0x00, 0x00, 0xC0, 0x7F, 0x00,
+	// U+03C2
+	0x00, 0x0C, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00,
+	0x70, 0xC0, 0x01, 0x00, 0x38, 0x80, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00,
+	0x18, 0x00, 0xC3, 0x00, 0x18, 0x00, 0xE7, 0x00, 0x18, 0x00, 0x7E, 0x00, 0x18, 0x00, 0x7E, 0x00,
+	0x38, 0x00, 0x18,
+	// U+03C3
+	0x00, 0x0F, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00,
+	0x70, 0xC0, 0x03, 0x00, 0x38, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00,
+	0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x38, 0x80, 0x03, 0x00, 0x78, 0xC0, 0x01, 0x00,
+	0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x18, 0x1F, 0x00, 0x00, 0x18, 0x00, 0x00,
+	// U+03C4
+	0x00, 0x0E, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00,
+	0xF8, 0xFF, 0x01, 0x00, 0x38, 0x80, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00,
+	0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+	// U+03C5
+	0x00, 0x0C, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x80, 0x03, 0x00, 0x08, 0xC0, 0x01, 0x00, 0x38, 0xF8, 0x01, 0x00, 0xF8, 0x7F, 0x00, 0x00,
+	0xE0, 0x3F, 0x00,
+	// U+03C6
+	0x00, 0x0F, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00,
+	0x70, 0xC0, 0x03, 0x00, 0x38, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0xE0, 0xFF, 0x7F, 0x00,
+	0xF0, 0xFF, 0xFF, 0x00, 0xF8, 0xFF, 0xFF, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x80, 0x03, 0x00,
+	0x78, 0xC0, 0x03, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x80, 0x3F, 0x00,
+	// U+03C7
+	0x00, 0x0E, 0x00, 0x00, 0x18, 0x00, 0x80, 0x00, 0x18, 0x00, 0xE0, 0x00, 0x38, 0x00, 0xF8, 0x00,
+	0x70, 0x00, 0x7E, 0x00, 0xF0, 0x03, 0x1F, 0x00, 0xC0, 0xCF, 0x07, 0x00, 0x00, 0xFE, 0x01, 0x00,
+	0x00, 0xFC, 0x01, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0xC0, 0x0F, 0x3F, 0x00, 0xE0, 0x03, 0x78, 0x00,
+	0xF8, 0x00, 0x60, 0x00, 0x38, 0x00, 0xE0, 0x00, 0x08, 0x00, 0xC0,
+	// U+03C8
+	0x00, 0x0F, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00,
+	0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0xF8, 0xFF, 0x7F, 0x00,
+	0xF8, 0xFF, 0xFF, 0x00, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x80, 0x03, 0x00, 0x00, 0xF0, 0x01, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0xF8, 0x7F, 0x00,
+	// U+03C9
+	0x00, 0x13, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00,
+	0x38, 0x80, 0x03, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x80, 0x03, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00,
+	0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x18, 0x80, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0xC0, 0x7F, 0x00,
+	// U+03CA
+	0x00, 0x08, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0xF8, 0x3F, 0x00, 0x00,
+	0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x01, 0xE0, 0x00, 0x80, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0,
+	0x00, 0x00, 0x03,
+	// U+03CB
+	0x00, 0x0C, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0xE0, 0xF8, 0xFF, 0x01, 0xE0, 0xF8, 0xFF, 0x03, 0xE0,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0xE0,
+	0x00, 0x80, 0x03, 0xE0, 0x08, 0xC0, 0x01, 0x00, 0x38, 0xF8, 0x01, 0x00, 0xF8, 0x7F, 0x00, 0x00,
+	0xE0, 0x3F, 0x00,
+	// U+03CC
+	0x00, 0x0E, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00,
+	0x78, 0xC0, 0x03, 0x00, 0x38, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x80, 0x19, 0x00, 0x03, 0xC0,
+	0x19, 0x00, 0x03, 0xE0, 0x18, 0x00, 0x03, 0x30, 0x38, 0x80, 0x03, 0x10, 0x70, 0xC0, 0x01, 0x00,
+	0xF0, 0xFF, 0x01, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0x00,
+	// U+03CD
+	0x00, 0x0C, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0xC0, 0x01, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0x70,
+	0x00, 0x80, 0x03, 0x30, 0x08, 0xC0, 0x01, 0x00, 0x38, 0xF8, 0x01, 0x00, 0xF8, 0x7F, 0x00, 0x00,
+	0xE0, 0x3F, 0x00,
+	// U+03CE
+	0x00, 0x13, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00,
+	0x38, 0x80, 0x03, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x80, 0x03, 0x00, 0x01, 0xFC, 0x01, 0x80, 0x01, 0xFE, 0x00, 0xE0, 0x00, 0xFE, 0x01, 0x70,
+	0x00, 0x80, 0x03, 0x30, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x18, 0x80, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0xC0, 0x7F, 0x00,
+	// U+0400
+	0x00, 0x0D, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC2, 0xC0, 0x01, 0x03, 0xC6, 0xC0, 0x01, 0x03, 0xCC,
+	0xC0, 0x01, 0x03, 0xC8, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0,
+	0xC0, 0x01, 0x03, 0xC0, 0x00, 0x00, 0x03,
+	// U+0401
+	0x00, 0x0D, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC6, 0xFF, 0xFF, 0x03, 0xCE,
+	0xC0, 0x01, 0x03, 0xCE, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0,
+	0xC0, 0x01, 0x03, 0xCE, 0xC0, 0x01, 0x03, 0xCE, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0,
+	0xC0, 0x01, 0x03, 0xC0, 0x00, 0x00, 0x03,
+	// U+0402
+	0x00, 0x14, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xFF, 0xFF, 0x03, 0xC0, 0xC1, 0x01, 0x00, 0xC0, 0xC0, 0x01, 0x00, 0xC0, 0xC0, 0x01, 0x00, 0xC0,
+	0xC0, 0x01, 0x00, 0xC0, 0xC0, 0x01, 0x00, 0xC0, 0xC0, 0x01, 0xE0, 0xC0, 0xC0, 0x01, 0x60, 0xC0,
+	0xC0, 0x01, 0x60, 0x00, 0x80, 0x03, 0x78, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0x1F, 0x00,
+	0x00, 0xF0, 0x03,
+	// U+0403
+	0x00, 0x0C, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0xC6,
+	0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00,
+	// U+0404
+	0x00, 0x10, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+	0x8F, 0xF1, 0x00, 0x80, 0x83, 0xC1, 0x01, 0xC0, 0x81, 0x81, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0,
+	0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0,
+	0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x81, 0x81, 0x03, 0x80, 0x01, 0x80, 0x01, 0x80,
+	0x03, 0xC0, 0x01,
+	// U+0405
+	0x00, 0x0E, 0x00, 0x00, 0x3E, 0x80, 0x01, 0x00, 0x7F, 0x80, 0x03, 0x80, 0xFF, 0x80, 0x03, 0xC0,
+	0xE1, 0x00, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0,
+	0xC0, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x03, 0x03, 0xC0, 0x80, 0x87, 0x03, 0xC0,
+	0x01, 0xFF, 0x01, 0x80, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x7C, 0x00,
+	// U+0406
+	0x00, 0x03, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// U+0407
+	0x00, 0x08, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xC0,
+	0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E,
+	0x00, 0x00, 0x00,
+	// U+0408
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00,
+	0x00, 0x00, 0x70, 0xC0, 0xFF, 0xFF, 0x7F, 0xC0, 0xFF, 0xFF, 0x3F, 0xC0, 0xFF, 0xFF, 0x0F,
+	// U+0409
+	0x00, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0xC0, 0x01, 0x00,
+	0x00, 0xE0, 0x01, 0x00, 0x00, 0xFE, 0x00, 0xC0, 0xFF, 0x7F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0,
+	0x3F, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00,
+	0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x01, 0x03, 0x00, 0xC0, 0x81, 0x03, 0x00,
+	0x80, 0xC3, 0x01, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7C, 0x00,
+	// U+040A
+	0x00, 0x18, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00,
+	0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00,
+	0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0xC0,
+	0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00,
+	0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x01, 0x03, 0x00,
+	0xC0, 0x81, 0x03, 0x00, 0x80, 0xC3, 0x01, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00,
+	0x00, 0x7E, 0x00,
+	// U+040B
+	0x00, 0x14, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xFF, 0xFF, 0x03, 0xC0, 0xC1, 0x01, 0x00, 0xC0, 0xC0, 0x01, 0x00, 0xC0, 0xC0, 0x01, 0x00, 0xC0,
+	0xC0, 0x01, 0x00, 0xC0, 0xC0, 0x01, 0x00, 0xC0, 0xC0, 0x01, 0x00, 0xC0, 0xC0, 0x01, 0x00, 0xC0,
+	0xC0, 0x01, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0xFF, 0x03, 0x00,
+	0x00, 0xF0, 0x03,
+	// U+040C
+	0x00, 0x10, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00,
+	0x80, 0x07, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x0E,
+	0xF8, 0x01, 0x00, 0x06, 0xFC, 0x07, 0x00, 0x02, 0x0E, 0x0F, 0x00, 0x00, 0x07, 0x3E, 0x00, 0x80,
+	0x03, 0x78, 0x00, 0xC0, 0x01, 0xF0, 0x01, 0xC0, 0x00, 0xC0, 0x03, 0x40, 0x00, 0x80, 0x03, 0x00,
+	0x00, 0x00, 0x02,
+	// U+040D
+	0x00, 0x0F, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00,
+	0x00, 0xE0, 0x03, 0x00, 0x00, 0xF8, 0x00, 0x02, 0x00, 0x3E, 0x00, 0x06, 0x80, 0x1F, 0x00, 0x0C,
+	0xC0, 0x07, 0x00, 0x08, 0xF0, 0x01, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xC0,
+	0x07, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// U+040E
+	0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x03, 0x80,
+	0x3F, 0x00, 0x03, 0x06, 0xFC, 0x01, 0x03, 0x06, 0xF0, 0x87, 0x03, 0x0C, 0xC0, 0xFF, 0x01, 0x0C,
+	0x00, 0xFE, 0x01, 0x0C, 0x00, 0x7F, 0x00, 0x0C, 0xC0, 0x1F, 0x00, 0x06, 0xF0, 0x03, 0x00, 0x02,
+	0xFE, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x40,
+	0x00, 0x00, 0x00,
+	// U+040F
+	0x00, 0x0F, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3F, 0x00,
+	0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// U+0410
+	0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF8, 0x03, 0x00,
+	0x00, 0xFE, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xFE, 0x18, 0x00, 0xC0,
+	0x1F, 0x18, 0x00, 0xC0, 0x03, 0x18, 0x00, 0xC0, 0x03, 0x18, 0x00, 0xC0, 0x0F, 0x18, 0x00, 0x00,
+	0x7F, 0x18, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
+	0x00, 0xF8, 0x03, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x03,
+	// U+0411
+	0x00, 0x0E, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xC0, 0x00, 0x03, 0xC0, 0xC0, 0x00, 0x03, 0xC0, 0xC0, 0x00, 0x03, 0xC0, 0xC0, 0x00, 0x03, 0xC0,
+	0xC0, 0x00, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x81, 0x03, 0xC0, 0x80, 0x83, 0x03, 0xC0,
+	0x80, 0xFF, 0x01, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7E, 0x00,
+	// U+0412
+	0x00, 0x0E, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xC0, 0x00, 0x03, 0xC0, 0xC0, 0x00, 0x03, 0xC0, 0xC0, 0x00, 0x03, 0xC0, 0xC0, 0x00, 0x03, 0xC0,
+	0xC0, 0x00, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC1, 0x81, 0x03, 0x80, 0xF3, 0x83, 0x03, 0x80,
+	0x7F, 0xFF, 0x01, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x7C, 0x00,
+	// U+0413
+	0x00, 0x0C, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00,
+	// U+0414
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x80, 0x03, 0x00,
+	0x00, 0xF0, 0x03, 0x00, 0xE0, 0xFF, 0x03, 0xC0, 0xFF, 0x7F, 0x03, 0xC0, 0xFF, 0x07, 0x03, 0xC0,
+	0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+	0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xFF, 0xFF, 0x03, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+	// U+0415
+	0x00, 0x0D, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0,
+	0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0,
+	0xC0, 0x01, 0x03, 0xC0, 0x00, 0x00, 0x03,
+	// U+0416
+	0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xC0, 0x03, 0xC0,
+	0x01, 0xE0, 0x01, 0x80, 0x03, 0x78, 0x00, 0x00, 0x07, 0x3E, 0x00, 0x00, 0x1E, 0x0F, 0x00, 0x00,
+	0xFC, 0x07, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00,
+	0xC0, 0x03, 0x00, 0x00, 0x80, 0x07, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xFF, 0xFF, 0x03, 0x00, 0x80, 0x03, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+	0xF0, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x9E, 0x0F, 0x00, 0x00, 0x0F, 0x1E, 0x00, 0x80,
+	0x07, 0x7C, 0x00, 0xC0, 0x03, 0xF0, 0x00, 0xC0, 0x01, 0xE0, 0x03, 0xC0, 0x00, 0x80, 0x03, 0x40,
+	0x00, 0x00, 0x03,
+	// U+0417
+	0x00, 0x0E, 0x00, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x01, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+	0x80, 0x00, 0x03, 0xC0, 0xC0, 0x00, 0x03, 0xC0, 0xC0, 0x00, 0x03, 0xC0, 0xC0, 0x00, 0x03, 0xC0,
+	0xC0, 0x01, 0x03, 0xC0, 0xC0, 0x01, 0x03, 0xC0, 0xC1, 0x81, 0x03, 0x80, 0xF3, 0x83, 0x01, 0x80,
+	0x7F, 0xFF, 0x01, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x7C, 0x00,
+	// U+0418
+	0x00, 0x0F, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00,
+	0x00, 0xE0, 0x03, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00,
+	0xC0, 0x07, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xC0,
+	0x07, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// U+0419
+	0x00, 0x0F, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x02,
+	0x00, 0xE0, 0x03, 0x06, 0x00, 0xF8, 0x00, 0x06, 0x00, 0x3E, 0x00, 0x0C, 0x80, 0x1F, 0x00, 0x0C,
+	0xC0, 0x07, 0x00, 0x0C, 0xF0, 0x01, 0x00, 0x06, 0x7C, 0x00, 0x00, 0x06, 0x1F, 0x00, 0x00, 0xC0,
+	0x07, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// U+041A
+	0x00, 0x10, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00,
+	0x80, 0x07, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
+	0xF8, 0x01, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x0E, 0x0F, 0x00, 0x00, 0x07, 0x3E, 0x00, 0x80,
+	0x03, 0x78, 0x00, 0xC0, 0x01, 0xF0, 0x01, 0xC0, 0x00, 0xC0, 0x03, 0x40, 0x00, 0x80, 0x03, 0x00,
+	0x00, 0x00, 0x02,
+	// U+041B
+	0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00,
+	0x00, 0xE0, 0x01, 0x00, 0x00, 0xFE, 0x00, 0xC0, 0xFF, 0x7F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0,
+	0x3F, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// U+041C
+	0x00, 0x12, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x07, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00,
+	0x80, 0x1F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
+	0xE0, 0x0F, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0xC0,
+	0x03, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// U+041D
+	0x00, 0x0F, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00,
+	0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00,
+	0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00,
+	0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// U+041E
+	0x00, 0x12, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00,
+	0x0F, 0xF0, 0x00, 0x80, 0x03, 0xC0, 0x01, 0xC0, 0x01, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+	0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+	0x00, 0x00, 0x03, 0xC0, 0x01, 0x80, 0x03, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x07, 0xE0, 0x01, 0x00,
+	0x3F, 0xFC, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xF8, 0x1F, 0x00,
+	// U+041F
+	0x00, 0x0F, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// U+0420
+	0x00, 0x0D, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0,
+	0x00, 0x03, 0x00, 0xC0, 0x81, 0x03, 0x00, 0x80, 0xC3, 0x01, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00,
+	0xFF, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
+	// U+0421
+	0x00, 0x10, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+	0x0F, 0xF0, 0x00, 0x80, 0x03, 0xC0, 0x01, 0xC0, 0x01, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x03, 0xC0,
+	0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+	0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x01, 0x80, 0x03, 0x80, 0x01, 0x80, 0x01, 0x80,
+	0x03, 0xC0, 0x01,
+	// U+0422
+	0x00, 0x11, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,
+	// U+0423
+	0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x03, 0x80,
+	0x3F, 0x00, 0x03, 0x00, 0xFC, 0x01, 0x03, 0x00, 0xF0, 0x87, 0x03, 0x00, 0xC0, 0xFF, 0x01, 0x00,
+	0x00, 0xFE, 0x01, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00,
+	0xFE, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x40,
+	0x00, 0x00, 0x00,
+	// U+0424
+	0x00, 0x14, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00,
+	0x1E, 0x38, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x07, 0x70, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00,
+	0x03, 0x60, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xFF, 0xFF, 0x03, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00,
+	0x06, 0x70, 0x00, 0x00, 0x0E, 0x38, 0x00, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00,
+	0xF0, 0x0F, 0x00,
+	// U+0425
+	0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xC0, 0x03, 0xC0,
+	0x03, 0xE0, 0x01, 0x80, 0x07, 0xF8, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00,
+	0xF0, 0x07, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x78, 0x0F, 0x00, 0x00,
+	0x3E, 0x3E, 0x00, 0x00, 0x0F, 0x78, 0x00, 0xC0, 0x07, 0xE0, 0x01, 0xC0, 0x01, 0xC0, 0x03, 0xC0,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02,
+	// U+0426
+	0x00, 0x12, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00,
+	0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+	// U+0427
+	0x00, 0x0E, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00, 0x00,
+	0xC0, 0x01, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00,
+	0x80, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0xC0,
+	0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// U+0428
+	0x00, 0x18, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x03, 0xC0,
+	0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xFF, 0xFF, 0x03,
+	// U+0429
+	0x00, 0x1A, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x03, 0xC0,
+	0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+	// U+042A
+	0x00, 0x14, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0,
+	0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00,
+	0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x01, 0x03, 0x00,
+	0xC0, 0x81, 0x03, 0x00, 0x80, 0xC3, 0x01, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00,
+	0x00, 0x7E, 0x00,
+	// U+042B
+	0x00, 0x13, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00,
+	0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00,
+	0xC0, 0x00, 0x03, 0x00, 0xC0, 0x01, 0x03, 0x00, 0xC0, 0x81, 0x03, 0x00, 0x80, 0x83, 0x03, 0x00,
+	0x80, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// U+042C
+	0x00, 0x0E, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00,
+	0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x03, 0x00,
+	0xC0, 0x00, 0x03, 0x00, 0xC0, 0x01, 0x03, 0x00, 0xC0, 0x81, 0x03, 0x00, 0x80, 0x83, 0x03, 0x00,
+	0x80, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7E, 0x00,
+	// U+042D
+	0x00, 0x10, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x01, 0x80, 0x03, 0xC0,
+	0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0,
+	0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x80, 0x01, 0x03, 0xC0, 0x81, 0x81, 0x03, 0x80,
+	0x83, 0xC1, 0x01, 0x00, 0x8F, 0xF1, 0x01, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00,
+	0xF0, 0x0F, 0x00,
+	// U+042E
+	0x00, 0x19, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x00,
+	0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+	0xF8, 0x1F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x80, 0x07, 0xE0, 0x01, 0x80,
+	0x03, 0xC0, 0x01, 0xC0, 0x01, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+	0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+	0x01, 0x80, 0x03, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x07, 0xE0, 0x01, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+	0xFE, 0x7F, 0x00, 0x00, 0xF8, 0x1F, 0x00,
+	// U+042F
+	0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x7E, 0x00, 0x03, 0x80, 0xFF, 0xC0, 0x03, 0x80,
+	0xFF, 0xF0, 0x01, 0xC0, 0xC1, 0xF9, 0x00, 0xC0, 0x81, 0x3F, 0x00, 0xC0, 0x80, 0x0F, 0x00, 0xC0,
+	0x80, 0x07, 0x00, 0xC0, 0x80, 0x03, 0x00, 0xC0, 0x80, 0x03, 0x00, 0xC0, 0x80, 0x03, 0x00, 0xC0,
+	0x80, 0x03, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03,
+	// U+0430
+	0x00, 0x0D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x30, 0xFC, 0x01, 0x00, 0x18, 0xDE, 0x03, 0x00,
+	0x18, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00,
+	0x18, 0x03, 0x03, 0x00, 0x18, 0x83, 0x01, 0x00, 0x38, 0xC3, 0x01, 0x00, 0xF0, 0xFF, 0x03, 0x00,
+	0xE0, 0xFF, 0x03, 0x00, 0x80, 0xFF, 0x03,
+	// U+0431
+	0x00, 0x0E, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0xC0,
+	0x79, 0xC0, 0x03, 0xC0, 0x39, 0x80, 0x03, 0xE0, 0x18, 0x00, 0x03, 0x60, 0x18, 0x00, 0x03, 0x60,
+	0x18, 0x00, 0x03, 0x60, 0x18, 0x00, 0x03, 0x60, 0x38, 0x80, 0x03, 0x60, 0x78, 0xC0, 0x03, 0x60,
+	0xF0, 0xFF, 0x01, 0x40, 0xE0, 0xFF, 0x00, 0x00, 0x80, 0x3F, 0x00,
+	// U+0432
+	0x00, 0x0C, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00,
+	0x18, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00,
+	0x18, 0x06, 0x03, 0x00, 0x38, 0x8F, 0x03, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0xF0, 0xF9, 0x01, 0x00,
+	0x00, 0xF0, 0x00,
+	// U+0433
+	0x00, 0x0B, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+	// U+0434
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x80, 0x03, 0x00,
+	0x00, 0xF0, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0x3F, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00,
+	0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00,
+	0x18, 0x00, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x3F, 0x00,
+	0x00, 0x00, 0x3F,
+	// U+0435
+	0x00, 0x0E, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00,
+	0x70, 0xC6, 0x01, 0x00, 0x38, 0x86, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00,
+	0x18, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00, 0x38, 0x06, 0x03, 0x00,
+	0xF0, 0x07, 0x03, 0x00, 0xE0, 0x87, 0x03, 0x00, 0x80, 0x07, 0x00,
+	// U+0436
+	0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x08, 0x00, 0x03, 0x00, 0x18, 0xC0, 0x03, 0x00,
+	0x38, 0xE0, 0x01, 0x00, 0x70, 0x78, 0x00, 0x00, 0xE0, 0x3C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00,
+	0x80, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+	0x80, 0x07, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0xE0, 0x3C, 0x00, 0x00, 0x70, 0x78, 0x00, 0x00,
+	0x38, 0xE0, 0x01, 0x00, 0x18, 0xC0, 0x03, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02,
+	// U+0437
+	0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00,
+	0x18, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00,
+	0x18, 0x0F, 0x03, 0x00, 0xF8, 0x9F, 0x03, 0x00, 0xF0, 0xF9, 0x01, 0x00, 0xE0, 0xF0, 0x00,
+	// U+0438
+	0x00, 0x0D, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00,
+	0x00, 0xE0, 0x01, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
+	0x80, 0x07, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03,
+	// U+0439
+	0x00, 0x0D, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x60, 0x00, 0xC0, 0x03, 0xE0,
+	0x00, 0xE0, 0x01, 0x80, 0x01, 0xF0, 0x00, 0x80, 0x01, 0x3C, 0x00, 0x80, 0x01, 0x0F, 0x00, 0x80,
+	0x81, 0x07, 0x00, 0xC0, 0xE1, 0x01, 0x00, 0xE0, 0x78, 0x00, 0x00, 0x20, 0xF8, 0xFF, 0x03, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03,
+	// U+043A
+	0x00, 0x0D, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x1E, 0x00, 0x00,
+	0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00,
+	0xE0, 0x3C, 0x00, 0x00, 0x70, 0x78, 0x00, 0x00, 0x38, 0xE0, 0x01, 0x00, 0x18, 0xC0, 0x03, 0x00,
+	0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02,
+	// U+043B
+	0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00,
+	0x00, 0xE0, 0x01, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03,
+	// U+043C
+	0x00, 0x10, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x78, 0x00, 0x00, 0x00,
+	0xF8, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+	0x00, 0x70, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00,
+	0xF0, 0x01, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0xF8, 0xFF, 0x03,
+	// U+043D
+	0x00, 0x0D, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x0E, 0x00, 0x00,
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03,
+	// U+043E
+	0x00, 0x0E, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00,
+	0x78, 0xC0, 0x03, 0x00, 0x38, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00,
+	0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x38, 0x80, 0x03, 0x00, 0x70, 0xC0, 0x01, 0x00,
+	0xF0, 0xFF, 0x01, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0x00,
+	// U+043F
+	0x00, 0x0D, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03,
+	// U+0440
+	0x00, 0x0D, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x00, 0xF8, 0xFF, 0xFF, 0x00, 0xF0, 0xFB, 0x01, 0x00,
+	0x30, 0x80, 0x01, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00,
+	0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x38, 0x80, 0x03, 0x00, 0xF0, 0xE0, 0x01, 0x00,
+	0xE0, 0xFF, 0x00, 0x00, 0xC0, 0x7F, 0x00,
+	// U+0441
+	0x00, 0x0C, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00,
+	0x70, 0xC0, 0x01, 0x00, 0x38, 0x80, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00,
+	0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00,
+	0x38, 0x80, 0x03,
+	// U+0442
+	0x00, 0x0E, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+	// U+0443
+	0x00, 0x0E, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x78, 0x00, 0x40, 0x00, 0xF8, 0x01, 0xC0, 0x00,
+	0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFC, 0x78, 0x00, 0x00, 0xE0, 0x3F, 0x00,
+	0x00, 0xC0, 0x1F, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00,
+	0xF0, 0x07, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
+	// U+0444
+	0x00, 0x14, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00,
+	0x38, 0x80, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00,
+	0x18, 0x00, 0x03, 0x00, 0x30, 0x80, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x00,
+	0x70, 0xC0, 0x01, 0x00, 0x30, 0x80, 0x01, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00,
+	0x18, 0x00, 0x03, 0x00, 0x38, 0x80, 0x03, 0x00, 0x78, 0xC0, 0x03, 0x00, 0xF0, 0xFF, 0x01, 0x00,
+	0xC0, 0x7F, 0x00,
+	// U+0445
+	0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x08, 0x00, 0x03, 0x00, 0x38, 0x80, 0x03, 0x00,
+	0x78, 0xE0, 0x01, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xC0, 0x7B, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00,
+	0x00, 0x1F, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xE0, 0x79, 0x00, 0x00, 0xF0, 0xE0, 0x00, 0x00,
+	0x78, 0xC0, 0x03, 0x00, 0x18, 0x80, 0x03, 0x00, 0x08, 0x00, 0x02,
+	// U+0446
+	0x00, 0x0F, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+	// U+0447
+	0x00, 0x0C, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00,
+	0x00, 0x0E, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00,
+	0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0xF8, 0xFF, 0x03,
+	// U+0448
+	0x00, 0x14, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0xF8, 0xFF, 0x03,
+	// U+0449
+	0x00, 0x16, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+	// U+044A
+	0x00, 0x11, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0x00, 0x06, 0x03, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x06, 0x03, 0x00,
+	0x00, 0x06, 0x03, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x8E, 0x03, 0x00, 0x00, 0xFC, 0x01, 0x00,
+	0x00, 0xFC, 0x01, 0x00, 0x00, 0xF0, 0x00,
+	// U+044B
+	0x00, 0x11, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x0E, 0x03, 0x00,
+	0x00, 0x06, 0x03, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x06, 0x03, 0x00,
+	0x00, 0x06, 0x03, 0x00, 0x00, 0x8E, 0x03, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0xFC, 0x01, 0x00,
+	0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03,
+	// U+044C
+	0x00, 0x0C, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x0E, 0x03, 0x00,
+	0x00, 0x06, 0x03, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x06, 0x03, 0x00,
+	0x00, 0x06, 0x03, 0x00, 0x00, 0x8E, 0x03, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0xFC, 0x01, 0x00,
+	0x00, 0xF8, 0x00,
+	// U+044D
+	0x00, 0x0C, 0x00, 0x00, 0x38, 0x80, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00,
+	0x18, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00,
+	0x38, 0x86, 0x03, 0x00, 0x70, 0xC6, 0x01, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0xC0, 0x7F, 0x00, 0x00,
+	0x00, 0x1F, 0x00,
+	// U+044E
+	0x00, 0x13, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00,
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00,
+	0xF0, 0xFF, 0x01, 0x00, 0x70, 0xC0, 0x01, 0x00, 0x38, 0x80, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00,
+	0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x38, 0x80, 0x03, 0x00,
+	0x78, 0xC0, 0x03, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x80, 0x3F, 0x00,
+	// U+044F
+	0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xE0, 0x03, 0x03, 0x00, 0xF0, 0xC7, 0x03, 0x00,
+	0xF8, 0xE7, 0x01, 0x00, 0x38, 0x7E, 0x00, 0x00, 0x18, 0x3C, 0x00, 0x00, 0x18, 0x0C, 0x00, 0x00,
+	0x18, 0x0C, 0x00, 0x00, 0x18, 0x0C, 0x00, 0x00, 0x18, 0x0C, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03,
+	// U+0450
+	0x00, 0x0E, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x10, 0xF0, 0xFF, 0x01, 0x30,
+	0x70, 0xC6, 0x01, 0x70, 0x38, 0x86, 0x03, 0xE0, 0x18, 0x06, 0x03, 0xC0, 0x19, 0x06, 0x03, 0x00,
+	0x19, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00, 0x38, 0x06, 0x03, 0x00,
+	0xF0, 0x07, 0x03, 0x00, 0xE0, 0x87, 0x03, 0x00, 0x80, 0x07, 0x00,
+	// U+0451
+	0x00, 0x0E, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0xE0,
+	0x70, 0xC6, 0x01, 0xE0, 0x38, 0x86, 0x03, 0xE0, 0x18, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00,
+	0x18, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0xE0, 0x18, 0x06, 0x03, 0xE0, 0x38, 0x06, 0x03, 0x00,
+	0xF0, 0x07, 0x03, 0x00, 0xE0, 0x87, 0x03, 0x00, 0x80, 0x07, 0x00,
+	// U+0452
+	0x00, 0x0F, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0xE0,
+	0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00,
+	0x18, 0x03, 0x00, 0x00, 0x18, 0x03, 0x60, 0x00, 0x18, 0x03, 0x60, 0x00, 0x18, 0x03, 0x30, 0x00,
+	0x18, 0x07, 0x3C, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0xF8, 0x01,
+	// U+0453
+	0x00, 0x0B, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x80, 0x19, 0x00, 0x00, 0xC0, 0x19, 0x00, 0x00, 0xE0,
+	0x18, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0x10, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+	// U+0454
+	0x00, 0x0C, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00,
+	0x70, 0xC6, 0x01, 0x00, 0x38, 0x86, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00,
+	0x18, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00,
+	0x38, 0x80, 0x03,
+	// U+0455
+	0x00, 0x0B, 0x00, 0x00, 0xE0, 0x81, 0x03, 0x00, 0xF0, 0x03, 0x03, 0x00, 0xF8, 0x07, 0x03, 0x00,
+	0x18, 0x07, 0x03, 0x00, 0x18, 0x06, 0x03, 0x00, 0x18, 0x0E, 0x03, 0x00, 0x18, 0x0E, 0x03, 0x00,
+	0x18, 0x0C, 0x03, 0x00, 0x18, 0x9C, 0x03, 0x00, 0x18, 0xFC, 0x01, 0x00, 0x10, 0xF8, 0x01,
+	// U+0456
+	0x00, 0x02, 0x00, 0xE0, 0xF8, 0xFF, 0x03, 0xE0, 0xF8, 0xFF, 0x03,
+	// U+0457
+	0x00, 0x08, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0,
+	0x00, 0x00, 0x00,
+	// U+0458
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0xE0,
+	0xF8, 0xFF, 0x7F, 0xE0, 0xF8, 0xFF, 0x3F, 0xC0, 0xF8, 0xFF, 0x07,
+	// U+0459
+	0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00,
+	0x00, 0xE0, 0x01, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x06, 0x03, 0x00,
+	0x00, 0x06, 0x03, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x8E, 0x03, 0x00,
+	0x00, 0xFC, 0x01, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0xF8, 0x00,
+	// U+045A
+	0x00, 0x15, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x0E, 0x00, 0x00,
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x06, 0x03, 0x00,
+	0x00, 0x06, 0x03, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x8C, 0x03, 0x00, 0x00, 0xFC, 0x01, 0x00,
+	0x00, 0xF8, 0x00, 0x00, 0x00, 0x20, 0x00,
+	// U+045B
+	0x00, 0x0F, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0xE0,
+	0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00,
+	0x18, 0x03, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00,
+	0x18, 0x07, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF8, 0x03,
+	// U+045C
+	0x00, 0x0D, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x1E, 0x00, 0x00,
+	0x00, 0x0E, 0x00, 0x00, 0x01, 0x07, 0x00, 0x80, 0x81, 0x07, 0x00, 0xC0, 0xC0, 0x0F, 0x00, 0x70,
+	0xE0, 0x3C, 0x00, 0x30, 0x70, 0x78, 0x00, 0x10, 0x38, 0xE0, 0x01, 0x00, 0x18, 0xC0, 0x03, 0x00,
+	0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02,
+	// U+045D
+	0x00, 0x0D, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x10, 0xF8, 0xFF, 0x03, 0x30, 0x00, 0xC0, 0x03, 0x70,
+	0x00, 0xE0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0xC0, 0x01, 0x3C, 0x00, 0x00, 0x01, 0x0F, 0x00, 0x00,
+	0x80, 0x07, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03,
+	// U+045E
+	0x00, 0x0E, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x78, 0x00, 0x40, 0x00, 0xF8, 0x01, 0xC0, 0x60,
+	0xE0, 0x0F, 0xC0, 0xE0, 0x00, 0x3F, 0xE0, 0x80, 0x01, 0xFC, 0x78, 0x80, 0x01, 0xE0, 0x3F, 0x80,
+	0x01, 0xC0, 0x1F, 0x80, 0x01, 0xF0, 0x03, 0xC0, 0x01, 0xFE, 0x00, 0xE0, 0x80, 0x1F, 0x00, 0x00,
+	0xF0, 0x07, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
+	// U+045F
+	0x00, 0x0D, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00,
+	0xF8, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x03,
+};
+
+// End
@@ -0,0 +1,68 @@
+/*
+ * GlyphCache.cpp
+ *
+ * Created: 19/10/2026 09:14:05
+ */
+
+#include "GlyphCache.hpp"
+
+GlyphCache::GlyphCache() : hits(0), misses(0)
+{
+	Clear();
+}
+
+void GlyphCache::Clear()
+{
+	for (unsigned int i = 0; i < NumEntries; ++i)
+	{
+		entries[i].font = NULL;
+	}
+}
+
+// Look up a glyph. The cache is small, so a linear search is faster than anything cleverer.
+const CachedGlyph* null GlyphCache::Find(const uint8_t *font, uint16_t glyphNumber)
+{
+	clock.Tick(entries, NumEntries);
+	for (unsigned int i = 0; i < NumEntries; ++i)
+	{
+		CachedGlyph& g = entries[i];
+		if (g.glyphNumber == glyphNumber && g.font == font)
+		{
+			g.lastUsed = clock.Now();
+			++hits;
+			return &g;
+		}
+	}
+	++misses;
+	return NULL;
+}
+
+// Claim an entry for a new glyph, evicting the one that has gone unused for longest
+CachedGlyph *GlyphCache::Allocate(const uint8_t *font, uint16_t glyphNumber)
+{
+	unsigned int victim = 0;
+	uint16_t oldest = 0;
+	for (unsigned int i = 0; i < NumEntries; ++i)
+	{
+		const CachedGlyph& g = entries[i];
+		if (g.font == NULL)
+		{
+			victim = i;
+			break;
+		}
+		const uint16_t age = clock.Age(g.lastUsed);
+		if (age >= oldest)
+		{
+			oldest = age;
+			victim = i;
+		}
+	}
+
+	CachedGlyph& g = entries[victim];
+	g.font = font;
+	g.glyphNumber = glyphNumber;
+	g.lastUsed = clock.Now();
+	return &g;
+}
+
+// End
@@ -0,0 +1,64 @@
+/*
+ * GlyphCache.hpp
+ *
+ * Created: 19/10/2026 09:12:40
+ */
+
+
+#ifndef GLYPHCACHE_H_
+#define GLYPHCACHE_H_
+
+#include "ecv.h"
+#undef array
+#undef result
+#include "asf.h"
+#define array _ecv_array
+#define result _ecv_result
+#include "Library/LruClock.hpp"
+
+// Number of glyphs in the glyph cache. Each one takes sizeof(CachedGlyph) bytes of RAM, which is 132 on the SAM3S.
+#ifndef GLYPH_CACHE_ENTRIES
+#define GLYPH_CACHE_ENTRIES	(16)
+#endif
+
+// A glyph expanded from font data into a form that is quick to render.
+// The column data is word-aligned and already masked to the font height, and the data used for kerning against the previous character is precomputed.
+struct CachedGlyph
+{
+	static const unsigned int MaxColumns = 28;		// enough for the widest font we use (glcd28x32)
+
+	const uint8_t *font;				// the font this glyph belongs to, or NULL if this entry is free
+	uint16_t glyphNumber;				// index of the glyph within the font
+	uint16_t lastUsed;					// LRU timestamp, see LruClock
+	uint8_t nCols;						// number of columns in the glyph
+	uint32_t kernColData;				// the column we compare with the end of the previous character when deciding whether to kern
+	uint32_t lastColData;				// the last column with any pixels set, or 0 if there are none
+	uint32_t colData[MaxColumns];
+};
+
+class GlyphCache
+{
+public:
+	static const unsigned int NumEntries = GLYPH_CACHE_ENTRIES;
+
+	GlyphCache();
+
+	// Look up a glyph. Returns NULL if it isn't in the cache.
+	const CachedGlyph* null Find(const uint8_t *font, uint16_t glyphNumber);
+
+	// Claim the least recently used entry for a new glyph. The caller must fill in nCols, kernColData, lastColData and colData.
+	CachedGlyph *Allocate(const uint8_t *font, uint16_t glyphNumber);
+
+	void Clear();
+
+	uint32_t GetHits() const { return hits; }
+	uint32_t GetMisses() const { return misses; }
+	void ResetStats() { hits = misses = 0; }
+
+private:
+	CachedGlyph entries[NumEntries];
+	LruClock clock;
+	uint32_t hits, misses;
+};
+
+#endif /* GLYPHCACHE_H_ */
@@ -2,14 +2,14 @@
 #define HW_AVR_h
 
 // *** Hardware specific functions ***
-void UTFT::LCD_Write_Bus(uint8_t VH, uint8_t VL)
+inline void UTFT::LCD_Write_Bus(uint8_t VH, uint8_t VL)
 {   
-	switch (displayTransferMode)
+	switch (getTransferMode())
 	{
 #ifndef DISABLE_SERIAL
 	case TModeSerial4pin:
 	case TModeSerial5pin:
-		if (displayTransferMode == TModeSerial4pin)
+		if (getTransferMode() == TModeSerial4pin)
 		{
 			if (VH==1)
 			{
@@ -234,8 +234,10 @@ void UTFT::LCD_Write_Bus(uint8_t VH, uint8_t VL)
 
 #ifndef DISABLE_16BIT
 	case TMode16bit:
-#if defined(SAM3S)
+#if defined(SAM3S) && defined(PIO_USE_ASF_DRIVER)
 		pio_sync_output_write(PIOA, (VH << 8) | VL);
+#elif defined(SAM3S)
+		PIOA->PIO_ODSR = (VH << 8) | VL;			// only the data bus pins are enabled for synchronous output, see _set_direction_registers
 #elif defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)
 		PORTA = VH;
 		PORTC = VL;
@@ -256,9 +258,18 @@ void UTFT::LCD_Write_Bus(uint8_t VH, uint8_t VL)
 // Only supported in 9 and 16 bit modes. Used to speed up setting large blocks of pixels to the same colour. 
 void UTFT::LCD_Write_Again(uint16_t num)
 {   
+	const OneBitPort wr = portWR;			// local copy so that the port address and mask stay in registers
+	while (num >= 4)
+	{
+		wr.pulseLow();
+		wr.pulseLow();
+		wr.pulseLow();
+		wr.pulseLow();
+		num -= 4;
+	}
 	while (num != 0)
 	{
-		portWR.pulseLow();
+		wr.pulseLow();
 		--num;
 	}
 }
@@ -266,16 +277,16 @@ void UTFT::LCD_Write_Again(uint16_t num)
 void UTFT::_set_direction_registers()
 {
 #if defined(SAM3S)
-	pio_configure(PIOA, PIO_OUTPUT_0, (displayTransferMode == TMode16bit) ? 0x0000FFFF : 0x000000FF, 0);
-	pio_enable_output_write(PIOA, (displayTransferMode == TMode16bit) ? 0x0000FFFF : 0x000000FF);
+	pio_configure(PIOA, PIO_OUTPUT_0, (getTransferMode() == TMode16bit) ? 0x0000FFFF : 0x000000FF, 0);
+	pio_enable_output_write(PIOA, (getTransferMode() == TMode16bit) ? 0x0000FFFF : 0x000000FF);
 #elif defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)
 	DDRA = 0xFF;
-	if (displayTransferMode == TMode16bit)
+	if (getTransferMode() == TMode16bit)
 	{
 		DDRC = 0xFF;
 	}
 #elif defined(__AVR_ATmega32U4__)
-	if (displayTransferMode == TMode9bit)
+	if (getTransferMode() == TMode9bit)
 	{
 		DDRF |= 0xF3;
 		DDRD |= 0x03;
@@ -293,7 +304,7 @@ void UTFT::_set_direction_registers()
 	}
 #else
 	DDRD = 0xFF;
-	if (displayTransferMode == TMode16bit)
+	if (getTransferMode() == TMode16bit)
 	{
 		DDRB |= 0x3F;
 		DDRC |= 0x03;
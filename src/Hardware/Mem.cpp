@@ -14,6 +14,7 @@
 //}
 
 extern int  _end, __ram_end__;
+extern int _sramfunc, _eramfunc;
 
 static unsigned char *heap = NULL;
 
@@ -40,4 +41,9 @@ unsigned int getFreeMemory()
 	return (unsigned char *)&__ram_end__ - heap;	
 }
 
+unsigned int getRamFunctionSize()
+{
+	return (unsigned char *)&_eramfunc - (unsigned char *)&_sramfunc;
+}
+
 // End
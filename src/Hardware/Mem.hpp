@@ -11,11 +11,29 @@
 
 #include <cstddef>
 
+// Functions declared with RAM_FUNCTION are copied from flash into RAM at startup along with the initialised data (see the .relocate
+// section in flash.ld), so that they run without flash wait states. Use it only for the few functions that the processor spends most of
+// its time in, because it costs RAM. Nothing is declared with it until DISPLAY_TIMING_TEST (see Configuration.hpp) has shown on the board
+// that the gain is worth the RAM: code fetched from RAM shares the bus with data accesses, and flash has a prefetch buffer. To try it,
+// declare the functions with RAM_FUNCTION, for example the pixel writers and writeNative in UTFT, and define USE_RAM_FUNCTIONS as 1.
+#ifndef USE_RAM_FUNCTIONS
+# define USE_RAM_FUNCTIONS	(0)
+#endif
+
+#if USE_RAM_FUNCTIONS
+// RAM and flash are too far apart for a BL instruction, hence long_call. The compiler may still inline a RAM function into its callers,
+// such as the pixel writers into writeNative, which saves a long call per pixel; a copy inlined into code in flash just runs from flash.
+# define RAM_FUNCTION		__attribute__((long_call, section(".ramfunc")))
+#else
+# define RAM_FUNCTION
+#endif
+
 void* operator new(size_t objsize);
 
 void operator delete(void* obj);
 
 unsigned int getFreeMemory();
+unsigned int getRamFunctionSize();			// the amount of RAM taken by code that runs from RAM
 
 #endif /* MEMH_H_ */
 
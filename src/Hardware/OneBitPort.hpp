@@ -16,6 +16,9 @@
 #define array _ecv_array
 #define result _ecv_result
 
+// On the SAM3S we drive the pins by writing the PIO set and clear registers directly, because this is on the display write path and the ASF
+// pio_set() and pio_clear() functions are not inline. Define PIO_USE_ASF_DRIVER to go through the ASF functions instead, for example so that
+// a host build can supply them to trace what is written.
 class OneBitPort
 {
 public:
@@ -27,8 +30,10 @@ public:
 		
 	void setLow() const
 	{
-#if defined(SAM3S)
+#if defined(SAM3S) && defined(PIO_USE_ASF_DRIVER)
 		pio_clear(port, mask);
+#elif defined(SAM3S)
+		port->PIO_CODR = mask;
 #else
 		*port &= ~mask;
 #endif
@@ -36,21 +41,23 @@ public:
 		
 	void setHigh() const
 	{
-#if defined(SAM3S)
+#if defined(SAM3S) && defined(PIO_USE_ASF_DRIVER)
 		pio_set(port, mask);
+#elif defined(SAM3S)
+		port->PIO_SODR = mask;
 #else
 		port |= mask;
 #endif
 	}
 		
-	// Pulse the pin high. On the SAM3S the pulse is about 400ns wide.
+	// Pulse the pin high
 	void pulseHigh() const
 	{
 		setHigh();
 		setLow();
 	}
 
-	// Pulse the pin high. On the SAM3S the pulse is about 400ns wide.
+	// Pulse the pin low. On the SAM3S the pulse is a few tens of ns wide, or about 400ns if we use the ASF driver.
 	void pulseLow() const
 	{
 		setLow();
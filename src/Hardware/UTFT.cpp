@@ -59,19 +59,48 @@ template <class T> inline void swap(T& a, T& b)
 	b = temp;
 }
 
+// If memorysaver.h configures the build for one controller, one transfer mode or landscape orientations only, these return constants
+// and the compiler drops the code for the other cases, including the checks in the bus write functions.
+inline DisplayType UTFT::getModel() const
+{
+#ifdef UTFT_ONLY_MODEL
+	return UTFT_ONLY_MODEL;
+#else
+	return displayModel;
+#endif
+}
+
+inline TransferMode UTFT::getTransferMode() const
+{
+#ifdef UTFT_ONLY_TRANSFER_MODE
+	return UTFT_ONLY_TRANSFER_MODE;
+#else
+	return displayTransferMode;
+#endif
+}
+
+inline bool UTFT::isSwapXY() const
+{
+#ifdef UTFT_ONLY_LANDSCAPE
+	return true;
+#else
+	return (orient & SwapXY) != 0;
+#endif
+}
+
 inline bool UTFT::isParallel() const
 {
-	return displayTransferMode >= TModeLowestParallel;
+	return getTransferMode() >= TModeLowestParallel;
 }
 
 UTFT::UTFT(DisplayType model, TransferMode pmode, unsigned int RS, unsigned int WR, unsigned int CS, unsigned int RST, unsigned int SER_LATCH)
 	: fcolour(0xFFFF), bcolour(0), transparentBackground(false),
-	  displayModel(model), displayTransferMode(pmode),
+	  displayModel(model), displayTransferMode(pmode), windowValid(false), scrollTop(0), scrollHeight(0), scrollOffset(0), scrollBoundaryCrossings(0),
 	  portRS(RS), portWR(WR), portCS(CS), portRST(RST), portSDA(RS), portSCL(SER_LATCH),
-	  translateFrom(NULL), translateTo(NULL),
-	  numContinuationBytesLeft(0)
+	  blendLevels(0), translateFrom(NULL), translateTo(NULL),
+	  numContinuationBytesLeft(0), measuring(false), clipDepth(0), clipStreaming(false), composing(false)
 { 
-	switch (model)
+	switch (getModel())
 	{
 		case HX8347A:
 		case SSD1289:
@@ -119,7 +148,7 @@ UTFT::UTFT(DisplayType model, TransferMode pmode, unsigned int RS, unsigned int
 		portWR.setMode(OneBitPort::Output);
 		portCS.setMode(OneBitPort::Output);
 		portRST.setMode(OneBitPort::Output);
-		if (displayTransferMode == TMode9bit)
+		if (getTransferMode() == TMode9bit)
 		{
 			portSCL.setMode(OneBitPort::Output);
 		}
@@ -131,7 +160,7 @@ UTFT::UTFT(DisplayType model, TransferMode pmode, unsigned int RS, unsigned int
 		portSCL.setMode(OneBitPort::Output);
 		portCS.setMode(OneBitPort::Output);
 		portRST.setMode(OneBitPort::Output);
-		if (displayTransferMode == TModeSerial5pin)
+		if (getTransferMode() == TModeSerial5pin)
 		{
 			portRS.setMode(OneBitPort::Output);
 		}
@@ -141,6 +170,7 @@ UTFT::UTFT(DisplayType model, TransferMode pmode, unsigned int RS, unsigned int
 
 void UTFT::LCD_Write_COM(uint8_t VL)  
 {   
+	clipStreaming = false;			// a command ends the pixel data for the window that setXY set
 #ifndef DISABLE_SERIAL
 	if (isParallel())
 #endif
@@ -158,6 +188,18 @@ void UTFT::LCD_Write_COM(uint8_t VL)
 
 void UTFT::LCD_Write_DATA16(uint16_t VHL)
 {
+#if UTFT_BAND_BUFFER_PIXELS != 0
+	if (composing)
+	{
+		composePixels(VHL, 1);
+		return;
+	}
+#endif
+	if (clipStreaming)
+	{
+		clipPixels(VHL, 1);
+		return;
+	}
 #ifndef DISABLE_SERIAL
 	if (isParallel())
 #endif
@@ -176,13 +218,25 @@ void UTFT::LCD_Write_DATA16(uint16_t VHL)
 
 void UTFT::LCD_Write_Repeated_DATA16(uint16_t VHL, uint16_t num)
 {
+#if UTFT_BAND_BUFFER_PIXELS != 0
+	if (composing)
+	{
+		composePixels(VHL, num);
+		return;
+	}
+#endif
+	if (clipStreaming)
+	{
+		clipPixels(VHL, num);
+		return;
+	}
 #ifndef DISABLE_SERIAL
 	if (isParallel())
 #endif
 	{
 		setRSHigh();
 #ifndef DISABLE_8BIT
-		if (displayTransferMode == TMode8bit)
+		if (getTransferMode() == TMode8bit)
 		{
 			do
 			{
@@ -211,6 +265,18 @@ void UTFT::LCD_Write_Repeated_DATA16(uint16_t VHL, uint16_t num)
 
 void UTFT::LCD_Write_Repeated_DATA16(uint16_t VHL, uint16_t num1, uint16_t num2)
 {
+#if UTFT_BAND_BUFFER_PIXELS != 0
+	if (composing)
+	{
+		composePixels(VHL, (uint32_t)num1 * num2);
+		return;
+	}
+#endif
+	if (clipStreaming)
+	{
+		clipPixels(VHL, (uint32_t)num1 * num2);
+		return;
+	}
 	while (num2 != 0)
 	{
 		LCD_Write_Repeated_DATA16(VHL, num1);
@@ -249,7 +315,13 @@ void UTFT::LCD_Write_COM_DATA8(uint8_t com1, uint8_t dat1)
 
 void UTFT::InitLCD(DisplayOrientation po, bool is24bit)
 {
+#ifdef UTFT_ONLY_LANDSCAPE
+	orient = static_cast<DisplayOrientation>(po | SwapXY);
+#else
 	orient = po;
+#endif
+	windowValid = false;
+	scrollTop = scrollHeight = scrollOffset = 0;		// resetting the controller cancels any scrolling
 	textXpos = 0;
 	textYpos = 0;
 	lastCharColData = 0UL;
@@ -264,7 +336,7 @@ void UTFT::InitLCD(DisplayOrientation po, bool is24bit)
 
 	assertCS();
 
-	switch(displayModel)
+	switch (getModel())
 	{
 #ifndef DISABLE_HX8347A
 	case HX8347A:
@@ -1366,9 +1438,42 @@ void UTFT::InitLCD(DisplayOrientation po, bool is24bit)
 	cfont.font=0;
 }
 
-void UTFT::setXY(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+// Return how far down the frame memory scrolling moves a window with rows y1 to y2, modulo 65536.
+// If the window is inside the scrolled area, it moves to where its content has been scrolled from.
+// A window is moved as a whole, so one that overlaps the scrolled area must lie inside it and on one side of the row at which it wraps round.
+// Callers keep to this by scrolling whole rows of fields. We don't split a window that breaks the rule, because the pixels written to it
+// would have to be split as well; instead we count it in scrollBoundaryCrossings, which the host build checks.
+uint16_t UTFT::scrollShift(uint16_t y1, uint16_t y2)
+{
+	if (scrollOffset != 0 && y2 >= scrollTop && y1 < scrollTop + scrollHeight)
+	{
+		const uint16_t wrapRow = scrollTop + scrollHeight - scrollOffset;		// first row whose content has wrapped round from the top
+		const bool inside = y1 >= scrollTop && y2 < scrollTop + scrollHeight;
+		if (!inside || (y1 < wrapRow && y2 >= wrapRow))
+		{
+			++scrollBoundaryCrossings;
+		}
+		if (inside)
+		{
+			return (y1 >= wrapRow) ? scrollOffset - scrollHeight : scrollOffset;
+		}
+	}
+	return 0;
+}
+
+// Convert a window in display coordinates to the coordinates that setXY sends to the controller, allowing for scrolling and orientation
+void UTFT::mapWindow(uint16_t& x1, uint16_t& y1, uint16_t& x2, uint16_t& y2)
+{
+	mapWindow(x1, y1, x2, y2, scrollShift(y1, y2));
+}
+
+// Convert a window as above, moving it down by 'shift' rows for scrolling
+void UTFT::mapWindow(uint16_t& x1, uint16_t& y1, uint16_t& x2, uint16_t& y2, uint16_t shift) const
 {
-	if (orient & SwapXY)
+	y1 += shift;
+	y2 += shift;
+
+	if (isSwapXY())
 	{
 		swap(x1, y1);
 		swap(x2, y2);
@@ -1401,8 +1506,54 @@ void UTFT::setXY(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
 			swap(x1, x2);
 		}
 	}
+}
+
+void UTFT::setXY(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+	// The part of the window inside the clip rectangle is moved by the same amount as the whole window, so that the pixels line up
+	const uint16_t shift = scrollShift(y1, y2);
+#if UTFT_BAND_BUFFER_PIXELS != 0
+	if (composing)
+	{
+		// The band is already clipped
+		mapWindow(x1, y1, x2, y2, shift);
+		composeWindow(x1, y1, x2, y2);
+		return;
+	}
+#endif
+
+	bool clipped = false;
+	if (clipDepth != 0)
+	{
+		const ClipRect& clip = clipStack[clipDepth - 1];
+		uint16_t cx1 = (x1 > clip.x1) ? x1 : clip.x1, cy1 = (y1 > clip.y1) ? y1 : clip.y1;
+		uint16_t cx2 = (x2 < clip.x2) ? x2 : clip.x2, cy2 = (y2 < clip.y2) ? y2 : clip.y2;
+		if (cx1 != x1 || cy1 != y1 || cx2 != x2 || cy2 != y2)
+		{
+			clipped = true;
+			mapWindow(x1, y1, x2, y2, shift);
+			composeWindow(x1, y1, x2, y2);
+			if (cx1 > cx2 || cy1 > cy2)
+			{
+				// None of the window is visible, so drop all the pixels written to it without telling the controller
+				clipMx1 = clipMy1 = 1;
+				clipMx2 = clipMy2 = 0;
+				clipStreaming = true;
+				return;
+			}
+			mapWindow(cx1, cy1, cx2, cy2, shift);
+			x1 = clipMx1 = cx1;
+			y1 = clipMy1 = cy1;
+			x2 = clipMx2 = cx2;
+			y2 = clipMy2 = cy2;
+		}
+	}
+	if (!clipped)
+	{
+		mapWindow(x1, y1, x2, y2, shift);
+	}
 
-	switch(displayModel)
+	switch (getModel())
 	{
 #if !(defined(DISABLE_HX8347A) && defined(DISABLE_HX8352A))
 	case HX8347A:
@@ -1501,16 +1652,28 @@ void UTFT::setXY(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
 	case SSD1963_800:
 		swap(x1, y1);
 		swap(x2, y2);
-		LCD_Write_COM(0x2a); 
-  		LCD_Write_DATA8(x1>>8);
-  		LCD_Write_DATA8(x1);
-  		LCD_Write_DATA8(x2>>8);
-  		LCD_Write_DATA8(x2);
-		LCD_Write_COM(0x2b); 
-  		LCD_Write_DATA8(y1>>8);
-  		LCD_Write_DATA8(y1);
-  		LCD_Write_DATA8(y2>>8);
-  		LCD_Write_DATA8(y2);
+		// Only send the column and page ranges if they have changed. We always send the memory write command, because that resets the write pointer.
+		if (!windowValid || x1 != windowX1 || x2 != windowX2)
+		{
+			LCD_Write_COM(0x2a); 
+  			LCD_Write_DATA8(x1>>8);
+  			LCD_Write_DATA8(x1);
+  			LCD_Write_DATA8(x2>>8);
+  			LCD_Write_DATA8(x2);
+			windowX1 = x1;
+			windowX2 = x2;
+		}
+		if (!windowValid || y1 != windowY1 || y2 != windowY2)
+		{
+			LCD_Write_COM(0x2b); 
+  			LCD_Write_DATA8(y1>>8);
+  			LCD_Write_DATA8(y1);
+  			LCD_Write_DATA8(y2>>8);
+  			LCD_Write_DATA8(y2);
+			windowY1 = y1;
+			windowY2 = y2;
+		}
+		windowValid = true;
 		LCD_Write_COM(0x2c); 
 		break;
 #endif
@@ -1527,11 +1690,14 @@ void UTFT::setXY(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
 	default:
 		break;
 	}
+	clipStreaming = clipped;
 }
 
+// Set the address window to the whole display, ready to fill it.
+// Primitives used to call this when they had finished, but every primitive sets its own window before writing, and they did it after releasing CS so the display ignored it anyway.
 void UTFT::clrXY()
 {
-	if (orient & SwapXY)
+	if (isSwapXY())
 	{
 		setXY(0, 0, disp_y_size, disp_x_size);
 	}
@@ -1592,8 +1758,18 @@ void UTFT::fillRect(int x1, int y1, int x2, int y2, Colour grad)
 		swap(y1, y2);
 	}
 
+	// Without a gradient the whole rectangle is one window, which saves setting up a window for every line
+	if (grad == 0)
+	{
+		assertCS();
+		setXY(x1, y1, x2, y2);
+		LCD_Write_Repeated_DATA16(fcolour, x2 - x1 + 1, y2 - y1 + 1);
+		removeCS();
+		return;
+	}
+
 	Colour fcolourSave = fcolour;
-	if (orient & SwapXY)
+	if (isSwapXY())
 	{
 		for (int i = x1; i <= x2; i++)
 		{
@@ -1612,6 +1788,18 @@ void UTFT::fillRect(int x1, int y1, int x2, int y2, Colour grad)
 	fcolour = fcolourSave;
 }
 
+// Reduce each channel of a colour by the corresponding channel of grad, stopping at zero.
+// Subtracting the packed values would borrow from the next channel when one of them ran out.
+static Colour reduceColour(Colour c, Colour grad)
+{
+	const unsigned int r = c & 0xF800, dr = grad & 0xF800;
+	const unsigned int g = c & 0x07E0, dg = grad & 0x07E0;
+	const unsigned int b = c & 0x001F, db = grad & 0x001F;
+	return ((r > dr) ? r - dr : 0) | ((g > dg) ? g - dg : 0) | ((b > db) ? b - db : 0);
+}
+
+// Fill a rectangle with rounded corners, getting darker by grad every gradChange rows.
+// The top two and bottom two rows are inset to round the corners. All the rows in between are written as a single window.
 void UTFT::fillRoundRect(int x1, int y1, int x2, int y2, Colour grad, uint8_t gradChange)
 {
 	if (x1>x2)
@@ -1625,46 +1813,113 @@ void UTFT::fillRoundRect(int x1, int y1, int x2, int y2, Colour grad, uint8_t gr
 
 	if ((x2-x1) > 4 && (y2-y1) > 4)
 	{
-		Colour fcolourSave = fcolour;
-		uint8_t gradCount = 0;
-
-		drawHLine(x1+2, y1, x2-x1-4);
-		++y1;
-		if (++gradCount == gradChange)
+		// Work out the colour of each band of rows. Once every channel that grad reduces has reached zero the colour stops changing,
+		// and that takes at most 63 steps, so we never need more than MaxGradientBands bands.
+		Colour bandColours[MaxGradientBands];
+		const unsigned int numRows = y2 - y1 + 1;
+		unsigned int numBands = 1;
+		bandColours[0] = fcolour;
+		if (grad != 0 && gradChange != 0)
+		{
+			const unsigned int bandsNeeded = (numRows + gradChange - 1)/gradChange;
+			numBands = (bandsNeeded < MaxGradientBands) ? bandsNeeded : MaxGradientBands;
+			for (unsigned int i = 1; i < numBands; ++i)
+			{
+				bandColours[i] = reduceColour(bandColours[i - 1], grad);
+			}
+		}
+		else
 		{
-			gradCount = 0;
-			fcolour -= grad;
+			gradChange = 0;
 		}
-		drawHLine(x1+1, y1, x2-x1-2);
-		++y1;
-		if (++gradCount == gradChange)
+
+		assertCS();
+		setXY(x1 + 2, y1, x2 - 2, y1);
+		LCD_Write_Repeated_DATA16(bandColours[0], x2 - x1 - 3);
+		setXY(x1 + 1, y1 + 1, x2 - 1, y1 + 1);
+		LCD_Write_Repeated_DATA16(bandColours[rowBand(1, gradChange, numBands)], x2 - x1 - 1);
+		fillGradientRows(x1, y1 + 2, x2, y2 - 2, 2, bandColours, numBands, gradChange);
+		setXY(x1 + 1, y2 - 1, x2 - 1, y2 - 1);
+		LCD_Write_Repeated_DATA16(bandColours[rowBand(numRows - 2, gradChange, numBands)], x2 - x1 - 1);
+		setXY(x1 + 2, y2, x2 - 2, y2);
+		LCD_Write_Repeated_DATA16(bandColours[rowBand(numRows - 1, gradChange, numBands)], x2 - x1 - 3);
+		removeCS();
+	}
+}
+
+// Return the band that a row of a gradient fill is in, given its index from the top of the shape
+inline unsigned int UTFT::rowBand(unsigned int row, uint8_t gradChange, unsigned int numBands)
+{
+	if (gradChange == 0)
+	{
+		return 0;
+	}
+	const unsigned int band = row/gradChange;
+	return (band < numBands) ? band : numBands - 1;
+}
+
+// Fill rows y1 to y2 between x1 and x2 inclusive with colours taken from bands of gradChange rows. firstRow is the index of row y1 within the shape.
+// When X and Y are swapped the display controller fills each column of the window in turn, so we can set up the window once
+// and send each column as one run per band, bottom-to-top if text is inverted. Otherwise we set up a window for each row.
+void UTFT::fillGradientRows(int x1, int y1, int x2, int y2, unsigned int firstRow, const Colour *bandColours, unsigned int numBands, uint8_t gradChange)
+{
+	if (y2 < y1)
+	{
+		return;
+	}
+
+	if (isSwapXY())
+	{
+		// Build the list of runs down one column in the order the controller wants them
+		Colour runColours[MaxGradientBands];
+		uint16_t runLengths[MaxGradientBands];
+		unsigned int numRuns = 0;
+		const unsigned int lastRow = firstRow + (y2 - y1);
+		unsigned int row = firstRow;
+		while (row <= lastRow)
 		{
-			gradCount = 0;
-			fcolour -= grad;
+			const unsigned int band = rowBand(row, gradChange, numBands);
+			const unsigned int bandEnd = (gradChange == 0 || band + 1 == numBands) ? lastRow : (band + 1) * gradChange - 1;
+			const unsigned int runEnd = (bandEnd < lastRow) ? bandEnd : lastRow;
+			runColours[numRuns] = bandColours[band];
+			runLengths[numRuns] = runEnd + 1 - row;
+			++numRuns;
+			row = runEnd + 1;
 		}
-		while (y1 + 1 < y2)
+
+		setXY(x1, y1, x2, y2);
+		for (int x = x1; x <= x2; ++x)
 		{
-			drawHLine(x1, y1, x2-x1);
-			++y1;
-			if (++gradCount == gradChange)
+			if (orient & InvertText)
+			{
+				for (unsigned int i = numRuns; i != 0; )
+				{
+					--i;
+					LCD_Write_Repeated_DATA16(runColours[i], runLengths[i]);
+				}
+			}
+			else
 			{
-				gradCount = 0;
-				fcolour -= grad;
+				for (unsigned int i = 0; i < numRuns; ++i)
+				{
+					LCD_Write_Repeated_DATA16(runColours[i], runLengths[i]);
+				}
 			}
 		}
-		drawHLine(x1+1, y1, x2-x1-2);
-		++y1;
-		if (++gradCount == gradChange)
+	}
+	else
+	{
+		for (int y = y1; y <= y2; ++y)
 		{
-			gradCount = 0;
-			fcolour -= grad;
+			setXY(x1, y, x2, y);
+			LCD_Write_Repeated_DATA16(bandColours[rowBand(firstRow + (y - y1), gradChange, numBands)], x2 - x1 + 1);
 		}
-		drawHLine(x1+2, y1, x2-x1-4);
-		
-		fcolour = fcolourSave;
 	}
 }
 
+// Draw a circle using the midpoint algorithm.
+// Walking round one octant, the points with the same y1 form a horizontal run in the octants next to the vertical axis
+// and a vertical run in the octants next to the horizontal axis, so we write each run as a single window instead of one pixel at a time.
 void UTFT::drawCircle(int x, int y, int radius)
 {
 	int f = 1 - radius;
@@ -1672,91 +1927,107 @@ void UTFT::drawCircle(int x, int y, int radius)
 	int ddF_y = -2 * radius;
 	int x1 = 0;
 	int y1 = radius;
+	int runStart = 0;
 	
 	assertCS();
-	setXY(x, y + radius, x, y + radius);
-	LCD_Write_DATA16(fcolour);
-	setXY(x, y - radius, x, y - radius);
-	LCD_Write_DATA16(fcolour);
-	setXY(x + radius, y, x + radius, y);
-	LCD_Write_DATA16(fcolour);
-	setXY(x - radius, y, x - radius, y);
-	LCD_Write_DATA16(fcolour);
- 
 	while(x1 < y1)
 	{
+		const int oldY1 = y1;
 		if(f >= 0) 
 		{
 			y1--;
 			ddF_y += 2;
 			f += ddF_y;
 		}
+		if (y1 != oldY1)
+		{
+			writeCircleRuns(x, y, runStart, x1, oldY1);
+			runStart = x1 + 1;
+		}
 		x1++;
 		ddF_x += 2;
 		f += ddF_x;    
-		setXY(x + x1, y + y1, x + x1, y + y1);
-		LCD_Write_DATA16(fcolour);
-		setXY(x - x1, y + y1, x - x1, y + y1);
-		LCD_Write_DATA16(fcolour);
-		setXY(x + x1, y - y1, x + x1, y - y1);
-		LCD_Write_DATA16(fcolour);
-		setXY(x - x1, y - y1, x - x1, y - y1);
-		LCD_Write_DATA16(fcolour);
-		setXY(x + y1, y + x1, x + y1, y + x1);
-		LCD_Write_DATA16(fcolour);
-		setXY(x - y1, y + x1, x - y1, y + x1);
-		LCD_Write_DATA16(fcolour);
-		setXY(x + y1, y - x1, x + y1, y - x1);
-		LCD_Write_DATA16(fcolour);
-		setXY(x - y1, y - x1, x - y1, y - x1);
-		LCD_Write_DATA16(fcolour);
 	}
+	writeCircleRuns(x, y, runStart, x1, y1);
 	removeCS();
-	clrXY();
 }
 
+// Write the 8 runs of a circle outline that correspond to points (a, d) to (b, d) in the first octant
+void UTFT::writeCircleRuns(int x, int y, int a, int b, int d)
+{
+	if (a == 0)
+	{
+		// The runs on either side of an axis meet, so write them as one
+		writeHRun(x - b, x + b, y + d);
+		writeHRun(x - b, x + b, y - d);
+		writeVRun(x + d, y - b, y + b);
+		writeVRun(x - d, y - b, y + b);
+	}
+	else
+	{
+		writeHRun(x + a, x + b, y + d);
+		writeHRun(x - b, x - a, y + d);
+		writeHRun(x + a, x + b, y - d);
+		writeHRun(x - b, x - a, y - d);
+		writeVRun(x + d, y + a, y + b);
+		writeVRun(x + d, y - b, y - a);
+		writeVRun(x - d, y + a, y + b);
+		writeVRun(x - d, y - b, y - a);
+	}
+}
+
+// Write a horizontal run of pixels in the foreground colour. CS must already be asserted.
+void UTFT::writeHRun(int x1, int x2, int y)
+{
+	setXY(x1, y, x2, y);
+	LCD_Write_Repeated_DATA16(fcolour, x2 - x1 + 1);
+}
+
+// Write a vertical run of pixels in the foreground colour. CS must already be asserted.
+void UTFT::writeVRun(int x, int y1, int y2)
+{
+	setXY(x, y1, x, y2);
+	LCD_Write_Repeated_DATA16(fcolour, y2 - y1 + 1);
+}
+
+// Fill a circle, writing each scan line once.
+// The half-width of each line is the furthest point from the centre that drawCircle would plot in that line. drawCircle's midpoint test
+// keeps a point (u, v) in the octant next to the vertical axis if 4u^2 + (2v - 1)^2 < 4r^2 + 1, and a point in the octant next to the
+// horizontal axis if the same holds with u and v exchanged. Both limits shrink as we move away from the centre line, so we track them incrementally.
 void UTFT::fillCircle(int x, int y, int radius)
 {
-	int f = 1 - radius;
-	int ddF_x = 1;
-	int ddF_y = -2 * radius;
-	int x1 = 0;
-	int y1 = radius;
+	const int32_t limit = 4 * radius * radius + 1;
+	int widthA = radius, widthB = radius;
 	
 	assertCS();
-	setXY(x, y + radius, x, y + radius);
-	LCD_Write_DATA16(fcolour);
-	setXY(x, y - radius, x, y - radius);
-	LCD_Write_DATA16(fcolour);
-	setXY(x - radius, y, x + radius, y);
-	LCD_Write_Repeated_DATA16(fcolour, radius + radius);
- 
-	while(x1 < y1)
+	for (int d = 0; d <= radius; ++d)
 	{
-		if(f >= 0) 
+		const int32_t vA = (2 * d - 1) * (2 * d - 1);
+		while (widthA >= 0 && 4 * widthA * widthA + vA >= limit)
 		{
-			y1--;
-			ddF_y += 2;
-			f += ddF_y;
+			--widthA;
+		}
+		const int32_t vB = 4 * d * d;
+		while (widthB >= 0 && (2 * widthB - 1) * (2 * widthB - 1) + vB >= limit)
+		{
+			--widthB;
+		}
+		const int width = (radius == 0) ? 0 : (widthA > widthB) ? widthA : widthB;
+		if (width >= 0)
+		{
+			writeHRun(x - width, x + width, y + d);
+			if (d != 0)
+			{
+				writeHRun(x - width, x + width, y - d);
+			}
 		}
-		x1++;
-		ddF_x += 2;
-		f += ddF_x;    
-		setXY(x - x1, y + y1, x + x1, y + y1);
-		LCD_Write_Repeated_DATA16(fcolour, x1 + x1);
-		setXY(x - x1, y - y1, x + x1, y - y1);
-		LCD_Write_Repeated_DATA16(fcolour, x1 + x1);
-		setXY(x - y1, y + x1, x + y1, y + x1);
-		LCD_Write_Repeated_DATA16(fcolour, y1 + y1);
-		setXY(x - y1, y - x1, x + y1, y - x1);
-		LCD_Write_Repeated_DATA16(fcolour, y1 + y1);
 	}
 	removeCS();
-	clrXY();
 }
 
 void UTFT::clrScr()
 {
+	resetScroll();
 	assertCS();
 	clrXY();
 	LCD_Write_Repeated_DATA16(0, disp_x_size+1, disp_y_size+1);
@@ -1770,6 +2041,7 @@ uint16_t UTFT::fromRGB(uint8_t r, uint8_t g, uint8_t b)
 
 void UTFT::fillScr(Colour c)
 {
+	resetScroll();
 	assertCS();
 	clrXY();
 	LCD_Write_Repeated_DATA16(c, disp_x_size+1, disp_y_size+1);
@@ -1782,7 +2054,6 @@ void UTFT::drawPixel(int x, int y)
 	setXY(x, y, x, y);
 	LCD_Write_DATA16(fcolour);
 	removeCS();
-	clrXY();
 }
 
 void UTFT::drawLine(int x1, int y1, int x2, int y2)
@@ -1806,34 +2077,54 @@ void UTFT::drawLine(int x1, int y1, int x2, int y2)
 	else
 	{
 		// Draw a line using the Bresenham Algorithm (thanks Wikipedia)
+		// Consecutive pixels in the same row of a mostly horizontal line, or the same column of a mostly vertical one, are written as a single run.
 		int dx = (x2 >= x1) ? x2 - x1 : x1 - x2;
 		int dy = (y2 >= y1) ? y2 - y1 : y1 - y2;
 		int sx = (x1 < x2) ? 1 : -1;
 		int sy = (y1 < y2) ? 1 : -1;
 		int err = dx - dy;
+		const bool horizontal = (dx >= dy);
+		int runX = x1, runY = y1;
 	 
 		assertCS();
 		for (;;)
 		{
-			setXY(x1, y1, x1, y1);
-			LCD_Write_DATA16(fcolour);
-			if (x1 == x2 && y1 == y2) break;
-			int e2 = err + err;
-			if (e2 > -dy)
-			{ 
-				err -= dy;
-				x1 += sx;
+			const int px = x1, py = y1;
+			const bool done = (x1 == x2 && y1 == y2);
+			if (!done)
+			{
+				int e2 = err + err;
+				if (e2 > -dy)
+				{ 
+					err -= dy;
+					x1 += sx;
+				}
+				if (e2 < dx)
+				{ 
+					err += dx;
+					y1 += sy;
+				}
 			}
-			if (e2 < dx)
-			{ 
-				err += dx;
-				y1 += sy;
+			if (done || (horizontal && y1 != py) || (!horizontal && x1 != px))
+			{
+				if (horizontal)
+				{
+					writeHRun((runX < px) ? runX : px, (runX < px) ? px : runX, py);
+				}
+				else
+				{
+					writeVRun(px, (runY < py) ? runY : py, (runY < py) ? py : runY);
+				}
+				if (done)
+				{
+					break;
+				}
+				runX = x1;
+				runY = y1;
 			}
 		}
 		removeCS();
 	}
-
-	clrXY();
 }
 
 void UTFT::drawHLine(int x, int y, int len)
@@ -1842,7 +2133,6 @@ void UTFT::drawHLine(int x, int y, int len)
 	setXY(x, y, x+len, y);
 	LCD_Write_Repeated_DATA16(fcolour, len + 1);
 	removeCS();
-	clrXY();
 }
 
 void UTFT::drawVLine(int x, int y, int len)
@@ -1851,7 +2141,6 @@ void UTFT::drawVLine(int x, int y, int len)
 	setXY(x, y, x, y+len);
 	LCD_Write_Repeated_DATA16(fcolour, len + 1);
 	removeCS();
-	clrXY();
 }
 
 // New print functions
@@ -1859,9 +2148,10 @@ void UTFT::setTextPos(uint16_t x, uint16_t y, uint16_t rm)
 {
 	textXpos = x;
 	textYpos = y;
-	uint16_t xSize = (orient & SwapXY) ? disp_y_size : disp_x_size;
+	uint16_t xSize = isSwapXY() ? disp_y_size : disp_x_size;
 	textRightMargin = (rm > xSize) ? xSize + 1 : rm;
     lastCharColData = 0UL;    // flag that we just set the cursor position, so no space before next character
+	numContinuationBytesLeft = 0;	// don't carry a UTF-8 sequence left unfinished by the last string into the next one
 }
 
 size_t UTFT::print(const char *s, uint16_t x, uint16_t y, uint16_t rm)
@@ -1884,7 +2174,6 @@ void UTFT::clearToMargin()
 		setXY(textXpos, textYpos, textRightMargin - 1, textYpos + ySize - 1);
 		LCD_Write_Repeated_DATA16(bcolour, textRightMargin - textXpos, ySize);
 		removeCS();
-		clrXY();
 	}
 }
 
@@ -1896,7 +2185,7 @@ size_t UTFT::write(uint8_t c)
 	{
 		if (c < 0x80)
 		{
-			return writeNative(c);
+			return writeChar(c);
 		}
 		else if ((c & 0xE0) == 0xC0)
 		{
@@ -1930,7 +2219,7 @@ size_t UTFT::write(uint8_t c)
 		}
 		else
 		{
-			return writeNative(0x7F);
+			return writeChar(0x7F);
 		}
 	}
 	else if ((c & 0xC0) == 0x80)
@@ -1939,7 +2228,7 @@ size_t UTFT::write(uint8_t c)
 		--numContinuationBytesLeft;
 		if (numContinuationBytesLeft == 0)
 		{
-			return writeNative((charVal < 0x100) ? (uint8_t)charVal : 0x7F);
+			return writeChar(charVal);
 		}
 		else
 		{
@@ -1950,30 +2239,44 @@ size_t UTFT::write(uint8_t c)
 	{
 		// Bad UTF8 state
 		numContinuationBytesLeft = 0;
-		return writeNative(0x7F);
+		return writeChar(0x7F);
 	}
 }
 
-// Write a character.
-// If textYpos is off the end of the display, then don't write anything, just update textXpos and lastCharColData
-size_t UTFT::writeNative(uint8_t c)
+// Read a 16-bit little-endian value from font data, which need not be aligned
+static inline uint16_t readLE16(const uint8_t *p)
 {
-	if (translateFrom != 0)
+	return p[0] | ((uint16_t)p[1] << 8);
+}
+
+// Read a column of font data. We assemble it a byte at a time, so that we don't do unaligned reads or pick up bytes from the next column.
+static uint32_t readColumn(const uint8_t *p, uint8_t bytesPerColumn)
+{
+	uint32_t colData = 0;
+	for (uint8_t j = 0; j < bytesPerColumn; ++j)
 	{
-		const char* p = strchr(translateFrom, c);
-		if (p != 0)
-		{
-			c = translateTo[p - translateFrom];
-		}
+		colData |= (uint32_t)p[j] << (8 * j);
 	}
+	return colData;
+}
 
-    if (c < cfont.firstChar || c > cfont.lastChar)
-    {
+// Return the mask for the bits of a font column that are within the character height
+static inline uint32_t fontColumnMask(uint8_t ySize)
+{
+	return (ySize >= 32) ? 0xFFFFFFFF : (1UL << ySize) - 1;
+}
+
+// Write a character.
+// If textYpos is off the end of the display, then don't write anything, just update textXpos and lastCharColData
+size_t UTFT::writeNative(uint32_t c)
+{
+	const int glyphNumber = lookupGlyph(translate(c));
+	if (glyphNumber < 0)
+	{
 		return 0;
-    }
+	}
     
 	uint8_t ySize = cfont.y_size;
-    const uint8_t bytesPerColumn = (ySize + 7)/8;
 	if (textYpos > disp_y_size)
 	{
 		ySize = 0;
@@ -1982,54 +2285,24 @@ size_t UTFT::writeNative(uint8_t c)
 	{
 		ySize = disp_y_size + 1 - textYpos;
 	}
-    const uint8_t bytesPerChar = (bytesPerColumn * cfont.x_size) + 1;
-    const uint8_t *fontPtr = (const uint8_t*)cfont.font + (bytesPerChar * (c - cfont.firstChar));
-    
-	const uint32_t cmask = (1UL << cfont.y_size) - 1;
-    
-    uint8_t nCols = *(uint8_t*)(fontPtr++);
-	assertCS();
-	
-	if (lastCharColData != 0)	// if we have written anything other than spaces
+	if (cfont.bitsPerPixel != 1)
 	{
-		uint8_t numSpaces = cfont.spaces;
-
-		// Decide whether to add the full number of space columns first (auto-kerning)
-		// We don't add a space column before a space character.
-		// We add a space column after a space character if we would have added one between the preceding and following characters.
-		uint32_t thisCharColData = *(uint32_t*)(fontPtr) & cmask;    // atmega328p is little-endian
-		if (thisCharColData == 0)  // for characters with deliberate space row at the start, e.g. decimal point
-		{
-			thisCharColData = *(uint32_t*)(fontPtr + bytesPerColumn) & cmask;	// get the next column instead
-		}
-
-		bool kern = (numSpaces >= 2)
-						? ((thisCharColData & lastCharColData) == 0)
-						: (((thisCharColData | (thisCharColData << 1)) & (lastCharColData | (lastCharColData << 1))) == 0);
-		if (kern)
-		{
-			--numSpaces;	// kern the character pair
-		}
-		while (numSpaces != 0 && textXpos < textRightMargin)
-		{
-			// Add a single space column after the character
-			if (ySize != 0 && !transparentBackground)
-			{
-				setXY(textXpos, textYpos, textXpos, textYpos + ySize - 1);
-				LCD_Write_Repeated_DATA16(bcolour, ySize);
-			}
-			++textXpos;
-			--numSpaces;
-		}      
+		writeAntiAliased(glyphNumber, ySize);
+		return 1;
 	}
 
+	const CachedGlyph *glyph = getGlyph(glyphNumber);
+	assertCS();
+	writeSpaceColumns(glyph->kernColData, ySize);
+
+	const uint32_t *colPtr = glyph->colData;
+	uint8_t nCols = glyph->nCols;
     while (nCols != 0 && textXpos < textRightMargin)
     {
-		uint32_t colData = *(uint32_t*)(fontPtr);
-		fontPtr += bytesPerColumn;
+		uint32_t colData = *colPtr++;
 		if (colData != 0)
 		{
-			lastCharColData = colData & cmask;
+			lastCharColData = colData;
 		}
 		if (ySize != 0)
 		{
@@ -2098,28 +2371,427 @@ size_t UTFT::writeNative(uint8_t c)
 		++textXpos;
     }
  	removeCS();
-	clrXY();
    
 	return 1;
 }
 
-// Set up translation for characters. Useful for translating fullstop into decimal point, or changing the width of spaces.
-// Either the first string passed must be NULL, or the two strings must have equal lengths as returned by strlen().
-void UTFT::setTranslation(const char *tFrom, const char *tTo)
+// Write the space columns between the previous character and the next one, given the data used for kerning the next one
+void UTFT::writeSpaceColumns(uint32_t kernColData, uint8_t ySize)
 {
-	translateFrom = tFrom;
-	translateTo = tTo;
+	if (lastCharColData != 0)	// if we have written anything other than spaces
+	{
+		uint8_t numSpaces = cfont.spaces;
+
+		// Decide whether to add the full number of space columns first (auto-kerning)
+		// We don't add a space column before a space character.
+		// We add a space column after a space character if we would have added one between the preceding and following characters.
+		if (canKern(kernColData, lastCharColData))
+		{
+			--numSpaces;	// kern the character pair
+		}
+		while (numSpaces != 0 && textXpos < textRightMargin)
+		{
+			// Add a single space column after the character
+			if (ySize != 0 && !transparentBackground)
+			{
+				setXY(textXpos, textYpos, textXpos, textYpos + ySize - 1);
+				LCD_Write_Repeated_DATA16(bcolour, ySize);
+			}
+			++textXpos;
+			--numSpaces;
+		}
+	}
 }
 
-void UTFT::setFont(const uint8_t* font)
+// Write a character in an anti-aliased font. These are always compact fonts with metrics, which give us the kerning data; setFont rejects any without.
+// The glyphs are read directly from flash because the glyph cache only holds 1-bit columns.
+// Each pixel is written in a colour looked up from its level in the blend table, so it costs no more than a 1-bit pixel.
+// We can't read back from the display, so with a transparent background we can't blend; instead we write the pixels
+// that are at least half covered in the foreground colour, which is how the kerning data in the metrics was derived.
+void UTFT::writeAntiAliased(unsigned int glyphNumber, uint8_t ySize)
 {
+	const uint8_t maskBytes = (cfont.y_size + 7)/8;
+	const uint32_t cmask = fontColumnMask(cfont.y_size);
+	const uint8_t *metricsPtr = cfont.metrics + ((1 + 2 * maskBytes) * glyphNumber) + 1;
+	const uint32_t kernColData = readColumn(metricsPtr, maskBytes) & cmask;
+	const uint32_t glyphLastColData = readColumn(metricsPtr + maskBytes, maskBytes) & cmask;
+
+	const uint8_t *fontPtr = cfont.glyphData + readLE16(cfont.font + (2 * glyphNumber));
+	const uint8_t leftBearing = *fontPtr++;
+	const uint8_t inkCols = *fontPtr++;
+	const uint8_t nCols = leftBearing + inkCols + *fontPtr++;
+	const uint8_t bitsPerPixel = cfont.bitsPerPixel;
+	const uint8_t bytesPerColumn = (cfont.y_size * bitsPerPixel + 7)/8;
+	const uint8_t levelMask = (1u << bitsPerPixel) - 1;
+	const Colour *blend = getBlendTable();
+
+	assertCS();
+	writeSpaceColumns(kernColData, ySize);
+
+	for (uint8_t col = 0; col < nCols && textXpos < textRightMargin; ++col)
+	{
+		if (ySize != 0)
+		{
+			if (col < leftBearing || col >= leftBearing + inkCols)
+			{
+				if (!transparentBackground)
+				{
+					setXY(textXpos, textYpos, textXpos, textYpos + ySize - 1);
+					LCD_Write_Repeated_DATA16(bcolour, ySize);
+				}
+			}
+			else
+			{
+				const uint8_t *colPtr = fontPtr + ((col - leftBearing) * bytesPerColumn);
+				const bool invert = (orient & InvertText) != 0;
+				bool doSetXY = true;
+				for (uint8_t i = 0; i < ySize; ++i)
+				{
+					const unsigned int bitPos = ((invert) ? ySize - 1 - i : i) * bitsPerPixel;
+					const uint8_t level = (colPtr[bitPos >> 3] >> (bitPos & 7)) & levelMask;
+					if (transparentBackground && level * 2 <= levelMask)
+					{
+						doSetXY = true;
+					}
+					else
+					{
+						if (doSetXY)
+						{
+							if (invert)
+							{
+								setXY(textXpos, textYpos, textXpos, textYpos + ySize - i - 1);
+							}
+							else
+							{
+								setXY(textXpos, textYpos + i, textXpos, textYpos + ySize - 1);
+							}
+							doSetXY = false;
+						}
+						LCD_Write_DATA16((transparentBackground) ? fcolour : blend[level]);
+					}
+				}
+			}
+		}
+		++textXpos;
+	}
+	if (glyphLastColData != 0)
+	{
+		lastCharColData = glyphLastColData;
+	}
+	removeCS();
+}
+
+// Get the table of colours for the levels of the current anti-aliased font, rebuilding it if the colours have changed since it was last built.
+// Colours are 5-6-5 RGB, so we blend each channel separately with rounding.
+const Colour *UTFT::getBlendTable()
+{
+	const uint8_t levels = 1u << cfont.bitsPerPixel;
+	if (levels != blendLevels || fcolour != blendForeground || bcolour != blendBackground)
+	{
+		const unsigned int maxLevel = levels - 1;
+		for (unsigned int level = 0; level <= maxLevel; ++level)
+		{
+			const unsigned int bgWeight = maxLevel - level;
+			const unsigned int r = (((fcolour >> 11) * level) + ((bcolour >> 11) * bgWeight) + maxLevel/2)/maxLevel;
+			const unsigned int g = ((((fcolour >> 5) & 0x3F) * level) + (((bcolour >> 5) & 0x3F) * bgWeight) + maxLevel/2)/maxLevel;
+			const unsigned int b = (((fcolour & 0x1F) * level) + ((bcolour & 0x1F) * bgWeight) + maxLevel/2)/maxLevel;
+			blendTable[level] = (Colour)((r << 11) | (g << 5) | b);
+		}
+		blendForeground = fcolour;
+		blendBackground = bcolour;
+		blendLevels = levels;
+	}
+	return blendTable;
+}
+
+// Apply the character translation set up by setTranslation
+uint32_t UTFT::translate(uint32_t c) const
+{
+	if (translateFrom != 0 && c < 0x100)
+	{
+		const char* p = strchr(translateFrom, c);
+		if (p != 0)
+		{
+			c = translateTo[p - translateFrom];
+		}
+	}
+	return c;
+}
+
+// Find the number of the glyph for a character in the current font, or return -1 if the font doesn't have that character
+int UTFT::findGlyph(uint32_t c) const
+{
+	if (cfont.ranges == NULL)
+	{
+		return (c >= cfont.firstChar && c <= cfont.lastChar) ? (int)(c - cfont.firstChar) : -1;
+	}
+
+	// Binary search of the character range table
+	unsigned int low = 0, high = cfont.numRanges;
+	while (low < high)
+	{
+		const unsigned int mid = (low + high)/2;
+		const uint8_t *range = cfont.ranges + (6 * mid);
+		const uint32_t first = readLE16(range);
+		if (c < first)
+		{
+			high = mid;
+		}
+		else if (c > readLE16(range + 2))
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			return (int)(readLE16(range + 4) + (c - first));
+		}
+	}
+	return -1;
+}
+
+// Find the glyph to display for a character. Characters beyond Latin-1 that the font doesn't have are shown using the glyph for 0x7F.
+int UTFT::lookupGlyph(uint32_t c) const
+{
+	const int glyphNumber = findGlyph(c);
+	return (glyphNumber < 0 && c >= 0x100) ? findGlyph(0x7F) : glyphNumber;
+}
+
+// Decide whether to kern a character pair, given the first column of the new character and the last column of the previous one
+bool UTFT::canKern(uint32_t thisCharColData, uint32_t prevCharColData) const
+{
+	return (cfont.spaces >= 2)
+			? ((thisCharColData & prevCharColData) == 0)
+			: (((thisCharColData | (thisCharColData << 1)) & (prevCharColData | (prevCharColData << 1))) == 0);
+}
+
+// Measure a character instead of writing it.
+// This must give the same result as writeNative, including the auto-kerning and stopping at the right margin.
+size_t UTFT::measureNative(uint32_t c)
+{
+	const int glyphNumber = lookupGlyph(translate(c));
+	if (glyphNumber < 0)
+	{
+		return 0;
+	}
+
+	uint8_t advance;
+	uint32_t kernColData, lastColData;
+	if (cfont.metrics != NULL)
+	{
+		const uint8_t bytesPerColumn = (cfont.y_size + 7)/8;
+		const uint8_t *p = cfont.metrics + ((1 + 2 * bytesPerColumn) * glyphNumber);
+		advance = *p++;
+		kernColData = readColumn(p, bytesPerColumn) & fontColumnMask(cfont.y_size);
+		lastColData = readColumn(p + bytesPerColumn, bytesPerColumn) & fontColumnMask(cfont.y_size);
+	}
+	else
+	{
+		const CachedGlyph *glyph = getGlyph(glyphNumber);
+		advance = glyph->nCols;
+		kernColData = glyph->kernColData;
+		lastColData = glyph->lastColData;
+	}
+
+	unsigned int numCols = advance;
+	if (measureLastColData != 0)	// if we have measured anything other than spaces
+	{
+		numCols += cfont.spaces;
+		if (canKern(kernColData, measureLastColData))
+		{
+			--numCols;
+		}
+	}
+
+	// writeNative stops advancing when it reaches the right margin, so we do the same
+	if (measureXpos < measureRightMargin)
+	{
+		measureXpos = (measureXpos + numCols < measureRightMargin) ? measureXpos + numCols : measureRightMargin;
+	}
+	if (lastColData != 0)
+	{
+		measureLastColData = lastColData;
+	}
+	return 1;
+}
+
+void UTFT::beginMeasure(uint16_t maxWidth)
+{
+	const uint16_t xSize = isSwapXY() ? disp_y_size : disp_x_size;
+	measureRightMargin = (maxWidth > xSize) ? xSize + 1 : maxWidth;
+	measureXpos = 0;
+	measureLastColData = 0UL;
+	numContinuationBytesLeft = 0;
+	measuring = true;
+}
+
+uint16_t UTFT::endMeasure()
+{
+	measuring = false;
+	numContinuationBytesLeft = 0;
+	return measureXpos;
+}
+
+uint16_t UTFT::measure(const char *s, uint16_t maxWidth)
+{
+	beginMeasure(maxWidth);
+	Print::print(s);
+	return endMeasure();
+}
+
+// Skipping is measuring that starts from, and ends at, the current text position
+void UTFT::beginSkip()
+{
+	measureRightMargin = textRightMargin;
+	measureXpos = textXpos;
+	measureLastColData = lastCharColData;
+	measuring = true;
+}
+
+void UTFT::endSkip()
+{
+	measuring = false;
+	textXpos = measureXpos;
+	lastCharColData = measureLastColData;
+}
+
+// Set up translation for characters. Useful for translating fullstop into decimal point, or changing the width of spaces.
+// Either the first string passed must be NULL, or the two strings must have equal lengths as returned by strlen().
+void UTFT::setTranslation(const char *tFrom, const char *tTo)
+{
+	translateFrom = tFrom;
+	translateTo = tTo;
+}
+
+// Get the expanded glyph for a character in the current font, decoding it from the font data if it isn't already in the cache.
+// The character must be in the range of the font.
+const CachedGlyph *UTFT::getGlyph(unsigned int glyphNumber)
+{
+	const CachedGlyph *cached = glyphCache.Find(cfont.font, glyphNumber);
+	if (cached != NULL)
+	{
+		return cached;
+	}
+
+	CachedGlyph *glyph = glyphCache.Allocate(cfont.font, glyphNumber);
+	const uint8_t bytesPerColumn = (cfont.y_size + 7)/8;
+	const uint32_t cmask = fontColumnMask(cfont.y_size);
+
+	const uint8_t *fontPtr;
+	uint8_t leftBearing, inkCols, rightBearing;
+	if (cfont.compact)
+	{
+		const uint8_t *offsetPtr = cfont.font + (2 * glyphNumber);
+		fontPtr = cfont.glyphData + readLE16(offsetPtr);
+		leftBearing = *fontPtr++;
+		inkCols = *fontPtr++;
+		rightBearing = *fontPtr++;
+	}
+	else
+	{
+		const unsigned int bytesPerChar = (bytesPerColumn * cfont.x_size) + 1;
+		fontPtr = cfont.font + (bytesPerChar * glyphNumber);
+		leftBearing = rightBearing = 0;
+		inkCols = *fontPtr++;
+	}
+
+	uint8_t nCols = 0;
+	while (leftBearing != 0 && nCols < CachedGlyph::MaxColumns)
+	{
+		glyph->colData[nCols++] = 0;
+		--leftBearing;
+	}
+	uint32_t lastColData = 0;
+	while (inkCols != 0 && nCols < CachedGlyph::MaxColumns)
+	{
+		const uint32_t colData = readColumn(fontPtr, bytesPerColumn) & cmask;
+		glyph->colData[nCols++] = colData;
+		if (colData != 0)
+		{
+			lastColData = colData;
+		}
+		fontPtr += bytesPerColumn;
+		--inkCols;
+	}
+	while (rightBearing != 0 && nCols < CachedGlyph::MaxColumns)
+	{
+		glyph->colData[nCols++] = 0;
+		--rightBearing;
+	}
+	glyph->nCols = nCols;
+	glyph->lastColData = lastColData;
+
+	// For characters with a deliberate space column at the start (e.g. decimal point) we kern against the next column instead
+	glyph->kernColData = (nCols == 0) ? 0
+							: (glyph->colData[0] != 0 || nCols == 1) ? glyph->colData[0]
+								: glyph->colData[1];
+	return glyph;
+}
+
+// Set the current font. This accepts both old-format fonts, in which every glyph is padded to the full character width,
+// and compact fonts generated by Tools/MakeFont.py, in which a glyph offset table is followed by just the ink columns of each glyph.
+// An anti-aliased font without the glyph metrics table can't be drawn, because writeAntiAliased gets its kerning data from the
+// metrics, so we reject it and keep the current font.
+bool UTFT::setFont(const uint8_t* font)
+{
+	if (font[0] == 0 && (font[6] & FontBitsPerPixelMask) != 0 && (font[6] & FontHasMetrics) == 0)
+	{
+		return false;
+	}
+
 	cfont.font=font;
-	cfont.x_size=fontbyte(0);
-	cfont.y_size=fontbyte(1);
-	cfont.spaces=fontbyte(2);
-	cfont.firstChar=fontbyte(3);
-	cfont.lastChar=fontbyte(4);
-	cfont.font += 5;
+	if (fontbyte(0) == 0)
+	{
+		cfont.compact=true;
+		cfont.y_size=fontbyte(1);
+		cfont.spaces=fontbyte(2);
+		cfont.firstChar=fontbyte(3);
+		cfont.lastChar=fontbyte(4);
+		cfont.x_size=fontbyte(5);
+		const uint8_t flags = fontbyte(6);
+		cfont.bitsPerPixel = 1u << ((flags & FontBitsPerPixelMask) >> FontBitsPerPixelShift);
+		cfont.font += 8;
+		unsigned int numGlyphs;
+		if (flags & FontHasRanges)
+		{
+			cfont.numRanges = cfont.firstChar | ((uint16_t)cfont.lastChar << 8);
+			cfont.ranges = cfont.font;
+			cfont.font += 6 * cfont.numRanges;
+			const uint8_t *lastRange = cfont.font - 6;
+			numGlyphs = readLE16(lastRange + 4) + readLE16(lastRange + 2) - readLE16(lastRange) + 1;
+		}
+		else
+		{
+			cfont.numRanges = 0;
+			cfont.ranges = NULL;
+			numGlyphs = cfont.lastChar - cfont.firstChar + 1;
+		}
+		cfont.glyphData = cfont.font + (2 * numGlyphs);
+		if (flags & FontHasMetrics)
+		{
+			cfont.metrics = cfont.glyphData;
+			cfont.glyphData += (1 + 2 * ((cfont.y_size + 7)/8)) * numGlyphs;
+		}
+		else
+		{
+			cfont.metrics = NULL;
+		}
+	}
+	else
+	{
+		cfont.compact=false;
+		cfont.bitsPerPixel=1;
+		cfont.x_size=fontbyte(0);
+		cfont.y_size=fontbyte(1);
+		cfont.spaces=fontbyte(2);
+		cfont.firstChar=fontbyte(3);
+		cfont.lastChar=fontbyte(4);
+		cfont.font += 5;
+		cfont.numRanges = 0;
+		cfont.ranges = NULL;
+		cfont.glyphData = NULL;
+		cfont.metrics = NULL;
+	}
+	return true;
 }
 
 void UTFT::drawBitmap(int x, int y, int sx, int sy, const uint16_t * data, int scale, bool byCols)
@@ -2160,7 +2832,210 @@ void UTFT::drawBitmap(int x, int y, int sx, int sy, const uint16_t * data, int s
 		}
 	}
 	removeCS();
-	clrXY();
+}
+
+// Draw a bitmap in one of the compressed formats produced by Tools/MakeIcons.py.
+// Each span of opaque pixels in a row is written through a single window, using repeated writes for runs of the same colour.
+// If the background isn't transparent, transparent pixels are drawn white as they are by drawBitmap.
+// If 'palette' isn't NULL then a palette-indexed bitmap is drawn using it instead of its own palette, which lets one bitmap be drawn
+// in different colours. It must have as many entries as the bitmap's palette. It is ignored for run-length encoded bitmaps.
+void UTFT::drawCompressedBitmap(int x, int y, int sx, int sy, const uint16_t * data, const Colour * null palette)
+{
+	const uint16_t format = *data++;
+	if (format == BitmapFormatRle)
+	{
+		drawRleBitmap(x, y, sx, sy, data);
+	}
+	else
+	{
+		drawIndexedBitmap(x, y, sx, sy, format, data, palette);
+	}
+}
+
+void UTFT::drawRleBitmap(int x, int y, int sx, int sy, const uint16_t * data)
+{
+	const unsigned int MaxSpanRuns = 16;
+	const uint16_t *spanRuns[MaxSpanRuns];
+
+	assertCS();
+	for (int ty = 0; ty < sy; ++ty)
+	{
+		int tx = 0;
+		while (tx < sx)
+		{
+			if (transparentBackground && (*data & BitmapRunTypeMask) == BitmapRunSkip)
+			{
+				tx += *data & BitmapRunLengthMask;
+				++data;
+				continue;
+			}
+
+			// Collect the runs in this span, because if the display scans the window from right to left then we must send them in reverse order
+			const int spanStart = tx;
+			unsigned int numRuns = 0;
+			do
+			{
+				spanRuns[numRuns++] = data;
+				const uint16_t code = *data++;
+				const unsigned int length = code & BitmapRunLengthMask;
+				tx += length;
+				if ((code & BitmapRunTypeMask) == BitmapRunLiteral)
+				{
+					data += length;
+				}
+				else if ((code & BitmapRunTypeMask) == BitmapRunRepeat)
+				{
+					++data;
+				}
+			} while (tx < sx && numRuns < MaxSpanRuns && !(transparentBackground && (*data & BitmapRunTypeMask) == BitmapRunSkip));
+
+			// Extend the window to the edge of the bitmap that the display scans towards. Consecutive rows then often have the same column range, so setXY needn't send it again.
+			if (orient & InvertBitmap)
+			{
+				setXY(x, y + ty, x + tx - 1, y + ty);
+				while (numRuns != 0)
+				{
+					--numRuns;
+					writeBitmapRun(spanRuns[numRuns], true);
+				}
+			}
+			else
+			{
+				setXY(x + spanStart, y + ty, x + sx - 1, y + ty);
+				for (unsigned int i = 0; i < numRuns; ++i)
+				{
+					writeBitmapRun(spanRuns[i], false);
+				}
+			}
+		}
+	}
+	removeCS();
+}
+
+// Write the pixels of one run of a compressed bitmap, last pixel first if 'reversed' is true
+void UTFT::writeBitmapRun(const uint16_t *run, bool reversed)
+{
+	const uint16_t code = *run++;
+	const unsigned int length = code & BitmapRunLengthMask;
+	switch (code & BitmapRunTypeMask)
+	{
+	case BitmapRunLiteral:
+		if (reversed)
+		{
+			for (const uint16_t *p = run + length; p != run; )
+			{
+				LCD_Write_DATA16(*--p);
+			}
+		}
+		else
+		{
+			for (const uint16_t *p = run; p != run + length; ++p)
+			{
+				LCD_Write_DATA16(*p);
+			}
+		}
+		break;
+
+	case BitmapRunRepeat:
+		LCD_Write_Repeated_DATA16(*run, length);
+		break;
+
+	default:
+		// Transparent pixels on an opaque background
+		LCD_Write_Repeated_DATA16(0xFFFF, length);
+		break;
+	}
+}
+
+// Get the palette index of the pixel at the given bit position in the data of a palette-indexed bitmap.
+// The number of bits per pixel divides 16, so a pixel never straddles two words.
+static inline unsigned int bitmapIndex(const uint16_t *pixels, unsigned int bitPos, unsigned int bitsPerPixel)
+{
+	return (pixels[bitPos >> 4] >> (bitPos & 15)) & ((1u << bitsPerPixel) - 1);
+}
+
+void UTFT::drawIndexedBitmap(int x, int y, int sx, int sy, uint16_t format, const uint16_t * data, const Colour * null palette)
+{
+	const unsigned int bitsPerPixel = format & BitmapBitsPerPixelMask;
+	const Colour *ownPalette = data;
+	const uint16_t *pixels = data + (format >> BitmapPaletteSizeShift) + 1;
+	if (palette == NULL)
+	{
+		palette = ownPalette;
+	}
+
+	assertCS();
+	unsigned int rowStart = 0;				// bit position of the first pixel in the current row
+	for (int ty = 0; ty < sy; ++ty)
+	{
+		int tx = 0;
+		while (tx < sx)
+		{
+			// Transparency comes from the bitmap's own palette, so that recolouring doesn't change the shape
+			if (transparentBackground)
+			{
+				while (tx < sx && ownPalette[bitmapIndex(pixels, rowStart + tx * bitsPerPixel, bitsPerPixel)] == 0xFFFF)
+				{
+					++tx;
+				}
+				if (tx == sx)
+				{
+					break;
+				}
+			}
+
+			const int spanStart = tx;
+			if (transparentBackground)
+			{
+				do
+				{
+					++tx;
+				} while (tx < sx && ownPalette[bitmapIndex(pixels, rowStart + tx * bitsPerPixel, bitsPerPixel)] != 0xFFFF);
+			}
+			else
+			{
+				tx = sx;
+			}
+
+			// As in drawRleBitmap, extend the window to the edge of the bitmap that the display scans towards
+			if (orient & InvertBitmap)
+			{
+				setXY(x, y + ty, x + tx - 1, y + ty);
+				writeIndexedSpan(pixels, rowStart + (tx - 1) * bitsPerPixel, -(int)bitsPerPixel, tx - spanStart, bitsPerPixel, palette);
+			}
+			else
+			{
+				setXY(x + spanStart, y + ty, x + sx - 1, y + ty);
+				writeIndexedSpan(pixels, rowStart + spanStart * bitsPerPixel, bitsPerPixel, tx - spanStart, bitsPerPixel, palette);
+			}
+		}
+		rowStart += sx * bitsPerPixel;
+	}
+	removeCS();
+}
+
+// Write 'count' pixels of a palette-indexed bitmap, starting at bit position 'bitPos' and stepping by 'bitStep' bits.
+// Adjacent pixels of the same colour are combined into a repeated write.
+void UTFT::writeIndexedSpan(const uint16_t *pixels, int bitPos, int bitStep, unsigned int count, unsigned int bitsPerPixel, const Colour *palette)
+{
+	Colour runColour = palette[bitmapIndex(pixels, bitPos, bitsPerPixel)];
+	uint16_t runLength = 1;
+	while (--count != 0)
+	{
+		bitPos += bitStep;
+		const Colour c = palette[bitmapIndex(pixels, bitPos, bitsPerPixel)];
+		if (c == runColour)
+		{
+			++runLength;
+		}
+		else
+		{
+			LCD_Write_Repeated_DATA16(runColour, runLength);
+			runColour = c;
+			runLength = 1;
+		}
+	}
+	LCD_Write_Repeated_DATA16(runColour, runLength);
 }
 
 #ifndef DISABLE_BITMAP_ROTATE
@@ -2191,7 +3066,6 @@ void UTFT::drawBitmap(int x, int y, int sx, int sy, uint16_t *data, int deg, int
 		}
 		removeCS();
 	}
-	clrXY();
 }
 
 #endif
@@ -2199,7 +3073,7 @@ void UTFT::drawBitmap(int x, int y, int sx, int sy, uint16_t *data, int deg, int
 void UTFT::lcdOff()
 {
 	assertCS();
-	switch (displayModel)
+	switch (getModel())
 	{
 	case PCF8833:
 		LCD_Write_COM(0x28);
@@ -2213,7 +3087,7 @@ void UTFT::lcdOff()
 void UTFT::lcdOn()
 {
 	assertCS();
-	switch (displayModel)
+	switch (getModel())
 	{
 	case PCF8833:
 		LCD_Write_COM(0x29);
@@ -2227,7 +3101,7 @@ void UTFT::lcdOn()
 void UTFT::setContrast(uint8_t c)
 {
 	assertCS();
-	switch (displayModel)
+	switch (getModel())
 	{
 	case PCF8833:
 		if (c>64) c=64;
@@ -2239,12 +3113,429 @@ void UTFT::setContrast(uint8_t c)
 	removeCS();
 }
 
+// Return true if we can scroll bands of rows in hardware.
+// The SSD1963 scrolls lines of the panel, which are rows of the display only in landscape orientations.
+bool UTFT::canScroll() const
+{
+	switch (getModel())
+	{
+#if !(defined(DISABLE_SSD1963_480) && defined(DISABLE_SSD1963_800))
+	case SSD1963_480:
+	case SSD1963_800:
+		return isSwapXY();
+#endif
+	default:
+		return false;
+	}
+}
+
+// Scroll rows 'top' to 'top + height - 1' so that what was drawn at row 'top + offset' is displayed at row 'top', wrapping round at the bottom.
+// While the area is scrolled, setXY moves windows that lie entirely inside it to where their content is, so that they can be redrawn as usual.
+// A window must not span the row at which the area wraps round, so scroll by a whole number of the rows of text or fields drawn there,
+// and nothing may be drawn across the top or bottom of the area. See scrollShift.
+// Only call this if canScroll() returns true.
+void UTFT::setScrollArea(uint16_t top, uint16_t height, uint16_t offset)
+{
+	// The panel lines run upwards if the display is upside down, and then so does the scrolling
+	const uint16_t numLines = disp_x_size + 1;
+	const bool reversed = (orient & ReverseY) != 0;
+	const uint16_t firstLine = (reversed) ? numLines - top - height : top;
+
+	assertCS();
+	if (top != scrollTop || height != scrollHeight)
+	{
+		LCD_Write_COM(0x33);							// set scroll area: top fixed lines, scrolled lines, bottom fixed lines
+		LCD_Write_DATA8(firstLine >> 8);
+		LCD_Write_DATA8(firstLine);
+		LCD_Write_DATA8(height >> 8);
+		LCD_Write_DATA8(height);
+		LCD_Write_DATA8((numLines - firstLine - height) >> 8);
+		LCD_Write_DATA8(numLines - firstLine - height);
+		scrollTop = top;
+		scrollHeight = height;
+	}
+	const uint16_t startLine = firstLine + ((reversed && offset != 0) ? height - offset : offset);
+	LCD_Write_COM(0x37);								// set scroll start
+	LCD_Write_DATA8(startLine >> 8);
+	LCD_Write_DATA8(startLine);
+	removeCS();
+	scrollOffset = offset;
+}
+
+// Cancel any scrolling. What was drawn in the scroll area is displayed where it was drawn again.
+void UTFT::resetScroll()
+{
+	if (scrollOffset != 0)
+	{
+		setScrollArea(scrollTop, scrollHeight, 0);
+	}
+}
+
+#if UTFT_BAND_BUFFER_PIXELS != 0
+
+// The band buffer. Pixels are stored in the order that the SSD1963 fills its address window in the mode we set,
+// which is along X in the coordinates that setXY sends to the controller, then along Y.
+static Colour bandBuffer[UTFT_BAND_BUFFER_PIXELS];
+
+#endif
+
+// Return how many rows of the given width fit in the band buffer, or 0 if fields must be drawn straight to the display
+uint16_t UTFT::getBandRows(uint16_t width) const
+{
+#if UTFT_BAND_BUFFER_PIXELS != 0
+	switch (getModel())
+	{
+#if !(defined(DISABLE_SSD1963_480) && defined(DISABLE_SSD1963_800))
+	case SSD1963_480:
+	case SSD1963_800:
+		return (width == 0) ? 0 : UTFT_BAND_BUFFER_PIXELS/width;
+#endif
+	default:
+		break;
+	}
+#endif
+	return 0;
+}
+
+// Start drawing into the band buffer instead of to the display. Everything drawn until endBand is clipped to the rectangle x1..x2, y1..y2,
+// which must fit in the buffer according to getBandRows. Pixels that nothing is drawn on get the background colour.
+// If a clip rectangle is set, the band only covers the part of the rectangle inside it. Return false without starting a band if that is empty.
+bool UTFT::beginBand(int x1, int y1, int x2, int y2, Colour background)
+{
+#if UTFT_BAND_BUFFER_PIXELS != 0
+	if (clipDepth != 0)
+	{
+		const ClipRect& clip = clipStack[clipDepth - 1];
+		if (x1 < clip.x1)
+		{
+			x1 = clip.x1;
+		}
+		if (y1 < clip.y1)
+		{
+			y1 = clip.y1;
+		}
+		if (x2 > clip.x2)
+		{
+			x2 = clip.x2;
+		}
+		if (y2 > clip.y2)
+		{
+			y2 = clip.y2;
+		}
+		if (x1 > x2 || y1 > y2)
+		{
+			return false;
+		}
+	}
+	bandX1 = x1;
+	bandY1 = y1;
+	bandX2 = x2;
+	bandY2 = y2;
+	uint16_t mx1 = x1, my1 = y1, mx2 = x2, my2 = y2;
+	mapWindow(mx1, my1, mx2, my2);
+	bandMx1 = mx1;
+	bandMy1 = my1;
+	bandMx2 = mx2;
+	bandMy2 = my2;
+
+	const size_t numPixels = (size_t)(mx2 + 1 - mx1) * (my2 + 1 - my1);
+	for (size_t i = 0; i < numPixels; ++i)
+	{
+		bandBuffer[i] = background;
+	}
+	drawMy = drawMy2 + 1;			// nothing to draw until setXY is called
+	composing = true;
+#endif
+	return true;
+}
+
+// Send the band buffer to the display, each pixel once, and go back to drawing straight to the display
+void UTFT::endBand()
+{
+#if UTFT_BAND_BUFFER_PIXELS != 0
+	composing = false;
+	const Colour *p = bandBuffer;
+	const Colour * const end = p + (size_t)(bandMx2 + 1 - bandMx1) * (bandMy2 + 1 - bandMy1);
+	assertCS();
+	setXY(bandX1, bandY1, bandX2, bandY2);
+	while (p != end)
+	{
+		// Send runs of the same colour as repeats, which only need the write strobe
+		const Colour c = *p;
+		const Colour *runEnd = p + 1;
+		while (runEnd != end && *runEnd == c && runEnd - p < 0xFFFF)
+		{
+			++runEnd;
+		}
+		LCD_Write_Repeated_DATA16(c, runEnd - p);
+		p = runEnd;
+	}
+	removeCS();
+#endif
+}
+
+// Band snapshots start with the line length and number of lines of the band in the buffer. Each line after that is either a count of runs
+// followed by a length and a colour for each run, or RepeatLine plus the number of times the line before it is repeated.
+const uint16_t RepeatLine = 0x8000;
+
+// Run-length encode what has been drawn in the band so far into 'buf'. Return the number of words used, or 0 if it doesn't fit.
+size_t UTFT::encodeBand(uint16_t *buf, size_t maxWords) const
+{
+#if UTFT_BAND_BUFFER_PIXELS != 0
+	const unsigned int lineLength = bandMx2 + 1 - bandMx1, numLines = bandMy2 + 1 - bandMy1;
+	if (maxWords < 2)
+	{
+		return 0;
+	}
+	buf[0] = lineLength;
+	buf[1] = numLines;
+	size_t used = 2;
+	size_t repeatIndex = 0;					// where the count of the repeats we are adding to is, or 0 if the last line wasn't a repeat
+	for (unsigned int line = 0; line < numLines; ++line)
+	{
+		const Colour *p = bandBuffer + line * lineLength;
+		if (line != 0 && memcmp(p, p - lineLength, lineLength * sizeof(Colour)) == 0)
+		{
+			if (repeatIndex != 0)
+			{
+				++buf[repeatIndex];
+			}
+			else if (used < maxWords)
+			{
+				repeatIndex = used;
+				buf[used++] = RepeatLine | 1;
+			}
+			else
+			{
+				return 0;
+			}
+			continue;
+		}
+
+		repeatIndex = 0;
+		if (used == maxWords)
+		{
+			return 0;
+		}
+		const size_t countIndex = used++;
+		buf[countIndex] = 0;
+		const Colour * const lineEnd = p + lineLength;
+		while (p != lineEnd)
+		{
+			const Colour c = *p;
+			const Colour *runEnd = p + 1;
+			while (runEnd != lineEnd && *runEnd == c)
+			{
+				++runEnd;
+			}
+			if (maxWords - used < 2)
+			{
+				return 0;
+			}
+			buf[used++] = runEnd - p;
+			buf[used++] = c;
+			++buf[countIndex];
+			p = runEnd;
+		}
+	}
+	return used;
+#else
+	return 0;
+#endif
+}
+
+// Replace what has been drawn in the band by a snapshot from encodeBand. Return false and leave the band alone if the snapshot is of a band of a different size.
+bool UTFT::decodeBand(const uint16_t *buf, size_t numWords)
+{
+#if UTFT_BAND_BUFFER_PIXELS != 0
+	const unsigned int lineLength = bandMx2 + 1 - bandMx1, numLines = bandMy2 + 1 - bandMy1;
+	if (numWords < 2 || buf[0] != lineLength || buf[1] != numLines)
+	{
+		return false;
+	}
+	const uint16_t * const end = buf + numWords;
+	buf += 2;
+	Colour *p = bandBuffer;
+	while (buf != end)
+	{
+		const uint16_t code = *buf++;
+		if ((code & RepeatLine) != 0)
+		{
+			for (unsigned int i = code & ~RepeatLine; i != 0; --i)
+			{
+				memcpy(p, p - lineLength, lineLength * sizeof(Colour));
+				p += lineLength;
+			}
+		}
+		else
+		{
+			for (unsigned int i = code; i != 0; --i)
+			{
+				const uint16_t length = *buf++;
+				const Colour c = *buf++;
+				for (const Colour *runEnd = p + length; p != runEnd; )
+				{
+					*p++ = c;
+				}
+			}
+		}
+	}
+	return true;
+#else
+	return false;
+#endif
+}
+
+// Record the window that the following pixels will be written to, in the coordinates that setXY sends to the controller
+void UTFT::composeWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+	drawMx1 = x1;
+	drawMx2 = x2;
+	drawMy2 = y2;
+	drawMx = x1;
+	drawMy = y1;
+}
+
+// Write 'num' pixels of the same colour to the window, sending those that fall inside the clip rectangle to the controller
+void UTFT::clipPixels(Colour c, uint32_t num)
+{
+	while (num != 0 && drawMy <= drawMy2)
+	{
+		const uint32_t lineLeft = drawMx2 + 1 - drawMx;
+		if (drawMy >= clipMy1 && drawMy <= clipMy2)
+		{
+			const uint32_t n = (num < lineLeft) ? num : lineLeft;
+			const uint16_t first = (drawMx > clipMx1) ? drawMx : clipMx1;
+			const uint16_t last = (drawMx + n - 1 < clipMx2) ? drawMx + n - 1 : clipMx2;
+			if (first <= last)
+			{
+				// The controller only has the clipped window, so these pixels go where they should
+				clipStreaming = false;
+				LCD_Write_Repeated_DATA16(c, last + 1 - first);
+				clipStreaming = true;
+			}
+			num -= n;
+			if (n == lineLeft)
+			{
+				drawMx = drawMx1;
+				++drawMy;
+			}
+			else
+			{
+				drawMx += n;
+			}
+		}
+		else if (num < lineLeft)
+		{
+			drawMx += num;
+			num = 0;
+		}
+		else
+		{
+			// Skip whole lines outside the clip rectangle in one go
+			const uint32_t linesLeft = drawMy2 + 1 - drawMy;
+			const uint32_t lineLength = drawMx2 + 1 - drawMx1;
+			uint32_t lines = 1 + (num - lineLeft)/lineLength;
+			if (drawMy < clipMy1 && lines > (uint32_t)(clipMy1 - drawMy))
+			{
+				lines = clipMy1 - drawMy;
+			}
+			if (lines > linesLeft)
+			{
+				lines = linesLeft;
+			}
+			num -= lineLeft + (lines - 1) * lineLength;
+			drawMx = drawMx1;
+			drawMy += lines;
+		}
+	}
+}
+
+// Set the clip rectangle to the part of the current one inside the given rectangle
+void UTFT::pushClip(int x1, int y1, int x2, int y2)
+{
+	ClipRect& clip = clipStack[clipDepth];
+	clip.x1 = (x1 < 0) ? 0 : x1;
+	clip.y1 = (y1 < 0) ? 0 : y1;
+	clip.x2 = (x2 < 0) ? 0 : x2;
+	clip.y2 = (y2 < 0) ? 0 : y2;
+	if (x2 < 0 || y2 < 0)
+	{
+		clip.x1 = clip.y1 = 1;				// empty
+	}
+	if (clipDepth != 0)
+	{
+		const ClipRect& outer = clipStack[clipDepth - 1];
+		if (clip.x1 < outer.x1)
+		{
+			clip.x1 = outer.x1;
+		}
+		if (clip.y1 < outer.y1)
+		{
+			clip.y1 = outer.y1;
+		}
+		if (clip.x2 > outer.x2)
+		{
+			clip.x2 = outer.x2;
+		}
+		if (clip.y2 > outer.y2)
+		{
+			clip.y2 = outer.y2;
+		}
+	}
+	++clipDepth;
+}
+
+void UTFT::popClip()
+{
+	--clipDepth;
+}
+
+#if UTFT_BAND_BUFFER_PIXELS != 0
+
+// Write 'num' pixels of the same colour to the window, keeping those that fall inside the band
+void UTFT::composePixels(Colour c, uint32_t num)
+{
+	const uint16_t bandWidth = bandMx2 + 1 - bandMx1;
+	while (num != 0 && drawMy <= drawMy2)
+	{
+		// Write as much of the current line of the window as we can
+		const uint32_t lineLeft = drawMx2 + 1 - drawMx;
+		const uint32_t n = (num < lineLeft) ? num : lineLeft;
+		if (drawMy >= bandMy1 && drawMy <= bandMy2)
+		{
+			const uint16_t first = (drawMx > bandMx1) ? drawMx : bandMx1;
+			const uint16_t last = (drawMx + n - 1 < bandMx2) ? drawMx + n - 1 : bandMx2;
+			if (first <= last)
+			{
+				Colour *p = bandBuffer + (size_t)(drawMy - bandMy1) * bandWidth + (first - bandMx1);
+				for (unsigned int i = first; i <= last; ++i)
+				{
+					*p++ = c;
+				}
+			}
+		}
+		num -= n;
+		if (n == lineLeft)
+		{
+			drawMx = drawMx1;
+			++drawMy;
+		}
+		else
+		{
+			drawMx += n;
+		}
+	}
+}
+
+#endif
+
 uint16_t UTFT::getDisplayXSize() const
 {
-	return ((orient & SwapXY) ? disp_y_size : disp_x_size) + 1;
+	return (isSwapXY() ? disp_y_size : disp_x_size) + 1;
 }
 
 uint16_t UTFT::getDisplayYSize() const
 {
-	return ((orient & SwapXY) ? disp_x_size : disp_y_size) + 1;
+	return (isSwapXY() ? disp_x_size : disp_y_size) + 1;
 }
@@ -51,6 +51,7 @@
 #include "Print.hpp"
 #include "OneBitPort.hpp"
 #include "DisplayOrientation.hpp"
+#include "GlyphCache.hpp"
 
 #include "HW_AVR_defines.h"
 
@@ -127,7 +128,8 @@ enum TransferMode
 };
 
 // This describes the structure we use to store font information.
-// The first 5 fields are also the layout of the data in the font header.
+// The first 5 fields are also the layout of the data in the header of an old-format (fixed width) font.
+// A compact font has 0 in the first header byte and the row height in the second, so GetFontHeight works for both formats.
 struct FontDescriptor
 {
 	uint8_t x_size;
@@ -135,12 +137,49 @@ struct FontDescriptor
 	uint8_t spaces;
 	uint8_t firstChar;
 	uint8_t lastChar;
-	const uint8_t* font;
+	bool compact;					// true if the font has a glyph offset table and variable-width glyphs
+	uint8_t bitsPerPixel;			// 1 for ordinary fonts, 2 or 4 for anti-aliased compact fonts
+	uint16_t numRanges;				// number of entries in the character range table of a compact font, or 0 if it doesn't have one
+	const uint8_t* ranges;			// character range table of a compact font
+	const uint8_t* font;			// glyph data for an old-format font, offset table for a compact font
+	const uint8_t* glyphData;		// glyph data for a compact font
+	const uint8_t* metrics;			// glyph metrics table for a compact font, or NULL if it doesn't have one
 };
 
+// Flags in the header of a compact font
+const uint8_t FontHasMetrics = 0x01;		// the glyph offset table is followed by a table of glyph metrics
+const uint8_t FontHasRanges = 0x02;			// the header is followed by a sorted table of character code ranges, instead of the font covering firstChar to lastChar
+const uint8_t FontBitsPerPixelMask = 0x0C;	// log2 of the number of bits per pixel in the glyph data; anti-aliased fonts must also have metrics
+const uint8_t FontBitsPerPixelShift = 2;
+
+// Compressed bitmap formats (see Tools/MakeIcons.py). The bitmap data starts with a format word, which is BitmapFormatRle for a
+// run-length encoded bitmap, otherwise the bits per pixel and palette size of a palette-indexed bitmap.
+const uint16_t BitmapFormatRle = 0;
+const uint16_t BitmapBitsPerPixelMask = 0x000F;
+const unsigned int BitmapPaletteSizeShift = 8;	// the top byte is the number of palette entries minus 1
+
+// Run codes in a run-length encoded bitmap. Each row is a sequence of runs, each starting with a code word
+// made of the run type and the number of pixels in the run.
+const uint16_t BitmapRunTypeMask = 0xC000;
+const uint16_t BitmapRunLengthMask = 0x3FFF;
+const uint16_t BitmapRunSkip = 0x0000;			// transparent pixels
+const uint16_t BitmapRunLiteral = 0x4000;		// opaque pixels, followed by one colour per pixel
+const uint16_t BitmapRunRepeat = 0x8000;		// opaque pixels all the same colour, followed by that colour
 
 typedef uint16_t Colour;
 
+// Depth of the clip rectangle stack
+const unsigned int MaxClipDepth = 4;
+
+// A rectangle in display coordinates. It is empty if x1 > x2 or y1 > y2.
+struct ClipRect
+{
+	uint16_t x1, y1, x2, y2;
+};
+
+// Maximum number of distinct colours in a gradient fill. Reducing a 5-6-5 colour channel by at least 1 each time reaches 0 within 63 steps.
+const unsigned int MaxGradientBands = 64;
+
 class UTFT : public Print
 {
 public:
@@ -168,25 +207,69 @@ public:
 	// Either the first string passed must be NULL, or the two strings must have equal lengths as returned by strlen().
 	void setTranslation(const char *tFrom, const char *tTo);
 	virtual size_t write(uint8_t c) /*override*/;
+	using Print::write;
 	void setTextPos(uint16_t x, uint16_t y, uint16_t rm = 9999);
 	void clearToMargin();
 	size_t print(const char *s, uint16_t x, uint16_t y, uint16_t rm = 9999);
 	using Print::print;
+
+	// Text measurement. This gives the same width as printing the text would, but it doesn't write to the display or change the text position.
+	// Between beginMeasure and endMeasure, anything printed is measured instead of being written.
+	uint16_t measure(const char *s, uint16_t maxWidth = 9999);
+	void beginMeasure(uint16_t maxWidth = 9999);
+	uint16_t endMeasure();
+	// Between beginSkip and endSkip, anything printed moves the text position on as if it had been written, but nothing is written.
+	// This lets us redraw part of a line of text without redrawing the characters before it.
+	void beginSkip();
+	void endSkip();
 		
-	void setFont(const uint8_t* font);
+	bool setFont(const uint8_t* font);			// returns false and keeps the current font if the font can't be drawn
 	void drawBitmap(int x, int y, int sx, int sy, const uint16_t *data, int scale = 1, bool byCols = true);
+	void drawCompressedBitmap(int x, int y, int sx, int sy, const uint16_t *data, const Colour * null palette = NULL);
 #ifndef DISABLE_BITMAP_ROTATE
 	void drawBitmap(int x, int y, int sx, int sy, const uint16_t *data, int deg, int rox, int roy);
 #endif
 	void lcdOff();
 	void lcdOn();
 	void setContrast(uint8_t c);
+
+	// Hardware vertical scrolling of a band of rows. Clearing or filling the screen cancels it.
+	bool canScroll() const;
+	void setScrollArea(uint16_t top, uint16_t height, uint16_t offset);
+	void resetScroll();
+	bool isScrolled() const { return scrollOffset != 0; }
+	uint16_t getScrollOffset() const { return scrollOffset; }
+	uint32_t getScrollBoundaryCrossings() const { return scrollBoundaryCrossings; }	// windows drawn across the edge or wrap row of the scrolled area, should be 0
+
+	// Clipping. While a clip rectangle is set, every primitive drops the pixels it would draw outside it, so nothing outside it changes.
+	// pushClip sets the clip rectangle to the intersection of the current one and the one given, and popClip goes back to the one before.
+	void pushClip(int x1, int y1, int x2, int y2) pre(clipDepth < MaxClipDepth);
+	void popClip() pre(clipDepth != 0);
+	bool isClipping() const { return clipDepth != 0; }
+	const ClipRect& getClip() const pre(clipDepth != 0) { return clipStack[clipDepth - 1]; }
+
+	// Band compositing. Between beginBand and endBand, drawing goes to a buffer in RAM instead of to the display, and endBand sends
+	// the band to the display in one go. So pixels that are drawn several times, such as a button background under its text, cross the bus once.
+	uint16_t getBandRows(uint16_t width) const;
+	bool beginBand(int x1, int y1, int x2, int y2, Colour background);
+	void endBand();
+	bool isComposing() const { return composing; }
+	uint16_t getBandX() const { return bandX1; }
+	uint16_t getBandY() const { return bandY1; }
+	// Band snapshots, for things that are drawn the same way many times, such as button backgrounds. encodeBand run-length encodes what has
+	// been drawn in the band so far, and decodeBand replaces what has been drawn in the band with a snapshot of a band of the same size.
+	size_t encodeBand(uint16_t *buf, size_t maxWords) const;
+	bool decodeBand(const uint16_t *buf, size_t numWords);
+
+	DisplayOrientation getOrientation() const { return orient; }
 	uint16_t getDisplayXSize() const;
 	uint16_t getDisplayYSize() const;
 	uint16_t getTextX() const { return textXpos; }
 	uint16_t getTextY() const { return textYpos; }
+	uint32_t getKernData() const { return lastCharColData; }		// what the spacing before the next character depends on, apart from the character itself
 	uint16_t getFontHeight() const { return cfont.y_size; }
 	static uint16_t GetFontHeight(const uint8_t *f) { return reinterpret_cast<const FontDescriptor*>(f)->y_size; }
+	const GlyphCache& getGlyphCache() const { return glyphCache; }
 
 private:
 	uint16_t fcolour, bcolour;
@@ -195,6 +278,14 @@ private:
 	uint16_t disp_x_size, disp_y_size;
 	DisplayType displayModel;
 	TransferMode displayTransferMode;
+
+	// Address window last sent to the display controller, in controller coordinates, so that setXY can skip the parts that haven't changed
+	uint16_t windowX1, windowY1, windowX2, windowY2;
+	bool windowValid;
+
+	// Hardware scroll area in display rows, and how far it is scrolled. setXY moves windows inside the area by the scroll offset.
+	uint16_t scrollTop, scrollHeight, scrollOffset;
+	uint32_t scrollBoundaryCrossings;
 	
 	// Port descriptors. In 9-bit parallel mode, portSDA is used as the latch port. In 5-bit serial mode, portRS is used as the extra port.
 	OneBitPort portRS, portWR, portCS, portRST, portSDA, portSCL;
@@ -202,15 +293,47 @@ private:
 	FontDescriptor cfont;
 	uint16_t textXpos, textYpos, textRightMargin;
 	uint32_t lastCharColData;		// used for auto kerning
+	GlyphCache glyphCache;
+	Colour blendTable[16];			// colours for each level of an anti-aliased font, blended from blendForeground and blendBackground
+	Colour blendForeground, blendBackground;
+	uint8_t blendLevels;			// number of valid entries in blendTable, or 0 if it hasn't been built
 	const char* translateFrom;
 	const char* translateTo;
 	
 	uint32_t charVal;
 	uint8_t numContinuationBytesLeft;
 
-	size_t writeNative(uint8_t c);
+	bool measuring;
+	uint16_t measureXpos, measureRightMargin;
+	uint32_t measureLastColData;
+
+	// Clip rectangles, the current one last. When a window that setXY sets is partly clipped, the controller gets the part of it inside the clip
+	// rectangle, the pixels written to it are tracked as they are when composing, and clipPixels passes on the ones inside the clip rectangle.
+	ClipRect clipStack[MaxClipDepth];
+	uint8_t clipDepth;
+	bool clipStreaming;
+	uint16_t clipMx1, clipMy1, clipMx2, clipMy2;
+
+	// Band being composed, in display coordinates and in the coordinates that setXY sends to the controller, and the window being drawn to
+	bool composing;
+	uint16_t bandX1, bandY1, bandX2, bandY2;
+	uint16_t bandMx1, bandMy1, bandMx2, bandMy2;
+	uint16_t drawMx1, drawMx2, drawMy2, drawMx, drawMy;
+
+	size_t writeChar(uint32_t c) { return (measuring) ? measureNative(c) : writeNative(c); }
+	size_t writeNative(uint32_t c);
+	void writeSpaceColumns(uint32_t kernColData, uint8_t ySize);
+	void writeAntiAliased(unsigned int glyphNumber, uint8_t ySize);
+	const Colour *getBlendTable();
+	size_t measureNative(uint32_t c);
+	uint32_t translate(uint32_t c) const;
+	int findGlyph(uint32_t c) const;
+	int lookupGlyph(uint32_t c) const;
+	bool canKern(uint32_t thisCharColData, uint32_t prevCharColData) const;
+	const CachedGlyph *getGlyph(unsigned int glyphNumber);
 
-	// Hardware interface
+	// Hardware interface. The functions that run once per pixel, or once per run of pixels, are in RAM so that they run at full speed.
+	// LCD_Write_Bus is inline, so it is in RAM wherever they use it.
 	void LCD_Write_Bus(uint8_t VH, uint8_t VL);
 	void LCD_Write_Again(uint16_t num);
 	void _set_direction_registers();
@@ -226,9 +349,27 @@ private:
 		
 	void drawHLine(int x, int y, int len);
 	void drawVLine(int x, int y, int len);
+	void writeHRun(int x1, int x2, int y);
+	void writeVRun(int x, int y1, int y2);
+	void writeCircleRuns(int x, int y, int a, int b, int d);
+	void drawRleBitmap(int x, int y, int sx, int sy, const uint16_t *data);
+	void drawIndexedBitmap(int x, int y, int sx, int sy, uint16_t format, const uint16_t *data, const Colour * null palette);
+	void writeBitmapRun(const uint16_t *run, bool reversed);
+	void writeIndexedSpan(const uint16_t *pixels, int bitPos, int bitStep, unsigned int count, unsigned int bitsPerPixel, const Colour *palette);
+	void fillGradientRows(int x1, int y1, int x2, int y2, unsigned int firstRow, const Colour *bandColours, unsigned int numBands, uint8_t gradChange);
+	static unsigned int rowBand(unsigned int row, uint8_t gradChange, unsigned int numBands);
+	uint16_t scrollShift(uint16_t y1, uint16_t y2);
+	void mapWindow(uint16_t& x1, uint16_t& y1, uint16_t& x2, uint16_t& y2);
+	void mapWindow(uint16_t& x1, uint16_t& y1, uint16_t& x2, uint16_t& y2, uint16_t shift) const;
 	void setXY(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+	void composeWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+	void composePixels(Colour c, uint32_t num);
+	void clipPixels(Colour c, uint32_t num);
 	void clrXY();
 		
+	DisplayType getModel() const;
+	TransferMode getTransferMode() const;
+	bool isSwapXY() const;
 	bool isParallel() const;
 	
 	void assertCS() const
@@ -19,12 +19,15 @@
 #define DISABLE_ILI9325D		1
 #define DISABLE_HX8340B			1
 #define DISABLE_HX8340B_S		1
-//#define DISABLE_HX8352A			1
+#define DISABLE_HX8352A			1
 #define DISABLE_ST7735			1
 #define DISABLE_PCF8833			1
 #define DISABLE_S1D19122		1
-//#define DISABLE_SSD1963_480		1
-//#define DISABLE_SSD1963_800		1
+#if defined(SCREEN_43)
+#define DISABLE_SSD1963_800		1
+#elif defined(SCREEN_50) || defined(SCREEN_70)
+#define DISABLE_SSD1963_480		1
+#endif
 #define DISABLE_S6D1121			1
 
 #define DISABLE_BITMAP_ROTATE	1
@@ -33,3 +36,22 @@
 #define DISABLE_8BIT			1
 #define DISABLE_9BIT			1
 //#define DISABLE_16BIT			1
+
+// When the build is for a single controller and transfer mode, UTFT can resolve its checks on them at compile time.
+// The constructor arguments for them must then agree with these.
+#if defined(SCREEN_43)
+#define UTFT_ONLY_MODEL			SSD1963_480
+#elif defined(SCREEN_50) || defined(SCREEN_70)
+#define UTFT_ONLY_MODEL			SSD1963_800
+#endif
+
+#if defined(DISABLE_SERIAL) && defined(DISABLE_8BIT) && defined(DISABLE_9BIT) && !defined(DISABLE_16BIT)
+#define UTFT_ONLY_TRANSFER_MODE	TMode16bit
+#endif
+
+// PanelDue only uses landscape orientations. Inverting the display flips the X and Y directions but never swaps them.
+#define UTFT_ONLY_LANDSCAPE		1
+
+// Size in pixels of the RAM buffer that fields are composed in before they are sent to the display. It costs 2 bytes per pixel.
+// Fields that need more are composed in several bands of rows. Define it as 0 to draw fields straight to the display.
+#define UTFT_BAND_BUFFER_PIXELS	(1536)
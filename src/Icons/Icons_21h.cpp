@@ -1,609 +1,271 @@
 /*
- * Icons.cpp
+ * Icons_21h.cpp
  *
- * Created: 20/10/2015 13:36:46
- *  Author: David
- */ 
+ * Generated by Tools/MakeIcons.py - do not edit
+ * Command: MakeIcons.py Icons_21h.cpp IconNozzle1_21h=Nozzle1_21h.bmp IconNozzle2_21h=Nozzle2_21h.bmp IconNozzle3_21h=Nozzle3_21h.bmp IconNozzle4_21h=Nozzle4_21h.bmp IconBed_21h=Bed_21h.bmp IconBackspace_21h=Backspace_21h.bmp IconUp_21h=UpArrow_21h.bmp IconDown_21h=DownArrow_21h.bmp IconEnter_21h=Enter_21h.bmp IconOk_21h=OK_21h.bmp IconCancel_21h=Cancel_21h.bmp IconFiles_21h=File_21h.bmp IconKeyboard_21h=Keyboard_21h.bmp
+ */
 
 #include "Display.hpp"
 #include "Icons_21h.hpp"
 
+// Nozzle1_21h.bmp, 4 bits per pixel, 16 colours
 extern const uint16_t IconNozzle1_21h[] =
 {	19, 21,		// width, height
-	0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfff6, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xfff6, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xffff, 0xb320, 0x6000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0x6000, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000,
-	0xffff, 0xffff, 0xdc87, 0x0000, 0x65bf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0xffff,
-	0xfed2, 0x0000, 0x3c96, 0xfffb, 0xfffb, 0xfffb, 0xfffb, 0xfffb, 0xfffb, 0xfffb, 0xfffb,
-	0xfffb, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3800,
-	0x0000, 0x91c0, 0x91c0, 0x91c0, 0x91c0, 0x91c0, 0x91c0, 0x91c0, 0x91c0, 0x91c0, 0x91c0,
-	0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x000c, 0x000c,
-	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0000,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb7ff, 0xb7ff, 0xb7ff,
-	0xb7ff, 0xb7ff, 0xb7ff, 0xb7ff, 0xb7ff, 0xb7ff, 0xb7ff, 0xb7ff, 0xb7ff, 0x0000, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0336, 0xffff, 0xffff, 0xffff,
-	0xc618, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000,
-	0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0xc618,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff,
-	0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff
+	0x0f04,		// format
+	0x0000, 0x000c, 0x0336, 0x3800, 0x3c96, 0x6000, 0x65bf, 0x91c0,	// palette
+	0xb320, 0xb7ff, 0xc618, 0xdc87, 0xfed2, 0xfff6, 0xfffb, 0xffff,
+	0xff00, 0xffff, 0xffff, 0xffff, 0x000f, 0xfff0, 0xcfff, 0xf913, 0xffff, 0x0000, 0xffff, 0x00bf,
+	0xff91, 0x0fff, 0xf000, 0x8fff, 0x1740, 0xfff9, 0x00ff, 0xff00, 0x65df, 0x917e, 0xffff, 0x000f,
+	0xfff0, 0xefff, 0xf917, 0xffff, 0x0000, 0xffff, 0x7eff, 0xff91, 0x0fff, 0xf000, 0xffff, 0x17ef,
+	0xfff9, 0x00ff, 0xff00, 0xffff, 0x917e, 0xffff, 0x000f, 0xfff0, 0xefff, 0xf917, 0xffff, 0x0000,
+	0xffff, 0x7eff, 0xff91, 0x0fff, 0xf000, 0xffff, 0x17ef, 0xfff9, 0x00ff, 0xff00, 0xffff, 0x917e,
+	0xffff, 0x000f, 0xfff0, 0x005d, 0x0000, 0xfff2, 0x0000, 0xfffa, 0xffff, 0xffff, 0x0aff, 0x00a0,
+	0xfffa, 0xffff, 0xffff, 0xa00a, 0x00af, 0xfffa, 0xffff, 0x0aff, 0xffa0, 0x00af, 0xfffa, 0xffff,
+	0xa00a, 0xffff, 0x00af, 0xfffa, 0x0aff, 0xffa0, 0xffff, 0x00af, 0xfffa, 0xa00a, 0xffff, 0xffff,
+	0x00af, 0x0fff, 0xffa0, 0x0fff,
 };
 
+// Nozzle2_21h.bmp, 8 bits per pixel, 19 colours
 extern const uint16_t IconNozzle2_21h[] =
 {	19, 21,		// width, height
-	0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xdc87, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xfed2, 0xb320, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000,
-	0xffff, 0xdc87, 0x01d2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xfdac, 0x3800, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0xffff,
-	0x0000, 0xdfff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdc87, 0x0000,
-	0x01d2, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdc87, 0x0000, 0x01d2, 0xdfff,
-	0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xfffb, 0xb320, 0x0000, 0x0336, 0xdfff, 0xffff, 0x0000,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xb320, 0xfff6,
-	0xfffb, 0xfff6, 0xfdac, 0x91c0, 0x0000, 0x3c9b, 0xffff, 0xffff, 0xffff, 0x0000, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0xffff, 0x65bf, 0x0000, 0x6000, 0x91c0,
-	0x6000, 0x0000, 0x000c, 0x65bf, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0xffff, 0xffff, 0x3c9b, 0x01d2, 0x000c, 0x01d2,
-	0x3c9b, 0xb7ff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xffff, 0xffff, 0xffff,
-	0xc618, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xdfff, 0xb7ff, 0xdfff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3c9b, 0xffff, 0xffff, 0xc618, 0x0000,
-	0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0xc618,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff,
-	0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff
+	0x1208,		// format
+	0x0000, 0x000c, 0x01d2, 0x0336, 0x3800, 0x3c9b, 0x6000, 0x65bf,	// palette
+	0x91c0, 0xb320, 0xb7ff, 0xc618, 0xdc87, 0xdfff, 0xfdac, 0xfed2,
+	0xfff6, 0xfffb, 0xffff,
+	0x0000, 0x1212, 0x1212, 0x1212, 0x1212, 0x1212, 0x1212, 0x1212, 0x0012, 0x0000, 0x1200, 0x1212,
+	0x1212, 0x000c, 0x0000, 0x0700, 0x1212, 0x1212, 0x0000, 0x0000, 0x1212, 0x1212, 0x020c, 0x120d,
+	0x0912, 0x0500, 0x1212, 0x0012, 0x0000, 0x1200, 0x1212, 0x1212, 0x1212, 0x1212, 0x0610, 0x0d02,
+	0x1212, 0x0000, 0x0000, 0x1212, 0x1212, 0x1212, 0x1212, 0x1112, 0x0108, 0x120a, 0x0012, 0x0000,
+	0x1200, 0x1212, 0x1212, 0x1212, 0x1212, 0x0610, 0x0d02, 0x1212, 0x0000, 0x0000, 0x1212, 0x1212,
+	0x1212, 0x1212, 0x0e12, 0x0500, 0x1212, 0x0012, 0x0000, 0x1200, 0x1212, 0x1212, 0x1212, 0x1112,
+	0x0108, 0x120a, 0x1212, 0x0000, 0x0000, 0x1212, 0x1212, 0x1212, 0x1212, 0x0009, 0x1207, 0x1212,
+	0x0012, 0x0000, 0x1200, 0x1212, 0x1212, 0x1212, 0x000c, 0x1205, 0x1212, 0x1212, 0x0000, 0x0000,
+	0x1212, 0x1212, 0x1212, 0x000c, 0x1203, 0x1212, 0x1212, 0x0012, 0x0000, 0x1200, 0x1212, 0x1212,
+	0x000e, 0x0d02, 0x1212, 0x1212, 0x1212, 0x0000, 0x0000, 0x1212, 0x1212, 0x040f, 0x0d02, 0x1212,
+	0x1212, 0x1212, 0x0012, 0x0000, 0x1200, 0x1212, 0x0912, 0x0000, 0x0000, 0x0000, 0x0500, 0x1212,
+	0x0000, 0x0000, 0x120b, 0x1212, 0x1212, 0x1212, 0x1212, 0x1212, 0x1212, 0x000b, 0x0b00, 0x0000,
+	0x120b, 0x1212, 0x1212, 0x1212, 0x1212, 0x1212, 0x000b, 0x0b00, 0x0b12, 0x0000, 0x120b, 0x1212,
+	0x1212, 0x1212, 0x1212, 0x000b, 0x0b00, 0x1212, 0x0b12, 0x0000, 0x120b, 0x1212, 0x1212, 0x1212,
+	0x000b, 0x0b00, 0x1212, 0x1212, 0x0b12, 0x0000, 0x120b, 0x1212, 0x1212, 0x000b, 0x0b00, 0x1212,
+	0x1212, 0x1212, 0x0b12, 0x0000, 0x120b, 0x1212, 0x000b, 0x0b00, 0x1212, 0x1212, 0x1212, 0x1212,
+	0x0b12, 0x0000, 0x1212, 0x0012, 0x0b00, 0x1212, 0x1212, 0x0012,
 };
 
+// Nozzle3_21h.bmp, 8 bits per pixel, 20 colours
 extern const uint16_t IconNozzle3_21h[] =
 {	19, 21,		// width, height
-	0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xfff6, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xffff, 0xdc87, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0x6000, 0xfed2, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xb320, 0x01d2, 0xffff, 0xffff, 0xffff, 0xffff, 0xdc87, 0xffff, 0xffff,
-	0xffff, 0xffff, 0x3c9b, 0x3800, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000,
-	0xffff, 0x0000, 0xdfff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0xffff,
-	0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xfff6, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xdc87,
-	0xfffb, 0xfffb, 0xfff6, 0x6000, 0x0007, 0xfdac, 0xffff, 0xffff, 0xffff, 0xfed2, 0x0000,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3c9b, 0x0000, 0x91c0,
-	0x91c0, 0x6000, 0x0007, 0x96df, 0x0000, 0xfdac, 0xfed2, 0xfdac, 0x3800, 0x3c9b, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0xffff, 0xffff, 0x3c9b, 0x000c, 0x000c,
-	0x01d2, 0x96df, 0xffff, 0x01d2, 0x0000, 0x3800, 0x0000, 0x01d2, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xb7ff, 0xb7ff, 0xdfff,
-	0xffff, 0xffff, 0xdfff, 0x3c9b, 0x0336, 0x3c9b, 0xdfff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xc618, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000,
-	0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0xc618,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff,
-	0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff
+	0x1308,		// format
+	0x0000, 0x0007, 0x000c, 0x01d2, 0x0336, 0x3800, 0x3c9b, 0x6000,	// palette
+	0x91c0, 0x96df, 0xb320, 0xb7ff, 0xc618, 0xdc87, 0xdfff, 0xfdac,
+	0xfed2, 0xfff6, 0xfffb, 0xffff,
+	0x0000, 0x1313, 0x1313, 0x1313, 0x1313, 0x1313, 0x1313, 0x1313, 0x0013, 0x0000, 0x1300, 0x1313,
+	0x0a13, 0x0000, 0x0000, 0x1306, 0x1313, 0x1313, 0x0000, 0x0000, 0x1313, 0x0d13, 0x0e03, 0x1313,
+	0x000d, 0x1306, 0x1313, 0x0013, 0x0000, 0x1300, 0x1313, 0x1313, 0x1313, 0x1213, 0x0208, 0x130b,
+	0x1313, 0x0000, 0x0000, 0x1313, 0x1313, 0x1313, 0x1313, 0x0812, 0x0b02, 0x1313, 0x0013, 0x0000,
+	0x1300, 0x1313, 0x1313, 0x1313, 0x1113, 0x0307, 0x130e, 0x1313, 0x0000, 0x0000, 0x1313, 0x1313,
+	0x1313, 0x1113, 0x0107, 0x1309, 0x1313, 0x0013, 0x0000, 0x1300, 0x1313, 0x0d13, 0x0000, 0x0100,
+	0x1309, 0x1313, 0x1313, 0x0000, 0x0000, 0x1313, 0x1313, 0x1313, 0x1313, 0x000f, 0x0e03, 0x1313,
+	0x0013, 0x0000, 0x1300, 0x1313, 0x1313, 0x1313, 0x1313, 0x000f, 0x1306, 0x1313, 0x0000, 0x0000,
+	0x1313, 0x1313, 0x1313, 0x1313, 0x1013, 0x0405, 0x1313, 0x0013, 0x0000, 0x1300, 0x1313, 0x1313,
+	0x1313, 0x1313, 0x000f, 0x1306, 0x1313, 0x0000, 0x0000, 0x1313, 0x0711, 0x1306, 0x1313, 0x0510,
+	0x0e03, 0x1313, 0x0013, 0x0000, 0x1300, 0x1313, 0x0510, 0x0000, 0x0000, 0x1306, 0x1313, 0x1313,
+	0x0000, 0x0000, 0x130c, 0x1313, 0x1313, 0x1313, 0x1313, 0x1313, 0x1313, 0x000c, 0x0c00, 0x0000,
+	0x130c, 0x1313, 0x1313, 0x1313, 0x1313, 0x1313, 0x000c, 0x0c00, 0x0c13, 0x0000, 0x130c, 0x1313,
+	0x1313, 0x1313, 0x1313, 0x000c, 0x0c00, 0x1313, 0x0c13, 0x0000, 0x130c, 0x1313, 0x1313, 0x1313,
+	0x000c, 0x0c00, 0x1313, 0x1313, 0x0c13, 0x0000, 0x130c, 0x1313, 0x1313, 0x000c, 0x0c00, 0x1313,
+	0x1313, 0x1313, 0x0c13, 0x0000, 0x130c, 0x1313, 0x000c, 0x0c00, 0x1313, 0x1313, 0x1313, 0x1313,
+	0x0c13, 0x0000, 0x1313, 0x0013, 0x0c00, 0x1313, 0x1313, 0x0013,
 };
 
+// Nozzle4_21h.bmp, 8 bits per pixel, 21 colours
 extern const uint16_t IconNozzle4_21h[] =
 {	19, 21,		// width, height
-	0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xfff6, 0xfdac, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffb, 0xdc87,
-	0x6000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfdac, 0x91c0, 0x0007, 0x0336,
-	0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xfed2, 0xb320, 0x0000, 0x01d2, 0x96df, 0xffff, 0x0000,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0xffff,
-	0xffff, 0xfff6, 0xdc87, 0x3800, 0x01d2, 0x65bf, 0xdfff, 0xffff, 0xffff, 0x0000, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfdac,
-	0x6000, 0x000c, 0x3c9b, 0xdfff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000,
-	0xb5ac, 0xfdac, 0xfdac, 0xfdac, 0xfdac, 0xfdac, 0xfdac, 0x0000, 0xfdac, 0xfdac, 0xfdac,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0xffff, 0x65bf, 0x65bf, 0x65bf, 0x65bf,
-	0x65bf, 0x65bf, 0x65bf, 0x65bf, 0x65bf, 0x0000, 0x65bf, 0x65bf, 0x65bf, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xc618, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0x65bf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000,
-	0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0xc618,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff,
-	0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff
+	0x1408,		// format
+	0x0000, 0x0007, 0x000c, 0x01d2, 0x0336, 0x3800, 0x3c9b, 0x6000,	// palette
+	0x65bf, 0x91c0, 0x96df, 0xb320, 0xb5ac, 0xc618, 0xdc87, 0xdfff,
+	0xfdac, 0xfed2, 0xfff6, 0xfffb, 0xffff,
+	0x0000, 0x1414, 0x1414, 0x1414, 0x1414, 0x1414, 0x1414, 0x1414, 0x0014, 0x0000, 0x1400, 0x1414,
+	0x1414, 0x1414, 0x0010, 0x0800, 0x1414, 0x1414, 0x0000, 0x0000, 0x1414, 0x1414, 0x1414, 0x0712,
+	0x0000, 0x1408, 0x1414, 0x0014, 0x0000, 0x1400, 0x1414, 0x1414, 0x0e14, 0x0c02, 0x0800, 0x1414,
+	0x1414, 0x0000, 0x0000, 0x1414, 0x1414, 0x1114, 0x0605, 0x0010, 0x1408, 0x1414, 0x0014, 0x0000,
+	0x1400, 0x1414, 0x1414, 0x030b, 0x100f, 0x0800, 0x1414, 0x1414, 0x0000, 0x0000, 0x1414, 0x1414,
+	0x0010, 0x1408, 0x0010, 0x1408, 0x1414, 0x0014, 0x0000, 0x1400, 0x1414, 0x0913, 0x0f03, 0x1014,
+	0x0800, 0x1414, 0x1414, 0x0000, 0x0000, 0x1414, 0x0e14, 0x0a01, 0x1414, 0x0010, 0x1408, 0x1414,
+	0x0014, 0x0000, 0x1400, 0x1214, 0x0407, 0x1414, 0x1014, 0x0800, 0x1414, 0x1414, 0x0000, 0x0000,
+	0x1414, 0x0010, 0x0000, 0x0000, 0x0000, 0x0000, 0x1408, 0x0014, 0x0000, 0x1400, 0x1414, 0x1414,
+	0x1414, 0x1014, 0x0800, 0x1414, 0x1414, 0x0000, 0x0000, 0x1414, 0x1414, 0x1414, 0x1414, 0x0010,
+	0x1408, 0x1414, 0x0014, 0x0000, 0x1400, 0x1414, 0x1414, 0x1414, 0x1014, 0x0800, 0x1414, 0x1414,
+	0x0000, 0x0000, 0x140d, 0x1414, 0x1414, 0x1414, 0x1414, 0x1414, 0x1414, 0x000d, 0x0d00, 0x0000,
+	0x140d, 0x1414, 0x1414, 0x1414, 0x1414, 0x1414, 0x000d, 0x0d00, 0x0d14, 0x0000, 0x140d, 0x1414,
+	0x1414, 0x1414, 0x1414, 0x000d, 0x0d00, 0x1414, 0x0d14, 0x0000, 0x140d, 0x1414, 0x1414, 0x1414,
+	0x000d, 0x0d00, 0x1414, 0x1414, 0x0d14, 0x0000, 0x140d, 0x1414, 0x1414, 0x000d, 0x0d00, 0x1414,
+	0x1414, 0x1414, 0x0d14, 0x0000, 0x140d, 0x1414, 0x000d, 0x0d00, 0x1414, 0x1414, 0x1414, 0x1414,
+	0x0d14, 0x0000, 0x1414, 0x0014, 0x0d00, 0x1414, 0x1414, 0x0014,
 };
 
+// Bed_21h.bmp, 2 bits per pixel, 3 colours
 extern const uint16_t IconBed_21h[] =
 {	20, 21,		// width, height
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xc618, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0x0000, 0x0000, 0x0000, 0xc618, 0x0000, 0xc618, 0xc618, 0x0000, 0xc618, 0xffff, 0xffff,
-	0xc618, 0x0000, 0xc618, 0xc618, 0x0000, 0xc618, 0xffff, 0xffff, 0xc618, 0xffff, 0x0000,
-	0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xc618, 0x0000, 0xc618, 0xc618, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xc618, 0x0000, 0xc618, 0xc618, 0x0000, 0xffff, 0x0000, 0x0000,
-	0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0xc618, 0xffff, 0x0000, 0x0000, 0x0000,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xc618,
-	0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0xc618,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xc618, 0x0000, 0xc618,
-	0xc618, 0x0000, 0xc618, 0xffff, 0xffff, 0xc618, 0x0000, 0xc618, 0xc618, 0x0000, 0xc618,
-	0xffff, 0xffff, 0xc618, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff,
-	0xc618, 0x0000, 0xc618, 0xc618, 0x0000, 0xc618, 0xffff, 0xffff, 0xc618, 0x0000, 0xc618,
-	0xc618, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000,
-	0xc618, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0x0000, 0x0000, 0x0000, 0xffff, 0xc618, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xc618, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000,
-	0x0000, 0x0000, 0xc618, 0x0000, 0xc618, 0xc618, 0x0000, 0xc618, 0xffff, 0xffff, 0xc618,
-	0x0000, 0xc618, 0xc618, 0x0000, 0xc618, 0xffff, 0xffff, 0xc618, 0xffff, 0x0000, 0x0000,
-	0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xc618, 0x0000, 0xc618, 0xc618, 0x0000, 0xc618,
-	0xffff, 0xffff, 0xc618, 0x0000, 0xc618, 0xc618, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0xc618, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000
+	0x0202,		// format
+	0x0000, 0xc618, 0xffff,	// palette
+	0xa86a, 0x6a86, 0x1aa8, 0x91a9, 0xa91a, 0xaa4a, 0x4aa4, 0x4aaa, 0xa4aa, 0xaa4a, 0xa91a, 0x1a91,
+	0x6aa9, 0x86a8, 0xa86a, 0xa1aa, 0xaa1a, 0xaaa1, 0x1aa1, 0xa1aa, 0xa86a, 0x6a86, 0x1aa8, 0x91a9,
+	0xa91a, 0xaa4a, 0x4aa4, 0x4aaa, 0xa4aa, 0xaa4a, 0xa91a, 0x1a91, 0x6aa9, 0x46a4, 0xa46a, 0xa1aa,
+	0xaa1a, 0xaaa1, 0x1aa1, 0xa1aa, 0xa46a, 0x6a46, 0xaaa4, 0xaaaa, 0xaaaa, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
 };
 
-extern const uint16_t IconBackspace_21h[] = 
+// Backspace_21h.bmp, run-length encoded
+extern const uint16_t IconBackspace_21h[] =
 {	28, 18,		// width, height
-	0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xf79e, 0x4208, 0x4208, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x0861,
-	0x0000, 0x0000, 0x0861, 0xad75, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xef7d, 0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x52aa, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad55, 0x1082,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xad55, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xf79e, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x528a, 0xf79e, 0xffff, 0xad75, 0x0861,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0861, 0xad75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x10a2, 0x7bcf, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x10a2, 0x7bcf, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0xce79,
-	0xffff, 0xb596, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb596, 0xffff, 0xce79,
-	0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0xce79, 0xffff, 0xffff, 0xad75, 0x0000,
-	0x0000, 0x0000, 0x0000, 0xad75, 0xffff, 0xffff, 0xce79, 0x0020, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0xb5b6, 0xffff, 0xffff, 0xb596, 0x0000, 0x0000, 0xb596, 0xffff,
-	0xffff, 0xb5b6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0xb5b6, 0xffff, 0xffff, 0x9cf3, 0x9cf3, 0xffff, 0xffff, 0xb5b6, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad75, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xad75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0xf79e, 0xffff, 0xffff, 0xf79e, 0x18e3, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0xa534, 0xffff, 0xffff, 0xffff, 0xffff, 0xa534, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb596, 0xffff, 0xffff, 0xa534, 0xa534,
-	0xffff, 0xffff, 0xb596, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0xad75, 0xffff, 0xffff, 0xbdd7, 0x0000, 0x0000, 0xbdd7, 0xffff, 0xffff, 0xad75,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc638, 0xffff, 0xffff, 0xb5b6,
-	0x0000, 0x0000, 0x0000, 0x0000, 0xb5b6, 0xffff, 0xffff, 0xc638, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0xbdd7, 0xffff, 0xbdd7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0xbdd7, 0xffff, 0xbdd7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861,
-	0x73ae, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x73ae, 0x0861,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0xc618
+	0x0000,		// format
+	0x0005, 0x8001, 0xad75, 0x8015, 0x0000, 0x8001, 0xc618,
+	0x0004, 0x4002, 0xf79e, 0x0861, 0x8016, 0x0000,
+	0x0004, 0x8001, 0x528a, 0x8006, 0x0000, 0x8002, 0x0020, 0x800f, 0x0000,
+	0x0003, 0x8001, 0xad55, 0x8006, 0x0000, 0x4003, 0x10a2, 0xce79, 0xce79, 0x8007, 0x0000, 0x4003, 0xc638, 0xbdd7, 0x0861, 0x8005, 0x0000,
+	0x0002, 0x4002, 0xef7d, 0x1082, 0x8006, 0x0000, 0x8001, 0x7bcf, 0x0002, 0x8001, 0xb5b6, 0x8005, 0x0000, 0x8001, 0xad75, 0x0002, 0x8001, 0x73ae, 0x8005, 0x0000,
+	0x0002, 0x8001, 0x52aa, 0x8007, 0x0000, 0x4002, 0x10a2, 0xb596, 0x0002, 0x4005, 0xb5b6, 0x0000, 0x0000, 0x0000, 0xb596, 0x0002, 0x4002, 0xbdd7, 0x18c3, 0x8005, 0x0000,
+	0x0001, 0x8001, 0xad75, 0x800a, 0x0000, 0x8001, 0xad75, 0x0002, 0x4003, 0xad75, 0x18e3, 0xa534, 0x0002, 0x8001, 0xb5b6, 0x8007, 0x0000,
+	0x4002, 0xf79e, 0x0861, 0x800b, 0x0000, 0x8001, 0xb596, 0x0002, 0x8001, 0xf79e, 0x0002, 0x8001, 0xbdd7, 0x8008, 0x0000,
+	0x8001, 0x4208, 0x800d, 0x0000, 0x8001, 0x9cf3, 0x0003, 0x8001, 0xa534, 0x8009, 0x0000,
+	0x8001, 0x4208, 0x800d, 0x0000, 0x8001, 0x9cf3, 0x0003, 0x8001, 0xa534, 0x8009, 0x0000,
+	0x4002, 0xf79e, 0x0861, 0x800b, 0x0000, 0x8001, 0xb596, 0x0002, 0x8001, 0xf79e, 0x0002, 0x8001, 0xbdd7, 0x8008, 0x0000,
+	0x0001, 0x8001, 0xad75, 0x800a, 0x0000, 0x8001, 0xad75, 0x0002, 0x4003, 0xad75, 0x18e3, 0xa534, 0x0002, 0x8001, 0xb5b6, 0x8007, 0x0000,
+	0x0002, 0x8001, 0x52aa, 0x8007, 0x0000, 0x4002, 0x10a2, 0xb596, 0x0002, 0x4005, 0xb5b6, 0x0000, 0x0000, 0x0000, 0xb596, 0x0002, 0x4002, 0xbdd7, 0x18c3, 0x8005, 0x0000,
+	0x0002, 0x4002, 0xef7d, 0x1082, 0x8006, 0x0000, 0x8001, 0x7bcf, 0x0002, 0x8001, 0xb5b6, 0x8005, 0x0000, 0x8001, 0xad75, 0x0002, 0x8001, 0x73ae, 0x8005, 0x0000,
+	0x0003, 0x8001, 0xad55, 0x8006, 0x0000, 0x4003, 0x10a2, 0xce79, 0xce79, 0x8007, 0x0000, 0x4003, 0xc638, 0xbdd7, 0x0861, 0x8005, 0x0000,
+	0x0004, 0x8001, 0x528a, 0x8006, 0x0000, 0x8002, 0x0020, 0x800f, 0x0000,
+	0x0004, 0x4002, 0xf79e, 0x0861, 0x8016, 0x0000,
+	0x0005, 0x8001, 0xad75, 0x8015, 0x0000, 0x8001, 0xc618,
 };
 
-extern const uint16_t IconUp_21h[] = 
+// UpArrow_21h.bmp, 2 bits per pixel, 3 colours
+extern const uint16_t IconUp_21h[] =
 {	17, 21,		// width, height
-	0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0xc618, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000,
-	0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0x0000,
-	0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xc618,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xc618,
-	0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618,
-	0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618,
-	0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618,
-	0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618,
-	0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618,
-	0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618,
-	0xc618, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff
+	0x0202,		// format
+	0x0000, 0xc618, 0xffff,	// palette
+	0xaaaa, 0xaaaa, 0xaaaa, 0xaa91, 0xaaaa, 0xa901, 0xaaaa, 0x9001, 0xaaaa, 0x0001, 0xaaa9, 0x0002,
+	0xaa90, 0x0001, 0xa900, 0x0401, 0x9004, 0x2401, 0x0060, 0xa405, 0x0680, 0xa414, 0x6a02, 0xaa90,
+	0xa80a, 0xaaaa, 0xa02a, 0xaaaa, 0x80aa, 0xaaaa, 0x02aa, 0xaaaa, 0x0aaa, 0xaaa8, 0x2aaa, 0xaaa0,
+	0xaaaa, 0xaa80, 0xaaaa, 0xaa02, 0xaaaa, 0xa80a, 0xaaaa, 0xa02a, 0x02aa,
 };
 
-extern const uint16_t IconDown_21h[] = 
+// DownArrow_21h.bmp, 2 bits per pixel, 3 colours
+extern const uint16_t IconDown_21h[] =
 {	17, 21,		// width, height
-	0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0xc618, 0xc618, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618,
-	0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000,
-	0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000,
-	0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xc618, 0xc618, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff
+	0x0202,		// format
+	0x0000, 0xc618, 0xffff,	// palette
+	0x2aaa, 0xaaa0, 0xaaaa, 0xaa80, 0xaaaa, 0xaa02, 0xaaaa, 0xa80a, 0xaaaa, 0xa02a, 0xaaaa, 0x80aa,
+	0xaaaa, 0x02aa, 0xaaaa, 0x0aaa, 0xaaa8, 0x2aaa, 0xaaa0, 0xaaaa, 0xaa80, 0xa41a, 0x6a02, 0x4050,
+	0x680a, 0x0140, 0x6024, 0x1900, 0x4040, 0xa900, 0x0001, 0xa900, 0x001a, 0xaa00, 0x01aa, 0xa900,
+	0x1aaa, 0xa900, 0xaaaa, 0xa901, 0xaaaa, 0xa91a, 0xaaaa, 0xaaaa, 0x02aa,
 };
 
-extern const uint16_t IconEnter_21h[] = 
+// Enter_21h.bmp, 2 bits per pixel, 3 colours
+extern const uint16_t IconEnter_21h[] =
 {	30, 21,		// width, height
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0xc618, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618,
-	0x0000, 0x0000, 0x0000, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0x0000,
-	0x0000, 0x0000, 0xffff, 0xc618, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000,
-	0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000,
-	0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000,
-	0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff
+	0x0202,		// format
+	0x0000, 0xc618, 0xffff,	// palette
+	0xaaaa, 0xaaaa, 0xaaaa, 0xaaaa, 0xaaaa, 0xaaaa, 0xaaaa, 0xaa02, 0xaaaa, 0xaaaa, 0x2aaa, 0xaaa0,
+	0xaaaa, 0xaaaa, 0x02aa, 0xaaaa, 0xaaaa, 0xaaaa, 0xa02a, 0xa5aa, 0xaaaa, 0xaaaa, 0xaa02, 0xaa06,
+	0xaaaa, 0x2aaa, 0x1aa0, 0xaaa0, 0xaaaa, 0x02aa, 0x006a, 0xaaaa, 0xaaaa, 0xa02a, 0xa401, 0xaaaa,
+	0xaaaa, 0x0602, 0xaa90, 0xaaaa, 0x2aaa, 0x0010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1000, 0x0000, 0x0000, 0x0000, 0x0600, 0xaa90, 0xaaaa, 0xaaaa, 0x01aa, 0xaaa4, 0xaaaa, 0xaaaa,
+	0x006a, 0xaaaa, 0xaaaa, 0xaaaa, 0xa01a, 0xaaaa, 0xaaaa, 0xaaaa, 0xaa06, 0xaaaa, 0xaaaa, 0xaaaa,
+	0xaaa5, 0xaaaa, 0xaaaa, 0xaaaa, 0xaaaa, 0xaaaa, 0x0aaa,
 };
 
+// OK_21h.bmp, run-length encoded
 extern const uint16_t IconOk_21h[] =
 {	18, 21,		// width, height
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdea7, 0xb640, 0xfffb, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0560, 0x0560, 0x95e0, 0xfffb, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0560, 0x0560, 0x0560, 0x95e0, 0xfff6, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0x0656, 0x0560, 0x0560, 0x0560, 0x6560, 0xff2c, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0x0656, 0x0560, 0x0560, 0x0560, 0x0560, 0xb640, 0xfff6,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0x673f, 0x0567, 0x0560, 0x0560, 0x0560, 0x6560, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0x979b, 0x0560, 0x0560, 0x0560, 0x0560, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xff92, 0xdea7, 0x95e0, 0x0560, 0x0560, 0x0560, 0x0560, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffb, 0xff92, 0xb640,
-	0x3d60, 0x0560, 0x0560, 0x0560, 0x0560, 0x056c, 0x0656, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffb, 0xff2c, 0x95e0, 0x3d60, 0x0560, 0x0560,
-	0x0560, 0x0567, 0x05f2, 0x673f, 0xb7ff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xff92, 0x95e0, 0x0560, 0x0560, 0x0560, 0x0560, 0x0567, 0x0656,
-	0x979f, 0xdfff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xfff6, 0xb640, 0x3d60, 0x0560, 0x0560, 0x0560, 0x0567, 0x0656, 0x979f, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffb, 0xdea7, 0x6560,
-	0x0560, 0x0560, 0x0560, 0x0567, 0x0656, 0x979f, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xff92, 0x95e0, 0x0560, 0x0560, 0x0560,
-	0x0560, 0x05f2, 0x979f, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3d60, 0x0560, 0x0560, 0x0560, 0x056c, 0x673f,
-	0xdfff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0x0560, 0x0560, 0x0560, 0x0656, 0xb7ff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0x0560, 0x056c, 0x673f, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0x0656, 0xb7ff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff
+	0x0000,		// format
+	0x0012,
+	0x0012,
+	0x000d, 0x4005, 0xff92, 0x3d60, 0x0560, 0x0560, 0x0656,
+	0x000c, 0x4006, 0xfffb, 0x95e0, 0x0560, 0x0560, 0x056c, 0xb7ff,
+	0x000c, 0x4005, 0xdea7, 0x0560, 0x0560, 0x0560, 0x673f, 0x0001,
+	0x000b, 0x4005, 0xfff6, 0x6560, 0x0560, 0x0560, 0x0656, 0x0002,
+	0x000b, 0x4005, 0xb640, 0x0560, 0x0560, 0x056c, 0xb7ff, 0x0002,
+	0x000a, 0x4005, 0xff92, 0x3d60, 0x0560, 0x0560, 0x673f, 0x0003,
+	0x0009, 0x4006, 0xfffb, 0x95e0, 0x0560, 0x0560, 0x05f2, 0xdfff, 0x0003,
+	0x0009, 0x4005, 0xff2c, 0x0560, 0x0560, 0x0567, 0x979f, 0x0004,
+	0x0008, 0x4005, 0xfffb, 0x95e0, 0x0560, 0x0560, 0x0656, 0x0005,
+	0x0008, 0x4005, 0xff92, 0x3d60, 0x0560, 0x0567, 0x979f, 0x0005,
+	0x4004, 0xdea7, 0x0560, 0x0560, 0x0656, 0x0004, 0x4004, 0xb640, 0x0560, 0x0560, 0x0656, 0x0006,
+	0x4005, 0xb640, 0x0560, 0x0560, 0x0560, 0x0656, 0x0002, 0x4005, 0xff92, 0x3d60, 0x0560, 0x0567, 0x979f, 0x0006,
+	0x4006, 0xfffb, 0x95e0, 0x0560, 0x0560, 0x0560, 0x673f, 0x0001, 0x4004, 0xdea7, 0x0560, 0x0560, 0x0656, 0x0007,
+	0x0001, 0x400a, 0xfffb, 0x95e0, 0x0560, 0x0560, 0x0567, 0x979b, 0x95e0, 0x0560, 0x0567, 0x979f, 0x0007,
+	0x0002, 0x4002, 0xfff6, 0x6560, 0x8005, 0x0560, 0x4002, 0x05f2, 0xdfff, 0x0007,
+	0x0003, 0x8001, 0xff2c, 0x8005, 0x0560, 0x8001, 0x673f, 0x0008,
+	0x0004, 0x4006, 0xb640, 0x0560, 0x0560, 0x0560, 0x056c, 0xb7ff, 0x0008,
+	0x0004, 0x4005, 0xfff6, 0x6560, 0x0560, 0x0560, 0x0656, 0x0009,
+	0x0012,
 };
 
+// Cancel_21h.bmp, 8 bits per pixel, 18 colours
 extern const uint16_t IconCancel_21h[] =
 {	20, 21,		// width, height
-	0xffff, 0xfef3, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xfff7, 0xf244, 0xffff, 0xffff, 0xf0e4, 0xfdce, 0xfffb, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xfdce, 0xf0e4, 0xe8e4, 0xffff, 0xffff, 0xe8e4, 0xe8e4, 0xf244, 0xfef3, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfff7, 0xfb84, 0xe8e4,
-	0xe8e4, 0xe8e4, 0xffff, 0xffff, 0xe8e4, 0xe8e4, 0xe8e4, 0xf0e4, 0xfcca, 0xfffb, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfdce, 0xf0e4, 0xe8e4, 0xe8e4, 0xe8e4,
-	0xe8e4, 0xffff, 0xffff, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xf244, 0xfef3, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xfff7, 0xfb84, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4,
-	0xffff, 0xffff, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xf0e4, 0xfcca, 0xfffb,
-	0xfffb, 0xfcca, 0xf0e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xffff,
-	0xffff, 0xe8ea, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xf244, 0xf244,
-	0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xea53, 0xffff, 0xffff,
-	0xf6ff, 0xea53, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4,
-	0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8ee, 0xf5df, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xf5df, 0xe8ee, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4,
-	0xe8e4, 0xe8e4, 0xe8ea, 0xf4db, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xf4db, 0xe8ee, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4,
-	0xea53, 0xf6ff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xfff7, 0xf4ca, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xfcca,
-	0xfff7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfff7, 0xfcca,
-	0xf0e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xf0e4,
-	0xfdce, 0xfffb, 0xffff, 0xffff, 0xffff, 0xffff, 0xfff7, 0xfcca, 0xf0e4, 0xe8e4, 0xe8e4,
-	0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4,
-	0xf244, 0xfef3, 0xffff, 0xffff, 0xffff, 0xf0e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4,
-	0xe8e4, 0xe8e4, 0xe8e4, 0xe8ee, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4,
-	0xf0e4, 0xfb84, 0xffff, 0xffff, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4,
-	0xe8ee, 0xf5df, 0xffff, 0xeb97, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4,
-	0xe8e4, 0xffff, 0xffff, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8ea, 0xf4db, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xf5df, 0xe8ee, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4,
-	0xffff, 0xffff, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xea53, 0xf6ff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xeb97, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xe8e4, 0xffff,
-	0xffff, 0xe8e4, 0xe8e4, 0xe8ee, 0xf5df, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xf5df, 0xea53, 0xe8e4, 0xe8e4, 0xe8e4, 0xffff, 0xffff,
-	0xe8e4, 0xeb97, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf4db, 0xe8ea, 0xe8e4, 0xffff, 0xffff, 0xf5df,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf6ff, 0xe8ee, 0xffff
+	0x1108,		// format
+	0xe8e4, 0xe8ea, 0xe8ee, 0xea53, 0xeb97, 0xf0e4, 0xf244, 0xf4ca,	// palette
+	0xf4db, 0xf5df, 0xf6ff, 0xfb84, 0xfcca, 0xfdce, 0xfef3, 0xfff7,
+	0xfffb, 0xffff,
+	0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x050e, 0x0000,
+	0x0000, 0x0a01, 0x1111, 0x1111, 0x050f, 0x0000, 0x0000, 0x0900, 0x0d11, 0x0000, 0x0000, 0x0300,
+	0x1111, 0x1111, 0x000c, 0x0000, 0x0000, 0x1104, 0x1011, 0x0006, 0x0000, 0x0000, 0x1109, 0x0f11,
+	0x0005, 0x0000, 0x0200, 0x1111, 0x1111, 0x050e, 0x0000, 0x0000, 0x1102, 0x0c11, 0x0000, 0x0000,
+	0x0900, 0x1111, 0x1111, 0x0c11, 0x0000, 0x0000, 0x0800, 0x050f, 0x0000, 0x0000, 0x1103, 0x1111,
+	0x1111, 0x1011, 0x0006, 0x0000, 0x0200, 0x0007, 0x0000, 0x0100, 0x110a, 0x1111, 0x1111, 0x1111,
+	0x050e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x1111, 0x1111, 0x1111, 0x1111, 0x0c11, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x1102, 0x1111, 0x1111, 0x1111, 0x1111, 0x1011, 0x0006, 0x0000, 0x0000,
+	0x0000, 0x1109, 0x1111, 0x1111, 0x1111, 0x1111, 0x1011, 0x0006, 0x0000, 0x0000, 0x0200, 0x1111,
+	0x1111, 0x1111, 0x1111, 0x1111, 0x0c11, 0x0000, 0x0000, 0x0000, 0x0000, 0x1104, 0x1111, 0x1111,
+	0x1111, 0x1111, 0x050f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0900, 0x1111, 0x1111, 0x1111, 0x1111,
+	0x000b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0200, 0x1111, 0x1111, 0x1111, 0x0d11, 0x0000, 0x0000,
+	0x0300, 0x000c, 0x0000, 0x0000, 0x1104, 0x1111, 0x1111, 0x050f, 0x0000, 0x0000, 0x0a01, 0x050f,
+	0x0000, 0x0000, 0x0900, 0x1111, 0x1111, 0x000b, 0x0000, 0x0000, 0x1108, 0x0d11, 0x0000, 0x0000,
+	0x0300, 0x1111, 0x0d11, 0x0000, 0x0000, 0x0200, 0x1111, 0x1011, 0x0006, 0x0000, 0x0000, 0x1108,
+	0x050f, 0x0000, 0x0000, 0x0900, 0x1111, 0x1111, 0x050e, 0x0000, 0x0000, 0x0a01, 0x0006, 0x0000,
+	0x0000, 0x1103, 0x1111, 0x1111, 0x0b11, 0x0000, 0x0000, 0x0200, 0x1111, 0x1111, 0x1111, 0x1111,
+	0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111,
 };
 
+// File_21h.bmp, run-length encoded
 extern const uint16_t IconFiles_21h[] =
 {	18, 21,		// width, height
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xc618, 0x7bef, 0x7bcf, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410,
-	0x8410, 0x7bef, 0x8410, 0xc638, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bef, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x2104, 0xc638, 0xffff, 0xffff, 0xffff, 0x7bef, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x10a2, 0xffff, 0xffff, 0x7bef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0xffff, 0x7bef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x7bef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x2102, 0x2102, 0x2102, 0x1081, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0xff91, 0xfeae, 0xfe8d, 0xfeae, 0x51e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0xffb1, 0xff31, 0xfe6f, 0xfe4b, 0x28e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1061,
-	0x1081, 0x1061, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf6ef, 0xff50,
-	0xfed0, 0xfe2c, 0x3121, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xff94, 0xff92, 0xfece,
-	0xfe0c, 0x51e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2943, 0x2963, 0x2942, 0x3142,
-	0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xff51, 0xff70, 0xff2f, 0xfe8d, 0x28e1,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xff71, 0xff50, 0xfeee, 0xfe6c, 0x5a03, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x18c3, 0x2965, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae,
-	0xffdf, 0x73ae, 0x528a, 0x52aa, 0x52aa, 0x52aa, 0x52aa, 0x5acb, 0x5acb, 0x5acb, 0x5acb,
-	0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x52aa, 0x52aa, 0x9cf3, 0xffff
+	0x0000,		// format
+	0x0005, 0x8001, 0x7bef, 0x800a, 0x0000, 0x4002, 0x2965, 0xffdf,
+	0x0004, 0x8001, 0x7bef, 0x800c, 0x0000, 0x8001, 0x73ae,
+	0x0003, 0x400f, 0x7bef, 0x0000, 0x0000, 0x2102, 0xff91, 0xffb1, 0x1061, 0xf6ef, 0xff94, 0x2943, 0xff51, 0xff71, 0x0000, 0x0000, 0x528a,
+	0x0002, 0x4010, 0x7bef, 0x0000, 0x0000, 0x0000, 0x2102, 0xfeae, 0xff31, 0x1081, 0xff50, 0xff92, 0x2963, 0xff70, 0xff50, 0x0000, 0x0000, 0x52aa,
+	0x0001, 0x8001, 0x7bef, 0x8004, 0x0000, 0x400c, 0x2102, 0xfe8d, 0xfe6f, 0x1061, 0xfed0, 0xfece, 0x2942, 0xff2f, 0xfeee, 0x0000, 0x0000, 0x52aa,
+	0x8001, 0xc618, 0x8005, 0x0000, 0x400c, 0x1081, 0xfeae, 0xfe4b, 0x1060, 0xfe2c, 0xfe0c, 0x3142, 0xfe8d, 0xfe6c, 0x0000, 0x0000, 0x52aa,
+	0x8001, 0x7bef, 0x8005, 0x0000, 0x400c, 0x0840, 0x51e3, 0x28e1, 0x0000, 0x3121, 0x51e3, 0x0840, 0x28e1, 0x5a03, 0x0000, 0x0000, 0x52aa,
+	0x8001, 0x7bcf, 0x8010, 0x0000, 0x8001, 0x5acb,
+	0x8001, 0x8410, 0x8010, 0x0000, 0x8001, 0x5acb,
+	0x8001, 0x8410, 0x8010, 0x0000, 0x8001, 0x5acb,
+	0x8001, 0x8410, 0x8010, 0x0000, 0x8001, 0x5acb,
+	0x8001, 0x8410, 0x8010, 0x0000, 0x8001, 0x5acb,
+	0x8001, 0x8410, 0x8010, 0x0000, 0x8001, 0x5acb,
+	0x8001, 0x8410, 0x8010, 0x0000, 0x8001, 0x5acb,
+	0x8001, 0x8410, 0x8010, 0x0000, 0x8001, 0x5acb,
+	0x8001, 0x8410, 0x8010, 0x0000, 0x8001, 0x5acb,
+	0x8001, 0x8410, 0x8010, 0x0000, 0x8001, 0x5acb,
+	0x8001, 0x7bef, 0x8010, 0x0000, 0x8001, 0x52aa,
+	0x8001, 0x8410, 0x8010, 0x0000, 0x8001, 0x52aa,
+	0x4002, 0xc638, 0x2104, 0x800f, 0x0000, 0x8001, 0x9cf3,
+	0x0001, 0x4002, 0xc638, 0x10a2, 0x800c, 0x0000, 0x4002, 0x18c3, 0x73ae, 0x0001,
 };
 
+// Keyboard_21h.bmp, 1 bits per pixel, 2 colours
 extern const uint16_t IconKeyboard_21h[] =
 {	40, 21,		// width, height
-	0x0000, 0x0000, 0x0000, 0x0000,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000,
-	0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000,
-	0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000,
-	0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000,
-	0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000,
-	0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000,
-	0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000,
-	0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff,
-	0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000,
-	0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff,
-	0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000,
-	0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000,
-	0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000,
-	0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000,
-	0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000,
-	0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff,
-	0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000,
-	0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000,
-	0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff,
-	0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff,
-	0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000,
-	0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000,
-	0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff,
-	0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff,
-	0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000,
-	0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000,
-	0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000,
-	0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000,
-	0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff
+	0x0101,		// format
+	0x0000, 0xffff,	// palette
+	0x0c30, 0x30c3, 0x300c, 0xc30c, 0x0c30, 0x0c30, 0x30c3, 0x300c, 0xc30c, 0x0c30, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0x6187, 0x8618, 0x87e1, 0x1861, 0xe186, 0x6187, 0x8618, 0x87e1, 0x1861,
+	0xe186, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x861f, 0x1861, 0x1f86, 0x6186, 0x8618, 0x861f,
+	0x1861, 0x1f86, 0x6186, 0x8618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x01ff, 0x0000, 0xffff,
+	0x0001, 0xff00, 0x01ff, 0x0000, 0x00ff,
 };
 
 // End
@@ -0,0 +1,45 @@
+/*
+ * LruClock.hpp
+ *
+ * Created: 21/10/2026 09:20:14
+ *
+ * Least-recently-used bookkeeping for the small caches. Each entry records when it was last used on a 16-bit clock that advances on every
+ * lookup. Just before the clock would wrap round, it and all the timestamps are moved back by half its range, and timestamps that would go
+ * below zero stay at zero. So a timestamp is never later than the clock, and an entry used within the last 32768 lookups always counts as
+ * newer than one that hasn't been.
+ */
+
+#ifndef LRUCLOCK_H_
+#define LRUCLOCK_H_
+
+#include <cstdint>
+
+class LruClock
+{
+public:
+	LruClock() : now(0) { }
+
+	// Advance the clock for a lookup. Each of the entries must have a uint16_t member lastUsed.
+	template<class T> void Tick(T *entries, unsigned int numEntries)
+	{
+		if (now == UINT16_MAX)
+		{
+			for (unsigned int i = 0; i < numEntries; ++i)
+			{
+				entries[i].lastUsed = (entries[i].lastUsed > HalfRange) ? entries[i].lastUsed - HalfRange : 0;
+			}
+			now -= HalfRange;
+		}
+		++now;
+	}
+
+	uint16_t Now() const { return now; }
+	uint16_t Age(uint16_t lastUsed) const { return now - lastUsed; }
+
+private:
+	static const uint16_t HalfRange = 0x8000;
+
+	uint16_t now;
+};
+
+#endif /* LRUCLOCK_H_ */
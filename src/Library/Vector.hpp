@@ -179,7 +179,7 @@ template<size_t N> int String<N>::sprintf(const char *fmt, ...)
 		this->filled = 0;
 		this->storage[0] = 0;
 	}
-	else if (ret < N)
+	else if ((size_t)ret < N)
 	{
 		this->filled = ret;
 	}
@@ -11,6 +11,7 @@
 #include "Library/Vector.hpp"
 #include "MessageLog.hpp"
 #include "Fields.hpp"
+#include "PanelDue.hpp"
 #include "Hardware/SysTick.hpp"
 #include "Library/Misc.hpp"
 
@@ -42,15 +43,15 @@ namespace MessageLog
 		UpdateMessages(true);
 	}
 	
-	// Update the messages on the message tab. If 'all' is true we do the times and the text, else we just do the times.
-	void UpdateMessages(bool all)
+	// Update the message rows from 'firstRow' to the bottom. If 'all' is true we do the times and the text, else we just do the times.
+	static void UpdateRows(size_t firstRow, bool all)
 	{
-		size_t index = messageStartRow;
-		for (size_t i = 0; i < numMessageRows; ++i)
+		size_t index = (messageStartRow + firstRow) % (numMessageRows + 1);
+		for (size_t i = firstRow; i < numMessageRows; ++i)
 		{
 			Message *m = &messages[index];
 			uint32_t tim = m->receivedTime;
-			char* p = m->receivedTimeText;
+			char p[Message::rttLen];
 			if (tim == 0)
 			{
 				p[0] = 0;
@@ -91,7 +92,13 @@ namespace MessageLog
 					}
 				}
 			}
-			messageTimeFields[i]->SetValue(p);
+
+			// Only redraw the time if it has changed
+			if (all || strcmp(p, m->receivedTimeText) != 0)
+			{
+				strcpy(m->receivedTimeText, p);
+				messageTimeFields[i]->SetValue(m->receivedTimeText);
+			}
 
 			if (all)
 			{
@@ -101,6 +108,38 @@ namespace MessageLog
 		}
 	}
 
+	// Scroll the message rows up by 'numRows' using the display's hardware scrolling, then fill in the rows exposed at the bottom.
+	// The fields move with the rows they were drawn in, so only the fields of the exposed rows need to be redrawn.
+	static void ScrollRows(size_t numRows)
+	{
+		const PixelNumber areaHeight = numMessageRows * rowTextHeight;
+		lcd.setScrollArea(firstMessageRow, areaHeight, (lcd.getScrollOffset() + numRows * rowTextHeight) % areaHeight);
+
+		StaticTextField *oldTimeFields[numMessageRows], *oldTextFields[numMessageRows];
+		for (size_t i = 0; i < numMessageRows; ++i)
+		{
+			oldTimeFields[i] = messageTimeFields[i];
+			oldTextFields[i] = messageTextFields[i];
+		}
+		for (size_t i = 0; i < numMessageRows; ++i)
+		{
+			const size_t source = (i + numRows) % numMessageRows;
+			const PixelNumber row = firstMessageRow + i * rowTextHeight;
+			messageTimeFields[i] = oldTimeFields[source];
+			messageTimeFields[i]->SetYpos(row);
+			messageTextFields[i] = oldTextFields[source];
+			messageTextFields[i]->SetYpos(row);
+		}
+
+		UpdateRows(numMessageRows - numRows, true);
+	}
+
+	// Update the messages on the message tab. If 'all' is true we do the times and the text, else we just do the times.
+	void UpdateMessages(bool all)
+	{
+		UpdateRows(0, all);
+	}
+
 	// Add a message to the end of the list. It will be just off the visible part until we scroll it in.
 	void AppendMessage(const char* data)
 	{
@@ -143,13 +182,22 @@ namespace MessageLog
 		newMessageStartRow = (messageStartRow + numLines) % (numMessageRows + 1);
 	}
 
-	// If there is a new message, scroll it in
+	// If there is a new message, scroll it in.
+	// If the message tab is showing and the display can scroll in hardware, we scroll the rows that are still visible instead of redrawing them.
 	void DisplayNewMessage()
 	{
 		if (newMessageStartRow != messageStartRow)
 		{
+			const size_t numNewRows = (newMessageStartRow + numMessageRows + 1 - messageStartRow) % (numMessageRows + 1);
 			messageStartRow = newMessageStartRow;
-			UpdateMessages(true);
+			if (numNewRows < numMessageRows && currentTab == tabMsg && !mgr.HasPopup() && lcd.canScroll())
+			{
+				ScrollRows(numNewRows);
+			}
+			else
+			{
+				UpdateMessages(true);
+			}
 		}
 	}
 	
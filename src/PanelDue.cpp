@@ -1497,6 +1497,49 @@ void SelfTest()
 	extrusionFactors[1]->SetValue(169);
 }
 
+#if DISPLAY_TIMING_TEST
+
+static void LogTiming(const char *text)
+{
+	MessageLog::BeginNewMessage();
+	MessageLog::AppendMessage(text);
+	MessageLog::DisplayNewMessage();
+}
+
+// Time some drawing with the processor cycle counter and put the results in the message log
+void TimeDisplay()
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;		// enable the DWT unit
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	uint32_t start = DWT->CYCCNT;
+	lcd.fillScr(white);
+	const uint32_t fillCycles = DWT->CYCCNT - start;
+
+	const unsigned int numLines = 10;
+	lcd.setFont(DEFAULT_FONT);
+	lcd.setColor(black);
+	lcd.setBackColor(white);
+	start = DWT->CYCCNT;
+	for (unsigned int i = 0; i < numLines; ++i)
+	{
+		lcd.print("The quick brown fox jumps over the lazy dog", 0, i * lcd.getFontHeight(), DisplayX);
+	}
+	const uint32_t textCycles = DWT->CYCCNT - start;
+
+	// The message log takes one message between BeginNewMessage and DisplayNewMessage, so log each result separately
+	String<50> msg;
+	msg.sprintf("Fill screen: %u cycles", (unsigned int)fillCycles);
+	LogTiming(msg.c_str());
+	msg.sprintf("Print %u lines: %u cycles", numLines, (unsigned int)textCycles);
+	LogTiming(msg.c_str());
+	msg.sprintf("Code in RAM: %u bytes", getRamFunctionSize());
+	LogTiming(msg.c_str());
+}
+
+#endif
+
 void SendRequest(const char *s, bool includeSeq = false)
 {
 	SerialIo::SendString(s);
@@ -1558,6 +1601,9 @@ int main(void)
 	volumeButton->SetValue(nvData.touchVolume);
 	
 	MessageLog::Init();
+#if DISPLAY_TIMING_TEST
+	TimeDisplay();
+#endif
 
 	UpdatePrintingFields();
 